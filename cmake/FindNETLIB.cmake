@@ -36,6 +36,28 @@ list(APPEND NETLIB_LINK ${NETLIB_BLAS_LIBRARY})
 
 find_package_handle_standard_args(NETLIB REQUIRED_VARS NETLIB_INCLUDE NETLIB_LINK)
 
+# A CBLAS library with 64-bit integers (ILP64) declares them in cblas.h, from which the integer
+# type of the dimensions is read
+include(CheckCXXSourceCompiles)
+set(CMAKE_REQUIRED_INCLUDES ${NETLIB_INCLUDE})
+set(CMAKE_REQUIRED_QUIET ON)
+check_cxx_source_compiles("
+#include <cstdint>
+#include \"cblas.h\"
+template <typename L, typename TA, typename TB, typename I, typename... R>
+I dimension_type(void (*)(L, TA, TB, I, R...));
+static_assert(sizeof(decltype(dimension_type(&cblas_dgemm))) == sizeof(std::int64_t), \"\");
+int main() { return 0; }" NETLIB_ILP64)
+unset(CMAKE_REQUIRED_INCLUDES)
+unset(CMAKE_REQUIRED_QUIET)
+if(NETLIB_ILP64)
+  message(STATUS "Netlib backend uses the 64-bit integers of the CBLAS library")
+elseif(ENABLE_NETLIB_ILP64)
+  message(FATAL_ERROR "ENABLE_NETLIB_ILP64 is set but the CBLAS library found in ${NETLIB_INCLUDE} has 32-bit integers")
+else()
+  message(STATUS "Netlib backend uses the 32-bit integers of the CBLAS library")
+endif()
+
 add_library(ONEMATH::NETLIB::NETLIB UNKNOWN IMPORTED)
 set_target_properties(ONEMATH::NETLIB::NETLIB PROPERTIES IMPORTED_LOCATION ${NETLIB_CBLAS_LIBRARY})
 
@@ -28,4 +28,10 @@
 #include "oneapi/math/rng.hpp"
 #include "oneapi/math/sparse_blas.hpp"
 
+#include "oneapi/math/async_errors.hpp"
+#include "oneapi/math/backend_priority.hpp"
+#include "oneapi/math/cpu_execution_policy.hpp"
+#include "oneapi/math/preload.hpp"
+#include "oneapi/math/trace.hpp"
+
 #endif //_ONEMATH_HPP_
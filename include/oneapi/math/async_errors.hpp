@@ -0,0 +1,69 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMATH_ASYNC_ERRORS_HPP_
+#define _ONEMATH_ASYNC_ERRORS_HPP_
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include <cstddef>
+#include <exception>
+#include <string>
+#include <vector>
+
+#include "oneapi/math/detail/export.hpp"
+
+// Errors raised by backends that run their work in host tasks (the CPU backends) reach the
+// application only through queue::wait_and_throw(). They are also recorded per queue by the
+// onemath library, so that applications can check for them once the work has completed,
+// for instance by polling the status of the returned event, without waiting on the queue.
+//
+// The backend libraries do not link to onemath: they look up its recording function in
+// the process. Errors are therefore recorded with the run-time dispatch API, and with the
+// compile-time API only if the application links onemath as well.
+
+namespace oneapi {
+namespace math {
+
+struct async_error {
+    // Message of the exception, as returned by what()
+    std::string message;
+    // The exception itself, which can be rethrown with std::rethrow_exception
+    std::exception_ptr exception;
+};
+
+// Errors kept per queue until they are taken; later ones are dropped
+constexpr std::size_t max_async_errors_per_queue = 64;
+
+// Returns true if host tasks submitted to the queue by oneMath have failed since the
+// errors of the queue were last taken.
+ONEMATH_EXPORT bool has_async_errors(const sycl::queue& queue);
+
+// Returns the errors of the host tasks submitted to the queue by oneMath, oldest first,
+// and clears them. The exceptions are still thrown by queue::wait_and_throw().
+ONEMATH_EXPORT std::vector<async_error> take_async_errors(const sycl::queue& queue);
+
+} // namespace math
+} // namespace oneapi
+
+#endif //_ONEMATH_ASYNC_ERRORS_HPP_
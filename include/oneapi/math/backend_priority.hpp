@@ -0,0 +1,47 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMATH_BACKEND_PRIORITY_HPP_
+#define _ONEMATH_BACKEND_PRIORITY_HPP_
+
+#include <string>
+#include <vector>
+
+#include "oneapi/math/detail/export.hpp"
+
+namespace oneapi {
+namespace math {
+
+// Sets the order in which run-time dispatching tries the backend libraries built for a
+// device, e.g. { "netlib", "mklcpu" } for BLAS on x86 CPUs. Backends not listed keep
+// their default order after the listed ones. The first backend that loads serves the
+// calls; if it throws oneapi::math::unimplemented for a routine, the call is forwarded
+// to the next one. Only an exception thrown by the call itself is forwarded: errors that
+// the submitted work raises later, for instance from a host task, are reported through
+// the queue as usual. Only affects function tables loaded after the call. The initial
+// order is read from the ONEMATH_BACKEND_PRIORITY environment variable, a comma
+// separated list of backend names.
+ONEMATH_EXPORT void set_backend_priority(const std::vector<std::string>& backends);
+
+ONEMATH_EXPORT std::vector<std::string> get_backend_priority();
+
+} // namespace math
+} // namespace oneapi
+
+#endif //_ONEMATH_BACKEND_PRIORITY_HPP_
@@ -61,12 +61,26 @@ namespace math {
 namespace blas {
 namespace column_major {
 
+#define ONEMATH_RT_INLINE   static inline
+#define ONEMATH_RT_QUEUE    sycl::queue& queue,
+#define ONEMATH_RT_DISPATCH get_device_id(queue), queue
 #include "blas.hxx"
+#undef ONEMATH_RT_INLINE
+#undef ONEMATH_RT_QUEUE
+#undef ONEMATH_RT_DISPATCH
+#include "oneapi/math/blas/detail/blas_bound.hxx"
 
 } //namespace column_major
 namespace row_major {
 
+#define ONEMATH_RT_INLINE   static inline
+#define ONEMATH_RT_QUEUE    sycl::queue& queue,
+#define ONEMATH_RT_DISPATCH get_device_id(queue), queue
 #include "blas.hxx"
+#undef ONEMATH_RT_INLINE
+#undef ONEMATH_RT_QUEUE
+#undef ONEMATH_RT_DISPATCH
+#include "oneapi/math/blas/detail/blas_bound.hxx"
 
 } //namespace row_major
 } //namespace blas
@@ -31,6 +31,7 @@
 #include "oneapi/math/types.hpp"
 
 #include "oneapi/math/detail/export.hpp"
+#include "oneapi/math/detail/dispatch_key.hpp"
 #include "oneapi/math/detail/get_device_id.hpp"
 
 namespace oneapi {
@@ -39,6 +40,8 @@ namespace blas {
 namespace column_major {
 namespace detail {
 
+using oneapi::math::detail::dispatch_key;
+
 #include "blas_loader.hxx"
 
 } //namespace detail
@@ -46,6 +49,8 @@ namespace detail {
 namespace row_major {
 namespace detail {
 
+using oneapi::math::detail::dispatch_key;
+
 #include "blas_loader.hxx"
 
 } //namespace detail
@@ -0,0 +1,67 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMATH_CPU_EXECUTION_POLICY_HPP_
+#define _ONEMATH_CPU_EXECUTION_POLICY_HPP_
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include <cstddef>
+#include <vector>
+
+#include "oneapi/math/detail/export.hpp"
+
+// The CPU backends run their work on host threads that the application does not create. An
+// execution policy attached to a queue limits the threads running the oneMath calls submitted
+// to it, and the logical CPUs they run on, so that the work of a queue can be kept on the cores
+// of one NUMA domain.
+//
+// The policies are kept by the onemath library. The backend libraries do not link to onemath:
+// they look up its policies in the process. Policies therefore apply with the run-time
+// dispatch API, and with the compile-time API only if the application links onemath as well.
+
+namespace oneapi {
+namespace math {
+
+struct cpu_execution_policy {
+    // Maximum number of threads running a call, or 0 for the backend default
+    std::size_t num_threads = 0;
+    // Logical CPUs the threads running a call are bound to, or empty to leave them unbound
+    std::vector<int> cpus;
+};
+
+// Attaches the policy to the queue, replacing its previous one. Applies to the calls of the
+// netlib BLAS backend submitted to the queue afterwards, and to the num_threads of the USM gemm
+// calls of the Intel(R) oneMKL CPU BLAS backend; the other backends ignore it.
+ONEMATH_EXPORT void set_cpu_execution_policy(const sycl::queue& queue, cpu_execution_policy policy);
+
+// Returns the policy attached to the queue, or the default policy if it has none
+ONEMATH_EXPORT cpu_execution_policy get_cpu_execution_policy(const sycl::queue& queue);
+
+// Detaches the policy of the queue, if any
+ONEMATH_EXPORT void reset_cpu_execution_policy(const sycl::queue& queue);
+
+} // namespace math
+} // namespace oneapi
+
+#endif //_ONEMATH_CPU_EXECUTION_POLICY_HPP_
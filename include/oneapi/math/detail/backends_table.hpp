@@ -72,7 +72,11 @@ static std::map<domain, std::map<device, std::vector<const char*>>> libraries =
               LIB_NAME("blas_mklgpu"),
 #endif
 #ifdef ONEMATH_ENABLE_GENERIC_BLAS_BACKEND_INTEL_GPU
+#ifdef ONEMATH_GENERIC_BLAS_TUNED_INTEL_GPU
+              LIB_NAME("blas_generic_intel_gpu"),
+#else
               LIB_NAME("blas_generic"),
+#endif
 #endif
           } },
         { device::amdgpu,
@@ -81,7 +85,11 @@ static std::map<domain, std::map<device, std::vector<const char*>>> libraries =
               LIB_NAME("blas_rocblas"),
 #endif
 #ifdef ONEMATH_ENABLE_GENERIC_BLAS_BACKEND_AMD_GPU
+#ifdef ONEMATH_GENERIC_BLAS_TUNED_AMD_GPU
+              LIB_NAME("blas_generic_amd_gpu"),
+#else
               LIB_NAME("blas_generic"),
+#endif
 #endif
           } },
         { device::nvidiagpu,
@@ -90,7 +98,11 @@ static std::map<domain, std::map<device, std::vector<const char*>>> libraries =
               LIB_NAME("blas_cublas"),
 #endif
 #ifdef ONEMATH_ENABLE_GENERIC_BLAS_BACKEND_NVIDIA_GPU
+#ifdef ONEMATH_GENERIC_BLAS_TUNED_NVIDIA_GPU
+              LIB_NAME("blas_generic_nvidia_gpu"),
+#else
               LIB_NAME("blas_generic"),
+#endif
 #endif
           } },
         { device::generic_device,
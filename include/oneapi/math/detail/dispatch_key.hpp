@@ -0,0 +1,47 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMATH_DISPATCH_KEY_HPP_
+#define _ONEMATH_DISPATCH_KEY_HPP_
+
+#include "oneapi/math/detail/backends_table.hpp"
+
+namespace oneapi {
+namespace math {
+namespace detail {
+
+// Selects the backend serving a run-time dispatched call. The free functions key calls by
+// the device of the queue, and the loader looks up the function table of that device on
+// every call. Bound handles also carry the function table the loader resolved when the
+// handle was created, and calls keyed by it go straight to that table. The table is owned
+// by the loader and is opaque outside of it.
+struct dispatch_key {
+    dispatch_key(oneapi::math::device id) : device_id(id), table(nullptr) {}
+    dispatch_key(oneapi::math::device id, const void* bound_table)
+            : device_id(id), table(bound_table) {}
+
+    oneapi::math::device device_id;
+    const void* table;
+};
+
+} //namespace detail
+} // namespace math
+} // namespace oneapi
+
+#endif //_ONEMATH_DISPATCH_KEY_HPP_
@@ -26,6 +26,11 @@
 #include <CL/sycl.hpp>
 #endif
 
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+
 #include "oneapi/math/detail/backends_table.hpp"
 #include "oneapi/math/exceptions.hpp"
 
@@ -39,8 +44,11 @@
 
 namespace oneapi {
 namespace math {
+namespace detail {
 
-inline oneapi::math::device get_device_id(sycl::queue& queue) {
+// Classifies the device of the queue by querying the SYCL runtime. Prefer
+// get_device_id, which caches the result per device.
+inline oneapi::math::device get_device_id_uncached(sycl::queue& queue) {
     oneapi::math::device device_id;
 #ifdef __x86_64__
     if (queue.get_device().is_cpu())
@@ -76,6 +84,60 @@ inline oneapi::math::device get_device_id(sycl::queue& queue) {
     return device_id;
 }
 
+// Process-wide cache of the oneMath classification of each SYCL device. The
+// classification of a device never changes, so entries are never invalidated. Entries
+// are only appended and are published through size_, so lookups take no lock. The
+// cache is never destroyed, so no sycl::device it holds is released after the SYCL
+// runtime has shut down.
+class device_id_cache {
+public:
+    static oneapi::math::device get(sycl::queue& queue) {
+        static device_id_cache& instance = *new device_id_cache();
+        return instance.lookup(queue);
+    }
+
+private:
+    // A process sees few devices; the classification of any device past this many is
+    // queried on every call instead of being cached.
+    static constexpr std::size_t max_devices = 64;
+
+    struct entry {
+        sycl::device device;
+        oneapi::math::device device_id;
+    };
+
+    oneapi::math::device lookup(sycl::queue& queue) {
+        const sycl::device dev = queue.get_device();
+        const std::size_t count = size_.load(std::memory_order_acquire);
+        for (std::size_t i = 0; i < count; ++i) {
+            if (entries_[i]->device == dev)
+                return entries_[i]->device_id;
+        }
+        const oneapi::math::device device_id = get_device_id_uncached(queue);
+        std::lock_guard<std::mutex> lock(insert_mutex_);
+        const std::size_t size = size_.load(std::memory_order_relaxed);
+        for (std::size_t i = count; i < size; ++i) {
+            if (entries_[i]->device == dev)
+                return entries_[i]->device_id;
+        }
+        if (size < max_devices) {
+            entries_[size] = new entry{ dev, device_id };
+            size_.store(size + 1, std::memory_order_release);
+        }
+        return device_id;
+    }
+
+    std::array<entry*, max_devices> entries_{};
+    std::atomic<std::size_t> size_{ 0 };
+    std::mutex insert_mutex_;
+};
+
+} //namespace detail
+
+inline oneapi::math::device get_device_id(sycl::queue& queue) {
+    return detail::device_id_cache::get(queue);
+}
+
 } //namespace math
 } //namespace oneapi
 
@@ -35,3 +35,4 @@
 #endif
 
 #include "oneapi/math/lapack/detail/lapack_rt.hpp"
+#include "oneapi/math/lapack/detail/lapack_bound.hpp"
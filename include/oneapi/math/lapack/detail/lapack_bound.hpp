@@ -0,0 +1,77 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#pragma once
+
+#include <complex>
+#include <cstdint>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include "oneapi/math/types.hpp"
+#include "oneapi/math/lapack/types.hpp"
+#include "oneapi/math/lapack/exceptions.hpp"
+#include "oneapi/math/detail/get_device_id.hpp"
+#include "oneapi/math/lapack/detail/lapack_loader.hpp"
+
+namespace oneapi {
+namespace math {
+namespace lapack {
+
+// Run-time dispatching interface bound to a queue. The backend function table for the device
+// of the queue is resolved and loaded once when the handle is created, and calls made through
+// the handle go straight to that table: they skip the device lookup and the backend priority
+// and fallback of the free functions. Tracing still applies.
+class bound_handle {
+public:
+    explicit bound_handle(sycl::queue& queue) : queue_(queue), key_(bind_key(queue)) {}
+
+    sycl::queue& get_queue() {
+        return queue_;
+    }
+
+#define ONEMATH_RT_INLINE
+#define ONEMATH_RT_QUEUE
+#define ONEMATH_RT_DISPATCH key_, queue_
+#include "oneapi/math/lapack/detail/lapack_rt.hxx"
+#undef ONEMATH_RT_INLINE
+#undef ONEMATH_RT_QUEUE
+#undef ONEMATH_RT_DISPATCH
+
+private:
+    static oneapi::math::detail::dispatch_key bind_key(sycl::queue& queue) {
+        const oneapi::math::device device_id = get_device_id(queue);
+        return { device_id, detail::load_function_table(device_id, queue) };
+    }
+
+    sycl::queue queue_;
+    oneapi::math::detail::dispatch_key key_;
+};
+
+static inline bound_handle bind(sycl::queue& queue) {
+    return bound_handle(queue);
+}
+
+} // namespace lapack
+} // namespace math
+} // namespace oneapi
@@ -0,0 +1,2387 @@
+/*******************************************************************************
+* Copyright 2021 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+// Run-time dispatching interface, included once for the free functions taking a queue and
+// once for bound_handle. The includer defines ONEMATH_RT_INLINE, ONEMATH_RT_QUEUE (the leading
+// queue parameter, if any) and ONEMATH_RT_DISPATCH (the leading loader arguments).
+
+ONEMATH_RT_INLINE void gebrd(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n,
+                             sycl::buffer<std::complex<float>>& a, std::int64_t lda,
+                             sycl::buffer<float>& d, sycl::buffer<float>& e,
+                             sycl::buffer<std::complex<float>>& tauq,
+                             sycl::buffer<std::complex<float>>& taup,
+                             sycl::buffer<std::complex<float>>& scratchpad,
+                             std::int64_t scratchpad_size) {
+    detail::gebrd(ONEMATH_RT_DISPATCH, m, n, a, lda, d, e, tauq, taup, scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void gebrd(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n,
+                             sycl::buffer<double>& a, std::int64_t lda, sycl::buffer<double>& d,
+                             sycl::buffer<double>& e, sycl::buffer<double>& tauq,
+                             sycl::buffer<double>& taup, sycl::buffer<double>& scratchpad,
+                             std::int64_t scratchpad_size) {
+    detail::gebrd(ONEMATH_RT_DISPATCH, m, n, a, lda, d, e, tauq, taup, scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void gebrd(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n,
+                             sycl::buffer<float>& a, std::int64_t lda, sycl::buffer<float>& d,
+                             sycl::buffer<float>& e, sycl::buffer<float>& tauq,
+                             sycl::buffer<float>& taup, sycl::buffer<float>& scratchpad,
+                             std::int64_t scratchpad_size) {
+    detail::gebrd(ONEMATH_RT_DISPATCH, m, n, a, lda, d, e, tauq, taup, scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void gebrd(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n,
+                             sycl::buffer<std::complex<double>>& a, std::int64_t lda,
+                             sycl::buffer<double>& d, sycl::buffer<double>& e,
+                             sycl::buffer<std::complex<double>>& tauq,
+                             sycl::buffer<std::complex<double>>& taup,
+                             sycl::buffer<std::complex<double>>& scratchpad,
+                             std::int64_t scratchpad_size) {
+    detail::gebrd(ONEMATH_RT_DISPATCH, m, n, a, lda, d, e, tauq, taup, scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void gerqf(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n,
+                             sycl::buffer<float>& a, std::int64_t lda, sycl::buffer<float>& tau,
+                             sycl::buffer<float>& scratchpad, std::int64_t scratchpad_size) {
+    detail::gerqf(ONEMATH_RT_DISPATCH, m, n, a, lda, tau, scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void gerqf(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n,
+                             sycl::buffer<double>& a, std::int64_t lda, sycl::buffer<double>& tau,
+                             sycl::buffer<double>& scratchpad, std::int64_t scratchpad_size) {
+    detail::gerqf(ONEMATH_RT_DISPATCH, m, n, a, lda, tau, scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void gerqf(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n,
+                             sycl::buffer<std::complex<float>>& a, std::int64_t lda,
+                             sycl::buffer<std::complex<float>>& tau,
+                             sycl::buffer<std::complex<float>>& scratchpad,
+                             std::int64_t scratchpad_size) {
+    detail::gerqf(ONEMATH_RT_DISPATCH, m, n, a, lda, tau, scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void gerqf(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n,
+                             sycl::buffer<std::complex<double>>& a, std::int64_t lda,
+                             sycl::buffer<std::complex<double>>& tau,
+                             sycl::buffer<std::complex<double>>& scratchpad,
+                             std::int64_t scratchpad_size) {
+    detail::gerqf(ONEMATH_RT_DISPATCH, m, n, a, lda, tau, scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void geqrf(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n,
+                             sycl::buffer<std::complex<float>>& a, std::int64_t lda,
+                             sycl::buffer<std::complex<float>>& tau,
+                             sycl::buffer<std::complex<float>>& scratchpad,
+                             std::int64_t scratchpad_size) {
+    detail::geqrf(ONEMATH_RT_DISPATCH, m, n, a, lda, tau, scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void geqrf(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n,
+                             sycl::buffer<double>& a, std::int64_t lda, sycl::buffer<double>& tau,
+                             sycl::buffer<double>& scratchpad, std::int64_t scratchpad_size) {
+    detail::geqrf(ONEMATH_RT_DISPATCH, m, n, a, lda, tau, scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void geqrf(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n,
+                             sycl::buffer<float>& a, std::int64_t lda, sycl::buffer<float>& tau,
+                             sycl::buffer<float>& scratchpad, std::int64_t scratchpad_size) {
+    detail::geqrf(ONEMATH_RT_DISPATCH, m, n, a, lda, tau, scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void geqrf(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n,
+                             sycl::buffer<std::complex<double>>& a, std::int64_t lda,
+                             sycl::buffer<std::complex<double>>& tau,
+                             sycl::buffer<std::complex<double>>& scratchpad,
+                             std::int64_t scratchpad_size) {
+    detail::geqrf(ONEMATH_RT_DISPATCH, m, n, a, lda, tau, scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void getrf(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n,
+                             sycl::buffer<std::complex<float>>& a, std::int64_t lda,
+                             sycl::buffer<std::int64_t>& ipiv,
+                             sycl::buffer<std::complex<float>>& scratchpad,
+                             std::int64_t scratchpad_size) {
+    detail::getrf(ONEMATH_RT_DISPATCH, m, n, a, lda, ipiv, scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void getrf(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n,
+                             sycl::buffer<double>& a, std::int64_t lda,
+                             sycl::buffer<std::int64_t>& ipiv, sycl::buffer<double>& scratchpad,
+                             std::int64_t scratchpad_size) {
+    detail::getrf(ONEMATH_RT_DISPATCH, m, n, a, lda, ipiv, scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void getrf(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n,
+                             sycl::buffer<float>& a, std::int64_t lda,
+                             sycl::buffer<std::int64_t>& ipiv, sycl::buffer<float>& scratchpad,
+                             std::int64_t scratchpad_size) {
+    detail::getrf(ONEMATH_RT_DISPATCH, m, n, a, lda, ipiv, scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void getrf(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n,
+                             sycl::buffer<std::complex<double>>& a, std::int64_t lda,
+                             sycl::buffer<std::int64_t>& ipiv,
+                             sycl::buffer<std::complex<double>>& scratchpad,
+                             std::int64_t scratchpad_size) {
+    detail::getrf(ONEMATH_RT_DISPATCH, m, n, a, lda, ipiv, scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void getri(ONEMATH_RT_QUEUE std::int64_t n, sycl::buffer<std::complex<float>>& a,
+                             std::int64_t lda, sycl::buffer<std::int64_t>& ipiv,
+                             sycl::buffer<std::complex<float>>& scratchpad,
+                             std::int64_t scratchpad_size) {
+    detail::getri(ONEMATH_RT_DISPATCH, n, a, lda, ipiv, scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void getri(ONEMATH_RT_QUEUE std::int64_t n, sycl::buffer<double>& a,
+                             std::int64_t lda, sycl::buffer<std::int64_t>& ipiv,
+                             sycl::buffer<double>& scratchpad, std::int64_t scratchpad_size) {
+    detail::getri(ONEMATH_RT_DISPATCH, n, a, lda, ipiv, scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void getri(ONEMATH_RT_QUEUE std::int64_t n, sycl::buffer<float>& a,
+                             std::int64_t lda, sycl::buffer<std::int64_t>& ipiv,
+                             sycl::buffer<float>& scratchpad, std::int64_t scratchpad_size) {
+    detail::getri(ONEMATH_RT_DISPATCH, n, a, lda, ipiv, scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void getri(ONEMATH_RT_QUEUE std::int64_t n, sycl::buffer<std::complex<double>>& a,
+                             std::int64_t lda, sycl::buffer<std::int64_t>& ipiv,
+                             sycl::buffer<std::complex<double>>& scratchpad,
+                             std::int64_t scratchpad_size) {
+    detail::getri(ONEMATH_RT_DISPATCH, n, a, lda, ipiv, scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void getrs(ONEMATH_RT_QUEUE oneapi::math::transpose trans, std::int64_t n,
+                             std::int64_t nrhs, sycl::buffer<std::complex<float>>& a,
+                             std::int64_t lda, sycl::buffer<std::int64_t>& ipiv,
+                             sycl::buffer<std::complex<float>>& b, std::int64_t ldb,
+                             sycl::buffer<std::complex<float>>& scratchpad,
+                             std::int64_t scratchpad_size) {
+    detail::getrs(ONEMATH_RT_DISPATCH, trans, n, nrhs, a, lda, ipiv, b, ldb, scratchpad,
+                  scratchpad_size);
+}
+ONEMATH_RT_INLINE void getrs(ONEMATH_RT_QUEUE oneapi::math::transpose trans, std::int64_t n,
+                             std::int64_t nrhs, sycl::buffer<double>& a, std::int64_t lda,
+                             sycl::buffer<std::int64_t>& ipiv, sycl::buffer<double>& b,
+                             std::int64_t ldb, sycl::buffer<double>& scratchpad,
+                             std::int64_t scratchpad_size) {
+    detail::getrs(ONEMATH_RT_DISPATCH, trans, n, nrhs, a, lda, ipiv, b, ldb, scratchpad,
+                  scratchpad_size);
+}
+ONEMATH_RT_INLINE void getrs(ONEMATH_RT_QUEUE oneapi::math::transpose trans, std::int64_t n,
+                             std::int64_t nrhs, sycl::buffer<float>& a, std::int64_t lda,
+                             sycl::buffer<std::int64_t>& ipiv, sycl::buffer<float>& b,
+                             std::int64_t ldb, sycl::buffer<float>& scratchpad,
+                             std::int64_t scratchpad_size) {
+    detail::getrs(ONEMATH_RT_DISPATCH, trans, n, nrhs, a, lda, ipiv, b, ldb, scratchpad,
+                  scratchpad_size);
+}
+ONEMATH_RT_INLINE void getrs(ONEMATH_RT_QUEUE oneapi::math::transpose trans, std::int64_t n,
+                             std::int64_t nrhs, sycl::buffer<std::complex<double>>& a,
+                             std::int64_t lda, sycl::buffer<std::int64_t>& ipiv,
+                             sycl::buffer<std::complex<double>>& b, std::int64_t ldb,
+                             sycl::buffer<std::complex<double>>& scratchpad,
+                             std::int64_t scratchpad_size) {
+    detail::getrs(ONEMATH_RT_DISPATCH, trans, n, nrhs, a, lda, ipiv, b, ldb, scratchpad,
+                  scratchpad_size);
+}
+ONEMATH_RT_INLINE void gesvd(ONEMATH_RT_QUEUE oneapi::math::jobsvd jobu, oneapi::math::jobsvd jobvt,
+                             std::int64_t m, std::int64_t n, sycl::buffer<double>& a,
+                             std::int64_t lda, sycl::buffer<double>& s, sycl::buffer<double>& u,
+                             std::int64_t ldu, sycl::buffer<double>& vt, std::int64_t ldvt,
+                             sycl::buffer<double>& scratchpad, std::int64_t scratchpad_size) {
+    detail::gesvd(ONEMATH_RT_DISPATCH, jobu, jobvt, m, n, a, lda, s, u, ldu, vt, ldvt, scratchpad,
+                  scratchpad_size);
+}
+ONEMATH_RT_INLINE void gesvd(ONEMATH_RT_QUEUE oneapi::math::jobsvd jobu, oneapi::math::jobsvd jobvt,
+                             std::int64_t m, std::int64_t n, sycl::buffer<float>& a,
+                             std::int64_t lda, sycl::buffer<float>& s, sycl::buffer<float>& u,
+                             std::int64_t ldu, sycl::buffer<float>& vt, std::int64_t ldvt,
+                             sycl::buffer<float>& scratchpad, std::int64_t scratchpad_size) {
+    detail::gesvd(ONEMATH_RT_DISPATCH, jobu, jobvt, m, n, a, lda, s, u, ldu, vt, ldvt, scratchpad,
+                  scratchpad_size);
+}
+ONEMATH_RT_INLINE void gesvd(ONEMATH_RT_QUEUE oneapi::math::jobsvd jobu, oneapi::math::jobsvd jobvt,
+                             std::int64_t m, std::int64_t n, sycl::buffer<std::complex<float>>& a,
+                             std::int64_t lda, sycl::buffer<float>& s,
+                             sycl::buffer<std::complex<float>>& u, std::int64_t ldu,
+                             sycl::buffer<std::complex<float>>& vt, std::int64_t ldvt,
+                             sycl::buffer<std::complex<float>>& scratchpad,
+                             std::int64_t scratchpad_size) {
+    detail::gesvd(ONEMATH_RT_DISPATCH, jobu, jobvt, m, n, a, lda, s, u, ldu, vt, ldvt, scratchpad,
+                  scratchpad_size);
+}
+ONEMATH_RT_INLINE void gesvd(ONEMATH_RT_QUEUE oneapi::math::jobsvd jobu, oneapi::math::jobsvd jobvt,
+                             std::int64_t m, std::int64_t n, sycl::buffer<std::complex<double>>& a,
+                             std::int64_t lda, sycl::buffer<double>& s,
+                             sycl::buffer<std::complex<double>>& u, std::int64_t ldu,
+                             sycl::buffer<std::complex<double>>& vt, std::int64_t ldvt,
+                             sycl::buffer<std::complex<double>>& scratchpad,
+                             std::int64_t scratchpad_size) {
+    detail::gesvd(ONEMATH_RT_DISPATCH, jobu, jobvt, m, n, a, lda, s, u, ldu, vt, ldvt, scratchpad,
+                  scratchpad_size);
+}
+ONEMATH_RT_INLINE void heevd(ONEMATH_RT_QUEUE oneapi::math::job jobz, oneapi::math::uplo uplo,
+                             std::int64_t n, sycl::buffer<std::complex<float>>& a, std::int64_t lda,
+                             sycl::buffer<float>& w, sycl::buffer<std::complex<float>>& scratchpad,
+                             std::int64_t scratchpad_size) {
+    detail::heevd(ONEMATH_RT_DISPATCH, jobz, uplo, n, a, lda, w, scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void heevd(ONEMATH_RT_QUEUE oneapi::math::job jobz, oneapi::math::uplo uplo,
+                             std::int64_t n, sycl::buffer<std::complex<double>>& a,
+                             std::int64_t lda, sycl::buffer<double>& w,
+                             sycl::buffer<std::complex<double>>& scratchpad,
+                             std::int64_t scratchpad_size) {
+    detail::heevd(ONEMATH_RT_DISPATCH, jobz, uplo, n, a, lda, w, scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void hegvd(ONEMATH_RT_QUEUE std::int64_t itype, oneapi::math::job jobz,
+                             oneapi::math::uplo uplo, std::int64_t n,
+                             sycl::buffer<std::complex<float>>& a, std::int64_t lda,
+                             sycl::buffer<std::complex<float>>& b, std::int64_t ldb,
+                             sycl::buffer<float>& w, sycl::buffer<std::complex<float>>& scratchpad,
+                             std::int64_t scratchpad_size) {
+    detail::hegvd(ONEMATH_RT_DISPATCH, itype, jobz, uplo, n, a, lda, b, ldb, w, scratchpad,
+                  scratchpad_size);
+}
+ONEMATH_RT_INLINE void hegvd(ONEMATH_RT_QUEUE std::int64_t itype, oneapi::math::job jobz,
+                             oneapi::math::uplo uplo, std::int64_t n,
+                             sycl::buffer<std::complex<double>>& a, std::int64_t lda,
+                             sycl::buffer<std::complex<double>>& b, std::int64_t ldb,
+                             sycl::buffer<double>& w,
+                             sycl::buffer<std::complex<double>>& scratchpad,
+                             std::int64_t scratchpad_size) {
+    detail::hegvd(ONEMATH_RT_DISPATCH, itype, jobz, uplo, n, a, lda, b, ldb, w, scratchpad,
+                  scratchpad_size);
+}
+ONEMATH_RT_INLINE void hetrd(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                             sycl::buffer<std::complex<float>>& a, std::int64_t lda,
+                             sycl::buffer<float>& d, sycl::buffer<float>& e,
+                             sycl::buffer<std::complex<float>>& tau,
+                             sycl::buffer<std::complex<float>>& scratchpad,
+                             std::int64_t scratchpad_size) {
+    detail::hetrd(ONEMATH_RT_DISPATCH, uplo, n, a, lda, d, e, tau, scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void hetrd(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                             sycl::buffer<std::complex<double>>& a, std::int64_t lda,
+                             sycl::buffer<double>& d, sycl::buffer<double>& e,
+                             sycl::buffer<std::complex<double>>& tau,
+                             sycl::buffer<std::complex<double>>& scratchpad,
+                             std::int64_t scratchpad_size) {
+    detail::hetrd(ONEMATH_RT_DISPATCH, uplo, n, a, lda, d, e, tau, scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void hetrf(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                             sycl::buffer<std::complex<float>>& a, std::int64_t lda,
+                             sycl::buffer<std::int64_t>& ipiv,
+                             sycl::buffer<std::complex<float>>& scratchpad,
+                             std::int64_t scratchpad_size) {
+    detail::hetrf(ONEMATH_RT_DISPATCH, uplo, n, a, lda, ipiv, scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void hetrf(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                             sycl::buffer<std::complex<double>>& a, std::int64_t lda,
+                             sycl::buffer<std::int64_t>& ipiv,
+                             sycl::buffer<std::complex<double>>& scratchpad,
+                             std::int64_t scratchpad_size) {
+    detail::hetrf(ONEMATH_RT_DISPATCH, uplo, n, a, lda, ipiv, scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void orgbr(ONEMATH_RT_QUEUE oneapi::math::generate vec, std::int64_t m,
+                             std::int64_t n, std::int64_t k, sycl::buffer<float>& a,
+                             std::int64_t lda, sycl::buffer<float>& tau,
+                             sycl::buffer<float>& scratchpad, std::int64_t scratchpad_size) {
+    detail::orgbr(ONEMATH_RT_DISPATCH, vec, m, n, k, a, lda, tau, scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void orgbr(ONEMATH_RT_QUEUE oneapi::math::generate vec, std::int64_t m,
+                             std::int64_t n, std::int64_t k, sycl::buffer<double>& a,
+                             std::int64_t lda, sycl::buffer<double>& tau,
+                             sycl::buffer<double>& scratchpad, std::int64_t scratchpad_size) {
+    detail::orgbr(ONEMATH_RT_DISPATCH, vec, m, n, k, a, lda, tau, scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void orgqr(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n, std::int64_t k,
+                             sycl::buffer<double>& a, std::int64_t lda, sycl::buffer<double>& tau,
+                             sycl::buffer<double>& scratchpad, std::int64_t scratchpad_size) {
+    detail::orgqr(ONEMATH_RT_DISPATCH, m, n, k, a, lda, tau, scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void orgqr(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n, std::int64_t k,
+                             sycl::buffer<float>& a, std::int64_t lda, sycl::buffer<float>& tau,
+                             sycl::buffer<float>& scratchpad, std::int64_t scratchpad_size) {
+    detail::orgqr(ONEMATH_RT_DISPATCH, m, n, k, a, lda, tau, scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void orgtr(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                             sycl::buffer<float>& a, std::int64_t lda, sycl::buffer<float>& tau,
+                             sycl::buffer<float>& scratchpad, std::int64_t scratchpad_size) {
+    detail::orgtr(ONEMATH_RT_DISPATCH, uplo, n, a, lda, tau, scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void orgtr(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                             sycl::buffer<double>& a, std::int64_t lda, sycl::buffer<double>& tau,
+                             sycl::buffer<double>& scratchpad, std::int64_t scratchpad_size) {
+    detail::orgtr(ONEMATH_RT_DISPATCH, uplo, n, a, lda, tau, scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void ormtr(ONEMATH_RT_QUEUE oneapi::math::side side, oneapi::math::uplo uplo,
+                             oneapi::math::transpose trans, std::int64_t m, std::int64_t n,
+                             sycl::buffer<float>& a, std::int64_t lda, sycl::buffer<float>& tau,
+                             sycl::buffer<float>& c, std::int64_t ldc,
+                             sycl::buffer<float>& scratchpad, std::int64_t scratchpad_size) {
+    detail::ormtr(ONEMATH_RT_DISPATCH, side, uplo, trans, m, n, a, lda, tau, c, ldc, scratchpad,
+                  scratchpad_size);
+}
+ONEMATH_RT_INLINE void ormtr(ONEMATH_RT_QUEUE oneapi::math::side side, oneapi::math::uplo uplo,
+                             oneapi::math::transpose trans, std::int64_t m, std::int64_t n,
+                             sycl::buffer<double>& a, std::int64_t lda, sycl::buffer<double>& tau,
+                             sycl::buffer<double>& c, std::int64_t ldc,
+                             sycl::buffer<double>& scratchpad, std::int64_t scratchpad_size) {
+    detail::ormtr(ONEMATH_RT_DISPATCH, side, uplo, trans, m, n, a, lda, tau, c, ldc, scratchpad,
+                  scratchpad_size);
+}
+ONEMATH_RT_INLINE void ormrq(ONEMATH_RT_QUEUE oneapi::math::side side,
+                             oneapi::math::transpose trans, std::int64_t m, std::int64_t n,
+                             std::int64_t k, sycl::buffer<float>& a, std::int64_t lda,
+                             sycl::buffer<float>& tau, sycl::buffer<float>& c, std::int64_t ldc,
+                             sycl::buffer<float>& scratchpad, std::int64_t scratchpad_size) {
+    detail::ormrq(ONEMATH_RT_DISPATCH, side, trans, m, n, k, a, lda, tau, c, ldc, scratchpad,
+                  scratchpad_size);
+}
+ONEMATH_RT_INLINE void ormrq(ONEMATH_RT_QUEUE oneapi::math::side side,
+                             oneapi::math::transpose trans, std::int64_t m, std::int64_t n,
+                             std::int64_t k, sycl::buffer<double>& a, std::int64_t lda,
+                             sycl::buffer<double>& tau, sycl::buffer<double>& c, std::int64_t ldc,
+                             sycl::buffer<double>& scratchpad, std::int64_t scratchpad_size) {
+    detail::ormrq(ONEMATH_RT_DISPATCH, side, trans, m, n, k, a, lda, tau, c, ldc, scratchpad,
+                  scratchpad_size);
+}
+ONEMATH_RT_INLINE void ormqr(ONEMATH_RT_QUEUE oneapi::math::side side,
+                             oneapi::math::transpose trans, std::int64_t m, std::int64_t n,
+                             std::int64_t k, sycl::buffer<double>& a, std::int64_t lda,
+                             sycl::buffer<double>& tau, sycl::buffer<double>& c, std::int64_t ldc,
+                             sycl::buffer<double>& scratchpad, std::int64_t scratchpad_size) {
+    detail::ormqr(ONEMATH_RT_DISPATCH, side, trans, m, n, k, a, lda, tau, c, ldc, scratchpad,
+                  scratchpad_size);
+}
+ONEMATH_RT_INLINE void ormqr(ONEMATH_RT_QUEUE oneapi::math::side side,
+                             oneapi::math::transpose trans, std::int64_t m, std::int64_t n,
+                             std::int64_t k, sycl::buffer<float>& a, std::int64_t lda,
+                             sycl::buffer<float>& tau, sycl::buffer<float>& c, std::int64_t ldc,
+                             sycl::buffer<float>& scratchpad, std::int64_t scratchpad_size) {
+    detail::ormqr(ONEMATH_RT_DISPATCH, side, trans, m, n, k, a, lda, tau, c, ldc, scratchpad,
+                  scratchpad_size);
+}
+ONEMATH_RT_INLINE void potrf(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                             sycl::buffer<float>& a, std::int64_t lda,
+                             sycl::buffer<float>& scratchpad, std::int64_t scratchpad_size) {
+    detail::potrf(ONEMATH_RT_DISPATCH, uplo, n, a, lda, scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void potrf(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                             sycl::buffer<double>& a, std::int64_t lda,
+                             sycl::buffer<double>& scratchpad, std::int64_t scratchpad_size) {
+    detail::potrf(ONEMATH_RT_DISPATCH, uplo, n, a, lda, scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void potrf(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                             sycl::buffer<std::complex<float>>& a, std::int64_t lda,
+                             sycl::buffer<std::complex<float>>& scratchpad,
+                             std::int64_t scratchpad_size) {
+    detail::potrf(ONEMATH_RT_DISPATCH, uplo, n, a, lda, scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void potrf(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                             sycl::buffer<std::complex<double>>& a, std::int64_t lda,
+                             sycl::buffer<std::complex<double>>& scratchpad,
+                             std::int64_t scratchpad_size) {
+    detail::potrf(ONEMATH_RT_DISPATCH, uplo, n, a, lda, scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void potri(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                             sycl::buffer<float>& a, std::int64_t lda,
+                             sycl::buffer<float>& scratchpad, std::int64_t scratchpad_size) {
+    detail::potri(ONEMATH_RT_DISPATCH, uplo, n, a, lda, scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void potri(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                             sycl::buffer<double>& a, std::int64_t lda,
+                             sycl::buffer<double>& scratchpad, std::int64_t scratchpad_size) {
+    detail::potri(ONEMATH_RT_DISPATCH, uplo, n, a, lda, scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void potri(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                             sycl::buffer<std::complex<float>>& a, std::int64_t lda,
+                             sycl::buffer<std::complex<float>>& scratchpad,
+                             std::int64_t scratchpad_size) {
+    detail::potri(ONEMATH_RT_DISPATCH, uplo, n, a, lda, scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void potri(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                             sycl::buffer<std::complex<double>>& a, std::int64_t lda,
+                             sycl::buffer<std::complex<double>>& scratchpad,
+                             std::int64_t scratchpad_size) {
+    detail::potri(ONEMATH_RT_DISPATCH, uplo, n, a, lda, scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void potrs(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                             std::int64_t nrhs, sycl::buffer<float>& a, std::int64_t lda,
+                             sycl::buffer<float>& b, std::int64_t ldb,
+                             sycl::buffer<float>& scratchpad, std::int64_t scratchpad_size) {
+    detail::potrs(ONEMATH_RT_DISPATCH, uplo, n, nrhs, a, lda, b, ldb, scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void potrs(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                             std::int64_t nrhs, sycl::buffer<double>& a, std::int64_t lda,
+                             sycl::buffer<double>& b, std::int64_t ldb,
+                             sycl::buffer<double>& scratchpad, std::int64_t scratchpad_size) {
+    detail::potrs(ONEMATH_RT_DISPATCH, uplo, n, nrhs, a, lda, b, ldb, scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void potrs(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                             std::int64_t nrhs, sycl::buffer<std::complex<float>>& a,
+                             std::int64_t lda, sycl::buffer<std::complex<float>>& b,
+                             std::int64_t ldb, sycl::buffer<std::complex<float>>& scratchpad,
+                             std::int64_t scratchpad_size) {
+    detail::potrs(ONEMATH_RT_DISPATCH, uplo, n, nrhs, a, lda, b, ldb, scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void potrs(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                             std::int64_t nrhs, sycl::buffer<std::complex<double>>& a,
+                             std::int64_t lda, sycl::buffer<std::complex<double>>& b,
+                             std::int64_t ldb, sycl::buffer<std::complex<double>>& scratchpad,
+                             std::int64_t scratchpad_size) {
+    detail::potrs(ONEMATH_RT_DISPATCH, uplo, n, nrhs, a, lda, b, ldb, scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void syevd(ONEMATH_RT_QUEUE oneapi::math::job jobz, oneapi::math::uplo uplo,
+                             std::int64_t n, sycl::buffer<double>& a, std::int64_t lda,
+                             sycl::buffer<double>& w, sycl::buffer<double>& scratchpad,
+                             std::int64_t scratchpad_size) {
+    detail::syevd(ONEMATH_RT_DISPATCH, jobz, uplo, n, a, lda, w, scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void syevd(ONEMATH_RT_QUEUE oneapi::math::job jobz, oneapi::math::uplo uplo,
+                             std::int64_t n, sycl::buffer<float>& a, std::int64_t lda,
+                             sycl::buffer<float>& w, sycl::buffer<float>& scratchpad,
+                             std::int64_t scratchpad_size) {
+    detail::syevd(ONEMATH_RT_DISPATCH, jobz, uplo, n, a, lda, w, scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void sygvd(ONEMATH_RT_QUEUE std::int64_t itype, oneapi::math::job jobz,
+                             oneapi::math::uplo uplo, std::int64_t n, sycl::buffer<double>& a,
+                             std::int64_t lda, sycl::buffer<double>& b, std::int64_t ldb,
+                             sycl::buffer<double>& w, sycl::buffer<double>& scratchpad,
+                             std::int64_t scratchpad_size) {
+    detail::sygvd(ONEMATH_RT_DISPATCH, itype, jobz, uplo, n, a, lda, b, ldb, w, scratchpad,
+                  scratchpad_size);
+}
+ONEMATH_RT_INLINE void sygvd(ONEMATH_RT_QUEUE std::int64_t itype, oneapi::math::job jobz,
+                             oneapi::math::uplo uplo, std::int64_t n, sycl::buffer<float>& a,
+                             std::int64_t lda, sycl::buffer<float>& b, std::int64_t ldb,
+                             sycl::buffer<float>& w, sycl::buffer<float>& scratchpad,
+                             std::int64_t scratchpad_size) {
+    detail::sygvd(ONEMATH_RT_DISPATCH, itype, jobz, uplo, n, a, lda, b, ldb, w, scratchpad,
+                  scratchpad_size);
+}
+ONEMATH_RT_INLINE void sytrd(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                             sycl::buffer<double>& a, std::int64_t lda, sycl::buffer<double>& d,
+                             sycl::buffer<double>& e, sycl::buffer<double>& tau,
+                             sycl::buffer<double>& scratchpad, std::int64_t scratchpad_size) {
+    detail::sytrd(ONEMATH_RT_DISPATCH, uplo, n, a, lda, d, e, tau, scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void sytrd(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                             sycl::buffer<float>& a, std::int64_t lda, sycl::buffer<float>& d,
+                             sycl::buffer<float>& e, sycl::buffer<float>& tau,
+                             sycl::buffer<float>& scratchpad, std::int64_t scratchpad_size) {
+    detail::sytrd(ONEMATH_RT_DISPATCH, uplo, n, a, lda, d, e, tau, scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void sytrf(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                             sycl::buffer<float>& a, std::int64_t lda,
+                             sycl::buffer<std::int64_t>& ipiv, sycl::buffer<float>& scratchpad,
+                             std::int64_t scratchpad_size) {
+    detail::sytrf(ONEMATH_RT_DISPATCH, uplo, n, a, lda, ipiv, scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void sytrf(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                             sycl::buffer<double>& a, std::int64_t lda,
+                             sycl::buffer<std::int64_t>& ipiv, sycl::buffer<double>& scratchpad,
+                             std::int64_t scratchpad_size) {
+    detail::sytrf(ONEMATH_RT_DISPATCH, uplo, n, a, lda, ipiv, scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void sytrf(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                             sycl::buffer<std::complex<float>>& a, std::int64_t lda,
+                             sycl::buffer<std::int64_t>& ipiv,
+                             sycl::buffer<std::complex<float>>& scratchpad,
+                             std::int64_t scratchpad_size) {
+    detail::sytrf(ONEMATH_RT_DISPATCH, uplo, n, a, lda, ipiv, scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void sytrf(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                             sycl::buffer<std::complex<double>>& a, std::int64_t lda,
+                             sycl::buffer<std::int64_t>& ipiv,
+                             sycl::buffer<std::complex<double>>& scratchpad,
+                             std::int64_t scratchpad_size) {
+    detail::sytrf(ONEMATH_RT_DISPATCH, uplo, n, a, lda, ipiv, scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void trtrs(ONEMATH_RT_QUEUE oneapi::math::uplo uplo,
+                             oneapi::math::transpose trans, oneapi::math::diag diag, std::int64_t n,
+                             std::int64_t nrhs, sycl::buffer<std::complex<float>>& a,
+                             std::int64_t lda, sycl::buffer<std::complex<float>>& b,
+                             std::int64_t ldb, sycl::buffer<std::complex<float>>& scratchpad,
+                             std::int64_t scratchpad_size) {
+    detail::trtrs(ONEMATH_RT_DISPATCH, uplo, trans, diag, n, nrhs, a, lda, b, ldb, scratchpad,
+                  scratchpad_size);
+}
+ONEMATH_RT_INLINE void trtrs(ONEMATH_RT_QUEUE oneapi::math::uplo uplo,
+                             oneapi::math::transpose trans, oneapi::math::diag diag, std::int64_t n,
+                             std::int64_t nrhs, sycl::buffer<double>& a, std::int64_t lda,
+                             sycl::buffer<double>& b, std::int64_t ldb,
+                             sycl::buffer<double>& scratchpad, std::int64_t scratchpad_size) {
+    detail::trtrs(ONEMATH_RT_DISPATCH, uplo, trans, diag, n, nrhs, a, lda, b, ldb, scratchpad,
+                  scratchpad_size);
+}
+ONEMATH_RT_INLINE void trtrs(ONEMATH_RT_QUEUE oneapi::math::uplo uplo,
+                             oneapi::math::transpose trans, oneapi::math::diag diag, std::int64_t n,
+                             std::int64_t nrhs, sycl::buffer<float>& a, std::int64_t lda,
+                             sycl::buffer<float>& b, std::int64_t ldb,
+                             sycl::buffer<float>& scratchpad, std::int64_t scratchpad_size) {
+    detail::trtrs(ONEMATH_RT_DISPATCH, uplo, trans, diag, n, nrhs, a, lda, b, ldb, scratchpad,
+                  scratchpad_size);
+}
+ONEMATH_RT_INLINE void trtrs(ONEMATH_RT_QUEUE oneapi::math::uplo uplo,
+                             oneapi::math::transpose trans, oneapi::math::diag diag, std::int64_t n,
+                             std::int64_t nrhs, sycl::buffer<std::complex<double>>& a,
+                             std::int64_t lda, sycl::buffer<std::complex<double>>& b,
+                             std::int64_t ldb, sycl::buffer<std::complex<double>>& scratchpad,
+                             std::int64_t scratchpad_size) {
+    detail::trtrs(ONEMATH_RT_DISPATCH, uplo, trans, diag, n, nrhs, a, lda, b, ldb, scratchpad,
+                  scratchpad_size);
+}
+ONEMATH_RT_INLINE void ungbr(ONEMATH_RT_QUEUE oneapi::math::generate vec, std::int64_t m,
+                             std::int64_t n, std::int64_t k, sycl::buffer<std::complex<float>>& a,
+                             std::int64_t lda, sycl::buffer<std::complex<float>>& tau,
+                             sycl::buffer<std::complex<float>>& scratchpad,
+                             std::int64_t scratchpad_size) {
+    detail::ungbr(ONEMATH_RT_DISPATCH, vec, m, n, k, a, lda, tau, scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void ungbr(ONEMATH_RT_QUEUE oneapi::math::generate vec, std::int64_t m,
+                             std::int64_t n, std::int64_t k, sycl::buffer<std::complex<double>>& a,
+                             std::int64_t lda, sycl::buffer<std::complex<double>>& tau,
+                             sycl::buffer<std::complex<double>>& scratchpad,
+                             std::int64_t scratchpad_size) {
+    detail::ungbr(ONEMATH_RT_DISPATCH, vec, m, n, k, a, lda, tau, scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void ungqr(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n, std::int64_t k,
+                             sycl::buffer<std::complex<float>>& a, std::int64_t lda,
+                             sycl::buffer<std::complex<float>>& tau,
+                             sycl::buffer<std::complex<float>>& scratchpad,
+                             std::int64_t scratchpad_size) {
+    detail::ungqr(ONEMATH_RT_DISPATCH, m, n, k, a, lda, tau, scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void ungqr(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n, std::int64_t k,
+                             sycl::buffer<std::complex<double>>& a, std::int64_t lda,
+                             sycl::buffer<std::complex<double>>& tau,
+                             sycl::buffer<std::complex<double>>& scratchpad,
+                             std::int64_t scratchpad_size) {
+    detail::ungqr(ONEMATH_RT_DISPATCH, m, n, k, a, lda, tau, scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void ungtr(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                             sycl::buffer<std::complex<float>>& a, std::int64_t lda,
+                             sycl::buffer<std::complex<float>>& tau,
+                             sycl::buffer<std::complex<float>>& scratchpad,
+                             std::int64_t scratchpad_size) {
+    detail::ungtr(ONEMATH_RT_DISPATCH, uplo, n, a, lda, tau, scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void ungtr(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                             sycl::buffer<std::complex<double>>& a, std::int64_t lda,
+                             sycl::buffer<std::complex<double>>& tau,
+                             sycl::buffer<std::complex<double>>& scratchpad,
+                             std::int64_t scratchpad_size) {
+    detail::ungtr(ONEMATH_RT_DISPATCH, uplo, n, a, lda, tau, scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void unmrq(ONEMATH_RT_QUEUE oneapi::math::side side,
+                             oneapi::math::transpose trans, std::int64_t m, std::int64_t n,
+                             std::int64_t k, sycl::buffer<std::complex<float>>& a, std::int64_t lda,
+                             sycl::buffer<std::complex<float>>& tau,
+                             sycl::buffer<std::complex<float>>& c, std::int64_t ldc,
+                             sycl::buffer<std::complex<float>>& scratchpad,
+                             std::int64_t scratchpad_size) {
+    detail::unmrq(ONEMATH_RT_DISPATCH, side, trans, m, n, k, a, lda, tau, c, ldc, scratchpad,
+                  scratchpad_size);
+}
+ONEMATH_RT_INLINE void unmrq(ONEMATH_RT_QUEUE oneapi::math::side side,
+                             oneapi::math::transpose trans, std::int64_t m, std::int64_t n,
+                             std::int64_t k, sycl::buffer<std::complex<double>>& a,
+                             std::int64_t lda, sycl::buffer<std::complex<double>>& tau,
+                             sycl::buffer<std::complex<double>>& c, std::int64_t ldc,
+                             sycl::buffer<std::complex<double>>& scratchpad,
+                             std::int64_t scratchpad_size) {
+    detail::unmrq(ONEMATH_RT_DISPATCH, side, trans, m, n, k, a, lda, tau, c, ldc, scratchpad,
+                  scratchpad_size);
+}
+ONEMATH_RT_INLINE void unmqr(ONEMATH_RT_QUEUE oneapi::math::side side,
+                             oneapi::math::transpose trans, std::int64_t m, std::int64_t n,
+                             std::int64_t k, sycl::buffer<std::complex<float>>& a, std::int64_t lda,
+                             sycl::buffer<std::complex<float>>& tau,
+                             sycl::buffer<std::complex<float>>& c, std::int64_t ldc,
+                             sycl::buffer<std::complex<float>>& scratchpad,
+                             std::int64_t scratchpad_size) {
+    detail::unmqr(ONEMATH_RT_DISPATCH, side, trans, m, n, k, a, lda, tau, c, ldc, scratchpad,
+                  scratchpad_size);
+}
+ONEMATH_RT_INLINE void unmqr(ONEMATH_RT_QUEUE oneapi::math::side side,
+                             oneapi::math::transpose trans, std::int64_t m, std::int64_t n,
+                             std::int64_t k, sycl::buffer<std::complex<double>>& a,
+                             std::int64_t lda, sycl::buffer<std::complex<double>>& tau,
+                             sycl::buffer<std::complex<double>>& c, std::int64_t ldc,
+                             sycl::buffer<std::complex<double>>& scratchpad,
+                             std::int64_t scratchpad_size) {
+    detail::unmqr(ONEMATH_RT_DISPATCH, side, trans, m, n, k, a, lda, tau, c, ldc, scratchpad,
+                  scratchpad_size);
+}
+ONEMATH_RT_INLINE void unmtr(ONEMATH_RT_QUEUE oneapi::math::side side, oneapi::math::uplo uplo,
+                             oneapi::math::transpose trans, std::int64_t m, std::int64_t n,
+                             sycl::buffer<std::complex<float>>& a, std::int64_t lda,
+                             sycl::buffer<std::complex<float>>& tau,
+                             sycl::buffer<std::complex<float>>& c, std::int64_t ldc,
+                             sycl::buffer<std::complex<float>>& scratchpad,
+                             std::int64_t scratchpad_size) {
+    detail::unmtr(ONEMATH_RT_DISPATCH, side, uplo, trans, m, n, a, lda, tau, c, ldc, scratchpad,
+                  scratchpad_size);
+}
+ONEMATH_RT_INLINE void unmtr(ONEMATH_RT_QUEUE oneapi::math::side side, oneapi::math::uplo uplo,
+                             oneapi::math::transpose trans, std::int64_t m, std::int64_t n,
+                             sycl::buffer<std::complex<double>>& a, std::int64_t lda,
+                             sycl::buffer<std::complex<double>>& tau,
+                             sycl::buffer<std::complex<double>>& c, std::int64_t ldc,
+                             sycl::buffer<std::complex<double>>& scratchpad,
+                             std::int64_t scratchpad_size) {
+    detail::unmtr(ONEMATH_RT_DISPATCH, side, uplo, trans, m, n, a, lda, tau, c, ldc, scratchpad,
+                  scratchpad_size);
+}
+ONEMATH_RT_INLINE void geqrf_batch(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n,
+                                   sycl::buffer<float>& a, std::int64_t lda, std::int64_t stride_a,
+                                   sycl::buffer<float>& tau, std::int64_t stride_tau,
+                                   std::int64_t batch_size, sycl::buffer<float>& scratchpad,
+                                   std::int64_t scratchpad_size) {
+    detail::geqrf_batch(ONEMATH_RT_DISPATCH, m, n, a, lda, stride_a, tau, stride_tau, batch_size,
+                        scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void geqrf_batch(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n,
+                                   sycl::buffer<double>& a, std::int64_t lda, std::int64_t stride_a,
+                                   sycl::buffer<double>& tau, std::int64_t stride_tau,
+                                   std::int64_t batch_size, sycl::buffer<double>& scratchpad,
+                                   std::int64_t scratchpad_size) {
+    detail::geqrf_batch(ONEMATH_RT_DISPATCH, m, n, a, lda, stride_a, tau, stride_tau, batch_size,
+                        scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void geqrf_batch(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n,
+                                   sycl::buffer<std::complex<float>>& a, std::int64_t lda,
+                                   std::int64_t stride_a, sycl::buffer<std::complex<float>>& tau,
+                                   std::int64_t stride_tau, std::int64_t batch_size,
+                                   sycl::buffer<std::complex<float>>& scratchpad,
+                                   std::int64_t scratchpad_size) {
+    detail::geqrf_batch(ONEMATH_RT_DISPATCH, m, n, a, lda, stride_a, tau, stride_tau, batch_size,
+                        scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void geqrf_batch(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n,
+                                   sycl::buffer<std::complex<double>>& a, std::int64_t lda,
+                                   std::int64_t stride_a, sycl::buffer<std::complex<double>>& tau,
+                                   std::int64_t stride_tau, std::int64_t batch_size,
+                                   sycl::buffer<std::complex<double>>& scratchpad,
+                                   std::int64_t scratchpad_size) {
+    detail::geqrf_batch(ONEMATH_RT_DISPATCH, m, n, a, lda, stride_a, tau, stride_tau, batch_size,
+                        scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void getri_batch(ONEMATH_RT_QUEUE std::int64_t n, sycl::buffer<float>& a,
+                                   std::int64_t lda, std::int64_t stride_a,
+                                   sycl::buffer<std::int64_t>& ipiv, std::int64_t stride_ipiv,
+                                   std::int64_t batch_size, sycl::buffer<float>& scratchpad,
+                                   std::int64_t scratchpad_size) {
+    detail::getri_batch(ONEMATH_RT_DISPATCH, n, a, lda, stride_a, ipiv, stride_ipiv, batch_size,
+                        scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void getri_batch(ONEMATH_RT_QUEUE std::int64_t n, sycl::buffer<double>& a,
+                                   std::int64_t lda, std::int64_t stride_a,
+                                   sycl::buffer<std::int64_t>& ipiv, std::int64_t stride_ipiv,
+                                   std::int64_t batch_size, sycl::buffer<double>& scratchpad,
+                                   std::int64_t scratchpad_size) {
+    detail::getri_batch(ONEMATH_RT_DISPATCH, n, a, lda, stride_a, ipiv, stride_ipiv, batch_size,
+                        scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void getri_batch(ONEMATH_RT_QUEUE std::int64_t n,
+                                   sycl::buffer<std::complex<float>>& a, std::int64_t lda,
+                                   std::int64_t stride_a, sycl::buffer<std::int64_t>& ipiv,
+                                   std::int64_t stride_ipiv, std::int64_t batch_size,
+                                   sycl::buffer<std::complex<float>>& scratchpad,
+                                   std::int64_t scratchpad_size) {
+    detail::getri_batch(ONEMATH_RT_DISPATCH, n, a, lda, stride_a, ipiv, stride_ipiv, batch_size,
+                        scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void getri_batch(ONEMATH_RT_QUEUE std::int64_t n,
+                                   sycl::buffer<std::complex<double>>& a, std::int64_t lda,
+                                   std::int64_t stride_a, sycl::buffer<std::int64_t>& ipiv,
+                                   std::int64_t stride_ipiv, std::int64_t batch_size,
+                                   sycl::buffer<std::complex<double>>& scratchpad,
+                                   std::int64_t scratchpad_size) {
+    detail::getri_batch(ONEMATH_RT_DISPATCH, n, a, lda, stride_a, ipiv, stride_ipiv, batch_size,
+                        scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void getrs_batch(ONEMATH_RT_QUEUE oneapi::math::transpose trans, std::int64_t n,
+                                   std::int64_t nrhs, sycl::buffer<float>& a, std::int64_t lda,
+                                   std::int64_t stride_a, sycl::buffer<std::int64_t>& ipiv,
+                                   std::int64_t stride_ipiv, sycl::buffer<float>& b,
+                                   std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+                                   sycl::buffer<float>& scratchpad, std::int64_t scratchpad_size) {
+    detail::getrs_batch(ONEMATH_RT_DISPATCH, trans, n, nrhs, a, lda, stride_a, ipiv, stride_ipiv, b,
+                        ldb, stride_b, batch_size, scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void getrs_batch(ONEMATH_RT_QUEUE oneapi::math::transpose trans, std::int64_t n,
+                                   std::int64_t nrhs, sycl::buffer<double>& a, std::int64_t lda,
+                                   std::int64_t stride_a, sycl::buffer<std::int64_t>& ipiv,
+                                   std::int64_t stride_ipiv, sycl::buffer<double>& b,
+                                   std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size,
+                                   sycl::buffer<double>& scratchpad, std::int64_t scratchpad_size) {
+    detail::getrs_batch(ONEMATH_RT_DISPATCH, trans, n, nrhs, a, lda, stride_a, ipiv, stride_ipiv, b,
+                        ldb, stride_b, batch_size, scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void getrs_batch(ONEMATH_RT_QUEUE oneapi::math::transpose trans, std::int64_t n,
+                                   std::int64_t nrhs, sycl::buffer<std::complex<float>>& a,
+                                   std::int64_t lda, std::int64_t stride_a,
+                                   sycl::buffer<std::int64_t>& ipiv, std::int64_t stride_ipiv,
+                                   sycl::buffer<std::complex<float>>& b, std::int64_t ldb,
+                                   std::int64_t stride_b, std::int64_t batch_size,
+                                   sycl::buffer<std::complex<float>>& scratchpad,
+                                   std::int64_t scratchpad_size) {
+    detail::getrs_batch(ONEMATH_RT_DISPATCH, trans, n, nrhs, a, lda, stride_a, ipiv, stride_ipiv, b,
+                        ldb, stride_b, batch_size, scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void getrs_batch(ONEMATH_RT_QUEUE oneapi::math::transpose trans, std::int64_t n,
+                                   std::int64_t nrhs, sycl::buffer<std::complex<double>>& a,
+                                   std::int64_t lda, std::int64_t stride_a,
+                                   sycl::buffer<std::int64_t>& ipiv, std::int64_t stride_ipiv,
+                                   sycl::buffer<std::complex<double>>& b, std::int64_t ldb,
+                                   std::int64_t stride_b, std::int64_t batch_size,
+                                   sycl::buffer<std::complex<double>>& scratchpad,
+                                   std::int64_t scratchpad_size) {
+    detail::getrs_batch(ONEMATH_RT_DISPATCH, trans, n, nrhs, a, lda, stride_a, ipiv, stride_ipiv, b,
+                        ldb, stride_b, batch_size, scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void getrf_batch(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n,
+                                   sycl::buffer<float>& a, std::int64_t lda, std::int64_t stride_a,
+                                   sycl::buffer<std::int64_t>& ipiv, std::int64_t stride_ipiv,
+                                   std::int64_t batch_size, sycl::buffer<float>& scratchpad,
+                                   std::int64_t scratchpad_size) {
+    detail::getrf_batch(ONEMATH_RT_DISPATCH, m, n, a, lda, stride_a, ipiv, stride_ipiv, batch_size,
+                        scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void getrf_batch(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n,
+                                   sycl::buffer<double>& a, std::int64_t lda, std::int64_t stride_a,
+                                   sycl::buffer<std::int64_t>& ipiv, std::int64_t stride_ipiv,
+                                   std::int64_t batch_size, sycl::buffer<double>& scratchpad,
+                                   std::int64_t scratchpad_size) {
+    detail::getrf_batch(ONEMATH_RT_DISPATCH, m, n, a, lda, stride_a, ipiv, stride_ipiv, batch_size,
+                        scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void getrf_batch(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n,
+                                   sycl::buffer<std::complex<float>>& a, std::int64_t lda,
+                                   std::int64_t stride_a, sycl::buffer<std::int64_t>& ipiv,
+                                   std::int64_t stride_ipiv, std::int64_t batch_size,
+                                   sycl::buffer<std::complex<float>>& scratchpad,
+                                   std::int64_t scratchpad_size) {
+    detail::getrf_batch(ONEMATH_RT_DISPATCH, m, n, a, lda, stride_a, ipiv, stride_ipiv, batch_size,
+                        scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void getrf_batch(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n,
+                                   sycl::buffer<std::complex<double>>& a, std::int64_t lda,
+                                   std::int64_t stride_a, sycl::buffer<std::int64_t>& ipiv,
+                                   std::int64_t stride_ipiv, std::int64_t batch_size,
+                                   sycl::buffer<std::complex<double>>& scratchpad,
+                                   std::int64_t scratchpad_size) {
+    detail::getrf_batch(ONEMATH_RT_DISPATCH, m, n, a, lda, stride_a, ipiv, stride_ipiv, batch_size,
+                        scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void orgqr_batch(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n, std::int64_t k,
+                                   sycl::buffer<float>& a, std::int64_t lda, std::int64_t stride_a,
+                                   sycl::buffer<float>& tau, std::int64_t stride_tau,
+                                   std::int64_t batch_size, sycl::buffer<float>& scratchpad,
+                                   std::int64_t scratchpad_size) {
+    detail::orgqr_batch(ONEMATH_RT_DISPATCH, m, n, k, a, lda, stride_a, tau, stride_tau, batch_size,
+                        scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void orgqr_batch(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n, std::int64_t k,
+                                   sycl::buffer<double>& a, std::int64_t lda, std::int64_t stride_a,
+                                   sycl::buffer<double>& tau, std::int64_t stride_tau,
+                                   std::int64_t batch_size, sycl::buffer<double>& scratchpad,
+                                   std::int64_t scratchpad_size) {
+    detail::orgqr_batch(ONEMATH_RT_DISPATCH, m, n, k, a, lda, stride_a, tau, stride_tau, batch_size,
+                        scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void potrf_batch(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                                   sycl::buffer<float>& a, std::int64_t lda, std::int64_t stride_a,
+                                   std::int64_t batch_size, sycl::buffer<float>& scratchpad,
+                                   std::int64_t scratchpad_size) {
+    detail::potrf_batch(ONEMATH_RT_DISPATCH, uplo, n, a, lda, stride_a, batch_size, scratchpad,
+                        scratchpad_size);
+}
+ONEMATH_RT_INLINE void potrf_batch(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                                   sycl::buffer<double>& a, std::int64_t lda, std::int64_t stride_a,
+                                   std::int64_t batch_size, sycl::buffer<double>& scratchpad,
+                                   std::int64_t scratchpad_size) {
+    detail::potrf_batch(ONEMATH_RT_DISPATCH, uplo, n, a, lda, stride_a, batch_size, scratchpad,
+                        scratchpad_size);
+}
+ONEMATH_RT_INLINE void potrf_batch(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                                   sycl::buffer<std::complex<float>>& a, std::int64_t lda,
+                                   std::int64_t stride_a, std::int64_t batch_size,
+                                   sycl::buffer<std::complex<float>>& scratchpad,
+                                   std::int64_t scratchpad_size) {
+    detail::potrf_batch(ONEMATH_RT_DISPATCH, uplo, n, a, lda, stride_a, batch_size, scratchpad,
+                        scratchpad_size);
+}
+ONEMATH_RT_INLINE void potrf_batch(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                                   sycl::buffer<std::complex<double>>& a, std::int64_t lda,
+                                   std::int64_t stride_a, std::int64_t batch_size,
+                                   sycl::buffer<std::complex<double>>& scratchpad,
+                                   std::int64_t scratchpad_size) {
+    detail::potrf_batch(ONEMATH_RT_DISPATCH, uplo, n, a, lda, stride_a, batch_size, scratchpad,
+                        scratchpad_size);
+}
+ONEMATH_RT_INLINE void potrs_batch(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                                   std::int64_t nrhs, sycl::buffer<float>& a, std::int64_t lda,
+                                   std::int64_t stride_a, sycl::buffer<float>& b, std::int64_t ldb,
+                                   std::int64_t stride_b, std::int64_t batch_size,
+                                   sycl::buffer<float>& scratchpad, std::int64_t scratchpad_size) {
+    detail::potrs_batch(ONEMATH_RT_DISPATCH, uplo, n, nrhs, a, lda, stride_a, b, ldb, stride_b,
+                        batch_size, scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void potrs_batch(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                                   std::int64_t nrhs, sycl::buffer<double>& a, std::int64_t lda,
+                                   std::int64_t stride_a, sycl::buffer<double>& b, std::int64_t ldb,
+                                   std::int64_t stride_b, std::int64_t batch_size,
+                                   sycl::buffer<double>& scratchpad, std::int64_t scratchpad_size) {
+    detail::potrs_batch(ONEMATH_RT_DISPATCH, uplo, n, nrhs, a, lda, stride_a, b, ldb, stride_b,
+                        batch_size, scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void potrs_batch(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                                   std::int64_t nrhs, sycl::buffer<std::complex<float>>& a,
+                                   std::int64_t lda, std::int64_t stride_a,
+                                   sycl::buffer<std::complex<float>>& b, std::int64_t ldb,
+                                   std::int64_t stride_b, std::int64_t batch_size,
+                                   sycl::buffer<std::complex<float>>& scratchpad,
+                                   std::int64_t scratchpad_size) {
+    detail::potrs_batch(ONEMATH_RT_DISPATCH, uplo, n, nrhs, a, lda, stride_a, b, ldb, stride_b,
+                        batch_size, scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void potrs_batch(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                                   std::int64_t nrhs, sycl::buffer<std::complex<double>>& a,
+                                   std::int64_t lda, std::int64_t stride_a,
+                                   sycl::buffer<std::complex<double>>& b, std::int64_t ldb,
+                                   std::int64_t stride_b, std::int64_t batch_size,
+                                   sycl::buffer<std::complex<double>>& scratchpad,
+                                   std::int64_t scratchpad_size) {
+    detail::potrs_batch(ONEMATH_RT_DISPATCH, uplo, n, nrhs, a, lda, stride_a, b, ldb, stride_b,
+                        batch_size, scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void ungqr_batch(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n, std::int64_t k,
+                                   sycl::buffer<std::complex<float>>& a, std::int64_t lda,
+                                   std::int64_t stride_a, sycl::buffer<std::complex<float>>& tau,
+                                   std::int64_t stride_tau, std::int64_t batch_size,
+                                   sycl::buffer<std::complex<float>>& scratchpad,
+                                   std::int64_t scratchpad_size) {
+    detail::ungqr_batch(ONEMATH_RT_DISPATCH, m, n, k, a, lda, stride_a, tau, stride_tau, batch_size,
+                        scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE void ungqr_batch(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n, std::int64_t k,
+                                   sycl::buffer<std::complex<double>>& a, std::int64_t lda,
+                                   std::int64_t stride_a, sycl::buffer<std::complex<double>>& tau,
+                                   std::int64_t stride_tau, std::int64_t batch_size,
+                                   sycl::buffer<std::complex<double>>& scratchpad,
+                                   std::int64_t scratchpad_size) {
+    detail::ungqr_batch(ONEMATH_RT_DISPATCH, m, n, k, a, lda, stride_a, tau, stride_tau, batch_size,
+                        scratchpad, scratchpad_size);
+}
+ONEMATH_RT_INLINE sycl::event gebrd(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n,
+                                    std::complex<float>* a, std::int64_t lda, float* d, float* e,
+                                    std::complex<float>* tauq, std::complex<float>* taup,
+                                    std::complex<float>* scratchpad, std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::gebrd(ONEMATH_RT_DISPATCH, m, n, a, lda, d, e, tauq, taup, scratchpad,
+                         scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event gebrd(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n, double* a,
+                                    std::int64_t lda, double* d, double* e, double* tauq,
+                                    double* taup, double* scratchpad, std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::gebrd(ONEMATH_RT_DISPATCH, m, n, a, lda, d, e, tauq, taup, scratchpad,
+                         scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event gebrd(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n, float* a,
+                                    std::int64_t lda, float* d, float* e, float* tauq, float* taup,
+                                    float* scratchpad, std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::gebrd(ONEMATH_RT_DISPATCH, m, n, a, lda, d, e, tauq, taup, scratchpad,
+                         scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event gebrd(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n,
+                                    std::complex<double>* a, std::int64_t lda, double* d, double* e,
+                                    std::complex<double>* tauq, std::complex<double>* taup,
+                                    std::complex<double>* scratchpad, std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::gebrd(ONEMATH_RT_DISPATCH, m, n, a, lda, d, e, tauq, taup, scratchpad,
+                         scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event gerqf(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n, float* a,
+                                    std::int64_t lda, float* tau, float* scratchpad,
+                                    std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::gerqf(ONEMATH_RT_DISPATCH, m, n, a, lda, tau, scratchpad, scratchpad_size,
+                         dependencies);
+}
+ONEMATH_RT_INLINE sycl::event gerqf(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n, double* a,
+                                    std::int64_t lda, double* tau, double* scratchpad,
+                                    std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::gerqf(ONEMATH_RT_DISPATCH, m, n, a, lda, tau, scratchpad, scratchpad_size,
+                         dependencies);
+}
+ONEMATH_RT_INLINE sycl::event gerqf(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n,
+                                    std::complex<float>* a, std::int64_t lda,
+                                    std::complex<float>* tau, std::complex<float>* scratchpad,
+                                    std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::gerqf(ONEMATH_RT_DISPATCH, m, n, a, lda, tau, scratchpad, scratchpad_size,
+                         dependencies);
+}
+ONEMATH_RT_INLINE sycl::event gerqf(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n,
+                                    std::complex<double>* a, std::int64_t lda,
+                                    std::complex<double>* tau, std::complex<double>* scratchpad,
+                                    std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::gerqf(ONEMATH_RT_DISPATCH, m, n, a, lda, tau, scratchpad, scratchpad_size,
+                         dependencies);
+}
+ONEMATH_RT_INLINE sycl::event geqrf(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n,
+                                    std::complex<float>* a, std::int64_t lda,
+                                    std::complex<float>* tau, std::complex<float>* scratchpad,
+                                    std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::geqrf(ONEMATH_RT_DISPATCH, m, n, a, lda, tau, scratchpad, scratchpad_size,
+                         dependencies);
+}
+ONEMATH_RT_INLINE sycl::event geqrf(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n, double* a,
+                                    std::int64_t lda, double* tau, double* scratchpad,
+                                    std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::geqrf(ONEMATH_RT_DISPATCH, m, n, a, lda, tau, scratchpad, scratchpad_size,
+                         dependencies);
+}
+ONEMATH_RT_INLINE sycl::event geqrf(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n, float* a,
+                                    std::int64_t lda, float* tau, float* scratchpad,
+                                    std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::geqrf(ONEMATH_RT_DISPATCH, m, n, a, lda, tau, scratchpad, scratchpad_size,
+                         dependencies);
+}
+ONEMATH_RT_INLINE sycl::event geqrf(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n,
+                                    std::complex<double>* a, std::int64_t lda,
+                                    std::complex<double>* tau, std::complex<double>* scratchpad,
+                                    std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::geqrf(ONEMATH_RT_DISPATCH, m, n, a, lda, tau, scratchpad, scratchpad_size,
+                         dependencies);
+}
+ONEMATH_RT_INLINE sycl::event getrf(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n,
+                                    std::complex<float>* a, std::int64_t lda, std::int64_t* ipiv,
+                                    std::complex<float>* scratchpad, std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::getrf(ONEMATH_RT_DISPATCH, m, n, a, lda, ipiv, scratchpad, scratchpad_size,
+                         dependencies);
+}
+ONEMATH_RT_INLINE sycl::event getrf(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n, double* a,
+                                    std::int64_t lda, std::int64_t* ipiv, double* scratchpad,
+                                    std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::getrf(ONEMATH_RT_DISPATCH, m, n, a, lda, ipiv, scratchpad, scratchpad_size,
+                         dependencies);
+}
+ONEMATH_RT_INLINE sycl::event getrf(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n, float* a,
+                                    std::int64_t lda, std::int64_t* ipiv, float* scratchpad,
+                                    std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::getrf(ONEMATH_RT_DISPATCH, m, n, a, lda, ipiv, scratchpad, scratchpad_size,
+                         dependencies);
+}
+ONEMATH_RT_INLINE sycl::event getrf(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n,
+                                    std::complex<double>* a, std::int64_t lda, std::int64_t* ipiv,
+                                    std::complex<double>* scratchpad, std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::getrf(ONEMATH_RT_DISPATCH, m, n, a, lda, ipiv, scratchpad, scratchpad_size,
+                         dependencies);
+}
+ONEMATH_RT_INLINE sycl::event getri(ONEMATH_RT_QUEUE std::int64_t n, std::complex<float>* a,
+                                    std::int64_t lda, std::int64_t* ipiv,
+                                    std::complex<float>* scratchpad, std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::getri(ONEMATH_RT_DISPATCH, n, a, lda, ipiv, scratchpad, scratchpad_size,
+                         dependencies);
+}
+ONEMATH_RT_INLINE sycl::event getri(ONEMATH_RT_QUEUE std::int64_t n, double* a, std::int64_t lda,
+                                    std::int64_t* ipiv, double* scratchpad,
+                                    std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::getri(ONEMATH_RT_DISPATCH, n, a, lda, ipiv, scratchpad, scratchpad_size,
+                         dependencies);
+}
+ONEMATH_RT_INLINE sycl::event getri(ONEMATH_RT_QUEUE std::int64_t n, float* a, std::int64_t lda,
+                                    std::int64_t* ipiv, float* scratchpad,
+                                    std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::getri(ONEMATH_RT_DISPATCH, n, a, lda, ipiv, scratchpad, scratchpad_size,
+                         dependencies);
+}
+ONEMATH_RT_INLINE sycl::event getri(ONEMATH_RT_QUEUE std::int64_t n, std::complex<double>* a,
+                                    std::int64_t lda, std::int64_t* ipiv,
+                                    std::complex<double>* scratchpad, std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::getri(ONEMATH_RT_DISPATCH, n, a, lda, ipiv, scratchpad, scratchpad_size,
+                         dependencies);
+}
+ONEMATH_RT_INLINE sycl::event getrs(ONEMATH_RT_QUEUE oneapi::math::transpose trans, std::int64_t n,
+                                    std::int64_t nrhs, std::complex<float>* a, std::int64_t lda,
+                                    std::int64_t* ipiv, std::complex<float>* b, std::int64_t ldb,
+                                    std::complex<float>* scratchpad, std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::getrs(ONEMATH_RT_DISPATCH, trans, n, nrhs, a, lda, ipiv, b, ldb, scratchpad,
+                         scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event getrs(ONEMATH_RT_QUEUE oneapi::math::transpose trans, std::int64_t n,
+                                    std::int64_t nrhs, double* a, std::int64_t lda,
+                                    std::int64_t* ipiv, double* b, std::int64_t ldb,
+                                    double* scratchpad, std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::getrs(ONEMATH_RT_DISPATCH, trans, n, nrhs, a, lda, ipiv, b, ldb, scratchpad,
+                         scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event getrs(ONEMATH_RT_QUEUE oneapi::math::transpose trans, std::int64_t n,
+                                    std::int64_t nrhs, float* a, std::int64_t lda,
+                                    std::int64_t* ipiv, float* b, std::int64_t ldb,
+                                    float* scratchpad, std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::getrs(ONEMATH_RT_DISPATCH, trans, n, nrhs, a, lda, ipiv, b, ldb, scratchpad,
+                         scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event getrs(ONEMATH_RT_QUEUE oneapi::math::transpose trans, std::int64_t n,
+                                    std::int64_t nrhs, std::complex<double>* a, std::int64_t lda,
+                                    std::int64_t* ipiv, std::complex<double>* b, std::int64_t ldb,
+                                    std::complex<double>* scratchpad, std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::getrs(ONEMATH_RT_DISPATCH, trans, n, nrhs, a, lda, ipiv, b, ldb, scratchpad,
+                         scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event gesvd(ONEMATH_RT_QUEUE oneapi::math::jobsvd jobu,
+                                    oneapi::math::jobsvd jobvt, std::int64_t m, std::int64_t n,
+                                    double* a, std::int64_t lda, double* s, double* u,
+                                    std::int64_t ldu, double* vt, std::int64_t ldvt,
+                                    double* scratchpad, std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::gesvd(ONEMATH_RT_DISPATCH, jobu, jobvt, m, n, a, lda, s, u, ldu, vt, ldvt,
+                         scratchpad, scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event gesvd(ONEMATH_RT_QUEUE oneapi::math::jobsvd jobu,
+                                    oneapi::math::jobsvd jobvt, std::int64_t m, std::int64_t n,
+                                    float* a, std::int64_t lda, float* s, float* u,
+                                    std::int64_t ldu, float* vt, std::int64_t ldvt,
+                                    float* scratchpad, std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::gesvd(ONEMATH_RT_DISPATCH, jobu, jobvt, m, n, a, lda, s, u, ldu, vt, ldvt,
+                         scratchpad, scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event gesvd(ONEMATH_RT_QUEUE oneapi::math::jobsvd jobu,
+                                    oneapi::math::jobsvd jobvt, std::int64_t m, std::int64_t n,
+                                    std::complex<float>* a, std::int64_t lda, float* s,
+                                    std::complex<float>* u, std::int64_t ldu,
+                                    std::complex<float>* vt, std::int64_t ldvt,
+                                    std::complex<float>* scratchpad, std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::gesvd(ONEMATH_RT_DISPATCH, jobu, jobvt, m, n, a, lda, s, u, ldu, vt, ldvt,
+                         scratchpad, scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event gesvd(ONEMATH_RT_QUEUE oneapi::math::jobsvd jobu,
+                                    oneapi::math::jobsvd jobvt, std::int64_t m, std::int64_t n,
+                                    std::complex<double>* a, std::int64_t lda, double* s,
+                                    std::complex<double>* u, std::int64_t ldu,
+                                    std::complex<double>* vt, std::int64_t ldvt,
+                                    std::complex<double>* scratchpad, std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::gesvd(ONEMATH_RT_DISPATCH, jobu, jobvt, m, n, a, lda, s, u, ldu, vt, ldvt,
+                         scratchpad, scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event heevd(ONEMATH_RT_QUEUE oneapi::math::job jobz,
+                                    oneapi::math::uplo uplo, std::int64_t n, std::complex<float>* a,
+                                    std::int64_t lda, float* w, std::complex<float>* scratchpad,
+                                    std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::heevd(ONEMATH_RT_DISPATCH, jobz, uplo, n, a, lda, w, scratchpad, scratchpad_size,
+                         dependencies);
+}
+ONEMATH_RT_INLINE sycl::event heevd(ONEMATH_RT_QUEUE oneapi::math::job jobz,
+                                    oneapi::math::uplo uplo, std::int64_t n,
+                                    std::complex<double>* a, std::int64_t lda, double* w,
+                                    std::complex<double>* scratchpad, std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::heevd(ONEMATH_RT_DISPATCH, jobz, uplo, n, a, lda, w, scratchpad, scratchpad_size,
+                         dependencies);
+}
+ONEMATH_RT_INLINE sycl::event hegvd(ONEMATH_RT_QUEUE std::int64_t itype, oneapi::math::job jobz,
+                                    oneapi::math::uplo uplo, std::int64_t n, std::complex<float>* a,
+                                    std::int64_t lda, std::complex<float>* b, std::int64_t ldb,
+                                    float* w, std::complex<float>* scratchpad,
+                                    std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::hegvd(ONEMATH_RT_DISPATCH, itype, jobz, uplo, n, a, lda, b, ldb, w, scratchpad,
+                         scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event hegvd(ONEMATH_RT_QUEUE std::int64_t itype, oneapi::math::job jobz,
+                                    oneapi::math::uplo uplo, std::int64_t n,
+                                    std::complex<double>* a, std::int64_t lda,
+                                    std::complex<double>* b, std::int64_t ldb, double* w,
+                                    std::complex<double>* scratchpad, std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::hegvd(ONEMATH_RT_DISPATCH, itype, jobz, uplo, n, a, lda, b, ldb, w, scratchpad,
+                         scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event hetrd(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                                    std::complex<float>* a, std::int64_t lda, float* d, float* e,
+                                    std::complex<float>* tau, std::complex<float>* scratchpad,
+                                    std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::hetrd(ONEMATH_RT_DISPATCH, uplo, n, a, lda, d, e, tau, scratchpad,
+                         scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event hetrd(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                                    std::complex<double>* a, std::int64_t lda, double* d, double* e,
+                                    std::complex<double>* tau, std::complex<double>* scratchpad,
+                                    std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::hetrd(ONEMATH_RT_DISPATCH, uplo, n, a, lda, d, e, tau, scratchpad,
+                         scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event hetrf(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                                    std::complex<float>* a, std::int64_t lda, std::int64_t* ipiv,
+                                    std::complex<float>* scratchpad, std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::hetrf(ONEMATH_RT_DISPATCH, uplo, n, a, lda, ipiv, scratchpad, scratchpad_size,
+                         dependencies);
+}
+ONEMATH_RT_INLINE sycl::event hetrf(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                                    std::complex<double>* a, std::int64_t lda, std::int64_t* ipiv,
+                                    std::complex<double>* scratchpad, std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::hetrf(ONEMATH_RT_DISPATCH, uplo, n, a, lda, ipiv, scratchpad, scratchpad_size,
+                         dependencies);
+}
+ONEMATH_RT_INLINE sycl::event orgbr(ONEMATH_RT_QUEUE oneapi::math::generate vec, std::int64_t m,
+                                    std::int64_t n, std::int64_t k, float* a, std::int64_t lda,
+                                    float* tau, float* scratchpad, std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::orgbr(ONEMATH_RT_DISPATCH, vec, m, n, k, a, lda, tau, scratchpad,
+                         scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event orgbr(ONEMATH_RT_QUEUE oneapi::math::generate vec, std::int64_t m,
+                                    std::int64_t n, std::int64_t k, double* a, std::int64_t lda,
+                                    double* tau, double* scratchpad, std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::orgbr(ONEMATH_RT_DISPATCH, vec, m, n, k, a, lda, tau, scratchpad,
+                         scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event orgqr(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n, std::int64_t k,
+                                    double* a, std::int64_t lda, double* tau, double* scratchpad,
+                                    std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::orgqr(ONEMATH_RT_DISPATCH, m, n, k, a, lda, tau, scratchpad, scratchpad_size,
+                         dependencies);
+}
+ONEMATH_RT_INLINE sycl::event orgqr(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n, std::int64_t k,
+                                    float* a, std::int64_t lda, float* tau, float* scratchpad,
+                                    std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::orgqr(ONEMATH_RT_DISPATCH, m, n, k, a, lda, tau, scratchpad, scratchpad_size,
+                         dependencies);
+}
+ONEMATH_RT_INLINE sycl::event orgtr(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                                    float* a, std::int64_t lda, float* tau, float* scratchpad,
+                                    std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::orgtr(ONEMATH_RT_DISPATCH, uplo, n, a, lda, tau, scratchpad, scratchpad_size,
+                         dependencies);
+}
+ONEMATH_RT_INLINE sycl::event orgtr(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                                    double* a, std::int64_t lda, double* tau, double* scratchpad,
+                                    std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::orgtr(ONEMATH_RT_DISPATCH, uplo, n, a, lda, tau, scratchpad, scratchpad_size,
+                         dependencies);
+}
+ONEMATH_RT_INLINE sycl::event ormtr(ONEMATH_RT_QUEUE oneapi::math::side side,
+                                    oneapi::math::uplo uplo, oneapi::math::transpose trans,
+                                    std::int64_t m, std::int64_t n, float* a, std::int64_t lda,
+                                    float* tau, float* c, std::int64_t ldc, float* scratchpad,
+                                    std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::ormtr(ONEMATH_RT_DISPATCH, side, uplo, trans, m, n, a, lda, tau, c, ldc,
+                         scratchpad, scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event ormtr(ONEMATH_RT_QUEUE oneapi::math::side side,
+                                    oneapi::math::uplo uplo, oneapi::math::transpose trans,
+                                    std::int64_t m, std::int64_t n, double* a, std::int64_t lda,
+                                    double* tau, double* c, std::int64_t ldc, double* scratchpad,
+                                    std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::ormtr(ONEMATH_RT_DISPATCH, side, uplo, trans, m, n, a, lda, tau, c, ldc,
+                         scratchpad, scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event ormrq(ONEMATH_RT_QUEUE oneapi::math::side side,
+                                    oneapi::math::transpose trans, std::int64_t m, std::int64_t n,
+                                    std::int64_t k, float* a, std::int64_t lda, float* tau,
+                                    float* c, std::int64_t ldc, float* scratchpad,
+                                    std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::ormrq(ONEMATH_RT_DISPATCH, side, trans, m, n, k, a, lda, tau, c, ldc, scratchpad,
+                         scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event ormrq(ONEMATH_RT_QUEUE oneapi::math::side side,
+                                    oneapi::math::transpose trans, std::int64_t m, std::int64_t n,
+                                    std::int64_t k, double* a, std::int64_t lda, double* tau,
+                                    double* c, std::int64_t ldc, double* scratchpad,
+                                    std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::ormrq(ONEMATH_RT_DISPATCH, side, trans, m, n, k, a, lda, tau, c, ldc, scratchpad,
+                         scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event ormqr(ONEMATH_RT_QUEUE oneapi::math::side side,
+                                    oneapi::math::transpose trans, std::int64_t m, std::int64_t n,
+                                    std::int64_t k, double* a, std::int64_t lda, double* tau,
+                                    double* c, std::int64_t ldc, double* scratchpad,
+                                    std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::ormqr(ONEMATH_RT_DISPATCH, side, trans, m, n, k, a, lda, tau, c, ldc, scratchpad,
+                         scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event ormqr(ONEMATH_RT_QUEUE oneapi::math::side side,
+                                    oneapi::math::transpose trans, std::int64_t m, std::int64_t n,
+                                    std::int64_t k, float* a, std::int64_t lda, float* tau,
+                                    float* c, std::int64_t ldc, float* scratchpad,
+                                    std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::ormqr(ONEMATH_RT_DISPATCH, side, trans, m, n, k, a, lda, tau, c, ldc, scratchpad,
+                         scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event potrf(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                                    float* a, std::int64_t lda, float* scratchpad,
+                                    std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::potrf(ONEMATH_RT_DISPATCH, uplo, n, a, lda, scratchpad, scratchpad_size,
+                         dependencies);
+}
+ONEMATH_RT_INLINE sycl::event potrf(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                                    double* a, std::int64_t lda, double* scratchpad,
+                                    std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::potrf(ONEMATH_RT_DISPATCH, uplo, n, a, lda, scratchpad, scratchpad_size,
+                         dependencies);
+}
+ONEMATH_RT_INLINE sycl::event potrf(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                                    std::complex<float>* a, std::int64_t lda,
+                                    std::complex<float>* scratchpad, std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::potrf(ONEMATH_RT_DISPATCH, uplo, n, a, lda, scratchpad, scratchpad_size,
+                         dependencies);
+}
+ONEMATH_RT_INLINE sycl::event potrf(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                                    std::complex<double>* a, std::int64_t lda,
+                                    std::complex<double>* scratchpad, std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::potrf(ONEMATH_RT_DISPATCH, uplo, n, a, lda, scratchpad, scratchpad_size,
+                         dependencies);
+}
+ONEMATH_RT_INLINE sycl::event potri(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                                    float* a, std::int64_t lda, float* scratchpad,
+                                    std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::potri(ONEMATH_RT_DISPATCH, uplo, n, a, lda, scratchpad, scratchpad_size,
+                         dependencies);
+}
+ONEMATH_RT_INLINE sycl::event potri(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                                    double* a, std::int64_t lda, double* scratchpad,
+                                    std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::potri(ONEMATH_RT_DISPATCH, uplo, n, a, lda, scratchpad, scratchpad_size,
+                         dependencies);
+}
+ONEMATH_RT_INLINE sycl::event potri(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                                    std::complex<float>* a, std::int64_t lda,
+                                    std::complex<float>* scratchpad, std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::potri(ONEMATH_RT_DISPATCH, uplo, n, a, lda, scratchpad, scratchpad_size,
+                         dependencies);
+}
+ONEMATH_RT_INLINE sycl::event potri(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                                    std::complex<double>* a, std::int64_t lda,
+                                    std::complex<double>* scratchpad, std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::potri(ONEMATH_RT_DISPATCH, uplo, n, a, lda, scratchpad, scratchpad_size,
+                         dependencies);
+}
+ONEMATH_RT_INLINE sycl::event potrs(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                                    std::int64_t nrhs, float* a, std::int64_t lda, float* b,
+                                    std::int64_t ldb, float* scratchpad,
+                                    std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::potrs(ONEMATH_RT_DISPATCH, uplo, n, nrhs, a, lda, b, ldb, scratchpad,
+                         scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event potrs(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                                    std::int64_t nrhs, double* a, std::int64_t lda, double* b,
+                                    std::int64_t ldb, double* scratchpad,
+                                    std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::potrs(ONEMATH_RT_DISPATCH, uplo, n, nrhs, a, lda, b, ldb, scratchpad,
+                         scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event potrs(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                                    std::int64_t nrhs, std::complex<float>* a, std::int64_t lda,
+                                    std::complex<float>* b, std::int64_t ldb,
+                                    std::complex<float>* scratchpad, std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::potrs(ONEMATH_RT_DISPATCH, uplo, n, nrhs, a, lda, b, ldb, scratchpad,
+                         scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event potrs(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                                    std::int64_t nrhs, std::complex<double>* a, std::int64_t lda,
+                                    std::complex<double>* b, std::int64_t ldb,
+                                    std::complex<double>* scratchpad, std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::potrs(ONEMATH_RT_DISPATCH, uplo, n, nrhs, a, lda, b, ldb, scratchpad,
+                         scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event syevd(ONEMATH_RT_QUEUE oneapi::math::job jobz,
+                                    oneapi::math::uplo uplo, std::int64_t n, double* a,
+                                    std::int64_t lda, double* w, double* scratchpad,
+                                    std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::syevd(ONEMATH_RT_DISPATCH, jobz, uplo, n, a, lda, w, scratchpad, scratchpad_size,
+                         dependencies);
+}
+ONEMATH_RT_INLINE sycl::event syevd(ONEMATH_RT_QUEUE oneapi::math::job jobz,
+                                    oneapi::math::uplo uplo, std::int64_t n, float* a,
+                                    std::int64_t lda, float* w, float* scratchpad,
+                                    std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::syevd(ONEMATH_RT_DISPATCH, jobz, uplo, n, a, lda, w, scratchpad, scratchpad_size,
+                         dependencies);
+}
+ONEMATH_RT_INLINE sycl::event sygvd(ONEMATH_RT_QUEUE std::int64_t itype, oneapi::math::job jobz,
+                                    oneapi::math::uplo uplo, std::int64_t n, double* a,
+                                    std::int64_t lda, double* b, std::int64_t ldb, double* w,
+                                    double* scratchpad, std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::sygvd(ONEMATH_RT_DISPATCH, itype, jobz, uplo, n, a, lda, b, ldb, w, scratchpad,
+                         scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event sygvd(ONEMATH_RT_QUEUE std::int64_t itype, oneapi::math::job jobz,
+                                    oneapi::math::uplo uplo, std::int64_t n, float* a,
+                                    std::int64_t lda, float* b, std::int64_t ldb, float* w,
+                                    float* scratchpad, std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::sygvd(ONEMATH_RT_DISPATCH, itype, jobz, uplo, n, a, lda, b, ldb, w, scratchpad,
+                         scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event sytrd(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                                    double* a, std::int64_t lda, double* d, double* e, double* tau,
+                                    double* scratchpad, std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::sytrd(ONEMATH_RT_DISPATCH, uplo, n, a, lda, d, e, tau, scratchpad,
+                         scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event sytrd(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                                    float* a, std::int64_t lda, float* d, float* e, float* tau,
+                                    float* scratchpad, std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::sytrd(ONEMATH_RT_DISPATCH, uplo, n, a, lda, d, e, tau, scratchpad,
+                         scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event sytrf(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                                    float* a, std::int64_t lda, std::int64_t* ipiv,
+                                    float* scratchpad, std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::sytrf(ONEMATH_RT_DISPATCH, uplo, n, a, lda, ipiv, scratchpad, scratchpad_size,
+                         dependencies);
+}
+ONEMATH_RT_INLINE sycl::event sytrf(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                                    double* a, std::int64_t lda, std::int64_t* ipiv,
+                                    double* scratchpad, std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::sytrf(ONEMATH_RT_DISPATCH, uplo, n, a, lda, ipiv, scratchpad, scratchpad_size,
+                         dependencies);
+}
+ONEMATH_RT_INLINE sycl::event sytrf(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                                    std::complex<float>* a, std::int64_t lda, std::int64_t* ipiv,
+                                    std::complex<float>* scratchpad, std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::sytrf(ONEMATH_RT_DISPATCH, uplo, n, a, lda, ipiv, scratchpad, scratchpad_size,
+                         dependencies);
+}
+ONEMATH_RT_INLINE sycl::event sytrf(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                                    std::complex<double>* a, std::int64_t lda, std::int64_t* ipiv,
+                                    std::complex<double>* scratchpad, std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::sytrf(ONEMATH_RT_DISPATCH, uplo, n, a, lda, ipiv, scratchpad, scratchpad_size,
+                         dependencies);
+}
+ONEMATH_RT_INLINE sycl::event trtrs(ONEMATH_RT_QUEUE oneapi::math::uplo uplo,
+                                    oneapi::math::transpose trans, oneapi::math::diag diag,
+                                    std::int64_t n, std::int64_t nrhs, std::complex<float>* a,
+                                    std::int64_t lda, std::complex<float>* b, std::int64_t ldb,
+                                    std::complex<float>* scratchpad, std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::trtrs(ONEMATH_RT_DISPATCH, uplo, trans, diag, n, nrhs, a, lda, b, ldb,
+                         scratchpad, scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event trtrs(ONEMATH_RT_QUEUE oneapi::math::uplo uplo,
+                                    oneapi::math::transpose trans, oneapi::math::diag diag,
+                                    std::int64_t n, std::int64_t nrhs, double* a, std::int64_t lda,
+                                    double* b, std::int64_t ldb, double* scratchpad,
+                                    std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::trtrs(ONEMATH_RT_DISPATCH, uplo, trans, diag, n, nrhs, a, lda, b, ldb,
+                         scratchpad, scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event trtrs(ONEMATH_RT_QUEUE oneapi::math::uplo uplo,
+                                    oneapi::math::transpose trans, oneapi::math::diag diag,
+                                    std::int64_t n, std::int64_t nrhs, float* a, std::int64_t lda,
+                                    float* b, std::int64_t ldb, float* scratchpad,
+                                    std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::trtrs(ONEMATH_RT_DISPATCH, uplo, trans, diag, n, nrhs, a, lda, b, ldb,
+                         scratchpad, scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event trtrs(ONEMATH_RT_QUEUE oneapi::math::uplo uplo,
+                                    oneapi::math::transpose trans, oneapi::math::diag diag,
+                                    std::int64_t n, std::int64_t nrhs, std::complex<double>* a,
+                                    std::int64_t lda, std::complex<double>* b, std::int64_t ldb,
+                                    std::complex<double>* scratchpad, std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::trtrs(ONEMATH_RT_DISPATCH, uplo, trans, diag, n, nrhs, a, lda, b, ldb,
+                         scratchpad, scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event ungbr(ONEMATH_RT_QUEUE oneapi::math::generate vec, std::int64_t m,
+                                    std::int64_t n, std::int64_t k, std::complex<float>* a,
+                                    std::int64_t lda, std::complex<float>* tau,
+                                    std::complex<float>* scratchpad, std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::ungbr(ONEMATH_RT_DISPATCH, vec, m, n, k, a, lda, tau, scratchpad,
+                         scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event ungbr(ONEMATH_RT_QUEUE oneapi::math::generate vec, std::int64_t m,
+                                    std::int64_t n, std::int64_t k, std::complex<double>* a,
+                                    std::int64_t lda, std::complex<double>* tau,
+                                    std::complex<double>* scratchpad, std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::ungbr(ONEMATH_RT_DISPATCH, vec, m, n, k, a, lda, tau, scratchpad,
+                         scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event ungqr(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n, std::int64_t k,
+                                    std::complex<float>* a, std::int64_t lda,
+                                    std::complex<float>* tau, std::complex<float>* scratchpad,
+                                    std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::ungqr(ONEMATH_RT_DISPATCH, m, n, k, a, lda, tau, scratchpad, scratchpad_size,
+                         dependencies);
+}
+ONEMATH_RT_INLINE sycl::event ungqr(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n, std::int64_t k,
+                                    std::complex<double>* a, std::int64_t lda,
+                                    std::complex<double>* tau, std::complex<double>* scratchpad,
+                                    std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::ungqr(ONEMATH_RT_DISPATCH, m, n, k, a, lda, tau, scratchpad, scratchpad_size,
+                         dependencies);
+}
+ONEMATH_RT_INLINE sycl::event ungtr(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                                    std::complex<float>* a, std::int64_t lda,
+                                    std::complex<float>* tau, std::complex<float>* scratchpad,
+                                    std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::ungtr(ONEMATH_RT_DISPATCH, uplo, n, a, lda, tau, scratchpad, scratchpad_size,
+                         dependencies);
+}
+ONEMATH_RT_INLINE sycl::event ungtr(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                                    std::complex<double>* a, std::int64_t lda,
+                                    std::complex<double>* tau, std::complex<double>* scratchpad,
+                                    std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::ungtr(ONEMATH_RT_DISPATCH, uplo, n, a, lda, tau, scratchpad, scratchpad_size,
+                         dependencies);
+}
+ONEMATH_RT_INLINE sycl::event unmrq(ONEMATH_RT_QUEUE oneapi::math::side side,
+                                    oneapi::math::transpose trans, std::int64_t m, std::int64_t n,
+                                    std::int64_t k, std::complex<float>* a, std::int64_t lda,
+                                    std::complex<float>* tau, std::complex<float>* c,
+                                    std::int64_t ldc, std::complex<float>* scratchpad,
+                                    std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::unmrq(ONEMATH_RT_DISPATCH, side, trans, m, n, k, a, lda, tau, c, ldc, scratchpad,
+                         scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event unmrq(ONEMATH_RT_QUEUE oneapi::math::side side,
+                                    oneapi::math::transpose trans, std::int64_t m, std::int64_t n,
+                                    std::int64_t k, std::complex<double>* a, std::int64_t lda,
+                                    std::complex<double>* tau, std::complex<double>* c,
+                                    std::int64_t ldc, std::complex<double>* scratchpad,
+                                    std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::unmrq(ONEMATH_RT_DISPATCH, side, trans, m, n, k, a, lda, tau, c, ldc, scratchpad,
+                         scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event unmqr(ONEMATH_RT_QUEUE oneapi::math::side side,
+                                    oneapi::math::transpose trans, std::int64_t m, std::int64_t n,
+                                    std::int64_t k, std::complex<float>* a, std::int64_t lda,
+                                    std::complex<float>* tau, std::complex<float>* c,
+                                    std::int64_t ldc, std::complex<float>* scratchpad,
+                                    std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::unmqr(ONEMATH_RT_DISPATCH, side, trans, m, n, k, a, lda, tau, c, ldc, scratchpad,
+                         scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event unmqr(ONEMATH_RT_QUEUE oneapi::math::side side,
+                                    oneapi::math::transpose trans, std::int64_t m, std::int64_t n,
+                                    std::int64_t k, std::complex<double>* a, std::int64_t lda,
+                                    std::complex<double>* tau, std::complex<double>* c,
+                                    std::int64_t ldc, std::complex<double>* scratchpad,
+                                    std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::unmqr(ONEMATH_RT_DISPATCH, side, trans, m, n, k, a, lda, tau, c, ldc, scratchpad,
+                         scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event unmtr(ONEMATH_RT_QUEUE oneapi::math::side side,
+                                    oneapi::math::uplo uplo, oneapi::math::transpose trans,
+                                    std::int64_t m, std::int64_t n, std::complex<float>* a,
+                                    std::int64_t lda, std::complex<float>* tau,
+                                    std::complex<float>* c, std::int64_t ldc,
+                                    std::complex<float>* scratchpad, std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::unmtr(ONEMATH_RT_DISPATCH, side, uplo, trans, m, n, a, lda, tau, c, ldc,
+                         scratchpad, scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event unmtr(ONEMATH_RT_QUEUE oneapi::math::side side,
+                                    oneapi::math::uplo uplo, oneapi::math::transpose trans,
+                                    std::int64_t m, std::int64_t n, std::complex<double>* a,
+                                    std::int64_t lda, std::complex<double>* tau,
+                                    std::complex<double>* c, std::int64_t ldc,
+                                    std::complex<double>* scratchpad, std::int64_t scratchpad_size,
+                                    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::unmtr(ONEMATH_RT_DISPATCH, side, uplo, trans, m, n, a, lda, tau, c, ldc,
+                         scratchpad, scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event geqrf_batch(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n, float* a,
+                                          std::int64_t lda, std::int64_t stride_a, float* tau,
+                                          std::int64_t stride_tau, std::int64_t batch_size,
+                                          float* scratchpad, std::int64_t scratchpad_size,
+                                          const std::vector<sycl::event>& dependencies = {}) {
+    return detail::geqrf_batch(ONEMATH_RT_DISPATCH, m, n, a, lda, stride_a, tau, stride_tau,
+                               batch_size, scratchpad, scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event geqrf_batch(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n,
+                                          double* a, std::int64_t lda, std::int64_t stride_a,
+                                          double* tau, std::int64_t stride_tau,
+                                          std::int64_t batch_size, double* scratchpad,
+                                          std::int64_t scratchpad_size,
+                                          const std::vector<sycl::event>& dependencies = {}) {
+    return detail::geqrf_batch(ONEMATH_RT_DISPATCH, m, n, a, lda, stride_a, tau, stride_tau,
+                               batch_size, scratchpad, scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event geqrf_batch(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n,
+                                          std::complex<float>* a, std::int64_t lda,
+                                          std::int64_t stride_a, std::complex<float>* tau,
+                                          std::int64_t stride_tau, std::int64_t batch_size,
+                                          std::complex<float>* scratchpad,
+                                          std::int64_t scratchpad_size,
+                                          const std::vector<sycl::event>& dependencies = {}) {
+    return detail::geqrf_batch(ONEMATH_RT_DISPATCH, m, n, a, lda, stride_a, tau, stride_tau,
+                               batch_size, scratchpad, scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event geqrf_batch(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n,
+                                          std::complex<double>* a, std::int64_t lda,
+                                          std::int64_t stride_a, std::complex<double>* tau,
+                                          std::int64_t stride_tau, std::int64_t batch_size,
+                                          std::complex<double>* scratchpad,
+                                          std::int64_t scratchpad_size,
+                                          const std::vector<sycl::event>& dependencies = {}) {
+    return detail::geqrf_batch(ONEMATH_RT_DISPATCH, m, n, a, lda, stride_a, tau, stride_tau,
+                               batch_size, scratchpad, scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event geqrf_batch(ONEMATH_RT_QUEUE std::int64_t* m, std::int64_t* n,
+                                          float** a, std::int64_t* lda, float** tau,
+                                          std::int64_t group_count, std::int64_t* group_sizes,
+                                          float* scratchpad, std::int64_t scratchpad_size,
+                                          const std::vector<sycl::event>& dependencies = {}) {
+    return detail::geqrf_batch(ONEMATH_RT_DISPATCH, m, n, a, lda, tau, group_count, group_sizes,
+                               scratchpad, scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event geqrf_batch(ONEMATH_RT_QUEUE std::int64_t* m, std::int64_t* n,
+                                          double** a, std::int64_t* lda, double** tau,
+                                          std::int64_t group_count, std::int64_t* group_sizes,
+                                          double* scratchpad, std::int64_t scratchpad_size,
+                                          const std::vector<sycl::event>& dependencies = {}) {
+    return detail::geqrf_batch(ONEMATH_RT_DISPATCH, m, n, a, lda, tau, group_count, group_sizes,
+                               scratchpad, scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event geqrf_batch(ONEMATH_RT_QUEUE std::int64_t* m, std::int64_t* n,
+                                          std::complex<float>** a, std::int64_t* lda,
+                                          std::complex<float>** tau, std::int64_t group_count,
+                                          std::int64_t* group_sizes,
+                                          std::complex<float>* scratchpad,
+                                          std::int64_t scratchpad_size,
+                                          const std::vector<sycl::event>& dependencies = {}) {
+    return detail::geqrf_batch(ONEMATH_RT_DISPATCH, m, n, a, lda, tau, group_count, group_sizes,
+                               scratchpad, scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event geqrf_batch(ONEMATH_RT_QUEUE std::int64_t* m, std::int64_t* n,
+                                          std::complex<double>** a, std::int64_t* lda,
+                                          std::complex<double>** tau, std::int64_t group_count,
+                                          std::int64_t* group_sizes,
+                                          std::complex<double>* scratchpad,
+                                          std::int64_t scratchpad_size,
+                                          const std::vector<sycl::event>& dependencies = {}) {
+    return detail::geqrf_batch(ONEMATH_RT_DISPATCH, m, n, a, lda, tau, group_count, group_sizes,
+                               scratchpad, scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event getrf_batch(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n, float* a,
+                                          std::int64_t lda, std::int64_t stride_a,
+                                          std::int64_t* ipiv, std::int64_t stride_ipiv,
+                                          std::int64_t batch_size, float* scratchpad,
+                                          std::int64_t scratchpad_size,
+                                          const std::vector<sycl::event>& dependencies = {}) {
+    return detail::getrf_batch(ONEMATH_RT_DISPATCH, m, n, a, lda, stride_a, ipiv, stride_ipiv,
+                               batch_size, scratchpad, scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event getrf_batch(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n,
+                                          double* a, std::int64_t lda, std::int64_t stride_a,
+                                          std::int64_t* ipiv, std::int64_t stride_ipiv,
+                                          std::int64_t batch_size, double* scratchpad,
+                                          std::int64_t scratchpad_size,
+                                          const std::vector<sycl::event>& dependencies = {}) {
+    return detail::getrf_batch(ONEMATH_RT_DISPATCH, m, n, a, lda, stride_a, ipiv, stride_ipiv,
+                               batch_size, scratchpad, scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event getrf_batch(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n,
+                                          std::complex<float>* a, std::int64_t lda,
+                                          std::int64_t stride_a, std::int64_t* ipiv,
+                                          std::int64_t stride_ipiv, std::int64_t batch_size,
+                                          std::complex<float>* scratchpad,
+                                          std::int64_t scratchpad_size,
+                                          const std::vector<sycl::event>& dependencies = {}) {
+    return detail::getrf_batch(ONEMATH_RT_DISPATCH, m, n, a, lda, stride_a, ipiv, stride_ipiv,
+                               batch_size, scratchpad, scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event getrf_batch(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n,
+                                          std::complex<double>* a, std::int64_t lda,
+                                          std::int64_t stride_a, std::int64_t* ipiv,
+                                          std::int64_t stride_ipiv, std::int64_t batch_size,
+                                          std::complex<double>* scratchpad,
+                                          std::int64_t scratchpad_size,
+                                          const std::vector<sycl::event>& dependencies = {}) {
+    return detail::getrf_batch(ONEMATH_RT_DISPATCH, m, n, a, lda, stride_a, ipiv, stride_ipiv,
+                               batch_size, scratchpad, scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event getrf_batch(ONEMATH_RT_QUEUE std::int64_t* m, std::int64_t* n,
+                                          float** a, std::int64_t* lda, std::int64_t** ipiv,
+                                          std::int64_t group_count, std::int64_t* group_sizes,
+                                          float* scratchpad, std::int64_t scratchpad_size,
+                                          const std::vector<sycl::event>& dependencies = {}) {
+    return detail::getrf_batch(ONEMATH_RT_DISPATCH, m, n, a, lda, ipiv, group_count, group_sizes,
+                               scratchpad, scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event getrf_batch(ONEMATH_RT_QUEUE std::int64_t* m, std::int64_t* n,
+                                          double** a, std::int64_t* lda, std::int64_t** ipiv,
+                                          std::int64_t group_count, std::int64_t* group_sizes,
+                                          double* scratchpad, std::int64_t scratchpad_size,
+                                          const std::vector<sycl::event>& dependencies = {}) {
+    return detail::getrf_batch(ONEMATH_RT_DISPATCH, m, n, a, lda, ipiv, group_count, group_sizes,
+                               scratchpad, scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event getrf_batch(ONEMATH_RT_QUEUE std::int64_t* m, std::int64_t* n,
+                                          std::complex<float>** a, std::int64_t* lda,
+                                          std::int64_t** ipiv, std::int64_t group_count,
+                                          std::int64_t* group_sizes,
+                                          std::complex<float>* scratchpad,
+                                          std::int64_t scratchpad_size,
+                                          const std::vector<sycl::event>& dependencies = {}) {
+    return detail::getrf_batch(ONEMATH_RT_DISPATCH, m, n, a, lda, ipiv, group_count, group_sizes,
+                               scratchpad, scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event getrf_batch(ONEMATH_RT_QUEUE std::int64_t* m, std::int64_t* n,
+                                          std::complex<double>** a, std::int64_t* lda,
+                                          std::int64_t** ipiv, std::int64_t group_count,
+                                          std::int64_t* group_sizes,
+                                          std::complex<double>* scratchpad,
+                                          std::int64_t scratchpad_size,
+                                          const std::vector<sycl::event>& dependencies = {}) {
+    return detail::getrf_batch(ONEMATH_RT_DISPATCH, m, n, a, lda, ipiv, group_count, group_sizes,
+                               scratchpad, scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event getri_batch(ONEMATH_RT_QUEUE std::int64_t n, float* a,
+                                          std::int64_t lda, std::int64_t stride_a,
+                                          std::int64_t* ipiv, std::int64_t stride_ipiv,
+                                          std::int64_t batch_size, float* scratchpad,
+                                          std::int64_t scratchpad_size,
+                                          const std::vector<sycl::event>& dependencies = {}) {
+    return detail::getri_batch(ONEMATH_RT_DISPATCH, n, a, lda, stride_a, ipiv, stride_ipiv,
+                               batch_size, scratchpad, scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event getri_batch(ONEMATH_RT_QUEUE std::int64_t n, double* a,
+                                          std::int64_t lda, std::int64_t stride_a,
+                                          std::int64_t* ipiv, std::int64_t stride_ipiv,
+                                          std::int64_t batch_size, double* scratchpad,
+                                          std::int64_t scratchpad_size,
+                                          const std::vector<sycl::event>& dependencies = {}) {
+    return detail::getri_batch(ONEMATH_RT_DISPATCH, n, a, lda, stride_a, ipiv, stride_ipiv,
+                               batch_size, scratchpad, scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event getri_batch(ONEMATH_RT_QUEUE std::int64_t n, std::complex<float>* a,
+                                          std::int64_t lda, std::int64_t stride_a,
+                                          std::int64_t* ipiv, std::int64_t stride_ipiv,
+                                          std::int64_t batch_size, std::complex<float>* scratchpad,
+                                          std::int64_t scratchpad_size,
+                                          const std::vector<sycl::event>& dependencies = {}) {
+    return detail::getri_batch(ONEMATH_RT_DISPATCH, n, a, lda, stride_a, ipiv, stride_ipiv,
+                               batch_size, scratchpad, scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event getri_batch(ONEMATH_RT_QUEUE std::int64_t n, std::complex<double>* a,
+                                          std::int64_t lda, std::int64_t stride_a,
+                                          std::int64_t* ipiv, std::int64_t stride_ipiv,
+                                          std::int64_t batch_size, std::complex<double>* scratchpad,
+                                          std::int64_t scratchpad_size,
+                                          const std::vector<sycl::event>& dependencies = {}) {
+    return detail::getri_batch(ONEMATH_RT_DISPATCH, n, a, lda, stride_a, ipiv, stride_ipiv,
+                               batch_size, scratchpad, scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event getri_batch(ONEMATH_RT_QUEUE std::int64_t* n, float** a,
+                                          std::int64_t* lda, std::int64_t** ipiv,
+                                          std::int64_t group_count, std::int64_t* group_sizes,
+                                          float* scratchpad, std::int64_t scratchpad_size,
+                                          const std::vector<sycl::event>& dependencies = {}) {
+    return detail::getri_batch(ONEMATH_RT_DISPATCH, n, a, lda, ipiv, group_count, group_sizes,
+                               scratchpad, scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event getri_batch(ONEMATH_RT_QUEUE std::int64_t* n, double** a,
+                                          std::int64_t* lda, std::int64_t** ipiv,
+                                          std::int64_t group_count, std::int64_t* group_sizes,
+                                          double* scratchpad, std::int64_t scratchpad_size,
+                                          const std::vector<sycl::event>& dependencies = {}) {
+    return detail::getri_batch(ONEMATH_RT_DISPATCH, n, a, lda, ipiv, group_count, group_sizes,
+                               scratchpad, scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event getri_batch(ONEMATH_RT_QUEUE std::int64_t* n, std::complex<float>** a,
+                                          std::int64_t* lda, std::int64_t** ipiv,
+                                          std::int64_t group_count, std::int64_t* group_sizes,
+                                          std::complex<float>* scratchpad,
+                                          std::int64_t scratchpad_size,
+                                          const std::vector<sycl::event>& dependencies = {}) {
+    return detail::getri_batch(ONEMATH_RT_DISPATCH, n, a, lda, ipiv, group_count, group_sizes,
+                               scratchpad, scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event getri_batch(ONEMATH_RT_QUEUE std::int64_t* n,
+                                          std::complex<double>** a, std::int64_t* lda,
+                                          std::int64_t** ipiv, std::int64_t group_count,
+                                          std::int64_t* group_sizes,
+                                          std::complex<double>* scratchpad,
+                                          std::int64_t scratchpad_size,
+                                          const std::vector<sycl::event>& dependencies = {}) {
+    return detail::getri_batch(ONEMATH_RT_DISPATCH, n, a, lda, ipiv, group_count, group_sizes,
+                               scratchpad, scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event getrs_batch(
+    ONEMATH_RT_QUEUE oneapi::math::transpose trans, std::int64_t n, std::int64_t nrhs, float* a,
+    std::int64_t lda, std::int64_t stride_a, std::int64_t* ipiv, std::int64_t stride_ipiv, float* b,
+    std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size, float* scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event>& dependencies = {}) {
+    return detail::getrs_batch(ONEMATH_RT_DISPATCH, trans, n, nrhs, a, lda, stride_a, ipiv,
+                               stride_ipiv, b, ldb, stride_b, batch_size, scratchpad,
+                               scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event getrs_batch(
+    ONEMATH_RT_QUEUE oneapi::math::transpose trans, std::int64_t n, std::int64_t nrhs, double* a,
+    std::int64_t lda, std::int64_t stride_a, std::int64_t* ipiv, std::int64_t stride_ipiv,
+    double* b, std::int64_t ldb, std::int64_t stride_b, std::int64_t batch_size, double* scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event>& dependencies = {}) {
+    return detail::getrs_batch(ONEMATH_RT_DISPATCH, trans, n, nrhs, a, lda, stride_a, ipiv,
+                               stride_ipiv, b, ldb, stride_b, batch_size, scratchpad,
+                               scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event getrs_batch(
+    ONEMATH_RT_QUEUE oneapi::math::transpose trans, std::int64_t n, std::int64_t nrhs,
+    std::complex<float>* a, std::int64_t lda, std::int64_t stride_a, std::int64_t* ipiv,
+    std::int64_t stride_ipiv, std::complex<float>* b, std::int64_t ldb, std::int64_t stride_b,
+    std::int64_t batch_size, std::complex<float>* scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::getrs_batch(ONEMATH_RT_DISPATCH, trans, n, nrhs, a, lda, stride_a, ipiv,
+                               stride_ipiv, b, ldb, stride_b, batch_size, scratchpad,
+                               scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event getrs_batch(
+    ONEMATH_RT_QUEUE oneapi::math::transpose trans, std::int64_t n, std::int64_t nrhs,
+    std::complex<double>* a, std::int64_t lda, std::int64_t stride_a, std::int64_t* ipiv,
+    std::int64_t stride_ipiv, std::complex<double>* b, std::int64_t ldb, std::int64_t stride_b,
+    std::int64_t batch_size, std::complex<double>* scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::getrs_batch(ONEMATH_RT_DISPATCH, trans, n, nrhs, a, lda, stride_a, ipiv,
+                               stride_ipiv, b, ldb, stride_b, batch_size, scratchpad,
+                               scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event getrs_batch(ONEMATH_RT_QUEUE oneapi::math::transpose* trans,
+                                          std::int64_t* n, std::int64_t* nrhs, float** a,
+                                          std::int64_t* lda, std::int64_t** ipiv, float** b,
+                                          std::int64_t* ldb, std::int64_t group_count,
+                                          std::int64_t* group_sizes, float* scratchpad,
+                                          std::int64_t scratchpad_size,
+                                          const std::vector<sycl::event>& dependencies = {}) {
+    return detail::getrs_batch(ONEMATH_RT_DISPATCH, trans, n, nrhs, a, lda, ipiv, b, ldb,
+                               group_count, group_sizes, scratchpad, scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event getrs_batch(ONEMATH_RT_QUEUE oneapi::math::transpose* trans,
+                                          std::int64_t* n, std::int64_t* nrhs, double** a,
+                                          std::int64_t* lda, std::int64_t** ipiv, double** b,
+                                          std::int64_t* ldb, std::int64_t group_count,
+                                          std::int64_t* group_sizes, double* scratchpad,
+                                          std::int64_t scratchpad_size,
+                                          const std::vector<sycl::event>& dependencies = {}) {
+    return detail::getrs_batch(ONEMATH_RT_DISPATCH, trans, n, nrhs, a, lda, ipiv, b, ldb,
+                               group_count, group_sizes, scratchpad, scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event getrs_batch(
+    ONEMATH_RT_QUEUE oneapi::math::transpose* trans, std::int64_t* n, std::int64_t* nrhs,
+    std::complex<float>** a, std::int64_t* lda, std::int64_t** ipiv, std::complex<float>** b,
+    std::int64_t* ldb, std::int64_t group_count, std::int64_t* group_sizes,
+    std::complex<float>* scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::getrs_batch(ONEMATH_RT_DISPATCH, trans, n, nrhs, a, lda, ipiv, b, ldb,
+                               group_count, group_sizes, scratchpad, scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event getrs_batch(
+    ONEMATH_RT_QUEUE oneapi::math::transpose* trans, std::int64_t* n, std::int64_t* nrhs,
+    std::complex<double>** a, std::int64_t* lda, std::int64_t** ipiv, std::complex<double>** b,
+    std::int64_t* ldb, std::int64_t group_count, std::int64_t* group_sizes,
+    std::complex<double>* scratchpad, std::int64_t scratchpad_size,
+    const std::vector<sycl::event>& dependencies = {}) {
+    return detail::getrs_batch(ONEMATH_RT_DISPATCH, trans, n, nrhs, a, lda, ipiv, b, ldb,
+                               group_count, group_sizes, scratchpad, scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event orgqr_batch(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n,
+                                          std::int64_t k, float* a, std::int64_t lda,
+                                          std::int64_t stride_a, float* tau,
+                                          std::int64_t stride_tau, std::int64_t batch_size,
+                                          float* scratchpad, std::int64_t scratchpad_size,
+                                          const std::vector<sycl::event>& dependencies = {}) {
+    return detail::orgqr_batch(ONEMATH_RT_DISPATCH, m, n, k, a, lda, stride_a, tau, stride_tau,
+                               batch_size, scratchpad, scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event orgqr_batch(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n,
+                                          std::int64_t k, double* a, std::int64_t lda,
+                                          std::int64_t stride_a, double* tau,
+                                          std::int64_t stride_tau, std::int64_t batch_size,
+                                          double* scratchpad, std::int64_t scratchpad_size,
+                                          const std::vector<sycl::event>& dependencies = {}) {
+    return detail::orgqr_batch(ONEMATH_RT_DISPATCH, m, n, k, a, lda, stride_a, tau, stride_tau,
+                               batch_size, scratchpad, scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event orgqr_batch(ONEMATH_RT_QUEUE std::int64_t* m, std::int64_t* n,
+                                          std::int64_t* k, float** a, std::int64_t* lda,
+                                          float** tau, std::int64_t group_count,
+                                          std::int64_t* group_sizes, float* scratchpad,
+                                          std::int64_t scratchpad_size,
+                                          const std::vector<sycl::event>& dependencies = {}) {
+    return detail::orgqr_batch(ONEMATH_RT_DISPATCH, m, n, k, a, lda, tau, group_count, group_sizes,
+                               scratchpad, scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event orgqr_batch(ONEMATH_RT_QUEUE std::int64_t* m, std::int64_t* n,
+                                          std::int64_t* k, double** a, std::int64_t* lda,
+                                          double** tau, std::int64_t group_count,
+                                          std::int64_t* group_sizes, double* scratchpad,
+                                          std::int64_t scratchpad_size,
+                                          const std::vector<sycl::event>& dependencies = {}) {
+    return detail::orgqr_batch(ONEMATH_RT_DISPATCH, m, n, k, a, lda, tau, group_count, group_sizes,
+                               scratchpad, scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event potrf_batch(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                                          float* a, std::int64_t lda, std::int64_t stride_a,
+                                          std::int64_t batch_size, float* scratchpad,
+                                          std::int64_t scratchpad_size,
+                                          const std::vector<sycl::event>& dependencies = {}) {
+    return detail::potrf_batch(ONEMATH_RT_DISPATCH, uplo, n, a, lda, stride_a, batch_size,
+                               scratchpad, scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event potrf_batch(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                                          double* a, std::int64_t lda, std::int64_t stride_a,
+                                          std::int64_t batch_size, double* scratchpad,
+                                          std::int64_t scratchpad_size,
+                                          const std::vector<sycl::event>& dependencies = {}) {
+    return detail::potrf_batch(ONEMATH_RT_DISPATCH, uplo, n, a, lda, stride_a, batch_size,
+                               scratchpad, scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event potrf_batch(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                                          std::complex<float>* a, std::int64_t lda,
+                                          std::int64_t stride_a, std::int64_t batch_size,
+                                          std::complex<float>* scratchpad,
+                                          std::int64_t scratchpad_size,
+                                          const std::vector<sycl::event>& dependencies = {}) {
+    return detail::potrf_batch(ONEMATH_RT_DISPATCH, uplo, n, a, lda, stride_a, batch_size,
+                               scratchpad, scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event potrf_batch(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                                          std::complex<double>* a, std::int64_t lda,
+                                          std::int64_t stride_a, std::int64_t batch_size,
+                                          std::complex<double>* scratchpad,
+                                          std::int64_t scratchpad_size,
+                                          const std::vector<sycl::event>& dependencies = {}) {
+    return detail::potrf_batch(ONEMATH_RT_DISPATCH, uplo, n, a, lda, stride_a, batch_size,
+                               scratchpad, scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event potrf_batch(ONEMATH_RT_QUEUE oneapi::math::uplo* uplo,
+                                          std::int64_t* n, float** a, std::int64_t* lda,
+                                          std::int64_t group_count, std::int64_t* group_sizes,
+                                          float* scratchpad, std::int64_t scratchpad_size,
+                                          const std::vector<sycl::event>& dependencies = {}) {
+    return detail::potrf_batch(ONEMATH_RT_DISPATCH, uplo, n, a, lda, group_count, group_sizes,
+                               scratchpad, scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event potrf_batch(ONEMATH_RT_QUEUE oneapi::math::uplo* uplo,
+                                          std::int64_t* n, double** a, std::int64_t* lda,
+                                          std::int64_t group_count, std::int64_t* group_sizes,
+                                          double* scratchpad, std::int64_t scratchpad_size,
+                                          const std::vector<sycl::event>& dependencies = {}) {
+    return detail::potrf_batch(ONEMATH_RT_DISPATCH, uplo, n, a, lda, group_count, group_sizes,
+                               scratchpad, scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event potrf_batch(ONEMATH_RT_QUEUE oneapi::math::uplo* uplo,
+                                          std::int64_t* n, std::complex<float>** a,
+                                          std::int64_t* lda, std::int64_t group_count,
+                                          std::int64_t* group_sizes,
+                                          std::complex<float>* scratchpad,
+                                          std::int64_t scratchpad_size,
+                                          const std::vector<sycl::event>& dependencies = {}) {
+    return detail::potrf_batch(ONEMATH_RT_DISPATCH, uplo, n, a, lda, group_count, group_sizes,
+                               scratchpad, scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event potrf_batch(ONEMATH_RT_QUEUE oneapi::math::uplo* uplo,
+                                          std::int64_t* n, std::complex<double>** a,
+                                          std::int64_t* lda, std::int64_t group_count,
+                                          std::int64_t* group_sizes,
+                                          std::complex<double>* scratchpad,
+                                          std::int64_t scratchpad_size,
+                                          const std::vector<sycl::event>& dependencies = {}) {
+    return detail::potrf_batch(ONEMATH_RT_DISPATCH, uplo, n, a, lda, group_count, group_sizes,
+                               scratchpad, scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event potrs_batch(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                                          std::int64_t nrhs, float* a, std::int64_t lda,
+                                          std::int64_t stride_a, float* b, std::int64_t ldb,
+                                          std::int64_t stride_b, std::int64_t batch_size,
+                                          float* scratchpad, std::int64_t scratchpad_size,
+                                          const std::vector<sycl::event>& dependencies = {}) {
+    return detail::potrs_batch(ONEMATH_RT_DISPATCH, uplo, n, nrhs, a, lda, stride_a, b, ldb,
+                               stride_b, batch_size, scratchpad, scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event potrs_batch(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                                          std::int64_t nrhs, double* a, std::int64_t lda,
+                                          std::int64_t stride_a, double* b, std::int64_t ldb,
+                                          std::int64_t stride_b, std::int64_t batch_size,
+                                          double* scratchpad, std::int64_t scratchpad_size,
+                                          const std::vector<sycl::event>& dependencies = {}) {
+    return detail::potrs_batch(ONEMATH_RT_DISPATCH, uplo, n, nrhs, a, lda, stride_a, b, ldb,
+                               stride_b, batch_size, scratchpad, scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event potrs_batch(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                                          std::int64_t nrhs, std::complex<float>* a,
+                                          std::int64_t lda, std::int64_t stride_a,
+                                          std::complex<float>* b, std::int64_t ldb,
+                                          std::int64_t stride_b, std::int64_t batch_size,
+                                          std::complex<float>* scratchpad,
+                                          std::int64_t scratchpad_size,
+                                          const std::vector<sycl::event>& dependencies = {}) {
+    return detail::potrs_batch(ONEMATH_RT_DISPATCH, uplo, n, nrhs, a, lda, stride_a, b, ldb,
+                               stride_b, batch_size, scratchpad, scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event potrs_batch(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                                          std::int64_t nrhs, std::complex<double>* a,
+                                          std::int64_t lda, std::int64_t stride_a,
+                                          std::complex<double>* b, std::int64_t ldb,
+                                          std::int64_t stride_b, std::int64_t batch_size,
+                                          std::complex<double>* scratchpad,
+                                          std::int64_t scratchpad_size,
+                                          const std::vector<sycl::event>& dependencies = {}) {
+    return detail::potrs_batch(ONEMATH_RT_DISPATCH, uplo, n, nrhs, a, lda, stride_a, b, ldb,
+                               stride_b, batch_size, scratchpad, scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event potrs_batch(ONEMATH_RT_QUEUE oneapi::math::uplo* uplo,
+                                          std::int64_t* n, std::int64_t* nrhs, float** a,
+                                          std::int64_t* lda, float** b, std::int64_t* ldb,
+                                          std::int64_t group_count, std::int64_t* group_sizes,
+                                          float* scratchpad, std::int64_t scratchpad_size,
+                                          const std::vector<sycl::event>& dependencies = {}) {
+    return detail::potrs_batch(ONEMATH_RT_DISPATCH, uplo, n, nrhs, a, lda, b, ldb, group_count,
+                               group_sizes, scratchpad, scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event potrs_batch(ONEMATH_RT_QUEUE oneapi::math::uplo* uplo,
+                                          std::int64_t* n, std::int64_t* nrhs, double** a,
+                                          std::int64_t* lda, double** b, std::int64_t* ldb,
+                                          std::int64_t group_count, std::int64_t* group_sizes,
+                                          double* scratchpad, std::int64_t scratchpad_size,
+                                          const std::vector<sycl::event>& dependencies = {}) {
+    return detail::potrs_batch(ONEMATH_RT_DISPATCH, uplo, n, nrhs, a, lda, b, ldb, group_count,
+                               group_sizes, scratchpad, scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event potrs_batch(
+    ONEMATH_RT_QUEUE oneapi::math::uplo* uplo, std::int64_t* n, std::int64_t* nrhs,
+    std::complex<float>** a, std::int64_t* lda, std::complex<float>** b, std::int64_t* ldb,
+    std::int64_t group_count, std::int64_t* group_sizes, std::complex<float>* scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event>& dependencies = {}) {
+    return detail::potrs_batch(ONEMATH_RT_DISPATCH, uplo, n, nrhs, a, lda, b, ldb, group_count,
+                               group_sizes, scratchpad, scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event potrs_batch(
+    ONEMATH_RT_QUEUE oneapi::math::uplo* uplo, std::int64_t* n, std::int64_t* nrhs,
+    std::complex<double>** a, std::int64_t* lda, std::complex<double>** b, std::int64_t* ldb,
+    std::int64_t group_count, std::int64_t* group_sizes, std::complex<double>* scratchpad,
+    std::int64_t scratchpad_size, const std::vector<sycl::event>& dependencies = {}) {
+    return detail::potrs_batch(ONEMATH_RT_DISPATCH, uplo, n, nrhs, a, lda, b, ldb, group_count,
+                               group_sizes, scratchpad, scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event ungqr_batch(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n,
+                                          std::int64_t k, std::complex<float>* a, std::int64_t lda,
+                                          std::int64_t stride_a, std::complex<float>* tau,
+                                          std::int64_t stride_tau, std::int64_t batch_size,
+                                          std::complex<float>* scratchpad,
+                                          std::int64_t scratchpad_size,
+                                          const std::vector<sycl::event>& dependencies = {}) {
+    return detail::ungqr_batch(ONEMATH_RT_DISPATCH, m, n, k, a, lda, stride_a, tau, stride_tau,
+                               batch_size, scratchpad, scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event ungqr_batch(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n,
+                                          std::int64_t k, std::complex<double>* a, std::int64_t lda,
+                                          std::int64_t stride_a, std::complex<double>* tau,
+                                          std::int64_t stride_tau, std::int64_t batch_size,
+                                          std::complex<double>* scratchpad,
+                                          std::int64_t scratchpad_size,
+                                          const std::vector<sycl::event>& dependencies = {}) {
+    return detail::ungqr_batch(ONEMATH_RT_DISPATCH, m, n, k, a, lda, stride_a, tau, stride_tau,
+                               batch_size, scratchpad, scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event ungqr_batch(ONEMATH_RT_QUEUE std::int64_t* m, std::int64_t* n,
+                                          std::int64_t* k, std::complex<float>** a,
+                                          std::int64_t* lda, std::complex<float>** tau,
+                                          std::int64_t group_count, std::int64_t* group_sizes,
+                                          std::complex<float>* scratchpad,
+                                          std::int64_t scratchpad_size,
+                                          const std::vector<sycl::event>& dependencies = {}) {
+    return detail::ungqr_batch(ONEMATH_RT_DISPATCH, m, n, k, a, lda, tau, group_count, group_sizes,
+                               scratchpad, scratchpad_size, dependencies);
+}
+ONEMATH_RT_INLINE sycl::event ungqr_batch(ONEMATH_RT_QUEUE std::int64_t* m, std::int64_t* n,
+                                          std::int64_t* k, std::complex<double>** a,
+                                          std::int64_t* lda, std::complex<double>** tau,
+                                          std::int64_t group_count, std::int64_t* group_sizes,
+                                          std::complex<double>* scratchpad,
+                                          std::int64_t scratchpad_size,
+                                          const std::vector<sycl::event>& dependencies = {}) {
+    return detail::ungqr_batch(ONEMATH_RT_DISPATCH, m, n, k, a, lda, tau, group_count, group_sizes,
+                               scratchpad, scratchpad_size, dependencies);
+}
+
+template <typename fp_type, internal::is_floating_point<fp_type> = nullptr>
+std::int64_t gebrd_scratchpad_size(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n,
+                                   std::int64_t lda) {
+    return detail::gebrd_scratchpad_size<fp_type>(ONEMATH_RT_DISPATCH, m, n, lda);
+}
+template <typename fp_type, oneapi::math::lapack::internal::is_floating_point<fp_type> = nullptr>
+std::int64_t gerqf_scratchpad_size(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n,
+                                   std::int64_t lda) {
+    return detail::gerqf_scratchpad_size<fp_type>(ONEMATH_RT_DISPATCH, m, n, lda);
+}
+template <typename fp_type, internal::is_floating_point<fp_type> = nullptr>
+std::int64_t geqrf_scratchpad_size(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n,
+                                   std::int64_t lda) {
+    return detail::geqrf_scratchpad_size<fp_type>(ONEMATH_RT_DISPATCH, m, n, lda);
+}
+template <typename fp_type, internal::is_real_floating_point<fp_type> = nullptr>
+std::int64_t gesvd_scratchpad_size(ONEMATH_RT_QUEUE oneapi::math::jobsvd jobu,
+                                   oneapi::math::jobsvd jobvt, std::int64_t m, std::int64_t n,
+                                   std::int64_t lda, std::int64_t ldu, std::int64_t ldvt) {
+    return detail::gesvd_scratchpad_size<fp_type>(ONEMATH_RT_DISPATCH, jobu, jobvt, m, n, lda, ldu,
+                                                  ldvt);
+}
+template <typename fp_type, internal::is_complex_floating_point<fp_type> = nullptr>
+std::int64_t gesvd_scratchpad_size(ONEMATH_RT_QUEUE oneapi::math::jobsvd jobu,
+                                   oneapi::math::jobsvd jobvt, std::int64_t m, std::int64_t n,
+                                   std::int64_t lda, std::int64_t ldu, std::int64_t ldvt) {
+    return detail::gesvd_scratchpad_size<fp_type>(ONEMATH_RT_DISPATCH, jobu, jobvt, m, n, lda, ldu,
+                                                  ldvt);
+}
+template <typename fp_type, internal::is_floating_point<fp_type> = nullptr>
+std::int64_t getrf_scratchpad_size(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n,
+                                   std::int64_t lda) {
+    return detail::getrf_scratchpad_size<fp_type>(ONEMATH_RT_DISPATCH, m, n, lda);
+}
+template <typename fp_type, internal::is_floating_point<fp_type> = nullptr>
+std::int64_t getri_scratchpad_size(ONEMATH_RT_QUEUE std::int64_t n, std::int64_t lda) {
+    return detail::getri_scratchpad_size<fp_type>(ONEMATH_RT_DISPATCH, n, lda);
+}
+template <typename fp_type, internal::is_floating_point<fp_type> = nullptr>
+std::int64_t getrs_scratchpad_size(ONEMATH_RT_QUEUE oneapi::math::transpose trans, std::int64_t n,
+                                   std::int64_t nrhs, std::int64_t lda, std::int64_t ldb) {
+    return detail::getrs_scratchpad_size<fp_type>(ONEMATH_RT_DISPATCH, trans, n, nrhs, lda, ldb);
+}
+template <typename fp_type, internal::is_complex_floating_point<fp_type> = nullptr>
+std::int64_t heevd_scratchpad_size(ONEMATH_RT_QUEUE oneapi::math::job jobz, oneapi::math::uplo uplo,
+                                   std::int64_t n, std::int64_t lda) {
+    return detail::heevd_scratchpad_size<fp_type>(ONEMATH_RT_DISPATCH, jobz, uplo, n, lda);
+}
+template <typename fp_type, internal::is_complex_floating_point<fp_type> = nullptr>
+std::int64_t hegvd_scratchpad_size(ONEMATH_RT_QUEUE std::int64_t itype, oneapi::math::job jobz,
+                                   oneapi::math::uplo uplo, std::int64_t n, std::int64_t lda,
+                                   std::int64_t ldb) {
+    return detail::hegvd_scratchpad_size<fp_type>(ONEMATH_RT_DISPATCH, itype, jobz, uplo, n, lda,
+                                                  ldb);
+}
+template <typename fp_type, internal::is_complex_floating_point<fp_type> = nullptr>
+std::int64_t hetrd_scratchpad_size(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                                   std::int64_t lda) {
+    return detail::hetrd_scratchpad_size<fp_type>(ONEMATH_RT_DISPATCH, uplo, n, lda);
+}
+template <typename fp_type,
+          oneapi::math::lapack::internal::is_complex_floating_point<fp_type> = nullptr>
+std::int64_t hetrf_scratchpad_size(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                                   std::int64_t lda) {
+    return detail::hetrf_scratchpad_size<fp_type>(ONEMATH_RT_DISPATCH, uplo, n, lda);
+}
+template <typename fp_type,
+          oneapi::math::lapack::internal::is_real_floating_point<fp_type> = nullptr>
+std::int64_t orgbr_scratchpad_size(ONEMATH_RT_QUEUE oneapi::math::generate vect, std::int64_t m,
+                                   std::int64_t n, std::int64_t k, std::int64_t lda) {
+    return detail::orgbr_scratchpad_size<fp_type>(ONEMATH_RT_DISPATCH, vect, m, n, k, lda);
+}
+template <typename fp_type,
+          oneapi::math::lapack::internal::is_real_floating_point<fp_type> = nullptr>
+std::int64_t orgtr_scratchpad_size(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                                   std::int64_t lda) {
+    return detail::orgtr_scratchpad_size<fp_type>(ONEMATH_RT_DISPATCH, uplo, n, lda);
+}
+template <typename fp_type, internal::is_real_floating_point<fp_type> = nullptr>
+std::int64_t orgqr_scratchpad_size(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n, std::int64_t k,
+                                   std::int64_t lda) {
+    return detail::orgqr_scratchpad_size<fp_type>(ONEMATH_RT_DISPATCH, m, n, k, lda);
+}
+template <typename fp_type,
+          oneapi::math::lapack::internal::is_real_floating_point<fp_type> = nullptr>
+std::int64_t ormrq_scratchpad_size(ONEMATH_RT_QUEUE oneapi::math::side side,
+                                   oneapi::math::transpose trans, std::int64_t m, std::int64_t n,
+                                   std::int64_t k, std::int64_t lda, std::int64_t ldc) {
+    return detail::ormrq_scratchpad_size<fp_type>(ONEMATH_RT_DISPATCH, side, trans, m, n, k, lda,
+                                                  ldc);
+}
+template <typename fp_type, internal::is_real_floating_point<fp_type> = nullptr>
+std::int64_t ormqr_scratchpad_size(ONEMATH_RT_QUEUE oneapi::math::side side,
+                                   oneapi::math::transpose trans, std::int64_t m, std::int64_t n,
+                                   std::int64_t k, std::int64_t lda, std::int64_t ldc) {
+    return detail::ormqr_scratchpad_size<fp_type>(ONEMATH_RT_DISPATCH, side, trans, m, n, k, lda,
+                                                  ldc);
+}
+template <typename fp_type,
+          oneapi::math::lapack::internal::is_real_floating_point<fp_type> = nullptr>
+std::int64_t ormtr_scratchpad_size(ONEMATH_RT_QUEUE oneapi::math::side side,
+                                   oneapi::math::uplo uplo, oneapi::math::transpose trans,
+                                   std::int64_t m, std::int64_t n, std::int64_t lda,
+                                   std::int64_t ldc) {
+    return detail::ormtr_scratchpad_size<fp_type>(ONEMATH_RT_DISPATCH, side, uplo, trans, m, n, lda,
+                                                  ldc);
+}
+template <typename fp_type, internal::is_floating_point<fp_type> = nullptr>
+std::int64_t potrf_scratchpad_size(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                                   std::int64_t lda) {
+    return detail::potrf_scratchpad_size<fp_type>(ONEMATH_RT_DISPATCH, uplo, n, lda);
+}
+template <typename fp_type, oneapi::math::lapack::internal::is_floating_point<fp_type> = nullptr>
+std::int64_t potrs_scratchpad_size(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                                   std::int64_t nrhs, std::int64_t lda, std::int64_t ldb) {
+    return detail::potrs_scratchpad_size<fp_type>(ONEMATH_RT_DISPATCH, uplo, n, nrhs, lda, ldb);
+}
+template <typename fp_type, oneapi::math::lapack::internal::is_floating_point<fp_type> = nullptr>
+std::int64_t potri_scratchpad_size(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                                   std::int64_t lda) {
+    return detail::potri_scratchpad_size<fp_type>(ONEMATH_RT_DISPATCH, uplo, n, lda);
+}
+template <typename fp_type, oneapi::math::lapack::internal::is_floating_point<fp_type> = nullptr>
+std::int64_t sytrf_scratchpad_size(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                                   std::int64_t lda) {
+    return detail::sytrf_scratchpad_size<fp_type>(ONEMATH_RT_DISPATCH, uplo, n, lda);
+}
+template <typename fp_type, internal::is_real_floating_point<fp_type> = nullptr>
+std::int64_t syevd_scratchpad_size(ONEMATH_RT_QUEUE oneapi::math::job jobz, oneapi::math::uplo uplo,
+                                   std::int64_t n, std::int64_t lda) {
+    return detail::syevd_scratchpad_size<fp_type>(ONEMATH_RT_DISPATCH, jobz, uplo, n, lda);
+}
+template <typename fp_type, internal::is_real_floating_point<fp_type> = nullptr>
+std::int64_t sygvd_scratchpad_size(ONEMATH_RT_QUEUE std::int64_t itype, oneapi::math::job jobz,
+                                   oneapi::math::uplo uplo, std::int64_t n, std::int64_t lda,
+                                   std::int64_t ldb) {
+    return detail::sygvd_scratchpad_size<fp_type>(ONEMATH_RT_DISPATCH, itype, jobz, uplo, n, lda,
+                                                  ldb);
+}
+template <typename fp_type, internal::is_real_floating_point<fp_type> = nullptr>
+std::int64_t sytrd_scratchpad_size(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                                   std::int64_t lda) {
+    return detail::sytrd_scratchpad_size<fp_type>(ONEMATH_RT_DISPATCH, uplo, n, lda);
+}
+template <typename fp_type, internal::is_floating_point<fp_type> = nullptr>
+std::int64_t trtrs_scratchpad_size(ONEMATH_RT_QUEUE oneapi::math::uplo uplo,
+                                   oneapi::math::transpose trans, oneapi::math::diag diag,
+                                   std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+                                   std::int64_t ldb) {
+    return detail::trtrs_scratchpad_size<fp_type>(ONEMATH_RT_DISPATCH, uplo, trans, diag, n, nrhs,
+                                                  lda, ldb);
+}
+template <typename fp_type,
+          oneapi::math::lapack::internal::is_complex_floating_point<fp_type> = nullptr>
+std::int64_t ungbr_scratchpad_size(ONEMATH_RT_QUEUE oneapi::math::generate vect, std::int64_t m,
+                                   std::int64_t n, std::int64_t k, std::int64_t lda) {
+    return detail::ungbr_scratchpad_size<fp_type>(ONEMATH_RT_DISPATCH, vect, m, n, k, lda);
+}
+template <typename fp_type, internal::is_complex_floating_point<fp_type> = nullptr>
+std::int64_t ungqr_scratchpad_size(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n, std::int64_t k,
+                                   std::int64_t lda) {
+    return detail::ungqr_scratchpad_size<fp_type>(ONEMATH_RT_DISPATCH, m, n, k, lda);
+}
+template <typename fp_type,
+          oneapi::math::lapack::internal::is_complex_floating_point<fp_type> = nullptr>
+std::int64_t ungtr_scratchpad_size(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                                   std::int64_t lda) {
+    return detail::ungtr_scratchpad_size<fp_type>(ONEMATH_RT_DISPATCH, uplo, n, lda);
+}
+template <typename fp_type,
+          oneapi::math::lapack::internal::is_complex_floating_point<fp_type> = nullptr>
+std::int64_t unmrq_scratchpad_size(ONEMATH_RT_QUEUE oneapi::math::side side,
+                                   oneapi::math::transpose trans, std::int64_t m, std::int64_t n,
+                                   std::int64_t k, std::int64_t lda, std::int64_t ldc) {
+    return detail::unmrq_scratchpad_size<fp_type>(ONEMATH_RT_DISPATCH, side, trans, m, n, k, lda,
+                                                  ldc);
+}
+template <typename fp_type, internal::is_complex_floating_point<fp_type> = nullptr>
+std::int64_t unmqr_scratchpad_size(ONEMATH_RT_QUEUE oneapi::math::side side,
+                                   oneapi::math::transpose trans, std::int64_t m, std::int64_t n,
+                                   std::int64_t k, std::int64_t lda, std::int64_t ldc) {
+    return detail::unmqr_scratchpad_size<fp_type>(ONEMATH_RT_DISPATCH, side, trans, m, n, k, lda,
+                                                  ldc);
+}
+template <typename fp_type,
+          oneapi::math::lapack::internal::is_complex_floating_point<fp_type> = nullptr>
+std::int64_t unmtr_scratchpad_size(ONEMATH_RT_QUEUE oneapi::math::side side,
+                                   oneapi::math::uplo uplo, oneapi::math::transpose trans,
+                                   std::int64_t m, std::int64_t n, std::int64_t lda,
+                                   std::int64_t ldc) {
+    return detail::unmtr_scratchpad_size<fp_type>(ONEMATH_RT_DISPATCH, side, uplo, trans, m, n, lda,
+                                                  ldc);
+}
+template <typename fp_type, oneapi::math::lapack::internal::is_floating_point<fp_type> = nullptr>
+std::int64_t getrf_batch_scratchpad_size(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n,
+                                         std::int64_t lda, std::int64_t stride_a,
+                                         std::int64_t stride_ipiv, std::int64_t batch_size) {
+    return detail::getrf_batch_scratchpad_size<fp_type>(ONEMATH_RT_DISPATCH, m, n, lda, stride_a,
+                                                        stride_ipiv, batch_size);
+}
+template <typename fp_type, oneapi::math::lapack::internal::is_floating_point<fp_type> = nullptr>
+std::int64_t getri_batch_scratchpad_size(ONEMATH_RT_QUEUE std::int64_t n, std::int64_t lda,
+                                         std::int64_t stride_a, std::int64_t stride_ipiv,
+                                         std::int64_t batch_size) {
+    return detail::getri_batch_scratchpad_size<fp_type>(ONEMATH_RT_DISPATCH, n, lda, stride_a,
+                                                        stride_ipiv, batch_size);
+}
+template <typename fp_type, oneapi::math::lapack::internal::is_floating_point<fp_type> = nullptr>
+std::int64_t getrs_batch_scratchpad_size(ONEMATH_RT_QUEUE oneapi::math::transpose trans,
+                                         std::int64_t n, std::int64_t nrhs, std::int64_t lda,
+                                         std::int64_t stride_a, std::int64_t stride_ipiv,
+                                         std::int64_t ldb, std::int64_t stride_b,
+                                         std::int64_t batch_size) {
+    return detail::getrs_batch_scratchpad_size<fp_type>(ONEMATH_RT_DISPATCH, trans, n, nrhs, lda,
+                                                        stride_a, stride_ipiv, ldb, stride_b,
+                                                        batch_size);
+}
+template <typename fp_type, oneapi::math::lapack::internal::is_floating_point<fp_type> = nullptr>
+std::int64_t geqrf_batch_scratchpad_size(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n,
+                                         std::int64_t lda, std::int64_t stride_a,
+                                         std::int64_t stride_tau, std::int64_t batch_size) {
+    return detail::geqrf_batch_scratchpad_size<fp_type>(ONEMATH_RT_DISPATCH, m, n, lda, stride_a,
+                                                        stride_tau, batch_size);
+}
+template <typename fp_type, oneapi::math::lapack::internal::is_floating_point<fp_type> = nullptr>
+std::int64_t potrf_batch_scratchpad_size(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                                         std::int64_t lda, std::int64_t stride_a,
+                                         std::int64_t batch_size) {
+    return detail::potrf_batch_scratchpad_size<fp_type>(ONEMATH_RT_DISPATCH, uplo, n, lda, stride_a,
+                                                        batch_size);
+}
+template <typename fp_type, oneapi::math::lapack::internal::is_floating_point<fp_type> = nullptr>
+std::int64_t potrs_batch_scratchpad_size(ONEMATH_RT_QUEUE oneapi::math::uplo uplo, std::int64_t n,
+                                         std::int64_t nrhs, std::int64_t lda, std::int64_t stride_a,
+                                         std::int64_t ldb, std::int64_t stride_b,
+                                         std::int64_t batch_size) {
+    return detail::potrs_batch_scratchpad_size<fp_type>(ONEMATH_RT_DISPATCH, uplo, n, nrhs, lda,
+                                                        stride_a, ldb, stride_b, batch_size);
+}
+template <typename fp_type,
+          oneapi::math::lapack::internal::is_real_floating_point<fp_type> = nullptr>
+std::int64_t orgqr_batch_scratchpad_size(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n,
+                                         std::int64_t k, std::int64_t lda, std::int64_t stride_a,
+                                         std::int64_t stride_tau, std::int64_t batch_size) {
+    return detail::orgqr_batch_scratchpad_size<fp_type>(ONEMATH_RT_DISPATCH, m, n, k, lda, stride_a,
+                                                        stride_tau, batch_size);
+}
+template <typename fp_type,
+          oneapi::math::lapack::internal::is_complex_floating_point<fp_type> = nullptr>
+std::int64_t ungqr_batch_scratchpad_size(ONEMATH_RT_QUEUE std::int64_t m, std::int64_t n,
+                                         std::int64_t k, std::int64_t lda, std::int64_t stride_a,
+                                         std::int64_t stride_tau, std::int64_t batch_size) {
+    return detail::ungqr_batch_scratchpad_size<fp_type>(ONEMATH_RT_DISPATCH, m, n, k, lda, stride_a,
+                                                        stride_tau, batch_size);
+}
+template <typename fp_type, oneapi::math::lapack::internal::is_floating_point<fp_type> = nullptr>
+std::int64_t getrf_batch_scratchpad_size(ONEMATH_RT_QUEUE std::int64_t* m, std::int64_t* n,
+                                         std::int64_t* lda, std::int64_t group_count,
+                                         std::int64_t* group_sizes) {
+    return detail::getrf_batch_scratchpad_size<fp_type>(ONEMATH_RT_DISPATCH, m, n, lda, group_count,
+                                                        group_sizes);
+}
+template <typename fp_type, oneapi::math::lapack::internal::is_floating_point<fp_type> = nullptr>
+std::int64_t getri_batch_scratchpad_size(ONEMATH_RT_QUEUE std::int64_t* n, std::int64_t* lda,
+                                         std::int64_t group_count, std::int64_t* group_sizes) {
+    return detail::getri_batch_scratchpad_size<fp_type>(ONEMATH_RT_DISPATCH, n, lda, group_count,
+                                                        group_sizes);
+}
+template <typename fp_type, oneapi::math::lapack::internal::is_floating_point<fp_type> = nullptr>
+std::int64_t getrs_batch_scratchpad_size(ONEMATH_RT_QUEUE oneapi::math::transpose* trans,
+                                         std::int64_t* n, std::int64_t* nrhs, std::int64_t* lda,
+                                         std::int64_t* ldb, std::int64_t group_count,
+                                         std::int64_t* group_sizes) {
+    return detail::getrs_batch_scratchpad_size<fp_type>(ONEMATH_RT_DISPATCH, trans, n, nrhs, lda,
+                                                        ldb, group_count, group_sizes);
+}
+template <typename fp_type, oneapi::math::lapack::internal::is_floating_point<fp_type> = nullptr>
+std::int64_t geqrf_batch_scratchpad_size(ONEMATH_RT_QUEUE std::int64_t* m, std::int64_t* n,
+                                         std::int64_t* lda, std::int64_t group_count,
+                                         std::int64_t* group_sizes) {
+    return detail::geqrf_batch_scratchpad_size<fp_type>(ONEMATH_RT_DISPATCH, m, n, lda, group_count,
+                                                        group_sizes);
+}
+template <typename fp_type,
+          oneapi::math::lapack::internal::is_real_floating_point<fp_type> = nullptr>
+std::int64_t orgqr_batch_scratchpad_size(ONEMATH_RT_QUEUE std::int64_t* m, std::int64_t* n,
+                                         std::int64_t* k, std::int64_t* lda,
+                                         std::int64_t group_count, std::int64_t* group_sizes) {
+    return detail::orgqr_batch_scratchpad_size<fp_type>(ONEMATH_RT_DISPATCH, m, n, k, lda,
+                                                        group_count, group_sizes);
+}
+template <typename fp_type, oneapi::math::lapack::internal::is_floating_point<fp_type> = nullptr>
+std::int64_t potrf_batch_scratchpad_size(ONEMATH_RT_QUEUE oneapi::math::uplo* uplo, std::int64_t* n,
+                                         std::int64_t* lda, std::int64_t group_count,
+                                         std::int64_t* group_sizes) {
+    return detail::potrf_batch_scratchpad_size<fp_type>(ONEMATH_RT_DISPATCH, uplo, n, lda,
+                                                        group_count, group_sizes);
+}
+template <typename fp_type, oneapi::math::lapack::internal::is_floating_point<fp_type> = nullptr>
+std::int64_t potrs_batch_scratchpad_size(ONEMATH_RT_QUEUE oneapi::math::uplo* uplo, std::int64_t* n,
+                                         std::int64_t* nrhs, std::int64_t* lda, std::int64_t* ldb,
+                                         std::int64_t group_count, std::int64_t* group_sizes) {
+    return detail::potrs_batch_scratchpad_size<fp_type>(ONEMATH_RT_DISPATCH, uplo, n, nrhs, lda,
+                                                        ldb, group_count, group_sizes);
+}
+template <typename fp_type,
+          oneapi::math::lapack::internal::is_complex_floating_point<fp_type> = nullptr>
+std::int64_t ungqr_batch_scratchpad_size(ONEMATH_RT_QUEUE std::int64_t* m, std::int64_t* n,
+                                         std::int64_t* k, std::int64_t* lda,
+                                         std::int64_t group_count, std::int64_t* group_sizes) {
+    return detail::ungqr_batch_scratchpad_size<fp_type>(ONEMATH_RT_DISPATCH, m, n, k, lda,
+                                                        group_count, group_sizes);
+}
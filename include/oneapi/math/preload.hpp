@@ -0,0 +1,62 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMATH_PRELOAD_HPP_
+#define _ONEMATH_PRELOAD_HPP_
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "oneapi/math/detail/backends_table.hpp"
+#include "oneapi/math/detail/export.hpp"
+
+namespace oneapi {
+namespace math {
+
+// Outcome of loading the backend library of one domain for one device
+struct preload_info {
+    domain domain_id;
+    device device_id;
+    bool loaded = false;
+    // Name of the loaded backend library, empty if none could be loaded
+    std::string library;
+    // Time spent loading the library and its function table
+    std::chrono::duration<double, std::milli> load_time{ 0 };
+    // Reason the library could not be loaded, empty on success
+    std::string error;
+};
+
+// Loads the run-time dispatching backend libraries of the given domains for the given
+// devices ahead of the first call, so that the first call does not pay for dlopen and
+// the backend initialization it triggers. Domains are loaded concurrently on
+// background threads and the call returns once every library has been processed.
+// Domains that are not built are reported as not loaded.
+ONEMATH_EXPORT std::vector<preload_info> preload(const std::vector<domain>& domains,
+                                                 const std::vector<device>& devices);
+
+// Loads the domains listed in the ONEMATH_PRELOAD environment variable (a comma
+// separated list such as "blas,lapack", or "all"), or every built domain if the
+// variable is not set, for all the devices available on the system.
+ONEMATH_EXPORT std::vector<preload_info> preload();
+
+} // namespace math
+} // namespace oneapi
+
+#endif //_ONEMATH_PRELOAD_HPP_
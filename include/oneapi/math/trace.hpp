@@ -0,0 +1,38 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMATH_TRACE_API_HPP_
+#define _ONEMATH_TRACE_API_HPP_
+
+#include "oneapi/math/detail/export.hpp"
+
+namespace oneapi {
+namespace math {
+
+// Waits for the calls traced so far, records the execution time of those made on queues
+// with profiling enabled and writes the trace file named by ONEMATH_TRACE. The file is
+// written again at exit with the later calls, but only with the execution times that are
+// known by then. Does nothing unless oneMath was built with ENABLE_TRACING and
+// ONEMATH_TRACE is set.
+ONEMATH_EXPORT void flush_trace();
+
+} // namespace math
+} // namespace oneapi
+
+#endif //_ONEMATH_TRACE_API_HPP_
@@ -0,0 +1,99 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+#include "oneapi/math/async_errors.hpp"
+#include "async_error_recorder.hpp"
+
+namespace oneapi {
+namespace math {
+namespace detail {
+
+// Queues are kept alive until their errors are taken, so that a new queue cannot be given
+// the errors of a destroyed one
+class async_error_registry {
+public:
+    // Never destroyed, as it holds queues and exceptions that must not be released after
+    // the SYCL runtime is torn down
+    static async_error_registry& get() {
+        static async_error_registry& registry = *new async_error_registry();
+        return registry;
+    }
+
+    void record(const sycl::queue& queue, std::string message, std::exception_ptr exception) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto& queue_errors = errors_[queue];
+        if (queue_errors.size() < max_async_errors_per_queue)
+            queue_errors.push_back({ std::move(message), std::move(exception) });
+        pending_.store(true, std::memory_order_release);
+    }
+
+    bool has(const sycl::queue& queue) {
+        if (!pending_.load(std::memory_order_acquire))
+            return false;
+        std::lock_guard<std::mutex> lock(mutex_);
+        return errors_.find(queue) != errors_.end();
+    }
+
+    std::vector<async_error> take(const sycl::queue& queue) {
+        if (!pending_.load(std::memory_order_acquire))
+            return {};
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::vector<async_error> queue_errors;
+        auto it = errors_.find(queue);
+        if (it != errors_.end()) {
+            queue_errors = std::move(it->second);
+            errors_.erase(it);
+        }
+        pending_.store(!errors_.empty(), std::memory_order_release);
+        return queue_errors;
+    }
+
+private:
+    async_error_registry() = default;
+
+    std::mutex mutex_;
+    // Set while any queue has errors, so that polling is a single load in the common case
+    std::atomic<bool> pending_{ false };
+    std::unordered_map<sycl::queue, std::vector<async_error>> errors_;
+};
+
+} // namespace detail
+
+bool has_async_errors(const sycl::queue& queue) {
+    return detail::async_error_registry::get().has(queue);
+}
+
+std::vector<async_error> take_async_errors(const sycl::queue& queue) {
+    return detail::async_error_registry::get().take(queue);
+}
+
+} // namespace math
+} // namespace oneapi
+
+// Looked up by name by the backends, see async_error_recorder.hpp
+extern "C" ONEMATH_EXPORT void onemath_record_async_error(const sycl::queue* queue,
+                                                          const char* message,
+                                                          const std::exception_ptr* exception) {
+    oneapi::math::detail::async_error_registry::get().record(*queue, message, *exception);
+}
@@ -0,0 +1,51 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <cstdlib>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "oneapi/math/backend_priority.hpp"
+
+#include "backend_order.hpp"
+
+namespace oneapi {
+namespace math {
+
+static std::mutex priority_mutex;
+
+static std::vector<std::string>& priority() {
+    static std::vector<std::string> backends =
+        detail::parse_backend_priority(std::getenv("ONEMATH_BACKEND_PRIORITY"));
+    return backends;
+}
+
+void set_backend_priority(const std::vector<std::string>& backends) {
+    std::lock_guard<std::mutex> lock(priority_mutex);
+    priority() = backends;
+}
+
+std::vector<std::string> get_backend_priority() {
+    std::lock_guard<std::mutex> lock(priority_mutex);
+    return priority();
+}
+
+} // namespace math
+} // namespace oneapi
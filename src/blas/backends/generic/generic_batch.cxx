@@ -192,7 +192,8 @@ void gemm_batch(sycl::queue& queue, oneapi::math::transpose transa, oneapi::math
                 sycl::buffer<std::complex<float>, 1>& b, std::int64_t ldb, std::int64_t stride_b,
                 std::complex<float> beta, sycl::buffer<std::complex<float>, 1>& c, std::int64_t ldc,
                 std::int64_t stride_c, std::int64_t batch_size) {
-    throw unimplemented("blas", "gemm_batch", " for complex");
+    detail::gemm_batch(queue, is_column_major(), transa, transb, m, n, k, alpha, a, lda, stride_a,
+                       b, ldb, stride_b, beta, c, ldc, stride_c, batch_size);
 }
 
 void gemm_batch(sycl::queue& queue, oneapi::math::transpose transa, oneapi::math::transpose transb,
@@ -201,7 +202,8 @@ void gemm_batch(sycl::queue& queue, oneapi::math::transpose transa, oneapi::math
                 sycl::buffer<std::complex<double>, 1>& b, std::int64_t ldb, std::int64_t stride_b,
                 std::complex<double> beta, sycl::buffer<std::complex<double>, 1>& c,
                 std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
-    throw unimplemented("blas", "gemm_batch", " for complex");
+    detail::gemm_batch(queue, is_column_major(), transa, transb, m, n, k, alpha, a, lda, stride_a,
+                       b, ldb, stride_b, beta, c, ldc, stride_c, batch_size);
 }
 
 void gemm_batch(sycl::queue& queue, oneapi::math::transpose transa, oneapi::math::transpose transb,
@@ -210,7 +212,10 @@ void gemm_batch(sycl::queue& queue, oneapi::math::transpose transa, oneapi::math
                 sycl::buffer<sycl::half, 1>& b, std::int64_t ldb, std::int64_t stride_b,
                 sycl::half beta, sycl::buffer<sycl::half, 1>& c, std::int64_t ldc,
                 std::int64_t stride_c, std::int64_t batch_size) {
-    throw unimplemented("blas", "gemm_batch", " for complex");
+    // Accumulated and scaled in float, rounded to half when stored
+    detail::gemm_batch<float>(queue, is_column_major(), transa, transb, m, n, k,
+                              static_cast<float>(alpha), a, lda, stride_a, b, ldb, stride_b,
+                              static_cast<float>(beta), c, ldc, stride_c, batch_size);
 }
 
 void gemm_batch(sycl::queue& queue, oneapi::math::transpose transa, oneapi::math::transpose transb,
@@ -219,7 +224,8 @@ void gemm_batch(sycl::queue& queue, oneapi::math::transpose transa, oneapi::math
                 sycl::buffer<sycl::half, 1>& b, std::int64_t ldb, std::int64_t stride_b, float beta,
                 sycl::buffer<float, 1>& c, std::int64_t ldc, std::int64_t stride_c,
                 std::int64_t batch_size) {
-    throw unimplemented("blas", "gemm_batch", " for unsupported dtype");
+    detail::gemm_batch<float>(queue, is_column_major(), transa, transb, m, n, k, alpha, a, lda,
+                              stride_a, b, ldb, stride_b, beta, c, ldc, stride_c, batch_size);
 }
 
 void gemm_batch(sycl::queue& queue, oneapi::math::transpose transa, oneapi::math::transpose transb,
@@ -228,7 +234,9 @@ void gemm_batch(sycl::queue& queue, oneapi::math::transpose transa, oneapi::math
                 sycl::buffer<std::int8_t, 1>& b, std::int64_t ldb, std::int64_t stride_b,
                 float beta, sycl::buffer<float, 1>& c, std::int64_t ldc, std::int64_t stride_c,
                 std::int64_t batch_size) {
-    throw unimplemented("blas", "gemm_batch", " for unsupported dtype");
+    detail::gemm_batch<std::int32_t>(queue, is_column_major(), transa, transb, m, n, k, alpha, a,
+                                     lda, stride_a, b, ldb, stride_b, beta, c, ldc, stride_c,
+                                     batch_size);
 }
 
 void gemm_batch(sycl::queue& queue, oneapi::math::transpose transa, oneapi::math::transpose transb,
@@ -237,7 +245,9 @@ void gemm_batch(sycl::queue& queue, oneapi::math::transpose transa, oneapi::math
                 sycl::buffer<std::int8_t, 1>& b, std::int64_t ldb, std::int64_t stride_b,
                 float beta, sycl::buffer<std::int32_t, 1>& c, std::int64_t ldc,
                 std::int64_t stride_c, std::int64_t batch_size) {
-    throw unimplemented("blas", "gemm_batch", " for unsupported dtype");
+    detail::gemm_batch<std::int32_t>(queue, is_column_major(), transa, transb, m, n, k, alpha, a,
+                                     lda, stride_a, b, ldb, stride_b, beta, c, ldc, stride_c,
+                                     batch_size);
 }
 
 void trsm_batch(sycl::queue& queue, oneapi::math::side left_right, oneapi::math::uplo upper_lower,
@@ -708,7 +718,8 @@ sycl::event gemm_batch(sycl::queue& queue, oneapi::math::transpose* transa,
                        std::complex<float>* beta, std::complex<float>** c, std::int64_t* ldc,
                        std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "gemm_batch", " for USM");
+    return detail::gemm_batch(queue, is_column_major(), transa, transb, m, n, k, alpha, a, lda, b,
+                              ldb, beta, c, ldc, group_count, group_size, dependencies);
 }
 
 sycl::event gemm_batch(sycl::queue& queue, oneapi::math::transpose* transa,
@@ -718,7 +729,8 @@ sycl::event gemm_batch(sycl::queue& queue, oneapi::math::transpose* transa,
                        std::complex<double>* beta, std::complex<double>** c, std::int64_t* ldc,
                        std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "gemm_batch", " for USM");
+    return detail::gemm_batch(queue, is_column_major(), transa, transb, m, n, k, alpha, a, lda, b,
+                              ldb, beta, c, ldc, group_count, group_size, dependencies);
 }
 
 sycl::event gemm_batch(sycl::queue& queue, oneapi::math::transpose* transa,
@@ -727,7 +739,9 @@ sycl::event gemm_batch(sycl::queue& queue, oneapi::math::transpose* transa,
                        const sycl::half** b, std::int64_t* ldb, sycl::half* beta, sycl::half** c,
                        std::int64_t* ldc, std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "gemm_batch", " for USM");
+    return detail::gemm_batch<float, float>(queue, is_column_major(), transa, transb, m, n, k,
+                                            alpha, a, lda, b, ldb, beta, c, ldc, group_count,
+                                            group_size, dependencies);
 }
 
 sycl::event gemm_batch(sycl::queue& queue, oneapi::math::transpose* transa,
@@ -736,7 +750,9 @@ sycl::event gemm_batch(sycl::queue& queue, oneapi::math::transpose* transa,
                        const sycl::half** b, std::int64_t* ldb, float* beta, float** c,
                        std::int64_t* ldc, std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "gemm_batch", " for USM");
+    return detail::gemm_batch<float, float>(queue, is_column_major(), transa, transb, m, n, k,
+                                            alpha, a, lda, b, ldb, beta, c, ldc, group_count,
+                                            group_size, dependencies);
 }
 
 sycl::event gemm_batch(sycl::queue& queue, oneapi::math::transpose* transa,
@@ -745,7 +761,9 @@ sycl::event gemm_batch(sycl::queue& queue, oneapi::math::transpose* transa,
                        const std::int8_t** b, std::int64_t* ldb, float* beta, float** c,
                        std::int64_t* ldc, std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "gemm_batch", " for USM");
+    return detail::gemm_batch<std::int32_t, float>(queue, is_column_major(), transa, transb, m,
+                                                   n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                                                   group_count, group_size, dependencies);
 }
 
 sycl::event gemm_batch(sycl::queue& queue, oneapi::math::transpose* transa,
@@ -754,7 +772,9 @@ sycl::event gemm_batch(sycl::queue& queue, oneapi::math::transpose* transa,
                        const std::int8_t** b, std::int64_t* ldb, float* beta, std::int32_t** c,
                        std::int64_t* ldc, std::int64_t group_count, std::int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "gemm_batch", " for USM");
+    return detail::gemm_batch<std::int32_t, float>(queue, is_column_major(), transa, transb, m,
+                                                   n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                                                   group_count, group_size, dependencies);
 }
 
 sycl::event gemm_batch(sycl::queue& queue, oneapi::math::transpose transa,
@@ -788,7 +808,9 @@ sycl::event gemm_batch(sycl::queue& queue, oneapi::math::transpose transa,
                        std::int64_t ldb, std::int64_t stride_b, std::complex<float> beta,
                        std::complex<float>* c, std::int64_t ldc, std::int64_t stride_c,
                        std::int64_t batch_size, const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "gemm_batch", " for USM");
+    return detail::gemm_batch(queue, is_column_major(), transa, transb, m, n, k, alpha, a, lda,
+                              stride_a, b, ldb, stride_b, beta, c, ldc, stride_c, batch_size,
+                              dependencies);
 }
 
 sycl::event gemm_batch(sycl::queue& queue, oneapi::math::transpose transa,
@@ -798,7 +820,9 @@ sycl::event gemm_batch(sycl::queue& queue, oneapi::math::transpose transa,
                        std::int64_t ldb, std::int64_t stride_b, std::complex<double> beta,
                        std::complex<double>* c, std::int64_t ldc, std::int64_t stride_c,
                        std::int64_t batch_size, const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "gemm_batch", " for USM");
+    return detail::gemm_batch(queue, is_column_major(), transa, transb, m, n, k, alpha, a, lda,
+                              stride_a, b, ldb, stride_b, beta, c, ldc, stride_c, batch_size,
+                              dependencies);
 }
 
 sycl::event gemm_batch(sycl::queue& queue, oneapi::math::transpose transa,
@@ -808,7 +832,11 @@ sycl::event gemm_batch(sycl::queue& queue, oneapi::math::transpose transa,
                        std::int64_t stride_b, sycl::half beta, sycl::half* c, std::int64_t ldc,
                        std::int64_t stride_c, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "gemm_batch", " for USM");
+    // Accumulated and scaled in float, rounded to half when stored
+    return detail::gemm_batch<float>(queue, is_column_major(), transa, transb, m, n, k,
+                                     static_cast<float>(alpha), a, lda, stride_a, b, ldb,
+                                     stride_b, static_cast<float>(beta), c, ldc, stride_c,
+                                     batch_size, dependencies);
 }
 
 sycl::event gemm_batch(sycl::queue& queue, oneapi::math::transpose transa,
@@ -818,7 +846,9 @@ sycl::event gemm_batch(sycl::queue& queue, oneapi::math::transpose transa,
                        std::int64_t stride_b, float beta, float* c, std::int64_t ldc,
                        std::int64_t stride_c, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "gemm_batch", " for USM");
+    return detail::gemm_batch<float>(queue, is_column_major(), transa, transb, m, n, k, alpha, a,
+                                     lda, stride_a, b, ldb, stride_b, beta, c, ldc, stride_c,
+                                     batch_size, dependencies);
 }
 
 sycl::event gemm_batch(sycl::queue& queue, oneapi::math::transpose transa,
@@ -828,7 +858,9 @@ sycl::event gemm_batch(sycl::queue& queue, oneapi::math::transpose transa,
                        std::int64_t stride_b, float beta, float* c, std::int64_t ldc,
                        std::int64_t stride_c, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "gemm_batch", " for USM");
+    return detail::gemm_batch<std::int32_t>(queue, is_column_major(), transa, transb, m, n, k,
+                                            alpha, a, lda, stride_a, b, ldb, stride_b, beta, c,
+                                            ldc, stride_c, batch_size, dependencies);
 }
 
 sycl::event gemm_batch(sycl::queue& queue, oneapi::math::transpose transa,
@@ -838,7 +870,9 @@ sycl::event gemm_batch(sycl::queue& queue, oneapi::math::transpose transa,
                        std::int64_t stride_b, float beta, std::int32_t* c, std::int64_t ldc,
                        std::int64_t stride_c, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "gemm_batch", " for USM");
+    return detail::gemm_batch<std::int32_t>(queue, is_column_major(), transa, transb, m, n, k,
+                                            alpha, a, lda, stride_a, b, ldb, stride_b, beta, c,
+                                            ldc, stride_c, batch_size, dependencies);
 }
 
 sycl::event trsm_batch(sycl::queue& queue, oneapi::math::side left_right,
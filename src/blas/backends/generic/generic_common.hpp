@@ -80,6 +80,12 @@ struct generic_type<sycl::buffer<ElemT, 1>> {
     using type = buffer_iterator_t<ElemT>;
 };
 
+// Complex buffers are reinterpreted in place, see convert_to_generic_type
+template <typename ElemT>
+struct generic_type<sycl::buffer<std::complex<ElemT>, 1>> {
+    using type = buffer_iterator_t<sycl_complex_t<ElemT>>;
+};
+
 template <typename ElemT>
 struct generic_type<ElemT*> {
     using type = ElemT*;
@@ -112,6 +118,23 @@ inline typename generic_type<InputT>::type convert_to_generic_type(InputT& input
     return typename generic_type<InputT>::type(input);
 }
 
+/** Convert a std::complex buffer to a onemath_sycl_blas buffer of sycl complex
+ *  sharing its memory, which avoids copying the data to a staging buffer.
+ *
+ *  @tparam ElemT The real type of the complex elements.
+ *  @param input The oneMath buffer.
+ *  @return The onemath_sycl_blas buffer iterator over the same memory.
+**/
+template <typename ElemT>
+inline buffer_iterator_t<sycl_complex_t<ElemT>> convert_to_generic_type(
+    sycl::buffer<std::complex<ElemT>, 1>& input) {
+    static_assert(sizeof(std::complex<ElemT>) == sizeof(sycl_complex_t<ElemT>) &&
+                      alignof(std::complex<ElemT>) == alignof(sycl_complex_t<ElemT>),
+                  "std::complex and sycl complex must have the same layout");
+    return buffer_iterator_t<sycl_complex_t<ElemT>>(
+        input.template reinterpret<sycl_complex_t<ElemT>, 1>(input.get_range()));
+}
+
 template <>
 inline char convert_to_generic_type<oneapi::math::transpose>(oneapi::math::transpose& trans) {
     if (trans == oneapi::math::transpose::nontrans) {
@@ -187,6 +210,21 @@ struct throw_if_unsupported_by_device {
     }
 };
 
+// The kernels of the generic backend are defined in a namespace of their library, set by
+// add_generic_blas_library, so that the libraries tuned for different devices do not define
+// kernels of the same name
+#ifndef GENERIC_BLAS_KERNEL_NAMESPACE
+#define GENERIC_BLAS_KERNEL_NAMESPACE onemath_blas_generic
+#endif
+inline namespace GENERIC_BLAS_KERNEL_NAMESPACE {
+
+// Submits the kernel setting result[0] to zero, which the reductions of onemath_sycl_blas add to
+template <typename T, typename P>
+void zero_result(sycl::handler& cgh, P result) {
+    cgh.single_task([=]() { result[0] = T(0); });
+}
+
+} // namespace GENERIC_BLAS_KERNEL_NAMESPACE
 } // namespace detail
 
 #define CALL_GENERIC_BLAS_FN(genericFunc, ...)                                                  \
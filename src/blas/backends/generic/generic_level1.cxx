@@ -62,7 +62,7 @@ void asum(sycl::queue& queue, std::int64_t n, sycl::buffer<real_t, 1>& x, std::i
     // before performing the computation.
     queue.submit([&](sycl::handler& cgh) {
         auto result_acc = result.template get_access<sycl::access::mode::write>(cgh);
-        cgh.single_task([=]() { result_acc[0] = real_t(0); });
+        detail::zero_result<real_t>(cgh, result_acc);
     });
     CALL_GENERIC_BLAS_FN(::blas::_asum, queue, n, x, incx, result);
 }
@@ -105,7 +105,7 @@ void dot(sycl::queue& queue, std::int64_t n, sycl::buffer<real_t, 1>& x, std::in
     // before performing the computation.
     queue.submit([&](sycl::handler& cgh) {
         auto result_acc = result.template get_access<sycl::access::mode::write>(cgh);
-        cgh.single_task([=]() { result_acc[0] = real_t(0); });
+        detail::zero_result<real_t>(cgh, result_acc);
     });
     CALL_GENERIC_BLAS_FN(::blas::_dot, queue, n, x, incx, y, incy, result);
 }
@@ -124,7 +124,7 @@ void sdsdot(sycl::queue& queue, std::int64_t n, real_t sb, sycl::buffer<real_t,
     // before performing the computation.
     queue.submit([&](sycl::handler& cgh) {
         auto result_acc = result.template get_access<sycl::access::mode::write>(cgh);
-        cgh.single_task([=]() { result_acc[0] = real_t(0); });
+        detail::zero_result<real_t>(cgh, result_acc);
     });
     CALL_GENERIC_BLAS_FN(::blas::_sdsdot, queue, n, sb, x, incx, y, incy, result);
 }
@@ -140,7 +140,7 @@ void nrm2(sycl::queue& queue, std::int64_t n, sycl::buffer<real_t, 1>& x, std::i
     // before performing the computation.
     queue.submit([&](sycl::handler& cgh) {
         auto result_acc = result.template get_access<sycl::access::mode::write>(cgh);
-        cgh.single_task([=]() { result_acc[0] = real_t(0); });
+        detail::zero_result<real_t>(cgh, result_acc);
     });
     CALL_GENERIC_BLAS_FN(::blas::_nrm2, queue, n, x, incx, result);
 }
@@ -247,8 +247,8 @@ sycl::event asum(sycl::queue& queue, std::int64_t n, const real_t* x, std::int64
                  real_t* result, const std::vector<sycl::event>& dependencies) {
     // Generic BLAS asum implementation requires result to be initializes to zero
     // before starting the computation.
-    auto init_res_val = queue.submit(
-        [&](sycl::handler& cgh) { cgh.single_task([=]() { result[0] = real_t(0); }); });
+    auto init_res_val =
+        queue.submit([&](sycl::handler& cgh) { detail::zero_result<real_t>(cgh, result); });
     std::vector<sycl::event> new_dependencies = dependencies;
     new_dependencies.push_back(init_res_val);
     CALL_GENERIC_BLAS_USM_FN(::blas::_asum, queue, n, x, incx, result, new_dependencies);
@@ -295,8 +295,8 @@ sycl::event dot(sycl::queue& queue, std::int64_t n, const real_t* x, std::int64_
                 const std::vector<sycl::event>& dependencies) {
     // Generic BLAS dot implementation requires result to be initializes to zero
     // before starting the computation.
-    auto init_res_val = queue.submit(
-        [&](sycl::handler& cgh) { cgh.single_task([=]() { result[0] = real_t(0); }); });
+    auto init_res_val =
+        queue.submit([&](sycl::handler& cgh) { detail::zero_result<real_t>(cgh, result); });
     std::vector<sycl::event> new_dependencies = dependencies;
     new_dependencies.emplace_back(init_res_val);
     CALL_GENERIC_BLAS_USM_FN(::blas::_dot, queue, n, x, incx, y, incy, result, new_dependencies);
@@ -315,8 +315,8 @@ sycl::event sdsdot(sycl::queue& queue, std::int64_t n, real_t sb, const real_t*
                    const std::vector<sycl::event>& dependencies) {
     // Generic BLAS sdsdot implementation requires result to be initializes to zero
     // before starting the computation.
-    auto init_res_val = queue.submit(
-        [&](sycl::handler& cgh) { cgh.single_task([=]() { result[0] = real_t(0); }); });
+    auto init_res_val =
+        queue.submit([&](sycl::handler& cgh) { detail::zero_result<real_t>(cgh, result); });
     std::vector<sycl::event> new_dependencies = dependencies;
     new_dependencies.emplace_back(init_res_val);
     CALL_GENERIC_BLAS_USM_FN(::blas::_sdsdot, queue, n, sb, x, incx, y, incy, result,
@@ -332,8 +332,8 @@ sycl::event nrm2(sycl::queue& queue, std::int64_t n, const real_t* x, std::int64
                  real_t* result, const std::vector<sycl::event>& dependencies) {
     // Generic BLAS nrm2 implementation requires result to be initializes to zero
     // before starting the computation.
-    auto init_res_val = queue.submit(
-        [&](sycl::handler& cgh) { cgh.single_task([=]() { result[0] = real_t(0); }); });
+    auto init_res_val =
+        queue.submit([&](sycl::handler& cgh) { detail::zero_result<real_t>(cgh, result); });
     std::vector<sycl::event> new_dependencies = dependencies;
     new_dependencies.push_back(init_res_val);
     CALL_GENERIC_BLAS_USM_FN(::blas::_nrm2, queue, n, x, incx, result, new_dependencies);
@@ -32,36 +32,32 @@ void gemm(sycl::queue& queue, oneapi::math::transpose transa, oneapi::math::tran
           sycl::buffer<std::complex<real_t>, 1>& a, std::int64_t lda,
           sycl::buffer<std::complex<real_t>, 1>& b, std::int64_t ldb, std::complex<real_t> beta,
           sycl::buffer<std::complex<real_t>, 1>& c, std::int64_t ldc) {
-    using sycl_complex_real_t = sycl::ext::oneapi::experimental::complex<real_t>;
+    // onemath_sycl_blas has no conjugate transpose. The operands taken with conjtrans are
+    // conjugated to a copy, which the tuned gemm takes with trans: the copy reads and writes the
+    // operand once, and the O(m * n * k) product runs on the tuned kernel rather than on the
+    // product kernel of the generic backend.
     if (transa == oneapi::math::transpose::conjtrans ||
         transb == oneapi::math::transpose::conjtrans) {
-        throw unimplemented("blas", "gemm",
-                            "Conjugate Transpose unsupported yet on onemath_sycl_blas");
+        if constexpr (is_column_major()) {
+            const bool conj_a = transa == oneapi::math::transpose::conjtrans;
+            const bool conj_b = transb == oneapi::math::transpose::conjtrans;
+            auto a_op = conj_a ? detail::conjugated_copy(queue, k, m, a, lda) : a;
+            auto b_op = conj_b ? detail::conjugated_copy(queue, n, k, b, ldb) : b;
+            gemm(queue, conj_a ? oneapi::math::transpose::trans : transa,
+                 conj_b ? oneapi::math::transpose::trans : transb, m, n, k, alpha, a_op,
+                 conj_a ? std::max<std::int64_t>(k, 1) : lda, b_op,
+                 conj_b ? std::max<std::int64_t>(n, 1) : ldb, beta, c, ldc);
+        }
+        else {
+            // The row major gemm of onemath_sycl_blas is unimplemented, the product kernel
+            // conjugates the operands as it loads them
+            detail::gemm_batch(queue, is_column_major(), transa, transb, m, n, k, alpha, a, lda,
+                               0, b, ldb, 0, beta, c, ldc, 0, 1);
+        }
+        return;
     }
-    // Intermediate buffers for conversion purposes as onemath_sycl_blas expects sycl::complex instead of std::complex
-    sycl::buffer<sycl_complex_real_t, 1> a_pb{ sycl::range<1>(a.size()) };
-    sycl::buffer<sycl_complex_real_t, 1> b_pb{ sycl::range<1>(b.size()) };
-    sycl::buffer<sycl_complex_real_t, 1> c_pb{ sycl::range<1>(c.size()) };
-
-    sycl::accessor<std::complex<real_t>, 1, sycl::access::mode::read> a_acc(a);
-    sycl::accessor<sycl_complex_real_t, 1, sycl::access::mode::write> a_pb_acc(a_pb);
-    queue.copy(a_acc, a_pb_acc);
-
-    sycl::accessor<std::complex<real_t>, 1, sycl::access::mode::read> b_acc(b);
-    sycl::accessor<sycl_complex_real_t, 1, sycl::access::mode::write> b_pb_acc(b_pb);
-    queue.copy(b_acc, b_pb_acc);
-
-    sycl::accessor<std::complex<real_t>, 1, sycl::access::mode::read> c_acc(c);
-    sycl::accessor<sycl_complex_real_t, 1, sycl::access::mode::write> c_pb_acc(c_pb);
-    queue.copy(c_acc, c_pb_acc);
-
-    CALL_GENERIC_BLAS_FN(::blas::_gemm, queue, transa, transb, m, n, k, alpha, a_pb, lda, b_pb, ldb,
-                         beta, c_pb, ldc);
-
-    // Copy c_pb back to c
-    sycl::accessor<std::complex<real_t>, 1, sycl::access::mode::write> out_acc(c);
-    sycl::accessor<sycl_complex_real_t, 1, sycl::access::mode::read> out_pb_acc(c_pb);
-    queue.copy(out_pb_acc, out_acc);
+    CALL_GENERIC_BLAS_FN(::blas::_gemm, queue, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta,
+                         c, ldc);
 }
 
 void symm(sycl::queue& queue, oneapi::math::side left_right, oneapi::math::uplo upper_lower,
@@ -77,7 +73,19 @@ void symm(sycl::queue& queue, oneapi::math::side left_right, oneapi::math::uplo
           sycl::buffer<std::complex<real_t>, 1>& a, std::int64_t lda,
           sycl::buffer<std::complex<real_t>, 1>& b, std::int64_t ldb, std::complex<real_t> beta,
           sycl::buffer<std::complex<real_t>, 1>& c, std::int64_t ldc) {
-    throw unimplemented("blas", "symm", "");
+    detail::check_precision<real_t>(queue);
+    auto a_sycl = detail::as_sycl_complex(a);
+    auto b_sycl = detail::as_sycl_complex(b);
+    auto c_sycl = detail::as_sycl_complex(c);
+    queue.submit([&](sycl::handler& cgh) {
+        auto a_acc = a_sycl.template get_access<sycl::access::mode::read>(cgh);
+        auto b_acc = b_sycl.template get_access<sycl::access::mode::read>(cgh);
+        auto c_acc = c_sycl.template get_access<sycl::access::mode::read_write>(cgh);
+        detail::symm(cgh, false, left_right, upper_lower, m, n, detail::to_sycl_complex(alpha),
+                     detail::matrix(a_acc, lda, is_column_major()),
+                     detail::matrix(b_acc, ldb, is_column_major()), detail::to_sycl_complex(beta),
+                     detail::matrix(c_acc, ldc, is_column_major()));
+    });
 }
 
 void hemm(sycl::queue& queue, oneapi::math::side left_right, oneapi::math::uplo upper_lower,
@@ -85,7 +93,19 @@ void hemm(sycl::queue& queue, oneapi::math::side left_right, oneapi::math::uplo
           sycl::buffer<std::complex<real_t>, 1>& a, std::int64_t lda,
           sycl::buffer<std::complex<real_t>, 1>& b, std::int64_t ldb, std::complex<real_t> beta,
           sycl::buffer<std::complex<real_t>, 1>& c, std::int64_t ldc) {
-    throw unimplemented("blas", "hemm", "");
+    detail::check_precision<real_t>(queue);
+    auto a_sycl = detail::as_sycl_complex(a);
+    auto b_sycl = detail::as_sycl_complex(b);
+    auto c_sycl = detail::as_sycl_complex(c);
+    queue.submit([&](sycl::handler& cgh) {
+        auto a_acc = a_sycl.template get_access<sycl::access::mode::read>(cgh);
+        auto b_acc = b_sycl.template get_access<sycl::access::mode::read>(cgh);
+        auto c_acc = c_sycl.template get_access<sycl::access::mode::read_write>(cgh);
+        detail::symm(cgh, true, left_right, upper_lower, m, n, detail::to_sycl_complex(alpha),
+                     detail::matrix(a_acc, lda, is_column_major()),
+                     detail::matrix(b_acc, ldb, is_column_major()), detail::to_sycl_complex(beta),
+                     detail::matrix(c_acc, ldc, is_column_major()));
+    });
 }
 
 void syrk(sycl::queue& queue, oneapi::math::uplo upper_lower, oneapi::math::transpose trans,
@@ -98,14 +118,35 @@ void syrk(sycl::queue& queue, oneapi::math::uplo upper_lower, oneapi::math::tran
           std::int64_t n, std::int64_t k, std::complex<real_t> alpha,
           sycl::buffer<std::complex<real_t>, 1>& a, std::int64_t lda, std::complex<real_t> beta,
           sycl::buffer<std::complex<real_t>, 1>& c, std::int64_t ldc) {
-    throw unimplemented("blas", "syrk", "");
+    detail::check_precision<real_t>(queue);
+    detail::check_transpose("syrk", trans, oneapi::math::transpose::trans);
+    auto a_sycl = detail::as_sycl_complex(a);
+    auto c_sycl = detail::as_sycl_complex(c);
+    queue.submit([&](sycl::handler& cgh) {
+        auto a_acc = a_sycl.template get_access<sycl::access::mode::read>(cgh);
+        auto c_acc = c_sycl.template get_access<sycl::access::mode::read_write>(cgh);
+        detail::syrk(cgh, false, upper_lower, trans, n, k, detail::to_sycl_complex(alpha),
+                     detail::matrix(a_acc, lda, is_column_major()), detail::to_sycl_complex(beta),
+                     detail::matrix(c_acc, ldc, is_column_major()));
+    });
 }
 
 void herk(sycl::queue& queue, oneapi::math::uplo upper_lower, oneapi::math::transpose trans,
           std::int64_t n, std::int64_t k, real_t alpha, sycl::buffer<std::complex<real_t>, 1>& a,
           std::int64_t lda, real_t beta, sycl::buffer<std::complex<real_t>, 1>& c,
           std::int64_t ldc) {
-    throw unimplemented("blas", "herk", "");
+    detail::check_precision<real_t>(queue);
+    detail::check_transpose("herk", trans, oneapi::math::transpose::conjtrans);
+    auto a_sycl = detail::as_sycl_complex(a);
+    auto c_sycl = detail::as_sycl_complex(c);
+    queue.submit([&](sycl::handler& cgh) {
+        auto a_acc = a_sycl.template get_access<sycl::access::mode::read>(cgh);
+        auto c_acc = c_sycl.template get_access<sycl::access::mode::read_write>(cgh);
+        detail::syrk(cgh, true, upper_lower, trans, n, k, detail::to_sycl_complex<real_t>(alpha),
+                     detail::matrix(a_acc, lda, is_column_major()),
+                     detail::to_sycl_complex<real_t>(beta),
+                     detail::matrix(c_acc, ldc, is_column_major()));
+    });
 }
 
 void syr2k(sycl::queue& queue, oneapi::math::uplo upper_lower, oneapi::math::transpose trans,
@@ -120,7 +161,20 @@ void syr2k(sycl::queue& queue, oneapi::math::uplo upper_lower, oneapi::math::tra
            sycl::buffer<std::complex<real_t>, 1>& a, std::int64_t lda,
            sycl::buffer<std::complex<real_t>, 1>& b, std::int64_t ldb, std::complex<real_t> beta,
            sycl::buffer<std::complex<real_t>, 1>& c, std::int64_t ldc) {
-    throw unimplemented("blas", "syr2k", "");
+    detail::check_precision<real_t>(queue);
+    detail::check_transpose("syr2k", trans, oneapi::math::transpose::trans);
+    auto a_sycl = detail::as_sycl_complex(a);
+    auto b_sycl = detail::as_sycl_complex(b);
+    auto c_sycl = detail::as_sycl_complex(c);
+    queue.submit([&](sycl::handler& cgh) {
+        auto a_acc = a_sycl.template get_access<sycl::access::mode::read>(cgh);
+        auto b_acc = b_sycl.template get_access<sycl::access::mode::read>(cgh);
+        auto c_acc = c_sycl.template get_access<sycl::access::mode::read_write>(cgh);
+        detail::syr2k(cgh, false, upper_lower, trans, n, k, detail::to_sycl_complex(alpha),
+                      detail::matrix(a_acc, lda, is_column_major()),
+                      detail::matrix(b_acc, ldb, is_column_major()), detail::to_sycl_complex(beta),
+                      detail::matrix(c_acc, ldc, is_column_major()));
+    });
 }
 
 void her2k(sycl::queue& queue, oneapi::math::uplo upper_lower, oneapi::math::transpose trans,
@@ -128,7 +182,21 @@ void her2k(sycl::queue& queue, oneapi::math::uplo upper_lower, oneapi::math::tra
            sycl::buffer<std::complex<real_t>, 1>& a, std::int64_t lda,
            sycl::buffer<std::complex<real_t>, 1>& b, std::int64_t ldb, real_t beta,
            sycl::buffer<std::complex<real_t>, 1>& c, std::int64_t ldc) {
-    throw unimplemented("blas", "her2k", "");
+    detail::check_precision<real_t>(queue);
+    detail::check_transpose("her2k", trans, oneapi::math::transpose::conjtrans);
+    auto a_sycl = detail::as_sycl_complex(a);
+    auto b_sycl = detail::as_sycl_complex(b);
+    auto c_sycl = detail::as_sycl_complex(c);
+    queue.submit([&](sycl::handler& cgh) {
+        auto a_acc = a_sycl.template get_access<sycl::access::mode::read>(cgh);
+        auto b_acc = b_sycl.template get_access<sycl::access::mode::read>(cgh);
+        auto c_acc = c_sycl.template get_access<sycl::access::mode::read_write>(cgh);
+        detail::syr2k(cgh, true, upper_lower, trans, n, k, detail::to_sycl_complex(alpha),
+                      detail::matrix(a_acc, lda, is_column_major()),
+                      detail::matrix(b_acc, ldb, is_column_major()),
+                      detail::to_sycl_complex<real_t>(beta),
+                      detail::matrix(c_acc, ldc, is_column_major()));
+    });
 }
 
 void trmm(sycl::queue& queue, oneapi::math::side left_right, oneapi::math::uplo upper_lower,
@@ -142,7 +210,27 @@ void trmm(sycl::queue& queue, oneapi::math::side left_right, oneapi::math::uplo
           oneapi::math::transpose trans, oneapi::math::diag unit_diag, std::int64_t m,
           std::int64_t n, std::complex<real_t> alpha, sycl::buffer<std::complex<real_t>, 1>& a,
           std::int64_t lda, sycl::buffer<std::complex<real_t>, 1>& b, std::int64_t ldb) {
-    throw unimplemented("blas", "trmm", "");
+    detail::check_precision<real_t>(queue);
+    auto a_sycl = detail::as_sycl_complex(a);
+    auto b_sycl = detail::as_sycl_complex(b);
+    // B is overwritten by the product, which reads it from a column major copy
+    sycl::buffer<detail::sycl_complex_t<real_t>, 1> b_copy{ sycl::range<1>(
+        std::max<std::int64_t>(m * n, 1)) };
+    queue.submit([&](sycl::handler& cgh) {
+        auto b_acc = b_sycl.template get_access<sycl::access::mode::read>(cgh);
+        auto copy_acc = b_copy.template get_access<sycl::access::mode::write>(cgh);
+        detail::copy_matrix(cgh, m, n, detail::matrix(b_acc, ldb, is_column_major()),
+                            detail::matrix(copy_acc, m, true));
+    });
+    queue.submit([&](sycl::handler& cgh) {
+        auto a_acc = a_sycl.template get_access<sycl::access::mode::read>(cgh);
+        auto b_acc = b_sycl.template get_access<sycl::access::mode::write>(cgh);
+        auto copy_acc = b_copy.template get_access<sycl::access::mode::read>(cgh);
+        detail::trmm(cgh, left_right, upper_lower, trans, unit_diag, m, n,
+                     detail::to_sycl_complex(alpha), detail::matrix(a_acc, lda, is_column_major()),
+                     detail::matrix(b_acc, ldb, is_column_major()),
+                     detail::matrix(copy_acc, m, true));
+    });
 }
 
 void trsm(sycl::queue& queue, oneapi::math::side left_right, oneapi::math::uplo upper_lower,
@@ -242,10 +330,45 @@ sycl::event gemm(sycl::queue& queue, oneapi::math::transpose transa, oneapi::mat
                  const std::complex<real_t>* a, std::int64_t lda, const std::complex<real_t>* b,
                  std::int64_t ldb, std::complex<real_t> beta, std::complex<real_t>* c,
                  std::int64_t ldc, const std::vector<sycl::event>& dependencies) {
+    // onemath_sycl_blas has no conjugate transpose, see the buffer gemm
     if (transa == oneapi::math::transpose::conjtrans ||
         transb == oneapi::math::transpose::conjtrans) {
-        throw unimplemented("blas", "gemm",
-                            "Conjugate Transpose unsupported yet on onemath_sycl_blas");
+        if constexpr (is_column_major()) {
+            const bool conj_a = transa == oneapi::math::transpose::conjtrans;
+            const bool conj_b = transb == oneapi::math::transpose::conjtrans;
+            const std::int64_t a_size = conj_a ? std::max<std::int64_t>(k * m, 1) : 0;
+            const std::int64_t b_size = conj_b ? std::max<std::int64_t>(n * k, 1) : 0;
+            detail::check_precision<real_t>(queue);
+            // One allocation holds the copies of both operands
+            auto copies = sycl::malloc_device<std::complex<real_t>>(a_size + b_size, queue);
+            if (!copies)
+                throw device_bad_alloc("blas", "gemm", queue.get_device());
+            std::vector<sycl::event> copied;
+            if (conj_a)
+                copied.push_back(
+                    detail::conjugated_copy(queue, k, m, a, lda, copies, dependencies));
+            if (conj_b)
+                copied.push_back(detail::conjugated_copy(queue, n, k, b, ldb, copies + a_size,
+                                                         dependencies));
+            auto done =
+                gemm(queue, conj_a ? oneapi::math::transpose::trans : transa,
+                     conj_b ? oneapi::math::transpose::trans : transb, m, n, k, alpha,
+                     conj_a ? copies : a, conj_a ? std::max<std::int64_t>(k, 1) : lda,
+                     conj_b ? copies + a_size : b, conj_b ? std::max<std::int64_t>(n, 1) : ldb,
+                     beta, c, ldc, copied);
+            queue.submit([&](sycl::handler& cgh) {
+                cgh.depends_on(done);
+                auto context = queue.get_context();
+                cgh.host_task([=]() { sycl::free(copies, context); });
+            });
+            return done;
+        }
+        else {
+            // The row major gemm of onemath_sycl_blas is unimplemented, the product kernel
+            // conjugates the operands as it loads them
+            return detail::gemm_batch(queue, is_column_major(), transa, transb, m, n, k, alpha,
+                                      a, lda, 0, b, ldb, 0, beta, c, ldc, 0, 1, dependencies);
+        }
     }
     CALL_GENERIC_BLAS_USM_FN(::blas::_gemm, queue, transa, transb, m, n, k, alpha, a, lda, b, ldb,
                              beta, c, ldc, dependencies);
@@ -264,7 +387,15 @@ sycl::event symm(sycl::queue& queue, oneapi::math::side left_right, oneapi::math
                  const std::complex<real_t>* a, std::int64_t lda, const std::complex<real_t>* b,
                  std::int64_t ldb, std::complex<real_t> beta, std::complex<real_t>* c,
                  std::int64_t ldc, const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "symm", " for USM");
+    detail::check_precision<real_t>(queue);
+    return queue.submit([&](sycl::handler& cgh) {
+        cgh.depends_on(dependencies);
+        detail::symm(cgh, false, left_right, upper_lower, m, n, detail::to_sycl_complex(alpha),
+                     detail::matrix(detail::as_sycl_complex(a), lda, is_column_major()),
+                     detail::matrix(detail::as_sycl_complex(b), ldb, is_column_major()),
+                     detail::to_sycl_complex(beta),
+                     detail::matrix(detail::as_sycl_complex(c), ldc, is_column_major()));
+    });
 }
 
 sycl::event hemm(sycl::queue& queue, oneapi::math::side left_right, oneapi::math::uplo upper_lower,
@@ -272,7 +403,15 @@ sycl::event hemm(sycl::queue& queue, oneapi::math::side left_right, oneapi::math
                  const std::complex<real_t>* a, std::int64_t lda, const std::complex<real_t>* b,
                  std::int64_t ldb, std::complex<real_t> beta, std::complex<real_t>* c,
                  std::int64_t ldc, const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "hemm", " for USM");
+    detail::check_precision<real_t>(queue);
+    return queue.submit([&](sycl::handler& cgh) {
+        cgh.depends_on(dependencies);
+        detail::symm(cgh, true, left_right, upper_lower, m, n, detail::to_sycl_complex(alpha),
+                     detail::matrix(detail::as_sycl_complex(a), lda, is_column_major()),
+                     detail::matrix(detail::as_sycl_complex(b), ldb, is_column_major()),
+                     detail::to_sycl_complex(beta),
+                     detail::matrix(detail::as_sycl_complex(c), ldc, is_column_major()));
+    });
 }
 
 sycl::event syrk(sycl::queue& queue, oneapi::math::uplo upper_lower, oneapi::math::transpose trans,
@@ -287,14 +426,30 @@ sycl::event syrk(sycl::queue& queue, oneapi::math::uplo upper_lower, oneapi::mat
                  const std::complex<real_t>* a, std::int64_t lda, std::complex<real_t> beta,
                  std::complex<real_t>* c, std::int64_t ldc,
                  const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "syrk", " for USM");
+    detail::check_precision<real_t>(queue);
+    detail::check_transpose("syrk", trans, oneapi::math::transpose::trans);
+    return queue.submit([&](sycl::handler& cgh) {
+        cgh.depends_on(dependencies);
+        detail::syrk(cgh, false, upper_lower, trans, n, k, detail::to_sycl_complex(alpha),
+                     detail::matrix(detail::as_sycl_complex(a), lda, is_column_major()),
+                     detail::to_sycl_complex(beta),
+                     detail::matrix(detail::as_sycl_complex(c), ldc, is_column_major()));
+    });
 }
 
 sycl::event herk(sycl::queue& queue, oneapi::math::uplo upper_lower, oneapi::math::transpose trans,
                  std::int64_t n, std::int64_t k, real_t alpha, const std::complex<real_t>* a,
                  std::int64_t lda, real_t beta, std::complex<real_t>* c, std::int64_t ldc,
                  const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "herk", " for USM");
+    detail::check_precision<real_t>(queue);
+    detail::check_transpose("herk", trans, oneapi::math::transpose::conjtrans);
+    return queue.submit([&](sycl::handler& cgh) {
+        cgh.depends_on(dependencies);
+        detail::syrk(cgh, true, upper_lower, trans, n, k, detail::to_sycl_complex<real_t>(alpha),
+                     detail::matrix(detail::as_sycl_complex(a), lda, is_column_major()),
+                     detail::to_sycl_complex<real_t>(beta),
+                     detail::matrix(detail::as_sycl_complex(c), ldc, is_column_major()));
+    });
 }
 
 sycl::event syr2k(sycl::queue& queue, oneapi::math::uplo upper_lower, oneapi::math::transpose trans,
@@ -309,7 +464,16 @@ sycl::event syr2k(sycl::queue& queue, oneapi::math::uplo upper_lower, oneapi::ma
                   const std::complex<real_t>* a, std::int64_t lda, const std::complex<real_t>* b,
                   std::int64_t ldb, std::complex<real_t> beta, std::complex<real_t>* c,
                   std::int64_t ldc, const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "syr2k", " for USM");
+    detail::check_precision<real_t>(queue);
+    detail::check_transpose("syr2k", trans, oneapi::math::transpose::trans);
+    return queue.submit([&](sycl::handler& cgh) {
+        cgh.depends_on(dependencies);
+        detail::syr2k(cgh, false, upper_lower, trans, n, k, detail::to_sycl_complex(alpha),
+                      detail::matrix(detail::as_sycl_complex(a), lda, is_column_major()),
+                      detail::matrix(detail::as_sycl_complex(b), ldb, is_column_major()),
+                      detail::to_sycl_complex(beta),
+                      detail::matrix(detail::as_sycl_complex(c), ldc, is_column_major()));
+    });
 }
 
 sycl::event her2k(sycl::queue& queue, oneapi::math::uplo upper_lower, oneapi::math::transpose trans,
@@ -317,7 +481,16 @@ sycl::event her2k(sycl::queue& queue, oneapi::math::uplo upper_lower, oneapi::ma
                   const std::complex<real_t>* a, std::int64_t lda, const std::complex<real_t>* b,
                   std::int64_t ldb, real_t beta, std::complex<real_t>* c, std::int64_t ldc,
                   const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "her2k", " for USM");
+    detail::check_precision<real_t>(queue);
+    detail::check_transpose("her2k", trans, oneapi::math::transpose::conjtrans);
+    return queue.submit([&](sycl::handler& cgh) {
+        cgh.depends_on(dependencies);
+        detail::syr2k(cgh, true, upper_lower, trans, n, k, detail::to_sycl_complex(alpha),
+                      detail::matrix(detail::as_sycl_complex(a), lda, is_column_major()),
+                      detail::matrix(detail::as_sycl_complex(b), ldb, is_column_major()),
+                      detail::to_sycl_complex<real_t>(beta),
+                      detail::matrix(detail::as_sycl_complex(c), ldc, is_column_major()));
+    });
 }
 
 sycl::event trmm(sycl::queue& queue, oneapi::math::side left_right, oneapi::math::uplo upper_lower,
@@ -332,7 +505,33 @@ sycl::event trmm(sycl::queue& queue, oneapi::math::side left_right, oneapi::math
                  std::int64_t n, std::complex<real_t> alpha, const std::complex<real_t>* a,
                  std::int64_t lda, std::complex<real_t>* b, std::int64_t ldb,
                  const std::vector<sycl::event>& dependencies) {
-    throw unimplemented("blas", "trmm", " for USM");
+    detail::check_precision<real_t>(queue);
+    // B is overwritten by the product, which reads it from a column major copy
+    auto b_copy = sycl::malloc_device<detail::sycl_complex_t<real_t>>(
+        std::max<std::int64_t>(m * n, 1), queue);
+    if (!b_copy)
+        throw device_bad_alloc("blas", "trmm", queue.get_device());
+    auto copied = queue.submit([&](sycl::handler& cgh) {
+        cgh.depends_on(dependencies);
+        detail::copy_matrix(cgh, m, n,
+                            detail::matrix(detail::as_sycl_complex(b), ldb, is_column_major()),
+                            detail::matrix(b_copy, m, true));
+    });
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        cgh.depends_on(copied);
+        detail::trmm(cgh, left_right, upper_lower, trans, unit_diag, m, n,
+                     detail::to_sycl_complex(alpha),
+                     detail::matrix(detail::as_sycl_complex(a), lda, is_column_major()),
+                     detail::matrix(detail::as_sycl_complex(b), ldb, is_column_major()),
+                     detail::matrix(static_cast<const detail::sycl_complex_t<real_t>*>(b_copy), m,
+                                    true));
+    });
+    queue.submit([&](sycl::handler& cgh) {
+        cgh.depends_on(done);
+        auto context = queue.get_context();
+        cgh.host_task([=]() { sycl::free(b_copy, context); });
+    });
+    return done;
 }
 
 sycl::event trsm(sycl::queue& queue, oneapi::math::side left_right, oneapi::math::uplo upper_lower,
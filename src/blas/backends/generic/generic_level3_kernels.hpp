@@ -0,0 +1,629 @@
+/*******************************************************************************
+* Copyright Codeplay Software
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _GENERIC_BLAS_LEVEL3_KERNELS_HPP_
+#define _GENERIC_BLAS_LEVEL3_KERNELS_HPP_
+
+#include "generic_common.hpp"
+
+#include <algorithm>
+#include <complex>
+#include <cstdint>
+#include <type_traits>
+
+namespace oneapi {
+namespace math {
+namespace blas {
+namespace generic {
+namespace detail {
+
+// In the kernel namespace of the library, see generic_common.hpp
+inline namespace GENERIC_BLAS_KERNEL_NAMESPACE {
+
+/** Level 3 routines that onemath_sycl_blas does not provide: the complex
+ *  ones, and the batched gemm of the low precision types.
+ *
+ *  Every routine is a product C = op_left * op_right of element views of its
+ *  operands, computed by one tiled kernel. The views implement the storage of
+ *  the operand (symmetric, Hermitian or triangular), its transposition and
+ *  the layout, so that the kernel itself only sees dense matrices. The views
+ *  convert the elements to the accumulation type of the kernel as they load
+ *  them.
+**/
+
+// Edge of the square tiles of the product kernel, and of its work-groups
+constexpr std::int64_t product_tile = 16;
+// Work-groups of the product kernel, which go over all the tiles of a larger product
+constexpr std::int64_t product_max_groups = std::int64_t(1) << 20;
+
+template <typename T>
+struct is_sycl_complex : std::false_type {};
+
+template <typename R>
+struct is_sycl_complex<sycl_complex_t<R>> : std::true_type {};
+
+// conj(value) for complex types, value for real ones
+template <typename T>
+T conjugate(T value) {
+    if constexpr (is_sycl_complex<T>::value)
+        return sycl::ext::oneapi::experimental::conj(value);
+    else
+        return value;
+}
+
+/** Matrices of a strided batch, or a single matrix with stride 0.
+ *
+ *  @tparam P is a pointer or a 1D accessor.
+**/
+template <typename P>
+struct strided_matrix {
+    P data;
+    std::int64_t ld;
+    std::int64_t stride;
+    bool column_major;
+
+    decltype(auto) operator()(std::int64_t batch, std::int64_t i, std::int64_t j) const {
+        return data[batch * stride + (column_major ? i + j * ld : i * ld + j)];
+    }
+};
+
+/** Matrices of a group of a batch given by an array of pointers.
+ *
+ *  @tparam T is the element type, const for input matrices.
+**/
+template <typename T>
+struct pointer_array_matrix {
+    T* const* data;
+    std::int64_t ld;
+    std::int64_t offset;
+    bool column_major;
+
+    T& operator()(std::int64_t batch, std::int64_t i, std::int64_t j) const {
+        return data[offset + batch][column_major ? i + j * ld : i * ld + j];
+    }
+};
+
+// op(X) of a general matrix
+template <typename T, typename M>
+struct general_view {
+    M x;
+    transpose trans;
+
+    T operator()(std::int64_t batch, std::int64_t i, std::int64_t j) const {
+        if (trans == transpose::nontrans)
+            return x(batch, i, j);
+        const T value = x(batch, j, i);
+        return trans == transpose::conjtrans ? conjugate(value) : value;
+    }
+};
+
+// Symmetric or Hermitian matrix, of which only the upper_lower triangle is read
+template <typename T, typename M>
+struct symmetric_view {
+    M x;
+    bool upper;
+    bool hermitian;
+
+    T operator()(std::int64_t batch, std::int64_t i, std::int64_t j) const {
+        if (i == j) {
+            const T value = x(batch, i, i);
+            return hermitian ? T(value.real(), 0) : value;
+        }
+        if ((i < j) == upper)
+            return x(batch, i, j);
+        const T value = x(batch, j, i);
+        return hermitian ? conjugate(value) : value;
+    }
+};
+
+// op(X) of a triangular matrix, of which only the upper_lower triangle is read
+template <typename T, typename M>
+struct triangular_view {
+    M x;
+    bool upper;
+    transpose trans;
+    bool unit;
+
+    T operator()(std::int64_t batch, std::int64_t i, std::int64_t j) const {
+        const std::int64_t row = trans == transpose::nontrans ? i : j;
+        const std::int64_t col = trans == transpose::nontrans ? j : i;
+        if (row == col && unit)
+            return T(1);
+        if (upper ? row > col : row < col)
+            return T(0);
+        const T value = x(batch, row, col);
+        return trans == transpose::conjtrans ? conjugate(value) : value;
+    }
+};
+
+// op(V)^T, or op(V)^H if conjugate
+template <typename T, typename V>
+struct transposed_view {
+    V v;
+    bool conjugate;
+
+    T operator()(std::int64_t batch, std::int64_t i, std::int64_t j) const {
+        const T value = v(batch, j, i);
+        return conjugate ? detail::conjugate(value) : value;
+    }
+};
+
+// conj(X)
+template <typename M>
+struct conjugated_matrix {
+    M x;
+
+    auto operator()(std::int64_t batch, std::int64_t i, std::int64_t j) const {
+        return conjugate(x(batch, i, j));
+    }
+};
+
+// [first_scale * first, second_scale * second], with k columns in first
+template <typename T, typename V1, typename V2>
+struct column_concat_view {
+    V1 first;
+    V2 second;
+    std::int64_t k;
+    T first_scale;
+    T second_scale;
+
+    T operator()(std::int64_t batch, std::int64_t i, std::int64_t j) const {
+        return j < k ? first_scale * first(batch, i, j) : second_scale * second(batch, i, j - k);
+    }
+};
+
+// [first; second], with k rows in first
+template <typename T, typename V1, typename V2>
+struct row_concat_view {
+    V1 first;
+    V2 second;
+    std::int64_t k;
+
+    T operator()(std::int64_t batch, std::int64_t i, std::int64_t j) const {
+        return i < k ? first(batch, i, j) : second(batch, i - k, j);
+    }
+};
+
+enum class triangle : char { full, upper, lower };
+
+/** Output of the product kernel: C = alpha * product + beta * C on the
+ *  elements of a triangle of C, computed in the type S of alpha and beta and
+ *  converted to the element type of C. C is not read if beta is zero.
+**/
+template <typename S, typename M>
+struct product_output {
+    M c;
+    S alpha;
+    S beta;
+    triangle part;
+    // Imaginary part of the diagonal set to zero, for Hermitian results
+    bool real_diagonal;
+
+    // Whether any element of rows [i_first, i_last] and columns [j_first, j_last] is written
+    bool touches(std::int64_t i_first, std::int64_t i_last, std::int64_t j_first,
+                 std::int64_t j_last) const {
+        return part == triangle::full || (part == triangle::upper ? i_first <= j_last
+                                                                  : i_last >= j_first);
+    }
+
+    bool contains(std::int64_t i, std::int64_t j) const {
+        return touches(i, i, j, j);
+    }
+
+    template <typename T>
+    void operator()(std::int64_t batch, std::int64_t i, std::int64_t j, T product) const {
+        auto&& element = c(batch, i, j);
+        S value = alpha * S(product);
+        if (beta != S(0))
+            value = value + beta * S(element);
+        if constexpr (is_sycl_complex<S>::value) {
+            if (real_diagonal && i == j)
+                value = S(value.real(), 0);
+        }
+        element = static_cast<std::remove_reference_t<decltype(element)>>(value);
+    }
+};
+
+/** Submits the kernel computing, for every batch item and every element (i, j)
+ *  of the m x n result, the sum over l < k of left(batch, i, l) * right(batch, l, j)
+ *  in the type T, and handing it to out(batch, i, j, sum).
+ *
+ *  Each work-group computes tiles of the result, loading the k dimension in
+ *  tiles of left and right to local memory. Tiles that out does not touch are
+ *  skipped.
+ *
+ *  The tiles of all the batch items are numbered along the last dimension of
+ *  the range, the only one not limited to 65535 work-groups on CUDA and HIP
+ *  devices. Work-groups go over the tiles with a stride of their number, which
+ *  is capped at product_max_groups.
+**/
+template <typename T, typename Left, typename Right, typename Out>
+void product(sycl::handler& cgh, std::int64_t batch_size, std::int64_t m, std::int64_t n,
+             std::int64_t k, Left left, Right right, Out out) {
+    constexpr std::int64_t tile = product_tile;
+    const std::int64_t m_tiles = (m + tile - 1) / tile;
+    const std::int64_t n_tiles = (n + tile - 1) / tile;
+    const std::int64_t num_tiles = batch_size * m_tiles * n_tiles;
+    const std::int64_t num_groups = std::min(num_tiles, product_max_groups);
+    // left_tile is stored transposed, so that the work-items of a row read consecutive elements
+    sycl::local_accessor<T, 2> left_tile(sycl::range<2>(tile, tile), cgh);
+    sycl::local_accessor<T, 2> right_tile(sycl::range<2>(tile, tile), cgh);
+    // Consecutive work-items compute consecutive rows of a column, and consecutive tiles are
+    // consecutive along the rows
+    const sycl::range<2> global(tile, num_groups * tile);
+    const sycl::range<2> local(tile, tile);
+    cgh.parallel_for(sycl::nd_range<2>(global, local), [=](sycl::nd_item<2> item) {
+        const std::int64_t tile_col = item.get_local_id(0);
+        const std::int64_t tile_row = item.get_local_id(1);
+        for (std::int64_t t = item.get_group(1); t < num_tiles; t += num_groups) {
+            const std::int64_t i_first = t % m_tiles * tile;
+            const std::int64_t j_first = t / m_tiles % n_tiles * tile;
+            const std::int64_t batch = t / m_tiles / n_tiles;
+            const std::int64_t i = i_first + tile_row;
+            const std::int64_t j = j_first + tile_col;
+            // Uniform over the work-group, which therefore skips the barriers as a whole
+            if (!out.touches(i_first, i_first + tile - 1, j_first, j_first + tile - 1))
+                continue;
+            T sum(0);
+            for (std::int64_t l_first = 0; l_first < k; l_first += tile) {
+                left_tile[tile_col][tile_row] =
+                    (i < m && l_first + tile_col < k) ? left(batch, i, l_first + tile_col) : T(0);
+                right_tile[tile_row][tile_col] =
+                    (l_first + tile_row < k && j < n) ? right(batch, l_first + tile_row, j) : T(0);
+                sycl::group_barrier(item.get_group());
+                for (std::int64_t l = 0; l < tile; ++l)
+                    sum = sum + left_tile[l][tile_row] * right_tile[l][tile_col];
+                sycl::group_barrier(item.get_group());
+            }
+            if (i < m && j < n && out.contains(i, j))
+                out(batch, i, j, sum);
+        }
+    });
+}
+
+template <typename T, typename M>
+general_view<T, M> general(M x, transpose trans) {
+    return { x, trans };
+}
+
+template <typename S, typename M>
+product_output<S, M> output(M c, S alpha, S beta, triangle part = triangle::full,
+                            bool real_diagonal = false) {
+    return { c, alpha, beta, part, real_diagonal };
+}
+
+inline triangle triangle_of(uplo upper_lower) {
+    return upper_lower == uplo::upper ? triangle::upper : triangle::lower;
+}
+
+// The routines below submit their kernel to cgh. The operands are strided_matrix or
+// pointer_array_matrix, of the sycl complex type T except for gemm. If alpha is zero, A and B
+// are not read.
+
+// gemm accumulating in T, with alpha and beta of type S, for any element types of A, B and C
+template <typename T, typename S, typename MA, typename MB, typename MC>
+void gemm(sycl::handler& cgh, std::int64_t batch_size, transpose transa, transpose transb,
+          std::int64_t m, std::int64_t n, std::int64_t k, S alpha, MA a, MB b, S beta, MC c) {
+    product<T>(cgh, batch_size, m, n, alpha == S(0) ? 0 : k, general<T>(a, transa),
+               general<T>(b, transb), output(c, alpha, beta));
+}
+
+template <typename T, typename MA, typename MB, typename MC>
+void symm(sycl::handler& cgh, bool hermitian, side left_right, uplo upper_lower, std::int64_t m,
+          std::int64_t n, T alpha, MA a, MB b, T beta, MC c) {
+    const symmetric_view<T, MA> a_view{ a, upper_lower == uplo::upper, hermitian };
+    const auto b_view = general<T>(b, transpose::nontrans);
+    if (left_right == side::left)
+        product<T>(cgh, 1, m, n, alpha == T(0) ? 0 : m, a_view, b_view, output(c, alpha, beta));
+    else
+        product<T>(cgh, 1, m, n, alpha == T(0) ? 0 : n, b_view, a_view, output(c, alpha, beta));
+}
+
+// syrk if hermitian is false, herk otherwise, with alpha and beta real for herk
+template <typename T, typename MA, typename MC>
+void syrk(sycl::handler& cgh, bool hermitian, uplo upper_lower, transpose trans, std::int64_t n,
+          std::int64_t k, T alpha, MA a, T beta, MC c) {
+    const auto a_view = general<T>(a, trans);
+    const transposed_view<T, decltype(a_view)> a_transposed{ a_view, hermitian };
+    product<T>(cgh, 1, n, n, alpha == T(0) ? 0 : k, a_view, a_transposed,
+               output(c, alpha, beta, triangle_of(upper_lower), hermitian));
+}
+
+// syr2k if hermitian is false, her2k otherwise, with beta real for her2k:
+// C = alpha * op(A) * op(B)^T + alpha * op(B) * op(A)^T + beta * C, or
+// C = alpha * op(A) * op(B)^H + conj(alpha) * op(B) * op(A)^H + beta * C,
+// computed as the product of [alpha * op(A), alpha' * op(B)] by [op(B)^T; op(A)^T]
+template <typename T, typename MA, typename MB, typename MC>
+void syr2k(sycl::handler& cgh, bool hermitian, uplo upper_lower, transpose trans, std::int64_t n,
+           std::int64_t k, T alpha, MA a, MB b, T beta, MC c) {
+    const auto a_view = general<T>(a, trans);
+    const auto b_view = general<T>(b, trans);
+    const column_concat_view<T, decltype(a_view), decltype(b_view)> left{
+        a_view, b_view, k, alpha,
+        hermitian ? sycl::ext::oneapi::experimental::conj(alpha) : alpha
+    };
+    const row_concat_view<T, transposed_view<T, decltype(b_view)>,
+                          transposed_view<T, decltype(a_view)>>
+        right{ { b_view, hermitian }, { a_view, hermitian }, k };
+    product<T>(cgh, 1, n, n, alpha == T(0) ? 0 : 2 * k, left, right,
+               output(c, T(1), beta, triangle_of(upper_lower), hermitian));
+}
+
+// B = alpha * op(A) * B or alpha * B * op(A), reading B from b_copy, a copy of B
+template <typename T, typename MA, typename MB, typename MBCopy>
+void trmm(sycl::handler& cgh, side left_right, uplo upper_lower, transpose trans, diag unit_diag,
+          std::int64_t m, std::int64_t n, T alpha, MA a, MB b, MBCopy b_copy) {
+    const triangular_view<T, MA> a_view{ a, upper_lower == uplo::upper, trans,
+                                         unit_diag == diag::unit };
+    const auto b_view = general<T>(b_copy, transpose::nontrans);
+    if (left_right == side::left)
+        product<T>(cgh, 1, m, n, alpha == T(0) ? 0 : m, a_view, b_view, output(b, alpha, T(0)));
+    else
+        product<T>(cgh, 1, m, n, alpha == T(0) ? 0 : n, b_view, a_view, output(b, alpha, T(0)));
+}
+
+// Submits the copy of the m x n matrix from to to
+template <typename MFrom, typename MTo>
+void copy_matrix(sycl::handler& cgh, std::int64_t m, std::int64_t n, MFrom from, MTo to) {
+    cgh.parallel_for(sycl::range<2>(n, m), [=](sycl::item<2> item) {
+        const std::int64_t j = item.get_id(0);
+        const std::int64_t i = item.get_id(1);
+        to(0, i, j) = from(0, i, j);
+    });
+}
+
+template <typename R>
+sycl_complex_t<R> to_sycl_complex(std::complex<R> value) {
+    return { value.real(), value.imag() };
+}
+
+// Buffer of sycl complex sharing the memory of buffer
+template <typename R>
+sycl::buffer<sycl_complex_t<R>, 1> as_sycl_complex(sycl::buffer<std::complex<R>, 1>& buffer) {
+    return buffer.template reinterpret<sycl_complex_t<R>, 1>(buffer.get_range());
+}
+
+template <typename R>
+const sycl_complex_t<R>* as_sycl_complex(const std::complex<R>* pointer) {
+    return reinterpret_cast<const sycl_complex_t<R>*>(pointer);
+}
+
+template <typename R>
+sycl_complex_t<R>* as_sycl_complex(std::complex<R>* pointer) {
+    return reinterpret_cast<sycl_complex_t<R>*>(pointer);
+}
+
+template <typename R>
+const sycl_complex_t<R>* const* as_sycl_complex(const std::complex<R>** pointers) {
+    return reinterpret_cast<const sycl_complex_t<R>* const*>(pointers);
+}
+
+template <typename R>
+sycl_complex_t<R>* const* as_sycl_complex(std::complex<R>** pointers) {
+    return reinterpret_cast<sycl_complex_t<R>* const*>(pointers);
+}
+
+template <typename P>
+strided_matrix<P> matrix(P data, std::int64_t ld, bool column_major, std::int64_t stride = 0) {
+    return { data, ld, stride, column_major };
+}
+
+template <typename M>
+conjugated_matrix<M> conjugated(M x) {
+    return { x };
+}
+
+// Throws unsupported_device if one of the types Ts is not supported by the device
+template <typename... Ts>
+void check_precision(sycl::queue& queue) {
+    throw_if_unsupported_by_device<double, sycl::aspect::fp64>{}(
+        " generic BLAS function requiring fp64 support", queue, Ts{}...);
+    throw_if_unsupported_by_device<sycl::half, sycl::aspect::fp16>{}(
+        " generic BLAS function requiring fp16 support", queue, Ts{}...);
+}
+
+// Throws invalid_argument for the transposition that the routine does not accept: trans for
+// the Hermitian routines, conjtrans for the symmetric ones
+inline void check_transpose(const std::string& function, transpose trans, transpose accepted) {
+    if (trans != transpose::nontrans && trans != accepted)
+        throw invalid_argument("blas", function, "unsupported transpose");
+}
+
+template <typename S, typename U>
+S to_scalar(U value) {
+    if constexpr (is_sycl_complex<S>::value)
+        return to_sycl_complex(value);
+    else
+        return static_cast<S>(value);
+}
+
+/** Conjugated copies of the operands that gemm takes with transpose::conjtrans,
+ *  which onemath_sycl_blas does not accept. The tuned gemm of onemath_sycl_blas
+ *  then takes the copy with transpose::trans.
+ *
+ *  Both compute conj(X) of the column major rows x cols matrix X to a dense
+ *  column major matrix, with a leading dimension of max(rows, 1).
+**/
+
+template <typename R>
+sycl::buffer<std::complex<R>, 1> conjugated_copy(sycl::queue& queue, std::int64_t rows,
+                                                 std::int64_t cols,
+                                                 sycl::buffer<std::complex<R>, 1>& x,
+                                                 std::int64_t ldx) {
+    check_precision<R>(queue);
+    sycl::buffer<std::complex<R>, 1> copy{ sycl::range<1>(
+        std::max<std::int64_t>(rows * cols, 1)) };
+    auto x_sycl = as_sycl_complex(x);
+    auto copy_sycl = as_sycl_complex(copy);
+    queue.submit([&](sycl::handler& cgh) {
+        auto x_acc = x_sycl.template get_access<sycl::access::mode::read>(cgh);
+        auto copy_acc = copy_sycl.template get_access<sycl::access::mode::discard_write>(cgh);
+        copy_matrix(cgh, rows, cols, conjugated(matrix(x_acc, ldx, true)),
+                    matrix(copy_acc, std::max<std::int64_t>(rows, 1), true));
+    });
+    return copy;
+}
+
+// Computes the copy to copy, which holds at least rows * cols elements, after the dependencies
+template <typename R>
+sycl::event conjugated_copy(sycl::queue& queue, std::int64_t rows, std::int64_t cols,
+                            const std::complex<R>* x, std::int64_t ldx, std::complex<R>* copy,
+                            const std::vector<sycl::event>& dependencies) {
+    check_precision<R>(queue);
+    return queue.submit([&](sycl::handler& cgh) {
+        cgh.depends_on(dependencies);
+        copy_matrix(cgh, rows, cols, conjugated(matrix(as_sycl_complex(x), ldx, true)),
+                    matrix(as_sycl_complex(copy), std::max<std::int64_t>(rows, 1), true));
+    });
+}
+
+/** gemm_batch of the buffer, strided USM and group USM APIs.
+ *
+ *  @tparam T is the accumulation type.
+ *  @tparam S is the type in which alpha and beta are applied.
+ *  @tparam TAB is the element type of A and B, TC the one of C.
+**/
+
+template <typename T, typename S, typename TAB, typename TC>
+void gemm_batch(sycl::queue& queue, bool column_major, transpose transa, transpose transb,
+                std::int64_t m, std::int64_t n, std::int64_t k, S alpha, sycl::buffer<TAB, 1> a,
+                std::int64_t lda, std::int64_t stride_a, sycl::buffer<TAB, 1> b,
+                std::int64_t ldb, std::int64_t stride_b, S beta, sycl::buffer<TC, 1> c,
+                std::int64_t ldc, std::int64_t stride_c, std::int64_t batch_size) {
+    check_precision<TAB, TC>(queue);
+    queue.submit([&](sycl::handler& cgh) {
+        auto a_acc = a.template get_access<sycl::access::mode::read>(cgh);
+        auto b_acc = b.template get_access<sycl::access::mode::read>(cgh);
+        auto c_acc = c.template get_access<sycl::access::mode::read_write>(cgh);
+        gemm<T>(cgh, batch_size, transa, transb, m, n, k, alpha,
+                matrix(a_acc, lda, column_major, stride_a),
+                matrix(b_acc, ldb, column_major, stride_b), beta,
+                matrix(c_acc, ldc, column_major, stride_c));
+    });
+}
+
+template <typename T, typename S, typename TAB, typename TC>
+sycl::event gemm_batch(sycl::queue& queue, bool column_major, transpose transa, transpose transb,
+                       std::int64_t m, std::int64_t n, std::int64_t k, S alpha, const TAB* a,
+                       std::int64_t lda, std::int64_t stride_a, const TAB* b, std::int64_t ldb,
+                       std::int64_t stride_b, S beta, TC* c, std::int64_t ldc,
+                       std::int64_t stride_c, std::int64_t batch_size,
+                       const std::vector<sycl::event>& dependencies) {
+    check_precision<TAB, TC>(queue);
+    return queue.submit([&](sycl::handler& cgh) {
+        cgh.depends_on(dependencies);
+        gemm<T>(cgh, batch_size, transa, transb, m, n, k, alpha,
+                matrix(a, lda, column_major, stride_a), matrix(b, ldb, column_major, stride_b),
+                beta, matrix(c, ldc, column_major, stride_c));
+    });
+}
+
+// One kernel per group, the groups running concurrently as they write distinct matrices.
+// alpha and beta are of the API type U, converted to S.
+template <typename T, typename S, typename U, typename TAB, typename TC>
+sycl::event gemm_batch(sycl::queue& queue, bool column_major, transpose* transa,
+                       transpose* transb, std::int64_t* m, std::int64_t* n, std::int64_t* k,
+                       U* alpha, const TAB* const* a, std::int64_t* lda, const TAB* const* b,
+                       std::int64_t* ldb, U* beta, TC* const* c, std::int64_t* ldc,
+                       std::int64_t group_count, std::int64_t* group_size,
+                       const std::vector<sycl::event>& dependencies) {
+    check_precision<TAB, TC>(queue);
+    std::vector<sycl::event> group_events;
+    std::int64_t offset = 0;
+    for (std::int64_t group = 0; group < group_count; ++group) {
+        group_events.push_back(queue.submit([&](sycl::handler& cgh) {
+            cgh.depends_on(dependencies);
+            gemm<T>(cgh, group_size[group], transa[group], transb[group], m[group], n[group],
+                    k[group], to_scalar<S>(alpha[group]),
+                    pointer_array_matrix<const TAB>{ a, lda[group], offset, column_major },
+                    pointer_array_matrix<const TAB>{ b, ldb[group], offset, column_major },
+                    to_scalar<S>(beta[group]),
+                    pointer_array_matrix<TC>{ c, ldc[group], offset, column_major });
+        }));
+        offset += group_size[group];
+    }
+    if (group_events.empty())
+        group_events = dependencies;
+    if (group_events.size() == 1)
+        return group_events[0];
+    // Joins the events on the device rather than in a host task
+#ifdef SYCL_EXT_ONEAPI_ENQUEUE_BARRIER
+    return queue.ext_oneapi_submit_barrier(group_events);
+#else
+    return queue.submit([&](sycl::handler& cgh) {
+        cgh.depends_on(group_events);
+        cgh.single_task([]() {});
+    });
+#endif
+}
+
+// Complex gemm_batch, on the sycl complex type sharing the memory of std::complex
+
+template <typename R>
+void gemm_batch(sycl::queue& queue, bool column_major, transpose transa, transpose transb,
+                std::int64_t m, std::int64_t n, std::int64_t k, std::complex<R> alpha,
+                sycl::buffer<std::complex<R>, 1>& a, std::int64_t lda, std::int64_t stride_a,
+                sycl::buffer<std::complex<R>, 1>& b, std::int64_t ldb, std::int64_t stride_b,
+                std::complex<R> beta, sycl::buffer<std::complex<R>, 1>& c, std::int64_t ldc,
+                std::int64_t stride_c, std::int64_t batch_size) {
+    check_precision<R>(queue);
+    gemm_batch<sycl_complex_t<R>>(queue, column_major, transa, transb, m, n, k,
+                                  to_sycl_complex(alpha), as_sycl_complex(a), lda, stride_a,
+                                  as_sycl_complex(b), ldb, stride_b, to_sycl_complex(beta),
+                                  as_sycl_complex(c), ldc, stride_c, batch_size);
+}
+
+template <typename R>
+sycl::event gemm_batch(sycl::queue& queue, bool column_major, transpose transa, transpose transb,
+                       std::int64_t m, std::int64_t n, std::int64_t k, std::complex<R> alpha,
+                       const std::complex<R>* a, std::int64_t lda, std::int64_t stride_a,
+                       const std::complex<R>* b, std::int64_t ldb, std::int64_t stride_b,
+                       std::complex<R> beta, std::complex<R>* c, std::int64_t ldc,
+                       std::int64_t stride_c, std::int64_t batch_size,
+                       const std::vector<sycl::event>& dependencies) {
+    check_precision<R>(queue);
+    return gemm_batch<sycl_complex_t<R>>(queue, column_major, transa, transb, m, n, k,
+                                         to_sycl_complex(alpha), as_sycl_complex(a), lda,
+                                         stride_a, as_sycl_complex(b), ldb, stride_b,
+                                         to_sycl_complex(beta), as_sycl_complex(c), ldc, stride_c,
+                                         batch_size, dependencies);
+}
+
+template <typename R>
+sycl::event gemm_batch(sycl::queue& queue, bool column_major, transpose* transa,
+                       transpose* transb, std::int64_t* m, std::int64_t* n, std::int64_t* k,
+                       std::complex<R>* alpha, const std::complex<R>** a, std::int64_t* lda,
+                       const std::complex<R>** b, std::int64_t* ldb, std::complex<R>* beta,
+                       std::complex<R>** c, std::int64_t* ldc, std::int64_t group_count,
+                       std::int64_t* group_size, const std::vector<sycl::event>& dependencies) {
+    check_precision<R>(queue);
+    return gemm_batch<sycl_complex_t<R>, sycl_complex_t<R>>(
+        queue, column_major, transa, transb, m, n, k, alpha, as_sycl_complex(a), lda,
+        as_sycl_complex(b), ldb, beta, as_sycl_complex(c), ldc, group_count, group_size,
+        dependencies);
+}
+
+} // namespace GENERIC_BLAS_KERNEL_NAMESPACE
+} // namespace detail
+} // namespace generic
+} // namespace blas
+} // namespace math
+} // namespace oneapi
+
+#endif // _GENERIC_BLAS_LEVEL3_KERNELS_HPP_
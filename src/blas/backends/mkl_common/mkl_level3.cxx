@@ -312,10 +312,19 @@ void trsm(sycl::queue& queue, side left_right, uplo upper_lower, transpose trans
 
 // USM APIs
 
+// The mklcpu backend defines MKLCPU_CBLAS_LAYOUT, so that the float and complex gemm routines
+// of a queue whose CPU execution policy sets num_threads run with that many threads
+
 sycl::event gemm(sycl::queue& queue, transpose transa, transpose transb, std::int64_t m,
                  std::int64_t n, std::int64_t k, float alpha, const float* a, std::int64_t lda,
                  const float* b, std::int64_t ldb, float beta, float* c, std::int64_t ldc,
                  const std::vector<sycl::event>& dependencies) {
+#ifdef MKLCPU_CBLAS_LAYOUT
+    if (const int num_threads = policy_num_threads(queue)) {
+        return gemm_with_threads(queue, MKLCPU_CBLAS_LAYOUT, transa, transb, m, n, k, alpha, a, lda,
+                                 b, ldb, beta, c, ldc, dependencies, num_threads);
+    }
+#endif
     RETHROW_ONEMKL_EXCEPTIONS_RET(blas_major::gemm(
         queue, detail::get_onemkl_transpose(transa), detail::get_onemkl_transpose(transb), m, n, k,
         alpha, a, lda, b, ldb, beta, c, ldc, dependencies));
@@ -325,6 +334,12 @@ sycl::event gemm(sycl::queue& queue, transpose transa, transpose transb, std::in
                  std::int64_t n, std::int64_t k, double alpha, const double* a, std::int64_t lda,
                  const double* b, std::int64_t ldb, double beta, double* c, std::int64_t ldc,
                  const std::vector<sycl::event>& dependencies) {
+#ifdef MKLCPU_CBLAS_LAYOUT
+    if (const int num_threads = policy_num_threads(queue)) {
+        return gemm_with_threads(queue, MKLCPU_CBLAS_LAYOUT, transa, transb, m, n, k, alpha, a, lda,
+                                 b, ldb, beta, c, ldc, dependencies, num_threads);
+    }
+#endif
     RETHROW_ONEMKL_EXCEPTIONS_RET(blas_major::gemm(
         queue, detail::get_onemkl_transpose(transa), detail::get_onemkl_transpose(transb), m, n, k,
         alpha, a, lda, b, ldb, beta, c, ldc, dependencies));
@@ -335,6 +350,12 @@ sycl::event gemm(sycl::queue& queue, transpose transa, transpose transb, std::in
                  const std::complex<float>* a, std::int64_t lda, const std::complex<float>* b,
                  std::int64_t ldb, std::complex<float> beta, std::complex<float>* c,
                  std::int64_t ldc, const std::vector<sycl::event>& dependencies) {
+#ifdef MKLCPU_CBLAS_LAYOUT
+    if (const int num_threads = policy_num_threads(queue)) {
+        return gemm_with_threads(queue, MKLCPU_CBLAS_LAYOUT, transa, transb, m, n, k, alpha, a, lda,
+                                 b, ldb, beta, c, ldc, dependencies, num_threads);
+    }
+#endif
     RETHROW_ONEMKL_EXCEPTIONS_RET(blas_major::gemm(
         queue, detail::get_onemkl_transpose(transa), detail::get_onemkl_transpose(transb), m, n, k,
         alpha, a, lda, b, ldb, beta, c, ldc, dependencies));
@@ -345,6 +366,12 @@ sycl::event gemm(sycl::queue& queue, transpose transa, transpose transb, std::in
                  const std::complex<double>* a, std::int64_t lda, const std::complex<double>* b,
                  std::int64_t ldb, std::complex<double> beta, std::complex<double>* c,
                  std::int64_t ldc, const std::vector<sycl::event>& dependencies) {
+#ifdef MKLCPU_CBLAS_LAYOUT
+    if (const int num_threads = policy_num_threads(queue)) {
+        return gemm_with_threads(queue, MKLCPU_CBLAS_LAYOUT, transa, transb, m, n, k, alpha, a, lda,
+                                 b, ldb, beta, c, ldc, dependencies, num_threads);
+    }
+#endif
     RETHROW_ONEMKL_EXCEPTIONS_RET(blas_major::gemm(
         queue, detail::get_onemkl_transpose(transa), detail::get_onemkl_transpose(transb), m, n, k,
         alpha, a, lda, b, ldb, beta, c, ldc, dependencies));
@@ -0,0 +1,125 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _MKLCPU_EXECUTION_POLICY_HPP_
+#define _MKLCPU_EXECUTION_POLICY_HPP_
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include <complex>
+#include <cstdint>
+#include <vector>
+
+#include <mkl_cblas.h>
+#include <mkl_service.h>
+
+#include "cpu_execution_policy_lookup.hpp"
+#include "oneapi/math/types.hpp"
+
+namespace oneapi {
+namespace math {
+namespace blas {
+namespace mklcpu {
+
+// The oneMKL SYCL routines run their work in the execution context of oneMKL, where a thread
+// count set on the submitting thread does not apply. A routine honoring the num_threads of the
+// execution policy of its queue therefore runs as a host task of its own, which sets the thread
+// count of the oneMKL C call it makes on its thread. The CPUs of the policy are left to the
+// threading layer of oneMKL.
+
+// num_threads of the execution policy of the queue, or 0 if it has none
+inline int policy_num_threads(const sycl::queue& queue) {
+    auto policy = oneapi::math::detail::find_cpu_execution_policy(queue);
+    return policy ? static_cast<int>(policy->num_threads) : 0;
+}
+
+// Runs f, a oneMKL C call, in a host task after the dependencies, with the number of threads
+// of the oneMKL calls made on the thread of the host task set to num_threads
+template <typename F>
+sycl::event submit_with_threads(sycl::queue& queue, const std::vector<sycl::event>& dependencies,
+                                int num_threads, F f) {
+    return queue.submit([&](sycl::handler& cgh) {
+        cgh.depends_on(dependencies);
+        cgh.host_task([=]() {
+            const int previous = mkl_set_num_threads_local(num_threads);
+            f();
+            // 0 restores the global number of threads
+            mkl_set_num_threads_local(previous);
+        });
+    });
+}
+
+inline CBLAS_TRANSPOSE get_cblas_transpose(transpose trans) {
+    return trans == transpose::nontrans ? CblasNoTrans
+                                        : (trans == transpose::trans ? CblasTrans : CblasConjTrans);
+}
+
+inline void cblas_gemm(CBLAS_LAYOUT layout, CBLAS_TRANSPOSE transa, CBLAS_TRANSPOSE transb,
+                       MKL_INT m, MKL_INT n, MKL_INT k, float alpha, const float* a, MKL_INT lda,
+                       const float* b, MKL_INT ldb, float beta, float* c, MKL_INT ldc) {
+    cblas_sgemm(layout, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+inline void cblas_gemm(CBLAS_LAYOUT layout, CBLAS_TRANSPOSE transa, CBLAS_TRANSPOSE transb,
+                       MKL_INT m, MKL_INT n, MKL_INT k, double alpha, const double* a,
+                       MKL_INT lda, const double* b, MKL_INT ldb, double beta, double* c,
+                       MKL_INT ldc) {
+    cblas_dgemm(layout, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+inline void cblas_gemm(CBLAS_LAYOUT layout, CBLAS_TRANSPOSE transa, CBLAS_TRANSPOSE transb,
+                       MKL_INT m, MKL_INT n, MKL_INT k, std::complex<float> alpha,
+                       const std::complex<float>* a, MKL_INT lda, const std::complex<float>* b,
+                       MKL_INT ldb, std::complex<float> beta, std::complex<float>* c,
+                       MKL_INT ldc) {
+    cblas_cgemm(layout, transa, transb, m, n, k, &alpha, a, lda, b, ldb, &beta, c, ldc);
+}
+
+inline void cblas_gemm(CBLAS_LAYOUT layout, CBLAS_TRANSPOSE transa, CBLAS_TRANSPOSE transb,
+                       MKL_INT m, MKL_INT n, MKL_INT k, std::complex<double> alpha,
+                       const std::complex<double>* a, MKL_INT lda, const std::complex<double>* b,
+                       MKL_INT ldb, std::complex<double> beta, std::complex<double>* c,
+                       MKL_INT ldc) {
+    cblas_zgemm(layout, transa, transb, m, n, k, &alpha, a, lda, b, ldb, &beta, c, ldc);
+}
+
+// USM gemm with the oneMKL C API, in a host task using num_threads threads. On CPU devices,
+// USM allocations of any kind are host memory.
+template <typename T>
+sycl::event gemm_with_threads(sycl::queue& queue, CBLAS_LAYOUT layout, transpose transa,
+                              transpose transb, std::int64_t m, std::int64_t n, std::int64_t k,
+                              T alpha, const T* a, std::int64_t lda, const T* b, std::int64_t ldb,
+                              T beta, T* c, std::int64_t ldc,
+                              const std::vector<sycl::event>& dependencies, int num_threads) {
+    return submit_with_threads(queue, dependencies, num_threads, [=]() {
+        cblas_gemm(layout, get_cblas_transpose(transa), get_cblas_transpose(transb), m, n, k,
+                   alpha, a, lda, b, ldb, beta, c, ldc);
+    });
+}
+
+} // namespace mklcpu
+} // namespace blas
+} // namespace math
+} // namespace oneapi
+
+#endif //_MKLCPU_EXECUTION_POLICY_HPP_
@@ -26,6 +26,7 @@
 #include "oneapi/math/blas/detail/mklcpu/onemath_blas_mklcpu.hpp"
 
 #include "../mkl_common/mkl_blas_backend.hpp"
+#include "mklcpu_execution_policy.hpp"
 
 namespace oneapi {
 namespace math {
@@ -34,13 +35,17 @@ namespace mklcpu {
 namespace column_major {
 
 namespace blas_major = ::oneapi::mkl::blas::column_major;
+#define MKLCPU_CBLAS_LAYOUT CblasColMajor
 #include "../mkl_common/mkl_level3.cxx"
+#undef MKLCPU_CBLAS_LAYOUT
 
 } // namespace column_major
 namespace row_major {
 
 namespace blas_major = ::oneapi::mkl::blas::row_major;
+#define MKLCPU_CBLAS_LAYOUT CblasRowMajor
 #include "../mkl_common/mkl_level3.cxx"
+#undef MKLCPU_CBLAS_LAYOUT
 
 } // namespace row_major
 } // namespace mklcpu
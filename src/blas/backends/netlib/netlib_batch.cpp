@@ -22,8 +22,14 @@
 #else
 #include <CL/sycl.hpp>
 #endif
+#include <algorithm>
+#include <complex>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #include "netlib_common.hpp"
+#include "netlib_thread_pool.hpp"
 #include "oneapi/math/exceptions.hpp"
 #include "oneapi/math/blas/detail/netlib/onemath_blas_netlib.hpp"
 
@@ -31,17 +37,585 @@ namespace oneapi {
 namespace math {
 namespace blas {
 namespace netlib {
+
+// Batch items are handed out to the pool threads in chunks of consecutive items holding
+// about this many elements, so that batches of small problems are not dominated by the
+// hand-out and the memory of neighbouring items is traversed by the same thread
+static constexpr int64_t chunk_elements = 16384;
+
+// Calls f(i) for every item i in [0, batch_size) of a batch whose items have item_elements
+// elements each, spread over the thread pool in chunks
+template <typename F>
+static void parallel_for_batch(int64_t batch_size, int64_t item_elements, F&& f) {
+    const int64_t chunk_items =
+        std::max<int64_t>(1, chunk_elements / std::max<int64_t>(1, item_elements));
+    const int64_t num_chunks = (batch_size + chunk_items - 1) / chunk_items;
+    thread_pool::get().parallel_for(num_chunks, [&](int64_t chunk) {
+        const int64_t end = std::min(batch_size, (chunk + 1) * chunk_items);
+        for (int64_t i = chunk * chunk_items; i < end; ++i)
+            f(i);
+    });
+}
+
+// Calls f(g, i) for every item i of every group g of a group batch, where the items of
+// group g have item_elements(g) elements each. All the groups are run as one range of
+// items, so that small groups are spread over the thread pool as well as large ones.
+template <typename E, typename F>
+static void parallel_for_groups(int64_t group_count, const int64_t* group_size, E&& item_elements,
+                                F&& f) {
+    // Index of the first item of each group, followed by the total number of items
+    std::vector<int64_t> group_start(group_count + 1, 0);
+    int64_t total_elements = 0;
+    for (int64_t g = 0; g < group_count; ++g) {
+        group_start[g + 1] = group_start[g] + group_size[g];
+        total_elements += group_size[g] * item_elements(g);
+    }
+    const int64_t batch_size = group_start.back();
+    if (batch_size <= 0)
+        return;
+    const int64_t chunk_items =
+        std::max<int64_t>(1, chunk_elements * batch_size / std::max<int64_t>(1, total_elements));
+    const int64_t num_chunks = (batch_size + chunk_items - 1) / chunk_items;
+    thread_pool::get().parallel_for(num_chunks, [&](int64_t chunk) {
+        const int64_t begin = chunk * chunk_items;
+        const int64_t end = std::min(batch_size, begin + chunk_items);
+        int64_t g = std::upper_bound(group_start.begin(), group_start.end(), begin) -
+                    group_start.begin() - 1;
+        for (int64_t i = begin; i < end; ++i) {
+            while (i >= group_start[g + 1])
+                ++g;
+            f(g, i);
+        }
+    });
+}
+
+// The routines for a single item of a batch are plain loops rather than CBLAS calls, whose
+// overhead dominates for small problems
+
+template <typename T, typename IncX, typename IncY>
+static void copy_item(int64_t n, const T* x, IncX incx, T* y, IncY incy) {
+    for (int64_t i = 0; i < n; ++i)
+        y[i * incy] = x[i * incx];
+}
+
+template <typename T, typename IncX, typename IncY>
+static void axpy_item(int64_t n, T alpha, const T* x, IncX incx, T* y, IncY incy) {
+    for (int64_t i = 0; i < n; ++i)
+        y[i * incy] += alpha * x[i * incx];
+}
+
+// y += alpha * op(a) * x for a column-major a, where op(a) is a or conj(a), by columns
+template <bool conj, typename T, typename IncX, typename IncY>
+static void gemv_n_item(int64_t m, int64_t n, T alpha, const T* a, int64_t lda, const T* x,
+                        IncX incx, T* y, IncY incy) {
+    for (int64_t j = 0; j < n; ++j) {
+        const T* a_j = a + j * lda;
+        const T alpha_x_j = alpha * x[j * incx];
+        for (int64_t i = 0; i < m; ++i)
+            y[i * incy] += alpha_x_j * (conj ? conj_element(a_j[i]) : a_j[i]);
+    }
+}
+
+// y += alpha * op(a) * x for a column-major a, where op(a) is the transpose or the conjugate
+// transpose of a, by dot products with the columns
+template <bool conj, typename T, typename IncX, typename IncY>
+static void gemv_t_item(int64_t m, int64_t n, T alpha, const T* a, int64_t lda, const T* x,
+                        IncX incx, T* y, IncY incy) {
+    for (int64_t j = 0; j < n; ++j) {
+        const T* a_j = a + j * lda;
+        T sum = T(0);
+        for (int64_t i = 0; i < m; ++i)
+            sum += (conj ? conj_element(a_j[i]) : a_j[i]) * x[i * incx];
+        y[j * incy] += alpha * sum;
+    }
+}
+
+// y = alpha * op(a) * x + beta * y for a column-major a, where op(a) is a, conj(a), the
+// transpose of a or the conjugate transpose of a
+template <typename T, typename IncX, typename IncY>
+static void gemv_item(bool trans, bool conj, int64_t m, int64_t n, T alpha, const T* a,
+                      int64_t lda, const T* x, IncX incx, T beta, T* y, IncY incy) {
+    const int64_t len_y = trans ? n : m;
+    if (beta == T(0)) {
+        for (int64_t i = 0; i < len_y; ++i)
+            y[i * incy] = T(0);
+    }
+    else if (beta != T(1)) {
+        for (int64_t i = 0; i < len_y; ++i)
+            y[i * incy] *= beta;
+    }
+    if (alpha == T(0))
+        return;
+    if (!trans && !conj)
+        gemv_n_item<false>(m, n, alpha, a, lda, x, incx, y, incy);
+    else if (!trans)
+        gemv_n_item<true>(m, n, alpha, a, lda, x, incx, y, incy);
+    else if (!conj)
+        gemv_t_item<false>(m, n, alpha, a, lda, x, incx, y, incy);
+    else
+        gemv_t_item<true>(m, n, alpha, a, lda, x, incx, y, incy);
+}
+
+// c = diag(x) * a if left, else c = a * diag(x), for column-major a and c
+template <typename T, typename IncX>
+static void dgmm_item(bool left, int64_t m, int64_t n, const T* a, int64_t lda, const T* x,
+                      IncX incx, T* c, int64_t ldc) {
+    for (int64_t j = 0; j < n; ++j) {
+        const T* a_j = a + j * lda;
+        T* c_j = c + j * ldc;
+        if (left) {
+            for (int64_t i = 0; i < m; ++i)
+                c_j[i] = x[i * incx] * a_j[i];
+        }
+        else {
+            const T x_j = x[j * incx];
+            for (int64_t i = 0; i < m; ++i)
+                c_j[i] = a_j[i] * x_j;
+        }
+    }
+}
+
+// Solves op(a) * x = b in place for the n columns of x, which are ldb apart in b and whose
+// elements are inc_b apart, where op(a) is a or conj(a) for a column-major triangular a.
+// inv_diag holds the reciprocals of the diagonal of op(a), or is null for a unit diagonal.
+template <bool conj, typename T, typename IncB>
+static void trsm_n_item(bool lower, int64_t m, int64_t n, const T* a, int64_t lda,
+                        const T* inv_diag, T* b, int64_t ldb, IncB inc_b) {
+    for (int64_t j = 0; j < n; ++j) {
+        T* x = b + j * ldb;
+        // Forward substitution for a lower a, backward for an upper one, by columns of a
+        for (int64_t q = 0; q < m; ++q) {
+            const int64_t p = lower ? q : m - 1 - q;
+            if (inv_diag)
+                x[p * inc_b] *= inv_diag[p];
+            const T x_p = x[p * inc_b];
+            const T* a_p = a + p * lda;
+            const int64_t i_end = lower ? m : p;
+            for (int64_t i = lower ? p + 1 : 0; i < i_end; ++i)
+                x[i * inc_b] -= x_p * (conj ? conj_element(a_p[i]) : a_p[i]);
+        }
+    }
+}
+
+// As trsm_n_item, where op(a) is the transpose or the conjugate transpose of a, by dot
+// products with the columns of a
+template <bool conj, typename T, typename IncB>
+static void trsm_t_item(bool lower, int64_t m, int64_t n, const T* a, int64_t lda,
+                        const T* inv_diag, T* b, int64_t ldb, IncB inc_b) {
+    for (int64_t j = 0; j < n; ++j) {
+        T* x = b + j * ldb;
+        // op(a) is upper for a lower a, so backward substitution, and forward for an upper a
+        for (int64_t q = 0; q < m; ++q) {
+            const int64_t i = lower ? m - 1 - q : q;
+            const T* a_i = a + i * lda;
+            const int64_t p_end = lower ? m : i;
+            T sum = x[i * inc_b];
+            for (int64_t p = lower ? i + 1 : 0; p < p_end; ++p)
+                sum -= (conj ? conj_element(a_i[p]) : a_i[p]) * x[p * inc_b];
+            x[i * inc_b] = inv_diag ? sum * inv_diag[i] : sum;
+        }
+    }
+}
+
+// Solves op(a) * x = alpha * b in place, as trsm_n_item, where op(a) is a, conj(a), the
+// transpose of a or the conjugate transpose of a
+template <typename T, typename IncB>
+static void trsm_item(bool trans, bool conj, bool lower, int64_t m, int64_t n, T alpha,
+                      const T* a, int64_t lda, const T* inv_diag, T* b, int64_t ldb,
+                      IncB inc_b) {
+    if (alpha != T(1)) {
+        for (int64_t j = 0; j < n; ++j) {
+            T* x = b + j * ldb;
+            for (int64_t i = 0; i < m; ++i)
+                x[i * inc_b] = alpha == T(0) ? T(0) : alpha * x[i * inc_b];
+        }
+        if (alpha == T(0))
+            return;
+    }
+    if (!trans && !conj)
+        trsm_n_item<false>(lower, m, n, a, lda, inv_diag, b, ldb, inc_b);
+    else if (!trans)
+        trsm_n_item<true>(lower, m, n, a, lda, inv_diag, b, ldb, inc_b);
+    else if (!conj)
+        trsm_t_item<false>(lower, m, n, a, lda, inv_diag, b, ldb, inc_b);
+    else
+        trsm_t_item<true>(lower, m, n, a, lda, inv_diag, b, ldb, inc_b);
+}
+
+// The triangle of the column-major n x n c given by lower = alpha * op(a) * op(a)^T + beta * c,
+// where op(a) is a or its transpose, without conjugation for the complex types
+template <typename T>
+static void syrk_item(bool lower, bool trans, int64_t n, int64_t k, T alpha, const T* a,
+                      int64_t lda, T beta, T* c, int64_t ldc) {
+    for (int64_t j = 0; j < n; ++j) {
+        T* c_j = c + j * ldc;
+        const int64_t i_begin = lower ? j : 0;
+        const int64_t i_end = lower ? n : j + 1;
+        for (int64_t i = i_begin; i < i_end; ++i)
+            c_j[i] = beta == T(0) ? T(0) : beta * c_j[i];
+        if (alpha == T(0))
+            continue;
+        if (!trans) {
+            // Column j of c gains alpha * a(j, p) times column p of a
+            for (int64_t p = 0; p < k; ++p) {
+                const T* a_p = a + p * lda;
+                const T alpha_a_jp = alpha * a_p[j];
+                for (int64_t i = i_begin; i < i_end; ++i)
+                    c_j[i] += alpha_a_jp * a_p[i];
+            }
+        }
+        else {
+            // c(i, j) gains alpha times the dot product of columns i and j of a
+            const T* a_j = a + j * lda;
+            for (int64_t i = i_begin; i < i_end; ++i) {
+                const T* a_i = a + i * lda;
+                T sum = T(0);
+                for (int64_t p = 0; p < k; ++p)
+                    sum += a_i[p] * a_j[p];
+                c_j[i] += alpha * sum;
+            }
+        }
+    }
+}
+
+template <typename T>
+static void copy(int64_t n, const T* x, int64_t incx, T* y, int64_t incy) {
+    if (n <= 0)
+        return;
+    if (incx == 1 && incy == 1)
+        copy_item(n, x, unit_inc(), y, unit_inc());
+    else
+        copy_item(n, x + first_element(n, incx), incx, y + first_element(n, incy), incy);
+}
+
+template <typename T>
+static void axpy(int64_t n, T alpha, const T* x, int64_t incx, T* y, int64_t incy) {
+    if (n <= 0 || alpha == T(0))
+        return;
+    if (incx == 1 && incy == 1)
+        axpy_item(n, alpha, x, unit_inc(), y, unit_inc());
+    else
+        axpy_item(n, alpha, x + first_element(n, incx), incx, y + first_element(n, incy), incy);
+}
+
+template <typename T>
+static void gemv(CBLAS_LAYOUT layout, transpose transa, int64_t m, int64_t n, T alpha, const T* a,
+                 int64_t lda, const T* x, int64_t incx, T beta, T* y, int64_t incy) {
+    if (m <= 0 || n <= 0 || (alpha == T(0) && beta == T(1)))
+        return;
+    // A row-major matrix is the transpose of a column-major one with m and n swapped
+    const bool col_major = layout == CblasColMajor;
+    const bool trans = (transa != transpose::nontrans) == col_major;
+    const bool conj = transa == transpose::conjtrans;
+    if (!col_major)
+        std::swap(m, n);
+    const int64_t len_x = trans ? m : n;
+    const int64_t len_y = trans ? n : m;
+    if (incx == 1 && incy == 1)
+        gemv_item(trans, conj, m, n, alpha, a, lda, x, unit_inc(), beta, y, unit_inc());
+    else
+        gemv_item(trans, conj, m, n, alpha, a, lda, x + first_element(len_x, incx), incx, beta,
+                  y + first_element(len_y, incy), incy);
+}
+
+template <typename T>
+static void dgmm(CBLAS_LAYOUT layout, side left_right, int64_t m, int64_t n, const T* a,
+                 int64_t lda, const T* x, int64_t incx, T* c, int64_t ldc) {
+    if (m <= 0 || n <= 0)
+        return;
+    // A row-major matrix is the transpose of a column-major one with m and n swapped
+    const bool col_major = layout == CblasColMajor;
+    const bool left = (left_right == side::left) == col_major;
+    if (!col_major)
+        std::swap(m, n);
+    if (incx == 1)
+        dgmm_item(left, m, n, a, lda, x, unit_inc(), c, ldc);
+    else
+        dgmm_item(left, m, n, a, lda, x + first_element(left ? m : n, incx), incx, c, ldc);
+}
+
+// Items whose triangular or symmetric matrix is at most of these orders are computed with the
+// loops above, and larger ones with CBLAS calls, which are faster for them. The rank-k update
+// reaches the optimized CBLAS kernels at a smaller order than the solve.
+static constexpr int64_t small_trsm_order = 16;
+static constexpr int64_t small_syrk_order = 4;
+
+template <typename T>
+static void trsm(CBLAS_LAYOUT layout, side left_right, uplo upper_lower, transpose trans,
+                 diag unit_diag, int64_t m, int64_t n, T alpha, const T* a, int64_t lda, T* b,
+                 int64_t ldb, workspace& ws) {
+    if (m <= 0 || n <= 0)
+        return;
+    // A row-major b is the transpose of a column-major one with m and n swapped, which a
+    // multiplies from the other side, and the row-major triangle of a is the other one of the
+    // column-major matrix
+    if (layout == CblasRowMajor) {
+        left_right = left_right == side::left ? side::right : side::left;
+        upper_lower = upper_lower == uplo::lower ? uplo::upper : uplo::lower;
+        std::swap(m, n);
+    }
+    const bool left = left_right == side::left;
+    const int64_t order = left ? m : n;
+    if (order > small_trsm_order) {
+        cblas_trsm(CblasColMajor, convert_to_cblas_side(left_right),
+                   convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
+                   convert_to_cblas_diag(unit_diag), to_cblas_int(m), to_cblas_int(n), alpha, a,
+                   to_cblas_int(lda), b, to_cblas_int(ldb));
+        return;
+    }
+    const bool conj = trans == transpose::conjtrans;
+    // In the workspace of the thread, so that the items of a batch do not allocate
+    T* inv_diag = nullptr;
+    if (unit_diag == diag::nonunit) {
+        inv_diag = ws.get<T>(order);
+        for (int64_t i = 0; i < order; ++i) {
+            const T a_ii = a[i + i * lda];
+            inv_diag[i] = T(1) / (conj ? conj_element(a_ii) : a_ii);
+        }
+    }
+    const bool lower = upper_lower == uplo::lower;
+    // x * op(a) = alpha * b is op(a)^T * x^T = alpha * b^T, whose columns are the rows of b
+    const bool trans_a = (trans != transpose::nontrans) == left;
+    if (left)
+        trsm_item(trans_a, conj, lower, m, n, alpha, a, lda, inv_diag, b, ldb, unit_inc());
+    else
+        trsm_item(trans_a, conj, lower, n, m, alpha, a, lda, inv_diag, b, 1, ldb);
+}
+
+template <typename T>
+static void syrk(CBLAS_LAYOUT layout, uplo upper_lower, transpose trans, int64_t n, int64_t k,
+                 T alpha, const T* a, int64_t lda, T beta, T* c, int64_t ldc) {
+    if (n <= 0)
+        return;
+    // The row-major triangle of c is the other one of the column-major matrix, and a row-major
+    // op(a) is the other op of the column-major a
+    if (layout == CblasRowMajor) {
+        upper_lower = upper_lower == uplo::lower ? uplo::upper : uplo::lower;
+        trans = trans == transpose::nontrans ? transpose::trans : transpose::nontrans;
+    }
+    if (n > small_syrk_order) {
+        cblas_syrk(CblasColMajor, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
+                   to_cblas_int(n), to_cblas_int(k), alpha, a, to_cblas_int(lda), beta, c,
+                   to_cblas_int(ldc));
+        return;
+    }
+    syrk_item(upper_lower == uplo::lower, trans != transpose::nontrans, n, k, alpha, a, lda, beta,
+              c, ldc);
+}
+
+template <typename T>
+static void copy_batch_strided(int64_t n, const T* x, int64_t incx, int64_t stridex, T* y,
+                               int64_t incy, int64_t stridey, int64_t batch_size) {
+    parallel_for_batch(batch_size, n, [&](int64_t i) {
+        copy(n, x + i * stridex, incx, y + i * stridey, incy);
+    });
+}
+
+template <typename T>
+static void copy_batch_group(const int64_t* n, const T** x, const int64_t* incx, T** y,
+                             const int64_t* incy, int64_t group_count, const int64_t* group_size) {
+    parallel_for_groups(
+        group_count, group_size, [&](int64_t g) { return n[g]; },
+        [&](int64_t g, int64_t i) { copy(n[g], x[i], incx[g], y[i], incy[g]); });
+}
+
+template <typename T>
+static void axpy_batch_strided(int64_t n, T alpha, const T* x, int64_t incx, int64_t stridex, T* y,
+                               int64_t incy, int64_t stridey, int64_t batch_size) {
+    parallel_for_batch(batch_size, n, [&](int64_t i) {
+        axpy(n, alpha, x + i * stridex, incx, y + i * stridey, incy);
+    });
+}
+
+template <typename T>
+static void axpy_batch_group(const int64_t* n, const T* alpha, const T** x, const int64_t* incx,
+                             T** y, const int64_t* incy, int64_t group_count,
+                             const int64_t* group_size) {
+    parallel_for_groups(
+        group_count, group_size, [&](int64_t g) { return n[g]; },
+        [&](int64_t g, int64_t i) { axpy(n[g], alpha[g], x[i], incx[g], y[i], incy[g]); });
+}
+
+template <typename T>
+static void gemv_batch_strided(CBLAS_LAYOUT layout, transpose transa, int64_t m, int64_t n,
+                               T alpha, const T* a, int64_t lda, int64_t stride_a, const T* x,
+                               int64_t incx, int64_t stride_x, T beta, T* y, int64_t incy,
+                               int64_t stride_y, int64_t batch_size) {
+    parallel_for_batch(batch_size, m * n, [&](int64_t i) {
+        gemv(layout, transa, m, n, alpha, a + i * stride_a, lda, x + i * stride_x, incx, beta,
+             y + i * stride_y, incy);
+    });
+}
+
+template <typename T>
+static void gemv_batch_group(CBLAS_LAYOUT layout, const transpose* transa, const int64_t* m,
+                             const int64_t* n, const T* alpha, const T** a, const int64_t* lda,
+                             const T** x, const int64_t* incx, const T* beta, T** y,
+                             const int64_t* incy, int64_t group_count, const int64_t* group_size) {
+    parallel_for_groups(
+        group_count, group_size, [&](int64_t g) { return m[g] * n[g]; },
+        [&](int64_t g, int64_t i) {
+            gemv(layout, transa[g], m[g], n[g], alpha[g], a[i], lda[g], x[i], incx[g], beta[g],
+                 y[i], incy[g]);
+        });
+}
+
+template <typename T>
+static void dgmm_batch_strided(CBLAS_LAYOUT layout, side left_right, int64_t m, int64_t n,
+                               const T* a, int64_t lda, int64_t stride_a, const T* x, int64_t incx,
+                               int64_t stride_x, T* c, int64_t ldc, int64_t stride_c,
+                               int64_t batch_size) {
+    parallel_for_batch(batch_size, m * n, [&](int64_t i) {
+        dgmm(layout, left_right, m, n, a + i * stride_a, lda, x + i * stride_x, incx,
+             c + i * stride_c, ldc);
+    });
+}
+
+template <typename T>
+static void dgmm_batch_group(CBLAS_LAYOUT layout, const side* left_right, const int64_t* m,
+                             const int64_t* n, const T** a, const int64_t* lda, const T** x,
+                             const int64_t* incx, T** c, const int64_t* ldc, int64_t group_count,
+                             const int64_t* group_size) {
+    parallel_for_groups(
+        group_count, group_size, [&](int64_t g) { return m[g] * n[g]; },
+        [&](int64_t g, int64_t i) {
+            dgmm(layout, left_right[g], m[g], n[g], a[i], lda[g], x[i], incx[g], c[i], ldc[g]);
+        });
+}
+
+// The gemm operations of a batch are CBLAS calls, whose overhead is small next to the
+// operation for all but the smallest sizes. A row-major batch is run as the column-major batch
+// of the transposed products c^T = op(b)^T * op(a)^T, with the operands swapped once for the
+// whole batch instead of by CBLAS for every item, and the arguments are converted to CBLAS
+// ones once as well.
+template <typename T>
+static void gemm_batch_strided(CBLAS_LAYOUT layout, transpose transa, transpose transb, int64_t m,
+                               int64_t n, int64_t k, T alpha, const T* a, int64_t lda,
+                               int64_t stride_a, const T* b, int64_t ldb, int64_t stride_b, T beta,
+                               T* c, int64_t ldc, int64_t stride_c, int64_t batch_size) {
+    if (layout == CblasRowMajor) {
+        std::swap(m, n);
+        std::swap(transa, transb);
+        std::swap(a, b);
+        std::swap(lda, ldb);
+        std::swap(stride_a, stride_b);
+    }
+    const CBLAS_TRANSPOSE cblas_transa = convert_to_cblas_trans(transa);
+    const CBLAS_TRANSPOSE cblas_transb = convert_to_cblas_trans(transb);
+    const cblas_int cblas_m = to_cblas_int(m), cblas_n = to_cblas_int(n), cblas_k = to_cblas_int(k);
+    const cblas_int cblas_lda = to_cblas_int(lda), cblas_ldb = to_cblas_int(ldb),
+                    cblas_ldc = to_cblas_int(ldc);
+    parallel_for_batch(batch_size, m * n * k, [&](int64_t i) {
+        cblas_gemm(CblasColMajor, cblas_transa, cblas_transb, cblas_m, cblas_n, cblas_k, alpha,
+                   a + i * stride_a, cblas_lda, b + i * stride_b, cblas_ldb, beta,
+                   c + i * stride_c, cblas_ldc);
+    });
+}
+
+// Column-major CBLAS arguments of a group of gemm_batch
+struct gemm_group {
+    CBLAS_TRANSPOSE transa, transb;
+    cblas_int m, n, k, lda, ldb, ldc;
+};
+
+template <typename T>
+static void gemm_batch_group(CBLAS_LAYOUT layout, const transpose* transa,
+                             const transpose* transb, const int64_t* m, const int64_t* n,
+                             const int64_t* k, const T* alpha, const T** a, const int64_t* lda,
+                             const T** b, const int64_t* ldb, const T* beta, T** c,
+                             const int64_t* ldc, int64_t group_count, const int64_t* group_size) {
+    const bool row_major = layout == CblasRowMajor;
+    std::vector<gemm_group> groups(group_count);
+    for (int64_t g = 0; g < group_count; ++g) {
+        gemm_group& p = groups[g];
+        p.transa = convert_to_cblas_trans(row_major ? transb[g] : transa[g]);
+        p.transb = convert_to_cblas_trans(row_major ? transa[g] : transb[g]);
+        p.m = to_cblas_int(row_major ? n[g] : m[g]);
+        p.n = to_cblas_int(row_major ? m[g] : n[g]);
+        p.k = to_cblas_int(k[g]);
+        p.lda = to_cblas_int(row_major ? ldb[g] : lda[g]);
+        p.ldb = to_cblas_int(row_major ? lda[g] : ldb[g]);
+        p.ldc = to_cblas_int(ldc[g]);
+    }
+    // Operands of the column-major products
+    const T* const* left = row_major ? b : a;
+    const T* const* right = row_major ? a : b;
+    parallel_for_groups(
+        group_count, group_size, [&](int64_t g) { return m[g] * n[g] * k[g]; },
+        [&](int64_t g, int64_t i) {
+            const gemm_group& p = groups[g];
+            cblas_gemm(CblasColMajor, p.transa, p.transb, p.m, p.n, p.k, alpha[g], left[i],
+                       p.lda, right[i], p.ldb, beta[g], c[i], p.ldc);
+        });
+}
+
+// The items of the triangular solves take the reciprocals of their diagonal from the
+// workspace of the pool thread running them
+template <typename T>
+static void trsm_batch_strided(const sycl::queue& queue, CBLAS_LAYOUT layout, side left_right,
+                               uplo upper_lower, transpose trans, diag unit_diag, int64_t m,
+                               int64_t n, T alpha, const T* a, int64_t lda, int64_t stride_a, T* b,
+                               int64_t ldb, int64_t stride_b, int64_t batch_size) {
+    const int64_t order = left_right == side::left ? m : n;
+    parallel_for_batch(batch_size, order * m * n, [&](int64_t i) {
+        trsm(layout, left_right, upper_lower, trans, unit_diag, m, n, alpha, a + i * stride_a, lda,
+             b + i * stride_b, ldb, get_workspace(queue));
+    });
+}
+
+template <typename T>
+static void trsm_batch_group(const sycl::queue& queue, CBLAS_LAYOUT layout, const side* left_right,
+                             const uplo* upper_lower, const transpose* trans,
+                             const diag* unit_diag, const int64_t* m, const int64_t* n,
+                             const T* alpha, const T** a, const int64_t* lda, T** b,
+                             const int64_t* ldb, int64_t group_count, const int64_t* group_size) {
+    parallel_for_groups(
+        group_count, group_size,
+        [&](int64_t g) { return (left_right[g] == side::left ? m[g] : n[g]) * m[g] * n[g]; },
+        [&](int64_t g, int64_t i) {
+            trsm(layout, left_right[g], upper_lower[g], trans[g], unit_diag[g], m[g], n[g],
+                 alpha[g], a[i], lda[g], b[i], ldb[g], get_workspace(queue));
+        });
+}
+
+template <typename T>
+static void syrk_batch_strided(CBLAS_LAYOUT layout, uplo upper_lower, transpose trans, int64_t n,
+                               int64_t k, T alpha, const T* a, int64_t lda, int64_t stride_a,
+                               T beta, T* c, int64_t ldc, int64_t stride_c, int64_t batch_size) {
+    parallel_for_batch(batch_size, n * n * k, [&](int64_t i) {
+        syrk(layout, upper_lower, trans, n, k, alpha, a + i * stride_a, lda, beta,
+             c + i * stride_c, ldc);
+    });
+}
+
+template <typename T>
+static void syrk_batch_group(CBLAS_LAYOUT layout, const uplo* upper_lower, const transpose* trans,
+                             const int64_t* n, const int64_t* k, const T* alpha, const T** a,
+                             const int64_t* lda, const T* beta, T** c, const int64_t* ldc,
+                             int64_t group_count, const int64_t* group_size) {
+    parallel_for_groups(
+        group_count, group_size, [&](int64_t g) { return n[g] * n[g] * k[g]; },
+        [&](int64_t g, int64_t i) {
+            syrk(layout, upper_lower[g], trans[g], n[g], k[g], alpha[g], a[i], lda[g], beta[g],
+                 c[i], ldc[g]);
+        });
+}
+
 namespace column_major {
 
+#define MAJOR CblasColMajor
 #define COLUMN_MAJOR
 #include "netlib_batch.cxx"
+#undef MAJOR
 #undef COLUMN_MAJOR
 
 } // namespace column_major
 namespace row_major {
 
+#define MAJOR CblasRowMajor
 #define ROW_MAJOR
 #include "netlib_batch.cxx"
+#undef MAJOR
 #undef ROW_MAJOR
 
 } // namespace row_major
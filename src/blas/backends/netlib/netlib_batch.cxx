@@ -22,115 +22,139 @@
 void copy_batch(sycl::queue& queue, int64_t n, sycl::buffer<float, 1>& x, int64_t incx,
                 int64_t stridex, sycl::buffer<float, 1>& y, int64_t incy, int64_t stridey,
                 int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "copy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "copy_batch", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler& cgh) {
+        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_scopy_batch>(queue, cgh, [=]() {
+            copy_batch_strided(n, accessor_x.GET_MULTI_PTR, incx, stridex, accessor_y.GET_MULTI_PTR,
+                               incy, stridey, batch_size);
+        });
+    });
 }
 
 void copy_batch(sycl::queue& queue, int64_t n, sycl::buffer<double, 1>& x, int64_t incx,
                 int64_t stridex, sycl::buffer<double, 1>& y, int64_t incy, int64_t stridey,
                 int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "copy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "copy_batch", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler& cgh) {
+        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_dcopy_batch>(queue, cgh, [=]() {
+            copy_batch_strided(n, accessor_x.GET_MULTI_PTR, incx, stridex, accessor_y.GET_MULTI_PTR,
+                               incy, stridey, batch_size);
+        });
+    });
 }
 
 void copy_batch(sycl::queue& queue, int64_t n, sycl::buffer<std::complex<float>, 1>& x,
                 int64_t incx, int64_t stridex, sycl::buffer<std::complex<float>, 1>& y,
                 int64_t incy, int64_t stridey, int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "copy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "copy_batch", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler& cgh) {
+        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_ccopy_batch>(queue, cgh, [=]() {
+            copy_batch_strided(n, accessor_x.GET_MULTI_PTR, incx, stridex, accessor_y.GET_MULTI_PTR,
+                               incy, stridey, batch_size);
+        });
+    });
 }
 
 void copy_batch(sycl::queue& queue, int64_t n, sycl::buffer<std::complex<double>, 1>& x,
                 int64_t incx, int64_t stridex, sycl::buffer<std::complex<double>, 1>& y,
                 int64_t incy, int64_t stridey, int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "copy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "copy_batch", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler& cgh) {
+        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_zcopy_batch>(queue, cgh, [=]() {
+            copy_batch_strided(n, accessor_x.GET_MULTI_PTR, incx, stridex, accessor_y.GET_MULTI_PTR,
+                               incy, stridey, batch_size);
+        });
+    });
 }
 
 void axpy_batch(sycl::queue& queue, int64_t n, float alpha, sycl::buffer<float, 1>& x, int64_t incx,
                 int64_t stridex, sycl::buffer<float, 1>& y, int64_t incy, int64_t stridey,
                 int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler& cgh) {
+        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_saxpy_batch>(queue, cgh, [=]() {
+            axpy_batch_strided(n, alpha, accessor_x.GET_MULTI_PTR, incx, stridex,
+                               accessor_y.GET_MULTI_PTR, incy, stridey, batch_size);
+        });
+    });
 }
 
 void axpy_batch(sycl::queue& queue, int64_t n, double alpha, sycl::buffer<double, 1>& x,
                 int64_t incx, int64_t stridex, sycl::buffer<double, 1>& y, int64_t incy,
                 int64_t stridey, int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler& cgh) {
+        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_daxpy_batch>(queue, cgh, [=]() {
+            axpy_batch_strided(n, alpha, accessor_x.GET_MULTI_PTR, incx, stridex,
+                               accessor_y.GET_MULTI_PTR, incy, stridey, batch_size);
+        });
+    });
 }
 
 void axpy_batch(sycl::queue& queue, int64_t n, std::complex<float> alpha,
                 sycl::buffer<std::complex<float>, 1>& x, int64_t incx, int64_t stridex,
                 sycl::buffer<std::complex<float>, 1>& y, int64_t incy, int64_t stridey,
                 int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler& cgh) {
+        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_caxpy_batch>(queue, cgh, [=]() {
+            axpy_batch_strided(n, alpha, accessor_x.GET_MULTI_PTR, incx, stridex,
+                               accessor_y.GET_MULTI_PTR, incy, stridey, batch_size);
+        });
+    });
 }
 
 void axpy_batch(sycl::queue& queue, int64_t n, std::complex<double> alpha,
                 sycl::buffer<std::complex<double>, 1>& x, int64_t incx, int64_t stridex,
                 sycl::buffer<std::complex<double>, 1>& y, int64_t incy, int64_t stridey,
                 int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler& cgh) {
+        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_zaxpy_batch>(queue, cgh, [=]() {
+            axpy_batch_strided(n, alpha, accessor_x.GET_MULTI_PTR, incx, stridex,
+                               accessor_y.GET_MULTI_PTR, incy, stridey, batch_size);
+        });
+    });
 }
 
 void gemv_batch(sycl::queue& queue, transpose transa, int64_t m, int64_t n, float alpha,
                 sycl::buffer<float, 1>& a, int64_t lda, int64_t stride_a, sycl::buffer<float, 1>& x,
                 int64_t incx, int64_t stride_x, float beta, sycl::buffer<float, 1>& y, int64_t incy,
                 int64_t stride_y, int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler& cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_sgemv_batch>(queue, cgh, [=]() {
+            gemv_batch_strided(MAJOR, transa, m, n, alpha, accessor_a.GET_MULTI_PTR, lda, stride_a,
+                               accessor_x.GET_MULTI_PTR, incx, stride_x, beta,
+                               accessor_y.GET_MULTI_PTR, incy, stride_y, batch_size);
+        });
+    });
 }
 
 void gemv_batch(sycl::queue& queue, transpose transa, int64_t m, int64_t n, double alpha,
                 sycl::buffer<double, 1>& a, int64_t lda, int64_t stride_a,
                 sycl::buffer<double, 1>& x, int64_t incx, int64_t stride_x, double beta,
                 sycl::buffer<double, 1>& y, int64_t incy, int64_t stride_y, int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler& cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_dgemv_batch>(queue, cgh, [=]() {
+            gemv_batch_strided(MAJOR, transa, m, n, alpha, accessor_a.GET_MULTI_PTR, lda, stride_a,
+                               accessor_x.GET_MULTI_PTR, incx, stride_x, beta,
+                               accessor_y.GET_MULTI_PTR, incy, stride_y, batch_size);
+        });
+    });
 }
 
 void gemv_batch(sycl::queue& queue, transpose transa, int64_t m, int64_t n,
@@ -138,12 +162,16 @@ void gemv_batch(sycl::queue& queue, transpose transa, int64_t m, int64_t n,
                 int64_t stride_a, sycl::buffer<std::complex<float>, 1>& x, int64_t incx,
                 int64_t stride_x, std::complex<float> beta, sycl::buffer<std::complex<float>, 1>& y,
                 int64_t incy, int64_t stride_y, int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler& cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_cgemv_batch>(queue, cgh, [=]() {
+            gemv_batch_strided(MAJOR, transa, m, n, alpha, accessor_a.GET_MULTI_PTR, lda, stride_a,
+                               accessor_x.GET_MULTI_PTR, incx, stride_x, beta,
+                               accessor_y.GET_MULTI_PTR, incy, stride_y, batch_size);
+        });
+    });
 }
 
 void gemv_batch(sycl::queue& queue, transpose transa, int64_t m, int64_t n,
@@ -152,36 +180,48 @@ void gemv_batch(sycl::queue& queue, transpose transa, int64_t m, int64_t n,
                 int64_t stride_x, std::complex<double> beta,
                 sycl::buffer<std::complex<double>, 1>& y, int64_t incy, int64_t stride_y,
                 int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler& cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_zgemv_batch>(queue, cgh, [=]() {
+            gemv_batch_strided(MAJOR, transa, m, n, alpha, accessor_a.GET_MULTI_PTR, lda, stride_a,
+                               accessor_x.GET_MULTI_PTR, incx, stride_x, beta,
+                               accessor_y.GET_MULTI_PTR, incy, stride_y, batch_size);
+        });
+    });
 }
 
 void dgmm_batch(sycl::queue& queue, side left_right, int64_t m, int64_t n,
                 sycl::buffer<float, 1>& a, int64_t lda, int64_t stride_a, sycl::buffer<float, 1>& x,
                 int64_t incx, int64_t stride_x, sycl::buffer<float, 1>& c, int64_t ldc,
                 int64_t stride_c, int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler& cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_sdgmm_batch>(queue, cgh, [=]() {
+            dgmm_batch_strided(MAJOR, left_right, m, n, accessor_a.GET_MULTI_PTR, lda, stride_a,
+                               accessor_x.GET_MULTI_PTR, incx, stride_x, accessor_c.GET_MULTI_PTR,
+                               ldc, stride_c, batch_size);
+        });
+    });
 }
 
 void dgmm_batch(sycl::queue& queue, side left_right, int64_t m, int64_t n,
                 sycl::buffer<double, 1>& a, int64_t lda, int64_t stride_a,
                 sycl::buffer<double, 1>& x, int64_t incx, int64_t stride_x,
                 sycl::buffer<double, 1>& c, int64_t ldc, int64_t stride_c, int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler& cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_ddgmm_batch>(queue, cgh, [=]() {
+            dgmm_batch_strided(MAJOR, left_right, m, n, accessor_a.GET_MULTI_PTR, lda, stride_a,
+                               accessor_x.GET_MULTI_PTR, incx, stride_x, accessor_c.GET_MULTI_PTR,
+                               ldc, stride_c, batch_size);
+        });
+    });
 }
 
 void dgmm_batch(sycl::queue& queue, side left_right, int64_t m, int64_t n,
@@ -189,12 +229,16 @@ void dgmm_batch(sycl::queue& queue, side left_right, int64_t m, int64_t n,
                 sycl::buffer<std::complex<float>, 1>& x, int64_t incx, int64_t stride_x,
                 sycl::buffer<std::complex<float>, 1>& c, int64_t ldc, int64_t stride_c,
                 int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler& cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_cdgmm_batch>(queue, cgh, [=]() {
+            dgmm_batch_strided(MAJOR, left_right, m, n, accessor_a.GET_MULTI_PTR, lda, stride_a,
+                               accessor_x.GET_MULTI_PTR, incx, stride_x, accessor_c.GET_MULTI_PTR,
+                               ldc, stride_c, batch_size);
+        });
+    });
 }
 
 void dgmm_batch(sycl::queue& queue, side left_right, int64_t m, int64_t n,
@@ -202,36 +246,50 @@ void dgmm_batch(sycl::queue& queue, side left_right, int64_t m, int64_t n,
                 sycl::buffer<std::complex<double>, 1>& x, int64_t incx, int64_t stride_x,
                 sycl::buffer<std::complex<double>, 1>& c, int64_t ldc, int64_t stride_c,
                 int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler& cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_zdgmm_batch>(queue, cgh, [=]() {
+            dgmm_batch_strided(MAJOR, left_right, m, n, accessor_a.GET_MULTI_PTR, lda, stride_a,
+                               accessor_x.GET_MULTI_PTR, incx, stride_x, accessor_c.GET_MULTI_PTR,
+                               ldc, stride_c, batch_size);
+        });
+    });
 }
 
 void gemm_batch(sycl::queue& queue, transpose transa, transpose transb, int64_t m, int64_t n,
                 int64_t k, float alpha, sycl::buffer<float, 1>& a, int64_t lda, int64_t stride_a,
                 sycl::buffer<float, 1>& b, int64_t ldb, int64_t stride_b, float beta,
                 sycl::buffer<float, 1>& c, int64_t ldc, int64_t stride_c, int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    check_cblas_ints(m, n, k, lda, ldb, ldc);
+    queue.submit([&](sycl::handler& cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_sgemm_batch>(queue, cgh, [=]() {
+            gemm_batch_strided(MAJOR, transa, transb, m, n, k, alpha, accessor_a.GET_MULTI_PTR,
+                               lda, stride_a, accessor_b.GET_MULTI_PTR, ldb, stride_b, beta,
+                               accessor_c.GET_MULTI_PTR, ldc, stride_c, batch_size);
+        });
+    });
 }
 
 void gemm_batch(sycl::queue& queue, transpose transa, transpose transb, int64_t m, int64_t n,
                 int64_t k, double alpha, sycl::buffer<double, 1>& a, int64_t lda, int64_t stride_a,
                 sycl::buffer<double, 1>& b, int64_t ldb, int64_t stride_b, double beta,
                 sycl::buffer<double, 1>& c, int64_t ldc, int64_t stride_c, int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    check_cblas_ints(m, n, k, lda, ldb, ldc);
+    queue.submit([&](sycl::handler& cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_dgemm_batch>(queue, cgh, [=]() {
+            gemm_batch_strided(MAJOR, transa, transb, m, n, k, alpha, accessor_a.GET_MULTI_PTR,
+                               lda, stride_a, accessor_b.GET_MULTI_PTR, ldb, stride_b, beta,
+                               accessor_c.GET_MULTI_PTR, ldc, stride_c, batch_size);
+        });
+    });
 }
 
 void gemm_batch(sycl::queue& queue, transpose transa, transpose transb, int64_t m, int64_t n,
@@ -239,12 +297,17 @@ void gemm_batch(sycl::queue& queue, transpose transa, transpose transb, int64_t
                 int64_t lda, int64_t stride_a, sycl::buffer<std::complex<float>, 1>& b, int64_t ldb,
                 int64_t stride_b, std::complex<float> beta, sycl::buffer<std::complex<float>, 1>& c,
                 int64_t ldc, int64_t stride_c, int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    check_cblas_ints(m, n, k, lda, ldb, ldc);
+    queue.submit([&](sycl::handler& cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_cgemm_batch>(queue, cgh, [=]() {
+            gemm_batch_strided(MAJOR, transa, transb, m, n, k, alpha, accessor_a.GET_MULTI_PTR,
+                               lda, stride_a, accessor_b.GET_MULTI_PTR, ldb, stride_b, beta,
+                               accessor_c.GET_MULTI_PTR, ldc, stride_c, batch_size);
+        });
+    });
 }
 
 void gemm_batch(sycl::queue& queue, transpose transa, transpose transb, int64_t m, int64_t n,
@@ -253,12 +316,17 @@ void gemm_batch(sycl::queue& queue, transpose transa, transpose transb, int64_t
                 int64_t ldb, int64_t stride_b, std::complex<double> beta,
                 sycl::buffer<std::complex<double>, 1>& c, int64_t ldc, int64_t stride_c,
                 int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    check_cblas_ints(m, n, k, lda, ldb, ldc);
+    queue.submit([&](sycl::handler& cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_zgemm_batch>(queue, cgh, [=]() {
+            gemm_batch_strided(MAJOR, transa, transb, m, n, k, alpha, accessor_a.GET_MULTI_PTR,
+                               lda, stride_a, accessor_b.GET_MULTI_PTR, ldb, stride_b, beta,
+                               accessor_c.GET_MULTI_PTR, ldc, stride_c, batch_size);
+        });
+    });
 }
 
 void gemm_batch(sycl::queue& queue, transpose transa, transpose transb, int64_t m, int64_t n,
@@ -317,24 +385,32 @@ void trsm_batch(sycl::queue& queue, side left_right, uplo upper_lower, transpose
                 diag unit_diag, int64_t m, int64_t n, float alpha, sycl::buffer<float, 1>& a,
                 int64_t lda, int64_t stride_a, sycl::buffer<float, 1>& b, int64_t ldb,
                 int64_t stride_b, int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for row_major layout");
-#endif
+    check_cblas_ints(m, n, lda, ldb);
+    queue.submit([&](sycl::handler& cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_strsm_batch>(queue, cgh, [=]() {
+            trsm_batch_strided(queue, MAJOR, left_right, upper_lower, trans, unit_diag, m, n, alpha,
+                               accessor_a.GET_MULTI_PTR, lda, stride_a, accessor_b.GET_MULTI_PTR,
+                               ldb, stride_b, batch_size);
+        });
+    });
 }
 
 void trsm_batch(sycl::queue& queue, side left_right, uplo upper_lower, transpose trans,
                 diag unit_diag, int64_t m, int64_t n, double alpha, sycl::buffer<double, 1>& a,
                 int64_t lda, int64_t stride_a, sycl::buffer<double, 1>& b, int64_t ldb,
                 int64_t stride_b, int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for row_major layout");
-#endif
+    check_cblas_ints(m, n, lda, ldb);
+    queue.submit([&](sycl::handler& cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_dtrsm_batch>(queue, cgh, [=]() {
+            trsm_batch_strided(queue, MAJOR, left_right, upper_lower, trans, unit_diag, m, n, alpha,
+                               accessor_a.GET_MULTI_PTR, lda, stride_a, accessor_b.GET_MULTI_PTR,
+                               ldb, stride_b, batch_size);
+        });
+    });
 }
 
 void trsm_batch(sycl::queue& queue, side left_right, uplo upper_lower, transpose trans,
@@ -342,12 +418,16 @@ void trsm_batch(sycl::queue& queue, side left_right, uplo upper_lower, transpose
                 sycl::buffer<std::complex<float>, 1>& a, int64_t lda, int64_t stride_a,
                 sycl::buffer<std::complex<float>, 1>& b, int64_t ldb, int64_t stride_b,
                 int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for row_major layout");
-#endif
+    check_cblas_ints(m, n, lda, ldb);
+    queue.submit([&](sycl::handler& cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_ctrsm_batch>(queue, cgh, [=]() {
+            trsm_batch_strided(queue, MAJOR, left_right, upper_lower, trans, unit_diag, m, n, alpha,
+                               accessor_a.GET_MULTI_PTR, lda, stride_a, accessor_b.GET_MULTI_PTR,
+                               ldb, stride_b, batch_size);
+        });
+    });
 }
 
 void trsm_batch(sycl::queue& queue, side left_right, uplo upper_lower, transpose trans,
@@ -355,47 +435,63 @@ void trsm_batch(sycl::queue& queue, side left_right, uplo upper_lower, transpose
                 sycl::buffer<std::complex<double>, 1>& a, int64_t lda, int64_t stride_a,
                 sycl::buffer<std::complex<double>, 1>& b, int64_t ldb, int64_t stride_b,
                 int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for row_major layout");
-#endif
+    check_cblas_ints(m, n, lda, ldb);
+    queue.submit([&](sycl::handler& cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_ztrsm_batch>(queue, cgh, [=]() {
+            trsm_batch_strided(queue, MAJOR, left_right, upper_lower, trans, unit_diag, m, n, alpha,
+                               accessor_a.GET_MULTI_PTR, lda, stride_a, accessor_b.GET_MULTI_PTR,
+                               ldb, stride_b, batch_size);
+        });
+    });
 }
 
 void syrk_batch(sycl::queue& queue, uplo upper_lower, transpose trans, int64_t n, int64_t k,
                 float alpha, sycl::buffer<float, 1>& a, int64_t lda, int64_t stride_a, float beta,
                 sycl::buffer<float, 1>& c, int64_t ldc, int64_t stride_c, int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for row_major layout");
-#endif
+    check_cblas_ints(n, k, lda, ldc);
+    queue.submit([&](sycl::handler& cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_ssyrk_batch>(queue, cgh, [=]() {
+            syrk_batch_strided(MAJOR, upper_lower, trans, n, k, alpha, accessor_a.GET_MULTI_PTR,
+                               lda, stride_a, beta, accessor_c.GET_MULTI_PTR, ldc, stride_c,
+                               batch_size);
+        });
+    });
 }
 
 void syrk_batch(sycl::queue& queue, uplo upper_lower, transpose trans, int64_t n, int64_t k,
                 double alpha, sycl::buffer<double, 1>& a, int64_t lda, int64_t stride_a,
                 double beta, sycl::buffer<double, 1>& c, int64_t ldc, int64_t stride_c,
                 int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for row_major layout");
-#endif
+    check_cblas_ints(n, k, lda, ldc);
+    queue.submit([&](sycl::handler& cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_dsyrk_batch>(queue, cgh, [=]() {
+            syrk_batch_strided(MAJOR, upper_lower, trans, n, k, alpha, accessor_a.GET_MULTI_PTR,
+                               lda, stride_a, beta, accessor_c.GET_MULTI_PTR, ldc, stride_c,
+                               batch_size);
+        });
+    });
 }
 
 void syrk_batch(sycl::queue& queue, uplo upper_lower, transpose trans, int64_t n, int64_t k,
                 std::complex<float> alpha, sycl::buffer<std::complex<float>, 1>& a, int64_t lda,
                 int64_t stride_a, std::complex<float> beta, sycl::buffer<std::complex<float>, 1>& c,
                 int64_t ldc, int64_t stride_c, int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for row_major layout");
-#endif
+    check_cblas_ints(n, k, lda, ldc);
+    queue.submit([&](sycl::handler& cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_csyrk_batch>(queue, cgh, [=]() {
+            syrk_batch_strided(MAJOR, upper_lower, trans, n, k, alpha, accessor_a.GET_MULTI_PTR,
+                               lda, stride_a, beta, accessor_c.GET_MULTI_PTR, ldc, stride_c,
+                               batch_size);
+        });
+    });
 }
 
 void syrk_batch(sycl::queue& queue, uplo upper_lower, transpose trans, int64_t n, int64_t k,
@@ -403,12 +499,16 @@ void syrk_batch(sycl::queue& queue, uplo upper_lower, transpose trans, int64_t n
                 int64_t stride_a, std::complex<double> beta,
                 sycl::buffer<std::complex<double>, 1>& c, int64_t ldc, int64_t stride_c,
                 int64_t batch_size) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for row_major layout");
-#endif
+    check_cblas_ints(n, k, lda, ldc);
+    queue.submit([&](sycl::handler& cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_zsyrk_batch>(queue, cgh, [=]() {
+            syrk_batch_strided(MAJOR, upper_lower, trans, n, k, alpha, accessor_a.GET_MULTI_PTR,
+                               lda, stride_a, beta, accessor_c.GET_MULTI_PTR, ldc, stride_c,
+                               batch_size);
+        });
+    });
 }
 
 void omatcopy_batch(sycl::queue& queue, transpose trans, int64_t m, int64_t n, float alpha,
@@ -558,195 +658,264 @@ void omatadd_batch(sycl::queue& queue, transpose transa, transpose transb, int64
 sycl::event copy_batch(sycl::queue& queue, int64_t* n, const float** x, int64_t* incx, float** y,
                        int64_t* incy, int64_t group_count, int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "copy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "copy_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_scopy_batch_group_usm>(queue, cgh, [=]() {
+            copy_batch_group(n, x, incx, y, incy, group_count, group_size);
+        });
+    });
+    return done;
 }
 
 sycl::event copy_batch(sycl::queue& queue, int64_t* n, const double** x, int64_t* incx, double** y,
                        int64_t* incy, int64_t group_count, int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "copy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "copy_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dcopy_batch_group_usm>(queue, cgh, [=]() {
+            copy_batch_group(n, x, incx, y, incy, group_count, group_size);
+        });
+    });
+    return done;
 }
 
 sycl::event copy_batch(sycl::queue& queue, int64_t* n, const std::complex<float>** x, int64_t* incx,
                        std::complex<float>** y, int64_t* incy, int64_t group_count,
                        int64_t* group_size, const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "copy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "copy_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_ccopy_batch_group_usm>(queue, cgh, [=]() {
+            copy_batch_group(n, x, incx, y, incy, group_count, group_size);
+        });
+    });
+    return done;
 }
 
 sycl::event copy_batch(sycl::queue& queue, int64_t* n, const std::complex<double>** x,
                        int64_t* incx, std::complex<double>** y, int64_t* incy, int64_t group_count,
                        int64_t* group_size, const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "copy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "copy_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zcopy_batch_group_usm>(queue, cgh, [=]() {
+            copy_batch_group(n, x, incx, y, incy, group_count, group_size);
+        });
+    });
+    return done;
 }
 
 sycl::event copy_batch(sycl::queue& queue, int64_t n, const float* x, int64_t incx,
                        std::int64_t stridex, float* y, int64_t incy, std::int64_t stridey,
                        std::int64_t batch_size, const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "copy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "copy_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_scopy_batch_usm>(queue, cgh, [=]() {
+            copy_batch_strided(n, x, incx, stridex, y, incy, stridey, batch_size);
+        });
+    });
+    return done;
 }
 
 sycl::event copy_batch(sycl::queue& queue, int64_t n, const double* x, int64_t incx,
                        std::int64_t stridex, double* y, int64_t incy, std::int64_t stridey,
                        std::int64_t batch_size, const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "copy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "copy_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dcopy_batch_usm>(queue, cgh, [=]() {
+            copy_batch_strided(n, x, incx, stridex, y, incy, stridey, batch_size);
+        });
+    });
+    return done;
 }
 
 sycl::event copy_batch(sycl::queue& queue, int64_t n, const std::complex<float>* x, int64_t incx,
                        std::int64_t stridex, std::complex<float>* y, int64_t incy,
                        std::int64_t stridey, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "copy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "copy_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_ccopy_batch_usm>(queue, cgh, [=]() {
+            copy_batch_strided(n, x, incx, stridex, y, incy, stridey, batch_size);
+        });
+    });
+    return done;
 }
 
 sycl::event copy_batch(sycl::queue& queue, int64_t n, const std::complex<double>* x, int64_t incx,
                        std::int64_t stridex, std::complex<double>* y, int64_t incy,
                        std::int64_t stridey, std::int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "copy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "copy_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zcopy_batch_usm>(queue, cgh, [=]() {
+            copy_batch_strided(n, x, incx, stridex, y, incy, stridey, batch_size);
+        });
+    });
+    return done;
 }
 
 sycl::event axpy_batch(sycl::queue& queue, int64_t* n, float* alpha, const float** x, int64_t* incx,
                        float** y, int64_t* incy, int64_t group_count, int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_saxpy_batch_group_usm>(queue, cgh, [=]() {
+            axpy_batch_group(n, alpha, x, incx, y, incy, group_count, group_size);
+        });
+    });
+    return done;
 }
 
 sycl::event axpy_batch(sycl::queue& queue, int64_t* n, double* alpha, const double** x,
                        int64_t* incx, double** y, int64_t* incy, int64_t group_count,
                        int64_t* group_size, const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_daxpy_batch_group_usm>(queue, cgh, [=]() {
+            axpy_batch_group(n, alpha, x, incx, y, incy, group_count, group_size);
+        });
+    });
+    return done;
 }
 
 sycl::event axpy_batch(sycl::queue& queue, int64_t* n, std::complex<float>* alpha,
                        const std::complex<float>** x, int64_t* incx, std::complex<float>** y,
                        int64_t* incy, int64_t group_count, int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_caxpy_batch_group_usm>(queue, cgh, [=]() {
+            axpy_batch_group(n, alpha, x, incx, y, incy, group_count, group_size);
+        });
+    });
+    return done;
 }
 
 sycl::event axpy_batch(sycl::queue& queue, int64_t* n, std::complex<double>* alpha,
                        const std::complex<double>** x, int64_t* incx, std::complex<double>** y,
                        int64_t* incy, int64_t group_count, int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zaxpy_batch_group_usm>(queue, cgh, [=]() {
+            axpy_batch_group(n, alpha, x, incx, y, incy, group_count, group_size);
+        });
+    });
+    return done;
 }
 
 sycl::event axpy_batch(sycl::queue& queue, int64_t n, float alpha, const float* x, int64_t incx,
                        int64_t stridex, float* y, int64_t incy, int64_t stridey, int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_saxpy_batch_usm>(queue, cgh, [=]() {
+            axpy_batch_strided(n, alpha, x, incx, stridex, y, incy, stridey, batch_size);
+        });
+    });
+    return done;
 }
 
 sycl::event axpy_batch(sycl::queue& queue, int64_t n, double alpha, const double* x, int64_t incx,
                        int64_t stridex, double* y, int64_t incy, int64_t stridey,
                        int64_t batch_size, const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_daxpy_batch_usm>(queue, cgh, [=]() {
+            axpy_batch_strided(n, alpha, x, incx, stridex, y, incy, stridey, batch_size);
+        });
+    });
+    return done;
 }
 
 sycl::event axpy_batch(sycl::queue& queue, int64_t n, std::complex<float> alpha,
                        const std::complex<float>* x, int64_t incx, int64_t stridex,
                        std::complex<float>* y, int64_t incy, int64_t stridey, int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_caxpy_batch_usm>(queue, cgh, [=]() {
+            axpy_batch_strided(n, alpha, x, incx, stridex, y, incy, stridey, batch_size);
+        });
+    });
+    return done;
 }
 
 sycl::event axpy_batch(sycl::queue& queue, int64_t n, std::complex<double> alpha,
                        const std::complex<double>* x, int64_t incx, int64_t stridex,
                        std::complex<double>* y, int64_t incy, int64_t stridey, int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "axpy_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zaxpy_batch_usm>(queue, cgh, [=]() {
+            axpy_batch_strided(n, alpha, x, incx, stridex, y, incy, stridey, batch_size);
+        });
+    });
+    return done;
 }
 
 sycl::event gemv_batch(sycl::queue& queue, transpose transa, int64_t m, int64_t n, float alpha,
                        const float* a, int64_t lda, int64_t stride_a, const float* x, int64_t incx,
                        int64_t stride_x, float beta, float* y, int64_t incy, int64_t stride_y,
                        int64_t batch_size, const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sgemv_batch_usm>(queue, cgh, [=]() {
+            gemv_batch_strided(MAJOR, transa, m, n, alpha, a, lda, stride_a, x, incx, stride_x,
+                               beta, y, incy, stride_y, batch_size);
+        });
+    });
+    return done;
 }
 
 sycl::event gemv_batch(sycl::queue& queue, transpose transa, int64_t m, int64_t n, double alpha,
@@ -754,12 +923,17 @@ sycl::event gemv_batch(sycl::queue& queue, transpose transa, int64_t m, int64_t
                        int64_t incx, int64_t stride_x, double beta, double* y, int64_t incy,
                        int64_t stride_y, int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dgemv_batch_usm>(queue, cgh, [=]() {
+            gemv_batch_strided(MAJOR, transa, m, n, alpha, a, lda, stride_a, x, incx, stride_x,
+                               beta, y, incy, stride_y, batch_size);
+        });
+    });
+    return done;
 }
 
 sycl::event gemv_batch(sycl::queue& queue, transpose transa, int64_t m, int64_t n,
@@ -768,12 +942,17 @@ sycl::event gemv_batch(sycl::queue& queue, transpose transa, int64_t m, int64_t
                        int64_t stride_x, std::complex<float> beta, std::complex<float>* y,
                        int64_t incy, int64_t stride_y, int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cgemv_batch_usm>(queue, cgh, [=]() {
+            gemv_batch_strided(MAJOR, transa, m, n, alpha, a, lda, stride_a, x, incx, stride_x,
+                               beta, y, incy, stride_y, batch_size);
+        });
+    });
+    return done;
 }
 
 sycl::event gemv_batch(sycl::queue& queue, transpose transa, int64_t m, int64_t n,
@@ -782,36 +961,51 @@ sycl::event gemv_batch(sycl::queue& queue, transpose transa, int64_t m, int64_t
                        int64_t stride_x, std::complex<double> beta, std::complex<double>* y,
                        int64_t incy, int64_t stride_y, int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zgemv_batch_usm>(queue, cgh, [=]() {
+            gemv_batch_strided(MAJOR, transa, m, n, alpha, a, lda, stride_a, x, incx, stride_x,
+                               beta, y, incy, stride_y, batch_size);
+        });
+    });
+    return done;
 }
 
 sycl::event gemv_batch(sycl::queue& queue, transpose* transa, int64_t* m, int64_t* n, float* alpha,
                        const float** a, int64_t* lda, const float** x, int64_t* incx, float* beta,
                        float** y, int64_t* incy, int64_t group_count, int64_t* groupsize,
                        const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sgemv_batch_group_usm>(queue, cgh, [=]() {
+            gemv_batch_group(MAJOR, transa, m, n, alpha, a, lda, x, incx, beta, y, incy,
+                             group_count, groupsize);
+        });
+    });
+    return done;
 }
 
 sycl::event gemv_batch(sycl::queue& queue, transpose* transa, int64_t* m, int64_t* n, double* alpha,
                        const double** a, int64_t* lda, const double** x, int64_t* incx,
                        double* beta, double** y, int64_t* incy, int64_t group_count,
                        int64_t* groupsize, const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dgemv_batch_group_usm>(queue, cgh, [=]() {
+            gemv_batch_group(MAJOR, transa, m, n, alpha, a, lda, x, incx, beta, y, incy,
+                             group_count, groupsize);
+        });
+    });
+    return done;
 }
 
 sycl::event gemv_batch(sycl::queue& queue, transpose* transa, int64_t* m, int64_t* n,
@@ -819,12 +1013,17 @@ sycl::event gemv_batch(sycl::queue& queue, transpose* transa, int64_t* m, int64_
                        const std::complex<float>** x, int64_t* incx, std::complex<float>* beta,
                        std::complex<float>** y, int64_t* incy, int64_t group_count,
                        int64_t* groupsize, const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cgemv_batch_group_usm>(queue, cgh, [=]() {
+            gemv_batch_group(MAJOR, transa, m, n, alpha, a, lda, x, incx, beta, y, incy,
+                             group_count, groupsize);
+        });
+    });
+    return done;
 }
 
 sycl::event gemv_batch(sycl::queue& queue, transpose* transa, int64_t* m, int64_t* n,
@@ -832,36 +1031,51 @@ sycl::event gemv_batch(sycl::queue& queue, transpose* transa, int64_t* m, int64_
                        const std::complex<double>** x, int64_t* incx, std::complex<double>* beta,
                        std::complex<double>** y, int64_t* incy, int64_t group_count,
                        int64_t* groupsize, const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemv_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zgemv_batch_group_usm>(queue, cgh, [=]() {
+            gemv_batch_group(MAJOR, transa, m, n, alpha, a, lda, x, incx, beta, y, incy,
+                             group_count, groupsize);
+        });
+    });
+    return done;
 }
 
 sycl::event dgmm_batch(sycl::queue& queue, side left_right, int64_t m, int64_t n, const float* a,
                        int64_t lda, int64_t stride_a, const float* x, int64_t incx,
                        int64_t stride_x, float* c, int64_t ldc, int64_t stride_c,
                        int64_t batch_size, const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sdgmm_batch_usm>(queue, cgh, [=]() {
+            dgmm_batch_strided(MAJOR, left_right, m, n, a, lda, stride_a, x, incx, stride_x, c, ldc,
+                               stride_c, batch_size);
+        });
+    });
+    return done;
 }
 
 sycl::event dgmm_batch(sycl::queue& queue, side left_right, int64_t m, int64_t n, const double* a,
                        int64_t lda, int64_t stride_a, const double* x, int64_t incx,
                        int64_t stride_x, double* c, int64_t ldc, int64_t stride_c,
                        int64_t batch_size, const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_ddgmm_batch_usm>(queue, cgh, [=]() {
+            dgmm_batch_strided(MAJOR, left_right, m, n, a, lda, stride_a, x, incx, stride_x, c, ldc,
+                               stride_c, batch_size);
+        });
+    });
+    return done;
 }
 
 sycl::event dgmm_batch(sycl::queue& queue, side left_right, int64_t m, int64_t n,
@@ -869,12 +1083,17 @@ sycl::event dgmm_batch(sycl::queue& queue, side left_right, int64_t m, int64_t n
                        const std::complex<float>* x, int64_t incx, int64_t stride_x,
                        std::complex<float>* c, int64_t ldc, int64_t stride_c, int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cdgmm_batch_usm>(queue, cgh, [=]() {
+            dgmm_batch_strided(MAJOR, left_right, m, n, a, lda, stride_a, x, incx, stride_x, c, ldc,
+                               stride_c, batch_size);
+        });
+    });
+    return done;
 }
 
 sycl::event dgmm_batch(sycl::queue& queue, side left_right, int64_t m, int64_t n,
@@ -882,60 +1101,85 @@ sycl::event dgmm_batch(sycl::queue& queue, side left_right, int64_t m, int64_t n
                        const std::complex<double>* x, int64_t incx, int64_t stride_x,
                        std::complex<double>* c, int64_t ldc, int64_t stride_c, int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zdgmm_batch_usm>(queue, cgh, [=]() {
+            dgmm_batch_strided(MAJOR, left_right, m, n, a, lda, stride_a, x, incx, stride_x, c, ldc,
+                               stride_c, batch_size);
+        });
+    });
+    return done;
 }
 
 sycl::event dgmm_batch(sycl::queue& queue, side* left_right, int64_t* m, int64_t* n,
                        const float** a, int64_t* lda, const float** x, int64_t* incx, float** c,
                        int64_t* ldc, int64_t group_count, int64_t* groupsize,
                        const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sdgmm_batch_group_usm>(queue, cgh, [=]() {
+            dgmm_batch_group(MAJOR, left_right, m, n, a, lda, x, incx, c, ldc, group_count,
+                             groupsize);
+        });
+    });
+    return done;
 }
 
 sycl::event dgmm_batch(sycl::queue& queue, side* left_right, int64_t* m, int64_t* n,
                        const double** a, int64_t* lda, const double** x, int64_t* incx, double** c,
                        int64_t* ldc, int64_t group_count, int64_t* groupsize,
                        const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_ddgmm_batch_group_usm>(queue, cgh, [=]() {
+            dgmm_batch_group(MAJOR, left_right, m, n, a, lda, x, incx, c, ldc, group_count,
+                             groupsize);
+        });
+    });
+    return done;
 }
 
 sycl::event dgmm_batch(sycl::queue& queue, side* left_right, int64_t* m, int64_t* n,
                        const std::complex<float>** a, int64_t* lda, const std::complex<float>** x,
                        int64_t* incx, std::complex<float>** c, int64_t* ldc, int64_t group_count,
                        int64_t* groupsize, const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cdgmm_batch_group_usm>(queue, cgh, [=]() {
+            dgmm_batch_group(MAJOR, left_right, m, n, a, lda, x, incx, c, ldc, group_count,
+                             groupsize);
+        });
+    });
+    return done;
 }
 
 sycl::event dgmm_batch(sycl::queue& queue, side* left_right, int64_t* m, int64_t* n,
                        const std::complex<double>** a, int64_t* lda, const std::complex<double>** x,
                        int64_t* incx, std::complex<double>** c, int64_t* ldc, int64_t group_count,
                        int64_t* groupsize, const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "dgmm_batch", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zdgmm_batch_group_usm>(queue, cgh, [=]() {
+            dgmm_batch_group(MAJOR, left_right, m, n, a, lda, x, incx, c, ldc, group_count,
+                             groupsize);
+        });
+    });
+    return done;
 }
 
 sycl::event gemm_batch(sycl::queue& queue, transpose* transa, transpose* transb, int64_t* m,
@@ -943,12 +1187,18 @@ sycl::event gemm_batch(sycl::queue& queue, transpose* transa, transpose* transb,
                        const float** b, int64_t* ldb, float* beta, float** c, int64_t* ldc,
                        int64_t group_count, int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    check_cblas_int_groups(group_count, m, n, k, lda, ldb, ldc);
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sgemm_batch_group_usm>(queue, cgh, [=]() {
+            gemm_batch_group(MAJOR, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                             group_count, group_size);
+        });
+    });
+    return done;
 }
 
 sycl::event gemm_batch(sycl::queue& queue, transpose* transa, transpose* transb, int64_t* m,
@@ -956,12 +1206,18 @@ sycl::event gemm_batch(sycl::queue& queue, transpose* transa, transpose* transb,
                        const double** b, int64_t* ldb, double* beta, double** c, int64_t* ldc,
                        int64_t group_count, int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    check_cblas_int_groups(group_count, m, n, k, lda, ldb, ldc);
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dgemm_batch_group_usm>(queue, cgh, [=]() {
+            gemm_batch_group(MAJOR, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                             group_count, group_size);
+        });
+    });
+    return done;
 }
 
 sycl::event gemm_batch(sycl::queue& queue, transpose* transa, transpose* transb, int64_t* m,
@@ -970,12 +1226,18 @@ sycl::event gemm_batch(sycl::queue& queue, transpose* transa, transpose* transb,
                        int64_t* ldb, std::complex<float>* beta, std::complex<float>** c,
                        int64_t* ldc, int64_t group_count, int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    check_cblas_int_groups(group_count, m, n, k, lda, ldb, ldc);
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cgemm_batch_group_usm>(queue, cgh, [=]() {
+            gemm_batch_group(MAJOR, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                             group_count, group_size);
+        });
+    });
+    return done;
 }
 
 sycl::event gemm_batch(sycl::queue& queue, transpose* transa, transpose* transb, int64_t* m,
@@ -984,12 +1246,18 @@ sycl::event gemm_batch(sycl::queue& queue, transpose* transa, transpose* transb,
                        int64_t* ldb, std::complex<double>* beta, std::complex<double>** c,
                        int64_t* ldc, int64_t group_count, int64_t* group_size,
                        const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    check_cblas_int_groups(group_count, m, n, k, lda, ldb, ldc);
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zgemm_batch_group_usm>(queue, cgh, [=]() {
+            gemm_batch_group(MAJOR, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                             group_count, group_size);
+        });
+    });
+    return done;
 }
 
 sycl::event gemm_batch(sycl::queue& queue, transpose* transa, transpose* transb, int64_t* m,
@@ -1049,12 +1317,18 @@ sycl::event gemm_batch(sycl::queue& queue, transpose transa, transpose transb, i
                        const float* b, int64_t ldb, int64_t stride_b, float beta, float* c,
                        int64_t ldc, int64_t stride_c, int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    check_cblas_ints(m, n, k, lda, ldb, ldc);
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sgemm_batch_usm>(queue, cgh, [=]() {
+            gemm_batch_strided(MAJOR, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                               stride_b, beta, c, ldc, stride_c, batch_size);
+        });
+    });
+    return done;
 }
 
 sycl::event gemm_batch(sycl::queue& queue, transpose transa, transpose transb, int64_t m, int64_t n,
@@ -1062,12 +1336,18 @@ sycl::event gemm_batch(sycl::queue& queue, transpose transa, transpose transb, i
                        const double* b, int64_t ldb, int64_t stride_b, double beta, double* c,
                        int64_t ldc, int64_t stride_c, int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    check_cblas_ints(m, n, k, lda, ldb, ldc);
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dgemm_batch_usm>(queue, cgh, [=]() {
+            gemm_batch_strided(MAJOR, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                               stride_b, beta, c, ldc, stride_c, batch_size);
+        });
+    });
+    return done;
 }
 
 sycl::event gemm_batch(sycl::queue& queue, transpose transa, transpose transb, int64_t m, int64_t n,
@@ -1076,12 +1356,18 @@ sycl::event gemm_batch(sycl::queue& queue, transpose transa, transpose transb, i
                        int64_t stride_b, std::complex<float> beta, std::complex<float>* c,
                        int64_t ldc, int64_t stride_c, int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    check_cblas_ints(m, n, k, lda, ldb, ldc);
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cgemm_batch_usm>(queue, cgh, [=]() {
+            gemm_batch_strided(MAJOR, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                               stride_b, beta, c, ldc, stride_c, batch_size);
+        });
+    });
+    return done;
 }
 
 sycl::event gemm_batch(sycl::queue& queue, transpose transa, transpose transb, int64_t m, int64_t n,
@@ -1090,12 +1376,18 @@ sycl::event gemm_batch(sycl::queue& queue, transpose transa, transpose transb, i
                        int64_t stride_b, std::complex<double> beta, std::complex<double>* c,
                        int64_t ldc, int64_t stride_c, int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_batch", "for row_major layout");
-#endif
+    check_cblas_ints(m, n, k, lda, ldb, ldc);
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zgemm_batch_usm>(queue, cgh, [=]() {
+            gemm_batch_strided(MAJOR, transa, transb, m, n, k, alpha, a, lda, stride_a, b, ldb,
+                               stride_b, beta, c, ldc, stride_c, batch_size);
+        });
+    });
+    return done;
 }
 
 sycl::event gemm_batch(sycl::queue& queue, transpose transa, transpose transb, int64_t m, int64_t n,
@@ -1154,24 +1446,36 @@ sycl::event trsm_batch(sycl::queue& queue, side left_right, uplo upper_lower, tr
                        diag unit_diag, int64_t m, int64_t n, float alpha, const float* a,
                        int64_t lda, int64_t stride_a, float* b, int64_t ldb, int64_t stride_b,
                        int64_t batch_size, const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for row_major layout");
-#endif
+    check_cblas_ints(m, n, lda, ldb);
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_strsm_batch_usm>(queue, cgh, [=]() {
+            trsm_batch_strided(queue, MAJOR, left_right, upper_lower, trans, unit_diag, m, n, alpha,
+                               a, lda, stride_a, b, ldb, stride_b, batch_size);
+        });
+    });
+    return done;
 }
 
 sycl::event trsm_batch(sycl::queue& queue, side left_right, uplo upper_lower, transpose trans,
                        diag unit_diag, int64_t m, int64_t n, double alpha, const double* a,
                        int64_t lda, int64_t stride_a, double* b, int64_t ldb, int64_t stride_b,
                        int64_t batch_size, const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for row_major layout");
-#endif
+    check_cblas_ints(m, n, lda, ldb);
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dtrsm_batch_usm>(queue, cgh, [=]() {
+            trsm_batch_strided(queue, MAJOR, left_right, upper_lower, trans, unit_diag, m, n, alpha,
+                               a, lda, stride_a, b, ldb, stride_b, batch_size);
+        });
+    });
+    return done;
 }
 
 sycl::event trsm_batch(sycl::queue& queue, side left_right, uplo upper_lower, transpose trans,
@@ -1179,12 +1483,18 @@ sycl::event trsm_batch(sycl::queue& queue, side left_right, uplo upper_lower, tr
                        const std::complex<float>* a, int64_t lda, int64_t stride_a,
                        std::complex<float>* b, int64_t ldb, int64_t stride_b, int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for row_major layout");
-#endif
+    check_cblas_ints(m, n, lda, ldb);
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_ctrsm_batch_usm>(queue, cgh, [=]() {
+            trsm_batch_strided(queue, MAJOR, left_right, upper_lower, trans, unit_diag, m, n, alpha,
+                               a, lda, stride_a, b, ldb, stride_b, batch_size);
+        });
+    });
+    return done;
 }
 
 sycl::event trsm_batch(sycl::queue& queue, side left_right, uplo upper_lower, transpose trans,
@@ -1192,36 +1502,54 @@ sycl::event trsm_batch(sycl::queue& queue, side left_right, uplo upper_lower, tr
                        const std::complex<double>* a, int64_t lda, int64_t stride_a,
                        std::complex<double>* b, int64_t ldb, int64_t stride_b, int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for row_major layout");
-#endif
+    check_cblas_ints(m, n, lda, ldb);
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_ztrsm_batch_usm>(queue, cgh, [=]() {
+            trsm_batch_strided(queue, MAJOR, left_right, upper_lower, trans, unit_diag, m, n, alpha,
+                               a, lda, stride_a, b, ldb, stride_b, batch_size);
+        });
+    });
+    return done;
 }
 
 sycl::event trsm_batch(sycl::queue& queue, side* left_right, uplo* upper_lower, transpose* trans,
                        diag* unit_diag, int64_t* m, int64_t* n, float* alpha, const float** a,
                        int64_t* lda, float** b, int64_t* ldb, int64_t group_count,
                        int64_t* groupsize, const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for row_major layout");
-#endif
+    check_cblas_int_groups(group_count, m, n, lda, ldb);
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_strsm_batch_group_usm>(queue, cgh, [=]() {
+            trsm_batch_group(queue, MAJOR, left_right, upper_lower, trans, unit_diag, m, n, alpha,
+                             a, lda, b, ldb, group_count, groupsize);
+        });
+    });
+    return done;
 }
 
 sycl::event trsm_batch(sycl::queue& queue, side* left_right, uplo* upper_lower, transpose* trans,
                        diag* unit_diag, int64_t* m, int64_t* n, double* alpha, const double** a,
                        int64_t* lda, double** b, int64_t* ldb, int64_t group_count,
                        int64_t* groupsize, const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for row_major layout");
-#endif
+    check_cblas_int_groups(group_count, m, n, lda, ldb);
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dtrsm_batch_group_usm>(queue, cgh, [=]() {
+            trsm_batch_group(queue, MAJOR, left_right, upper_lower, trans, unit_diag, m, n, alpha,
+                             a, lda, b, ldb, group_count, groupsize);
+        });
+    });
+    return done;
 }
 
 sycl::event trsm_batch(sycl::queue& queue, side* left_right, uplo* upper_lower, transpose* trans,
@@ -1229,12 +1557,18 @@ sycl::event trsm_batch(sycl::queue& queue, side* left_right, uplo* upper_lower,
                        const std::complex<float>** a, int64_t* lda, std::complex<float>** b,
                        int64_t* ldb, int64_t group_count, int64_t* groupsize,
                        const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for row_major layout");
-#endif
+    check_cblas_int_groups(group_count, m, n, lda, ldb);
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_ctrsm_batch_group_usm>(queue, cgh, [=]() {
+            trsm_batch_group(queue, MAJOR, left_right, upper_lower, trans, unit_diag, m, n, alpha,
+                             a, lda, b, ldb, group_count, groupsize);
+        });
+    });
+    return done;
 }
 
 sycl::event trsm_batch(sycl::queue& queue, side* left_right, uplo* upper_lower, transpose* trans,
@@ -1242,36 +1576,54 @@ sycl::event trsm_batch(sycl::queue& queue, side* left_right, uplo* upper_lower,
                        const std::complex<double>** a, int64_t* lda, std::complex<double>** b,
                        int64_t* ldb, int64_t group_count, int64_t* groupsize,
                        const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "trsm_batch", "for row_major layout");
-#endif
+    check_cblas_int_groups(group_count, m, n, lda, ldb);
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_ztrsm_batch_group_usm>(queue, cgh, [=]() {
+            trsm_batch_group(queue, MAJOR, left_right, upper_lower, trans, unit_diag, m, n, alpha,
+                             a, lda, b, ldb, group_count, groupsize);
+        });
+    });
+    return done;
 }
 
 sycl::event syrk_batch(sycl::queue& queue, uplo* upper_lower, transpose* trans, int64_t* n,
                        int64_t* k, float* alpha, const float** a, int64_t* lda, float* beta,
                        float** c, int64_t* ldc, int64_t group_count, int64_t* groupsize,
                        const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for row_major layout");
-#endif
+    check_cblas_int_groups(group_count, n, k, lda, ldc);
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_ssyrk_batch_group_usm>(queue, cgh, [=]() {
+            syrk_batch_group(MAJOR, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                             group_count, groupsize);
+        });
+    });
+    return done;
 }
 
 sycl::event syrk_batch(sycl::queue& queue, uplo* upper_lower, transpose* trans, int64_t* n,
                        int64_t* k, double* alpha, const double** a, int64_t* lda, double* beta,
                        double** c, int64_t* ldc, int64_t group_count, int64_t* groupsize,
                        const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for row_major layout");
-#endif
+    check_cblas_int_groups(group_count, n, k, lda, ldc);
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dsyrk_batch_group_usm>(queue, cgh, [=]() {
+            syrk_batch_group(MAJOR, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                             group_count, groupsize);
+        });
+    });
+    return done;
 }
 
 sycl::event syrk_batch(sycl::queue& queue, uplo* upper_lower, transpose* trans, int64_t* n,
@@ -1279,12 +1631,18 @@ sycl::event syrk_batch(sycl::queue& queue, uplo* upper_lower, transpose* trans,
                        int64_t* lda, std::complex<float>* beta, std::complex<float>** c,
                        int64_t* ldc, int64_t group_count, int64_t* groupsize,
                        const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for row_major layout");
-#endif
+    check_cblas_int_groups(group_count, n, k, lda, ldc);
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_csyrk_batch_group_usm>(queue, cgh, [=]() {
+            syrk_batch_group(MAJOR, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                             group_count, groupsize);
+        });
+    });
+    return done;
 }
 
 sycl::event syrk_batch(sycl::queue& queue, uplo* upper_lower, transpose* trans, int64_t* n,
@@ -1292,36 +1650,54 @@ sycl::event syrk_batch(sycl::queue& queue, uplo* upper_lower, transpose* trans,
                        int64_t* lda, std::complex<double>* beta, std::complex<double>** c,
                        int64_t* ldc, int64_t group_count, int64_t* groupsize,
                        const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for row_major layout");
-#endif
+    check_cblas_int_groups(group_count, n, k, lda, ldc);
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zsyrk_batch_group_usm>(queue, cgh, [=]() {
+            syrk_batch_group(MAJOR, upper_lower, trans, n, k, alpha, a, lda, beta, c, ldc,
+                             group_count, groupsize);
+        });
+    });
+    return done;
 }
 
 sycl::event syrk_batch(sycl::queue& queue, uplo upper_lower, transpose trans, int64_t n, int64_t k,
                        float alpha, const float* a, int64_t lda, int64_t stride_a, float beta,
                        float* c, int64_t ldc, int64_t stride_c, int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for row_major layout");
-#endif
+    check_cblas_ints(n, k, lda, ldc);
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_ssyrk_batch_usm>(queue, cgh, [=]() {
+            syrk_batch_strided(MAJOR, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c,
+                               ldc, stride_c, batch_size);
+        });
+    });
+    return done;
 }
 
 sycl::event syrk_batch(sycl::queue& queue, uplo upper_lower, transpose trans, int64_t n, int64_t k,
                        double alpha, const double* a, int64_t lda, int64_t stride_a, double beta,
                        double* c, int64_t ldc, int64_t stride_c, int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for row_major layout");
-#endif
+    check_cblas_ints(n, k, lda, ldc);
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dsyrk_batch_usm>(queue, cgh, [=]() {
+            syrk_batch_strided(MAJOR, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c,
+                               ldc, stride_c, batch_size);
+        });
+    });
+    return done;
 }
 
 sycl::event syrk_batch(sycl::queue& queue, uplo upper_lower, transpose trans, int64_t n, int64_t k,
@@ -1329,12 +1705,18 @@ sycl::event syrk_batch(sycl::queue& queue, uplo upper_lower, transpose trans, in
                        int64_t stride_a, std::complex<float> beta, std::complex<float>* c,
                        int64_t ldc, int64_t stride_c, int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for row_major layout");
-#endif
+    check_cblas_ints(n, k, lda, ldc);
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_csyrk_batch_usm>(queue, cgh, [=]() {
+            syrk_batch_strided(MAJOR, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c,
+                               ldc, stride_c, batch_size);
+        });
+    });
+    return done;
 }
 
 sycl::event syrk_batch(sycl::queue& queue, uplo upper_lower, transpose trans, int64_t n, int64_t k,
@@ -1342,12 +1724,18 @@ sycl::event syrk_batch(sycl::queue& queue, uplo upper_lower, transpose trans, in
                        int64_t stride_a, std::complex<double> beta, std::complex<double>* c,
                        int64_t ldc, int64_t stride_c, int64_t batch_size,
                        const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "syrk_batch", "for row_major layout");
-#endif
+    check_cblas_ints(n, k, lda, ldc);
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zsyrk_batch_usm>(queue, cgh, [=]() {
+            syrk_batch_strided(MAJOR, upper_lower, trans, n, k, alpha, a, lda, stride_a, beta, c,
+                               ldc, stride_c, batch_size);
+        });
+    });
+    return done;
 }
 
 sycl::event omatcopy_batch(sycl::queue& queue, transpose trans, int64_t m, int64_t n, float alpha,
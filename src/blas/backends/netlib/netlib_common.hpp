@@ -25,12 +25,27 @@
 #else
 #include <CL/sycl.hpp>
 #endif
+#include <algorithm>
 #include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <limits>
+#include <memory>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <utility>
 
 #include "cblas.h"
 
 #include "oneapi/math/blas/detail/netlib/onemath_blas_netlib.hpp"
+#include "oneapi/math/exceptions.hpp"
 #include "oneapi/math/types.hpp"
+#include "async_error_recorder.hpp"
+#include "cpu_execution_policy_lookup.hpp"
+#include "handle_pool.hpp"
+#include "netlib_thread_pool.hpp"
 
 #define GET_MULTI_PTR template get_multi_ptr<sycl::access::decorated::yes>().get_raw()
 
@@ -76,6 +91,276 @@ inline CBLAS_OFFSET convert_to_cblas_offset(offset offsetc) {
         return CBLAS_OFFSET::CblasRowOffset;
 }
 
+/**
+ * Integer type of the CBLAS library. The build defines NETLIB_ILP64 when it finds a CBLAS
+ * with 64-bit integers, to which the dimensions, leading dimensions and increments are passed
+ * unchanged.
+ */
+#ifdef NETLIB_ILP64
+using cblas_int = int64_t;
+#else
+using cblas_int = int;
+#endif
+
+// Converts a dimension, leading dimension or increment to the CBLAS integer type. With a
+// 32-bit CBLAS, values out of its range are reported instead of being truncated.
+inline cblas_int to_cblas_int(int64_t value) {
+#ifndef NETLIB_ILP64
+    if (value > std::numeric_limits<int>::max() || value < std::numeric_limits<int>::min()) {
+        throw invalid_argument("blas", "netlib",
+                               "for the value " + std::to_string(value) +
+                                   ", which the 32-bit integers of the CBLAS library cannot hold");
+    }
+#endif
+    return static_cast<cblas_int>(value);
+}
+
+// Whether a value fits the CBLAS integer type
+inline bool fits_cblas_int(int64_t value) {
+    return value == static_cast<cblas_int>(value);
+}
+
+// Checks the dimensions, leading dimensions and increments of a routine on the calling
+// thread, so that a value out of range is thrown by the routine itself rather than reported
+// by its host task
+template <typename... Values>
+inline void check_cblas_ints(Values... values) {
+    (static_cast<void>(to_cblas_int(values)), ...);
+}
+
+// Checks the arguments of every group of a group batch routine on the calling thread, before
+// its host task is submitted
+template <typename... Arrays>
+inline void check_cblas_int_groups(int64_t group_count, const Arrays*... arrays) {
+    for (int64_t g = 0; g < group_count; ++g) {
+        check_cblas_ints(arrays[g]...);
+    }
+}
+
+/**
+ * CBLAS routines overloaded on the data type, for the routines implemented once for all
+ * types.
+ */
+
+inline void cblas_gemm(CBLAS_LAYOUT layout, CBLAS_TRANSPOSE transa, CBLAS_TRANSPOSE transb,
+                       cblas_int m, cblas_int n, cblas_int k, float alpha, const float* a,
+                       cblas_int lda, const float* b, cblas_int ldb, float beta, float* c,
+                       cblas_int ldc) {
+    ::cblas_sgemm(layout, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+inline void cblas_gemm(CBLAS_LAYOUT layout, CBLAS_TRANSPOSE transa, CBLAS_TRANSPOSE transb,
+                       cblas_int m, cblas_int n, cblas_int k, double alpha, const double* a,
+                       cblas_int lda, const double* b, cblas_int ldb, double beta, double* c,
+                       cblas_int ldc) {
+    ::cblas_dgemm(layout, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+inline void cblas_gemm(CBLAS_LAYOUT layout, CBLAS_TRANSPOSE transa, CBLAS_TRANSPOSE transb,
+                       cblas_int m, cblas_int n, cblas_int k, std::complex<float> alpha,
+                       const std::complex<float>* a, cblas_int lda, const std::complex<float>* b,
+                       cblas_int ldb, std::complex<float> beta, std::complex<float>* c,
+                       cblas_int ldc) {
+    ::cblas_cgemm(layout, transa, transb, m, n, k, &alpha, a, lda, b, ldb, &beta, c, ldc);
+}
+
+inline void cblas_gemm(CBLAS_LAYOUT layout, CBLAS_TRANSPOSE transa, CBLAS_TRANSPOSE transb,
+                       cblas_int m, cblas_int n, cblas_int k, std::complex<double> alpha,
+                       const std::complex<double>* a, cblas_int lda, const std::complex<double>* b,
+                       cblas_int ldb, std::complex<double> beta, std::complex<double>* c,
+                       cblas_int ldc) {
+    ::cblas_zgemm(layout, transa, transb, m, n, k, &alpha, a, lda, b, ldb, &beta, c, ldc);
+}
+
+inline void cblas_syrk(CBLAS_LAYOUT layout, CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans, cblas_int n,
+                       cblas_int k, float alpha, const float* a, cblas_int lda, float beta,
+                       float* c, cblas_int ldc) {
+    ::cblas_ssyrk(layout, uplo, trans, n, k, alpha, a, lda, beta, c, ldc);
+}
+
+inline void cblas_syrk(CBLAS_LAYOUT layout, CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans, cblas_int n,
+                       cblas_int k, double alpha, const double* a, cblas_int lda, double beta,
+                       double* c, cblas_int ldc) {
+    ::cblas_dsyrk(layout, uplo, trans, n, k, alpha, a, lda, beta, c, ldc);
+}
+
+inline void cblas_syrk(CBLAS_LAYOUT layout, CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans, cblas_int n,
+                       cblas_int k, std::complex<float> alpha, const std::complex<float>* a,
+                       cblas_int lda, std::complex<float> beta, std::complex<float>* c,
+                       cblas_int ldc) {
+    ::cblas_csyrk(layout, uplo, trans, n, k, &alpha, a, lda, &beta, c, ldc);
+}
+
+inline void cblas_syrk(CBLAS_LAYOUT layout, CBLAS_UPLO uplo, CBLAS_TRANSPOSE trans, cblas_int n,
+                       cblas_int k, std::complex<double> alpha, const std::complex<double>* a,
+                       cblas_int lda, std::complex<double> beta, std::complex<double>* c,
+                       cblas_int ldc) {
+    ::cblas_zsyrk(layout, uplo, trans, n, k, &alpha, a, lda, &beta, c, ldc);
+}
+
+inline void cblas_trsm(CBLAS_LAYOUT layout, CBLAS_SIDE side, CBLAS_UPLO uplo,
+                       CBLAS_TRANSPOSE trans, CBLAS_DIAG diag, cblas_int m, cblas_int n,
+                       float alpha, const float* a, cblas_int lda, float* b, cblas_int ldb) {
+    ::cblas_strsm(layout, side, uplo, trans, diag, m, n, alpha, a, lda, b, ldb);
+}
+
+inline void cblas_trsm(CBLAS_LAYOUT layout, CBLAS_SIDE side, CBLAS_UPLO uplo,
+                       CBLAS_TRANSPOSE trans, CBLAS_DIAG diag, cblas_int m, cblas_int n,
+                       double alpha, const double* a, cblas_int lda, double* b, cblas_int ldb) {
+    ::cblas_dtrsm(layout, side, uplo, trans, diag, m, n, alpha, a, lda, b, ldb);
+}
+
+inline void cblas_trsm(CBLAS_LAYOUT layout, CBLAS_SIDE side, CBLAS_UPLO uplo,
+                       CBLAS_TRANSPOSE trans, CBLAS_DIAG diag, cblas_int m, cblas_int n,
+                       std::complex<float> alpha, const std::complex<float>* a, cblas_int lda,
+                       std::complex<float>* b, cblas_int ldb) {
+    ::cblas_ctrsm(layout, side, uplo, trans, diag, m, n, &alpha, a, lda, b, ldb);
+}
+
+inline void cblas_trsm(CBLAS_LAYOUT layout, CBLAS_SIDE side, CBLAS_UPLO uplo,
+                       CBLAS_TRANSPOSE trans, CBLAS_DIAG diag, cblas_int m, cblas_int n,
+                       std::complex<double> alpha, const std::complex<double>* a, cblas_int lda,
+                       std::complex<double>* b, cblas_int ldb) {
+    ::cblas_ztrsm(layout, side, uplo, trans, diag, m, n, &alpha, a, lda, b, ldb);
+}
+
+// General matrix product with cblas_gemm. A 32-bit CBLAS is called on tiles whose dimensions
+// fit its integers, and an operand whose leading dimension does not fit is passed one column
+// at a time, with the rows of the tile as leading dimension.
+template <typename T>
+inline void gemm_in_tiles(CBLAS_LAYOUT layout, transpose transa, transpose transb, int64_t m,
+                          int64_t n, int64_t k, T alpha, const T* a, int64_t lda, const T* b,
+                          int64_t ldb, T beta, T* c, int64_t ldc) {
+#ifdef NETLIB_ILP64
+    cblas_gemm(layout, convert_to_cblas_trans(transa), convert_to_cblas_trans(transb), m, n, k,
+               alpha, a, lda, b, ldb, beta, c, ldc);
+#else
+    // A row-major product is the column-major product of the transposes in reverse order
+    if (layout == CblasRowMajor) {
+        std::swap(m, n);
+        std::swap(transa, transb);
+        std::swap(a, b);
+        std::swap(lda, ldb);
+    }
+    constexpr int64_t max_int = std::numeric_limits<int>::max();
+    const bool trans_a = transa != transpose::nontrans;
+    const bool trans_b = transb != transpose::nontrans;
+    const bool long_a = lda > max_int, long_b = ldb > max_int, long_c = ldc > max_int;
+    // Columns of a are the k dimension, or the m one when it is transposed, and likewise for b
+    const int64_t tile_m = long_a && trans_a ? 1 : max_int;
+    const int64_t tile_n = long_c || (long_b && !trans_b) ? 1 : max_int;
+    const int64_t tile_k = (long_a && !trans_a) || (long_b && trans_b) ? 1 : max_int;
+    const CBLAS_TRANSPOSE cblas_transa = convert_to_cblas_trans(transa);
+    const CBLAS_TRANSPOSE cblas_transb = convert_to_cblas_trans(transb);
+    for (int64_t j0 = 0; j0 < n; j0 += tile_n) {
+        const int64_t nb = std::min(tile_n, n - j0);
+        for (int64_t i0 = 0; i0 < m; i0 += tile_m) {
+            const int64_t mb = std::min(tile_m, m - i0);
+            // With k = 0, c is only scaled by beta
+            for (int64_t p0 = 0; p0 == 0 || p0 < k; p0 += tile_k) {
+                const int64_t kb = std::min(tile_k, k - p0);
+                const T* a_tile = trans_a ? a + p0 + i0 * lda : a + i0 + p0 * lda;
+                const T* b_tile = trans_b ? b + j0 + p0 * ldb : b + p0 + j0 * ldb;
+                const int64_t lda_tile = long_a ? std::max<int64_t>(trans_a ? kb : mb, 1) : lda;
+                const int64_t ldb_tile = long_b ? std::max<int64_t>(trans_b ? nb : kb, 1) : ldb;
+                const int64_t ldc_tile = long_c ? mb : ldc;
+                cblas_gemm(CblasColMajor, cblas_transa, cblas_transb, (cblas_int)mb, (cblas_int)nb,
+                           (cblas_int)kb, alpha, a_tile, (cblas_int)lda_tile, b_tile,
+                           (cblas_int)ldb_tile, p0 == 0 ? beta : T(1), c + i0 + j0 * ldc,
+                           (cblas_int)ldc_tile);
+            }
+        }
+    }
+#endif
+}
+
+// Offset of the first element of a vector of n elements with increment inc, which is the
+// last one in memory when inc is negative
+inline int64_t first_element(int64_t n, int64_t inc) {
+    return inc < 0 ? (1 - n) * inc : 0;
+}
+
+template <typename T>
+inline T conj_element(T value) {
+    return value;
+}
+
+template <typename T>
+inline std::complex<T> conj_element(std::complex<T> value) {
+    return std::conj(value);
+}
+
+// Increment or leading dimension of the host loops written in place of CBLAS calls. The loops
+// take them as template parameters, so that unit increments are compile-time constants and
+// the loops can be vectorized.
+using unit_inc = std::integral_constant<int64_t, 1>;
+
+// Order of the square panels that the gemm routines for types without a CBLAS gemm convert
+// their operands to, so that the converted panels stay in the L2 cache and the extra memory
+// does not grow with the problem
+static constexpr int64_t gemm_panel = 256;
+
+// Converts the rows x cols block at (i0, j0) of op(a), for a column-major a of a real type,
+// to a column-major panel with leading dimension rows: panel(i, j) = op(a)(i0 + i, j0 + j) -
+// offset
+template <typename Ta, typename Tp>
+inline void pack_panel(transpose trans, const Ta* a, int64_t lda, int64_t i0, int64_t j0,
+                       int64_t rows, int64_t cols, Tp offset, Tp* panel) {
+    if (trans == transpose::nontrans) {
+        for (int64_t j = 0; j < cols; ++j) {
+            const Ta* a_j = a + i0 + (j0 + j) * lda;
+            for (int64_t i = 0; i < rows; ++i)
+                panel[i + j * rows] = static_cast<Tp>(a_j[i]) - offset;
+        }
+    }
+    else {
+        // Row i of op(a) is column i of a
+        for (int64_t i = 0; i < rows; ++i) {
+            const Ta* a_i = a + j0 + (i0 + i) * lda;
+            for (int64_t j = 0; j < cols; ++j)
+                panel[i + j * rows] = static_cast<Tp>(a_i[j]) - offset;
+        }
+    }
+}
+
+/**
+ * Host memory for the temporaries of a routine. It is pooled per host thread and device,
+ * so that the host tasks of consecutive calls reuse it instead of allocating.
+ */
+class workspace {
+public:
+    explicit workspace(const sycl::queue&) {}
+
+    // Returns space for at least count elements of T, 64-byte aligned. The contents of
+    // previous requests are not preserved.
+    template <typename T>
+    T* get(std::size_t count) {
+        const std::size_t bytes = count * sizeof(T);
+        if (bytes > size_) {
+            data_.reset(static_cast<char*>(::operator new(bytes, std::align_val_t(alignment))));
+            size_ = bytes;
+        }
+        return reinterpret_cast<T*>(data_.get());
+    }
+
+private:
+    static constexpr std::size_t alignment = 64;
+
+    struct deleter {
+        void operator()(char* p) const {
+            ::operator delete(p, std::align_val_t(alignment));
+        }
+    };
+
+    std::unique_ptr<char, deleter> data_;
+    std::size_t size_ = 0;
+};
+
+// To be called from within host tasks, whose thread then owns the workspace
+inline workspace& get_workspace(const sycl::queue& queue) {
+    return oneapi::math::detail::handle_pool<workspace>::get(queue);
+}
+
 // host_task automatically uses run_on_host_intel if it is supported by the
 //  compiler. Otherwise, it falls back to single_task.
 template <typename K, typename H, typename F>
@@ -90,9 +375,29 @@ static inline void host_task_internal(H& cgh, F f, long) {
 #endif
 }
 
+// Execution policy of the queue, or nullptr if it has none
+inline std::shared_ptr<const cpu_execution_policy> get_execution_policy(const sycl::queue& queue) {
+    return oneapi::math::detail::find_cpu_execution_policy(queue);
+}
+
+// The host task runs f with the execution policy the queue has at submission, if any. Its
+// errors, including those of the batch items run by the thread pool and the policy CPUs
+// that cannot be bound, are recorded for the queue.
 template <typename K, typename H, typename F>
-static inline void host_task(H& cgh, F f) {
-    (void)host_task_internal<K>(cgh, f, 0);
+static inline void host_task(const sycl::queue& queue, H& cgh, F f) {
+    auto policy = get_execution_policy(queue);
+    (void)host_task_internal<K>(
+        cgh,
+        [=]() {
+            try {
+                policy_scope scope(policy);
+                f();
+            }
+            catch (...) {
+                oneapi::math::detail::raise_async_error(queue, std::current_exception());
+            }
+        },
+        0);
 }
 
 } // namespace netlib
@@ -22,8 +22,13 @@
 #else
 #include <CL/sycl.hpp>
 #endif
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
 
 #include "netlib_common.hpp"
+#include "netlib_thread_pool.hpp"
 #include "oneapi/math/blas/detail/netlib/onemath_blas_netlib.hpp"
 #include "oneapi/math/exceptions.hpp"
 
@@ -31,17 +36,239 @@ namespace oneapi {
 namespace math {
 namespace blas {
 namespace netlib {
+
+// Side of the square tiles that the matrix copies are done by, so that the rows and columns
+// of a transposed tile stay in cache between the reads and the writes
+static constexpr int64_t tile_size = 32;
+
+// Matrices with fewer elements are copied on the calling thread only
+static constexpr int64_t parallel_elements = 1 << 16;
+
+// For the rows [i0, i1) and columns [j0, j1) of a column-major c, whose element (i, j) is at
+// c[i * inc_c + j * ldc]: c(i, j) = alpha * op(a)(i, j), plus c(i, j) if accumulate
+template <bool accumulate, typename T, typename IncA, typename IncC>
+static void scale_tile(transpose trans, int64_t i0, int64_t i1, int64_t j0, int64_t j1, T alpha,
+                       const T* a, int64_t lda, IncA inc_a, T* c, int64_t ldc, IncC inc_c) {
+    for (int64_t j = j0; j < j1; ++j) {
+        T* c_j = c + j * ldc;
+        if (trans == transpose::nontrans) {
+            const T* a_j = a + j * lda;
+            for (int64_t i = i0; i < i1; ++i)
+                c_j[i * inc_c] = alpha * a_j[i * inc_a] + (accumulate ? c_j[i * inc_c] : T(0));
+        }
+        else if (trans == transpose::trans) {
+            const T* a_j = a + j * inc_a;
+            for (int64_t i = i0; i < i1; ++i)
+                c_j[i * inc_c] = alpha * a_j[i * lda] + (accumulate ? c_j[i * inc_c] : T(0));
+        }
+        else {
+            const T* a_j = a + j * inc_a;
+            for (int64_t i = i0; i < i1; ++i)
+                c_j[i * inc_c] =
+                    alpha * conj_element(a_j[i * lda]) + (accumulate ? c_j[i * inc_c] : T(0));
+        }
+    }
+}
+
+// Calls f(i0, i1, j0, j1) for the tiles of an m x n matrix, spread over the thread pool by
+// columns of tiles for large matrices
+template <typename F>
+static void for_each_tile(int64_t m, int64_t n, F&& f) {
+    const int64_t num_tile_cols = (n + tile_size - 1) / tile_size;
+    auto tile_col = [&](int64_t tj) {
+        const int64_t j0 = tj * tile_size;
+        const int64_t j1 = std::min(n, j0 + tile_size);
+        for (int64_t i0 = 0; i0 < m; i0 += tile_size)
+            f(i0, std::min(m, i0 + tile_size), j0, j1);
+    };
+    if (m * n < parallel_elements) {
+        for (int64_t tj = 0; tj < num_tile_cols; ++tj)
+            tile_col(tj);
+    }
+    else {
+        thread_pool::get().parallel_for(num_tile_cols, tile_col);
+    }
+}
+
+// b = alpha * op(a), where the elements of a column are inc_a apart in a and inc_b in b
+template <typename T>
+static void omatcopy_tiled(CBLAS_LAYOUT layout, transpose trans, int64_t m, int64_t n, T alpha,
+                           const T* a, int64_t lda, int64_t inc_a, T* b, int64_t ldb,
+                           int64_t inc_b) {
+    // A row-major matrix is the transpose of a column-major one with m and n swapped
+    if (layout == CblasRowMajor)
+        std::swap(m, n);
+    const int64_t rows_b = trans == transpose::nontrans ? m : n;
+    const int64_t cols_b = trans == transpose::nontrans ? n : m;
+    for_each_tile(rows_b, cols_b, [&](int64_t i0, int64_t i1, int64_t j0, int64_t j1) {
+        if (inc_a == 1 && inc_b == 1)
+            scale_tile<false>(trans, i0, i1, j0, j1, alpha, a, lda, unit_inc(), b, ldb,
+                              unit_inc());
+        else
+            scale_tile<false>(trans, i0, i1, j0, j1, alpha, a, lda, inc_a, b, ldb, inc_b);
+    });
+}
+
+// ab = alpha * op(ab), through a copy of the result in the workspace unless no element moves
+template <typename T>
+static void imatcopy_tiled(CBLAS_LAYOUT layout, transpose trans, int64_t m, int64_t n, T alpha,
+                           T* ab, int64_t lda, int64_t ldb, workspace& ws) {
+    if (trans == transpose::nontrans && lda == ldb) {
+        omatcopy_tiled(layout, trans, m, n, alpha, ab, lda, 1, ab, ldb, 1);
+        return;
+    }
+    if (layout == CblasRowMajor)
+        std::swap(m, n);
+    const int64_t rows_b = trans == transpose::nontrans ? m : n;
+    const int64_t cols_b = trans == transpose::nontrans ? n : m;
+    T* temp = ws.get<T>(rows_b * cols_b);
+    omatcopy_tiled(CblasColMajor, trans, m, n, alpha, ab, lda, 1, temp, rows_b, 1);
+    omatcopy_tiled(CblasColMajor, transpose::nontrans, rows_b, cols_b, T(1), temp, rows_b, 1, ab,
+                   ldb, 1);
+}
+
+// c = alpha * op(a) + beta * op(b), adding op(b) to each tile of c while it is in cache
+template <typename T>
+static void omatadd_tiled(CBLAS_LAYOUT layout, transpose transa, transpose transb, int64_t m,
+                          int64_t n, T alpha, const T* a, int64_t lda, T beta, const T* b,
+                          int64_t ldb, T* c, int64_t ldc) {
+    if (layout == CblasRowMajor)
+        std::swap(m, n);
+    for_each_tile(m, n, [&](int64_t i0, int64_t i1, int64_t j0, int64_t j1) {
+        scale_tile<false>(transa, i0, i1, j0, j1, alpha, a, lda, unit_inc(), c, ldc, unit_inc());
+        scale_tile<true>(transb, i0, i1, j0, j1, beta, b, ldb, unit_inc(), c, ldc, unit_inc());
+    });
+}
+
+// Order of the diagonal blocks of gemmt, which are computed in full into the workspace
+static constexpr int64_t gemmt_block = 128;
+
+// The triangle of c given by upper_lower = alpha * op(a) * op(b) + beta * c. Each block
+// column of the triangle is one gemm on its part below (or above) the diagonal block, plus
+// the diagonal block, so that little more than the triangle is computed.
+template <typename T>
+static void gemmt_blocked(CBLAS_LAYOUT layout, uplo upper_lower, transpose transa,
+                          transpose transb, int64_t n, int64_t k, T alpha, const T* a, int64_t lda,
+                          const T* b, int64_t ldb, T beta, T* c, int64_t ldc, workspace& ws) {
+    // Row-major c = op(a) * op(b) is the column-major c^T = op(b)^T * op(a)^T, whose
+    // operands are the row-major ones with the same transposes
+    if (layout == CblasRowMajor) {
+        upper_lower = upper_lower == uplo::upper ? uplo::lower : uplo::upper;
+        std::swap(transa, transb);
+        std::swap(a, b);
+        std::swap(lda, ldb);
+    }
+    const bool lower = upper_lower == uplo::lower;
+    // Row i of op(a) and column j of op(b)
+    auto a_row = [&](int64_t i) { return transa == transpose::nontrans ? a + i : a + i * lda; };
+    auto b_col = [&](int64_t j) { return transb == transpose::nontrans ? b + j * ldb : b + j; };
+    T* diag_block = ws.get<T>(gemmt_block * gemmt_block);
+    for (int64_t j0 = 0; j0 < n; j0 += gemmt_block) {
+        const int64_t nb = std::min(gemmt_block, n - j0);
+        gemm_in_tiles(CblasColMajor, transa, transb, nb, nb, k, alpha, a_row(j0), lda, b_col(j0),
+                      ldb, T(0), diag_block, nb);
+        for (int64_t j = 0; j < nb; ++j) {
+            T* c_j = c + j0 + (j0 + j) * ldc;
+            const T* block_j = diag_block + j * nb;
+            for (int64_t i = lower ? j : 0; i < (lower ? nb : j + 1); ++i)
+                c_j[i] = beta == T(0) ? block_j[i] : block_j[i] + beta * c_j[i];
+        }
+        const int64_t rows = lower ? n - j0 - nb : j0;
+        if (rows > 0) {
+            const int64_t i0 = lower ? j0 + nb : 0;
+            gemm_in_tiles(CblasColMajor, transa, transb, rows, nb, k, alpha, a_row(i0), lda,
+                          b_col(j0), ldb, beta, c + i0 + j0 * ldc, ldc);
+        }
+    }
+}
+
+// Rounds value to the nearest int32_t, saturating at the ends of its range
+static int32_t round_to_int32(double value) {
+    value = std::nearbyint(value);
+    if (value <= static_cast<double>(std::numeric_limits<int32_t>::min()))
+        return std::numeric_limits<int32_t>::min();
+    if (value >= static_cast<double>(std::numeric_limits<int32_t>::max()))
+        return std::numeric_limits<int32_t>::max();
+    return static_cast<int32_t>(value);
+}
+
+// c = alpha * (op(a) - ao) * (op(b) - bo) + beta * c + co, as CBLAS has no integer gemm.
+// The operands minus their offsets fit in int16_t, and panels of them are converted so that
+// rows of op(a) and columns of op(b) are contiguous: each element of c is then a dot product
+// of int16_t, which compilers vectorize as multiply-adds of pairs into int32_t sums.
+template <typename Ta, typename Tb>
+static void gemm_bias_blocked(CBLAS_LAYOUT layout, transpose transa, transpose transb,
+                              offset offsetc, int64_t m, int64_t n, int64_t k, float alpha,
+                              const Ta* a, int64_t lda, Ta ao, const Tb* b, int64_t ldb, Tb bo,
+                              float beta, int32_t* c, int64_t ldc, const int32_t* co,
+                              workspace& ws) {
+    // Row-major c = op(a) * op(b) is the column-major c^T = op(b)^T * op(a)^T, whose column
+    // offsets are the row ones of c
+    if (layout == CblasRowMajor) {
+        if (offsetc != offset::fix)
+            offsetc = offsetc == offset::column ? offset::row : offset::column;
+        gemm_bias_blocked(CblasColMajor, transb, transa, offsetc, n, m, k, alpha, b, ldb, bo, a,
+                          lda, ao, beta, c, ldc, co, ws);
+        return;
+    }
+    // op(a)^T, whose columns are the rows of op(a)
+    const transpose transa_t =
+        transa == transpose::nontrans ? transpose::trans : transpose::nontrans;
+    // Two int16_t panels, then an int32_t one taking the space of two
+    int16_t* a_panel = ws.get<int16_t>(4 * gemm_panel * gemm_panel);
+    int16_t* b_panel = a_panel + gemm_panel * gemm_panel;
+    int32_t* sum = reinterpret_cast<int32_t*>(b_panel + gemm_panel * gemm_panel);
+    for (int64_t j0 = 0; j0 < n; j0 += gemm_panel) {
+        const int64_t nb = std::min(gemm_panel, n - j0);
+        for (int64_t i0 = 0; i0 < m; i0 += gemm_panel) {
+            const int64_t mb = std::min(gemm_panel, m - i0);
+            std::fill(sum, sum + mb * nb, 0);
+            for (int64_t p0 = 0; p0 < k; p0 += gemm_panel) {
+                const int64_t kb = std::min(gemm_panel, k - p0);
+                pack_panel(transa_t, a, lda, p0, i0, kb, mb, static_cast<int16_t>(ao), a_panel);
+                pack_panel(transb, b, ldb, p0, j0, kb, nb, static_cast<int16_t>(bo), b_panel);
+                for (int64_t j = 0; j < nb; ++j) {
+                    const int16_t* b_j = b_panel + j * kb;
+                    for (int64_t i = 0; i < mb; ++i) {
+                        const int16_t* a_i = a_panel + i * kb;
+                        int32_t dot = 0;
+                        for (int64_t p = 0; p < kb; ++p)
+                            dot += a_i[p] * b_j[p];
+                        sum[i + j * mb] += dot;
+                    }
+                }
+            }
+            for (int64_t j = 0; j < nb; ++j) {
+                int32_t* c_j = c + i0 + (j0 + j) * ldc;
+                const int32_t* sum_j = sum + j * mb;
+                for (int64_t i = 0; i < mb; ++i) {
+                    const int32_t co_ij = offsetc == offset::fix      ? co[0]
+                                          : offsetc == offset::column ? co[i0 + i]
+                                                                      : co[j0 + j];
+                    c_j[i] = round_to_int32(static_cast<double>(alpha) * sum_j[i] +
+                                            static_cast<double>(beta) * c_j[i]) +
+                             co_ij;
+                }
+            }
+        }
+    }
+}
+
 namespace column_major {
 
+#define MAJOR CblasColMajor
 #define COLUMN_MAJOR
 #include "netlib_extensions.cxx"
+#undef MAJOR
 #undef COLUMN_MAJOR
 
 } // namespace column_major
 namespace row_major {
 
+#define MAJOR CblasRowMajor
 #define ROW_MAJOR
 #include "netlib_extensions.cxx"
+#undef MAJOR
 #undef ROW_MAJOR
 
 } // namespace row_major
@@ -23,269 +23,341 @@ void gemm_bias(sycl::queue& queue, transpose transa, transpose transb, offset of
                int64_t n, int64_t k, float alpha, sycl::buffer<int8_t, 1>& a, int64_t lda,
                int8_t ao, sycl::buffer<int8_t, 1>& b, int64_t ldb, int8_t bo, float beta,
                sycl::buffer<int32_t, 1>& c, int64_t ldc, sycl::buffer<int32_t, 1>& co) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_bias", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_bias", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler& cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_co = co.get_access<sycl::access::mode::read>(cgh);
+        host_task<class netlib_gemm_bias_s8s8s32>(queue, cgh, [=]() {
+            gemm_bias_blocked(MAJOR, transa, transb, offsetc, m, n, k, alpha,
+                              accessor_a.GET_MULTI_PTR, lda, ao, accessor_b.GET_MULTI_PTR, ldb, bo,
+                              beta, accessor_c.GET_MULTI_PTR, ldc, accessor_co.GET_MULTI_PTR,
+                              get_workspace(queue));
+        });
+    });
 }
 
 void gemm_bias(sycl::queue& queue, transpose transa, transpose transb, offset offsetc, int64_t m,
                int64_t n, int64_t k, float alpha, sycl::buffer<int8_t, 1>& a, int64_t lda,
                int8_t ao, sycl::buffer<uint8_t, 1>& b, int64_t ldb, uint8_t bo, float beta,
                sycl::buffer<int32_t, 1>& c, int64_t ldc, sycl::buffer<int32_t, 1>& co) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_bias", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_bias", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler& cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_co = co.get_access<sycl::access::mode::read>(cgh);
+        host_task<class netlib_gemm_bias_s8u8s32>(queue, cgh, [=]() {
+            gemm_bias_blocked(MAJOR, transa, transb, offsetc, m, n, k, alpha,
+                              accessor_a.GET_MULTI_PTR, lda, ao, accessor_b.GET_MULTI_PTR, ldb, bo,
+                              beta, accessor_c.GET_MULTI_PTR, ldc, accessor_co.GET_MULTI_PTR,
+                              get_workspace(queue));
+        });
+    });
 }
 
 void gemm_bias(sycl::queue& queue, transpose transa, transpose transb, offset offsetc, int64_t m,
                int64_t n, int64_t k, float alpha, sycl::buffer<uint8_t, 1>& a, int64_t lda,
                uint8_t ao, sycl::buffer<int8_t, 1>& b, int64_t ldb, int8_t bo, float beta,
                sycl::buffer<int32_t, 1>& c, int64_t ldc, sycl::buffer<int32_t, 1>& co) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_bias", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_bias", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler& cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_co = co.get_access<sycl::access::mode::read>(cgh);
+        host_task<class netlib_gemm_bias_u8s8s32>(queue, cgh, [=]() {
+            gemm_bias_blocked(MAJOR, transa, transb, offsetc, m, n, k, alpha,
+                              accessor_a.GET_MULTI_PTR, lda, ao, accessor_b.GET_MULTI_PTR, ldb, bo,
+                              beta, accessor_c.GET_MULTI_PTR, ldc, accessor_co.GET_MULTI_PTR,
+                              get_workspace(queue));
+        });
+    });
 }
 
 void gemm_bias(sycl::queue& queue, transpose transa, transpose transb, offset offsetc, int64_t m,
                int64_t n, int64_t k, float alpha, sycl::buffer<uint8_t, 1>& a, int64_t lda,
                uint8_t ao, sycl::buffer<uint8_t, 1>& b, int64_t ldb, uint8_t bo, float beta,
                sycl::buffer<int32_t, 1>& c, int64_t ldc, sycl::buffer<int32_t, 1>& co) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_bias", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_bias", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler& cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        auto accessor_co = co.get_access<sycl::access::mode::read>(cgh);
+        host_task<class netlib_gemm_bias_u8u8s32>(queue, cgh, [=]() {
+            gemm_bias_blocked(MAJOR, transa, transb, offsetc, m, n, k, alpha,
+                              accessor_a.GET_MULTI_PTR, lda, ao, accessor_b.GET_MULTI_PTR, ldb, bo,
+                              beta, accessor_c.GET_MULTI_PTR, ldc, accessor_co.GET_MULTI_PTR,
+                              get_workspace(queue));
+        });
+    });
 }
 
 void gemmt(sycl::queue& queue, uplo upper_lower, transpose transa, transpose transb, int64_t n,
            int64_t k, float alpha, sycl::buffer<float, 1>& a, int64_t lda,
            sycl::buffer<float, 1>& b, int64_t ldb, float beta, sycl::buffer<float, 1>& c,
            int64_t ldc) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemmt", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemmt", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler& cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_sgemmt>(queue, cgh, [=]() {
+            gemmt_blocked(MAJOR, upper_lower, transa, transb, n, k, alpha, accessor_a.GET_MULTI_PTR,
+                          lda, accessor_b.GET_MULTI_PTR, ldb, beta, accessor_c.GET_MULTI_PTR, ldc,
+                          get_workspace(queue));
+        });
+    });
 }
 
 void gemmt(sycl::queue& queue, uplo upper_lower, transpose transa, transpose transb, int64_t n,
            int64_t k, double alpha, sycl::buffer<double, 1>& a, int64_t lda,
            sycl::buffer<double, 1>& b, int64_t ldb, double beta, sycl::buffer<double, 1>& c,
            int64_t ldc) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemmt", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemmt", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler& cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_dgemmt>(queue, cgh, [=]() {
+            gemmt_blocked(MAJOR, upper_lower, transa, transb, n, k, alpha, accessor_a.GET_MULTI_PTR,
+                          lda, accessor_b.GET_MULTI_PTR, ldb, beta, accessor_c.GET_MULTI_PTR, ldc,
+                          get_workspace(queue));
+        });
+    });
 }
 
 void gemmt(sycl::queue& queue, uplo upper_lower, transpose transa, transpose transb, int64_t n,
            int64_t k, std::complex<float> alpha, sycl::buffer<std::complex<float>, 1>& a,
            int64_t lda, sycl::buffer<std::complex<float>, 1>& b, int64_t ldb,
            std::complex<float> beta, sycl::buffer<std::complex<float>, 1>& c, int64_t ldc) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemmt", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemmt", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler& cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_cgemmt>(queue, cgh, [=]() {
+            gemmt_blocked(MAJOR, upper_lower, transa, transb, n, k, alpha, accessor_a.GET_MULTI_PTR,
+                          lda, accessor_b.GET_MULTI_PTR, ldb, beta, accessor_c.GET_MULTI_PTR, ldc,
+                          get_workspace(queue));
+        });
+    });
 }
 
 void gemmt(sycl::queue& queue, uplo upper_lower, transpose transa, transpose transb, int64_t n,
            int64_t k, std::complex<double> alpha, sycl::buffer<std::complex<double>, 1>& a,
            int64_t lda, sycl::buffer<std::complex<double>, 1>& b, int64_t ldb,
            std::complex<double> beta, sycl::buffer<std::complex<double>, 1>& c, int64_t ldc) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemmt", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemmt", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler& cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_zgemmt>(queue, cgh, [=]() {
+            gemmt_blocked(MAJOR, upper_lower, transa, transb, n, k, alpha, accessor_a.GET_MULTI_PTR,
+                          lda, accessor_b.GET_MULTI_PTR, ldb, beta, accessor_c.GET_MULTI_PTR, ldc,
+                          get_workspace(queue));
+        });
+    });
 }
 
 void omatcopy(sycl::queue& queue, transpose trans, int64_t m, int64_t n, float alpha,
               sycl::buffer<float, 1>& a, int64_t lda, sycl::buffer<float, 1>& b, int64_t ldb) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "omatcopy", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "omatcopy", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler& cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_somatcopy>(queue, cgh, [=]() {
+            omatcopy_tiled(MAJOR, trans, m, n, alpha, accessor_a.GET_MULTI_PTR, lda, 1,
+                           accessor_b.GET_MULTI_PTR, ldb, 1);
+        });
+    });
 }
 
 void omatcopy(sycl::queue& queue, transpose trans, int64_t m, int64_t n, double alpha,
               sycl::buffer<double, 1>& a, int64_t lda, sycl::buffer<double, 1>& b, int64_t ldb) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "omatcopy", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "omatcopy", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler& cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_domatcopy>(queue, cgh, [=]() {
+            omatcopy_tiled(MAJOR, trans, m, n, alpha, accessor_a.GET_MULTI_PTR, lda, 1,
+                           accessor_b.GET_MULTI_PTR, ldb, 1);
+        });
+    });
 }
 
 void omatcopy(sycl::queue& queue, transpose trans, int64_t m, int64_t n, std::complex<float> alpha,
               sycl::buffer<std::complex<float>, 1>& a, int64_t lda,
               sycl::buffer<std::complex<float>, 1>& b, int64_t ldb) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "omatcopy", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "omatcopy", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler& cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_comatcopy>(queue, cgh, [=]() {
+            omatcopy_tiled(MAJOR, trans, m, n, alpha, accessor_a.GET_MULTI_PTR, lda, 1,
+                           accessor_b.GET_MULTI_PTR, ldb, 1);
+        });
+    });
 }
 
 void omatcopy(sycl::queue& queue, transpose trans, int64_t m, int64_t n, std::complex<double> alpha,
               sycl::buffer<std::complex<double>, 1>& a, int64_t lda,
               sycl::buffer<std::complex<double>, 1>& b, int64_t ldb) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "omatcopy", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "omatcopy", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler& cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_zomatcopy>(queue, cgh, [=]() {
+            omatcopy_tiled(MAJOR, trans, m, n, alpha, accessor_a.GET_MULTI_PTR, lda, 1,
+                           accessor_b.GET_MULTI_PTR, ldb, 1);
+        });
+    });
 }
 
 void omatcopy2(sycl::queue& queue, transpose trans, int64_t m, int64_t n, float alpha,
                sycl::buffer<float, 1>& a, int64_t lda, std::int64_t stridea,
                sycl::buffer<float, 1>& b, int64_t ldb, std::int64_t strideb) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "omatcopy2", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "omatcopy2", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler& cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_somatcopy2>(queue, cgh, [=]() {
+            omatcopy_tiled(MAJOR, trans, m, n, alpha, accessor_a.GET_MULTI_PTR, lda, stridea,
+                           accessor_b.GET_MULTI_PTR, ldb, strideb);
+        });
+    });
 }
 
 void omatcopy2(sycl::queue& queue, transpose trans, int64_t m, int64_t n, double alpha,
                sycl::buffer<double, 1>& a, int64_t lda, std::int64_t stridea,
                sycl::buffer<double, 1>& b, int64_t ldb, std::int64_t strideb) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "omatcopy2", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "omatcopy2", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler& cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_domatcopy2>(queue, cgh, [=]() {
+            omatcopy_tiled(MAJOR, trans, m, n, alpha, accessor_a.GET_MULTI_PTR, lda, stridea,
+                           accessor_b.GET_MULTI_PTR, ldb, strideb);
+        });
+    });
 }
 
 void omatcopy2(sycl::queue& queue, transpose trans, int64_t m, int64_t n, std::complex<float> alpha,
                sycl::buffer<std::complex<float>, 1>& a, int64_t lda, std::int64_t stridea,
                sycl::buffer<std::complex<float>, 1>& b, int64_t ldb, std::int64_t strideb) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "omatcopy2", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "omatcopy2", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler& cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_comatcopy2>(queue, cgh, [=]() {
+            omatcopy_tiled(MAJOR, trans, m, n, alpha, accessor_a.GET_MULTI_PTR, lda, stridea,
+                           accessor_b.GET_MULTI_PTR, ldb, strideb);
+        });
+    });
 }
 
 void omatcopy2(sycl::queue& queue, transpose trans, int64_t m, int64_t n,
                std::complex<double> alpha, sycl::buffer<std::complex<double>, 1>& a, int64_t lda,
                std::int64_t stridea, sycl::buffer<std::complex<double>, 1>& b, int64_t ldb,
                std::int64_t strideb) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "omatcopy2", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "omatcopy2", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler& cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_zomatcopy2>(queue, cgh, [=]() {
+            omatcopy_tiled(MAJOR, trans, m, n, alpha, accessor_a.GET_MULTI_PTR, lda, stridea,
+                           accessor_b.GET_MULTI_PTR, ldb, strideb);
+        });
+    });
 }
 
 void imatcopy(sycl::queue& queue, transpose trans, int64_t m, int64_t n, float alpha,
               sycl::buffer<float, 1>& ab, int64_t lda, int64_t ldb) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "imatcopy", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "imatcopy", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler& cgh) {
+        auto accessor_ab = ab.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_simatcopy>(queue, cgh, [=]() {
+            imatcopy_tiled(MAJOR, trans, m, n, alpha, accessor_ab.GET_MULTI_PTR, lda, ldb,
+                           get_workspace(queue));
+        });
+    });
 }
 
 void imatcopy(sycl::queue& queue, transpose trans, int64_t m, int64_t n, double alpha,
               sycl::buffer<double, 1>& ab, int64_t lda, int64_t ldb) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "imatcopy", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "imatcopy", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler& cgh) {
+        auto accessor_ab = ab.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_dimatcopy>(queue, cgh, [=]() {
+            imatcopy_tiled(MAJOR, trans, m, n, alpha, accessor_ab.GET_MULTI_PTR, lda, ldb,
+                           get_workspace(queue));
+        });
+    });
 }
 
 void imatcopy(sycl::queue& queue, transpose trans, int64_t m, int64_t n, std::complex<float> alpha,
               sycl::buffer<std::complex<float>, 1>& ab, int64_t lda, int64_t ldb) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "imatcopy", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "imatcopy", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler& cgh) {
+        auto accessor_ab = ab.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_cimatcopy>(queue, cgh, [=]() {
+            imatcopy_tiled(MAJOR, trans, m, n, alpha, accessor_ab.GET_MULTI_PTR, lda, ldb,
+                           get_workspace(queue));
+        });
+    });
 }
 
 void imatcopy(sycl::queue& queue, transpose trans, int64_t m, int64_t n, std::complex<double> alpha,
               sycl::buffer<std::complex<double>, 1>& ab, int64_t lda, int64_t ldb) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "imatcopy", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "imatcopy", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler& cgh) {
+        auto accessor_ab = ab.get_access<sycl::access::mode::read_write>(cgh);
+        host_task<class netlib_zimatcopy>(queue, cgh, [=]() {
+            imatcopy_tiled(MAJOR, trans, m, n, alpha, accessor_ab.GET_MULTI_PTR, lda, ldb,
+                           get_workspace(queue));
+        });
+    });
 }
 
 void omatadd(sycl::queue& queue, transpose transa, transpose transb, int64_t m, int64_t n,
              float alpha, sycl::buffer<float, 1>& a, int64_t lda, float beta,
              sycl::buffer<float, 1>& b, int64_t ldb, sycl::buffer<float, 1>& c, int64_t ldc) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "omatadd", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "omatadd", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler& cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_somatadd>(queue, cgh, [=]() {
+            omatadd_tiled(MAJOR, transa, transb, m, n, alpha, accessor_a.GET_MULTI_PTR, lda, beta,
+                          accessor_b.GET_MULTI_PTR, ldb, accessor_c.GET_MULTI_PTR, ldc);
+        });
+    });
 }
 
 void omatadd(sycl::queue& queue, transpose transa, transpose transb, int64_t m, int64_t n,
              double alpha, sycl::buffer<double, 1>& a, int64_t lda, double beta,
              sycl::buffer<double, 1>& b, int64_t ldb, sycl::buffer<double, 1>& c, int64_t ldc) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "omatadd", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "omatadd", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler& cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_domatadd>(queue, cgh, [=]() {
+            omatadd_tiled(MAJOR, transa, transb, m, n, alpha, accessor_a.GET_MULTI_PTR, lda, beta,
+                          accessor_b.GET_MULTI_PTR, ldb, accessor_c.GET_MULTI_PTR, ldc);
+        });
+    });
 }
 
 void omatadd(sycl::queue& queue, transpose transa, transpose transb, int64_t m, int64_t n,
              std::complex<float> alpha, sycl::buffer<std::complex<float>, 1>& a, int64_t lda,
              std::complex<float> beta, sycl::buffer<std::complex<float>, 1>& b, int64_t ldb,
              sycl::buffer<std::complex<float>, 1>& c, int64_t ldc) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "omatadd", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "omatadd", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler& cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_comatadd>(queue, cgh, [=]() {
+            omatadd_tiled(MAJOR, transa, transb, m, n, alpha, accessor_a.GET_MULTI_PTR, lda, beta,
+                          accessor_b.GET_MULTI_PTR, ldb, accessor_c.GET_MULTI_PTR, ldc);
+        });
+    });
 }
 
 void omatadd(sycl::queue& queue, transpose transa, transpose transb, int64_t m, int64_t n,
              std::complex<double> alpha, sycl::buffer<std::complex<double>, 1>& a, int64_t lda,
              std::complex<double> beta, sycl::buffer<std::complex<double>, 1>& b, int64_t ldb,
              sycl::buffer<std::complex<double>, 1>& c, int64_t ldc) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "omatadd", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "omatadd", "for row_major layout");
-#endif
+    queue.submit([&](sycl::handler& cgh) {
+        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
+        auto accessor_c = c.get_access<sycl::access::mode::write>(cgh);
+        host_task<class netlib_zomatadd>(queue, cgh, [=]() {
+            omatadd_tiled(MAJOR, transa, transb, m, n, alpha, accessor_a.GET_MULTI_PTR, lda, beta,
+                          accessor_b.GET_MULTI_PTR, ldb, accessor_c.GET_MULTI_PTR, ldc);
+        });
+    });
 }
 
 // USM APIs
@@ -295,12 +367,17 @@ sycl::event gemm_bias(sycl::queue& queue, transpose transa, transpose transb, of
                       int8_t ao, const int8_t* b, int64_t ldb, int8_t bo, float beta, int32_t* c,
                       int64_t ldc, const int32_t* co,
                       const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_bias", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_bias", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_gemm_bias_s8s8s32_usm>(queue, cgh, [=]() {
+            gemm_bias_blocked(MAJOR, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb,
+                              bo, beta, c, ldc, co, get_workspace(queue));
+        });
+    });
+    return done;
 }
 
 sycl::event gemm_bias(sycl::queue& queue, transpose transa, transpose transb, offset offsetc,
@@ -308,12 +385,17 @@ sycl::event gemm_bias(sycl::queue& queue, transpose transa, transpose transb, of
                       int8_t ao, const uint8_t* b, int64_t ldb, uint8_t bo, float beta, int32_t* c,
                       int64_t ldc, const int32_t* co,
                       const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_bias", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_bias", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_gemm_bias_s8u8s32_usm>(queue, cgh, [=]() {
+            gemm_bias_blocked(MAJOR, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb,
+                              bo, beta, c, ldc, co, get_workspace(queue));
+        });
+    });
+    return done;
 }
 
 sycl::event gemm_bias(sycl::queue& queue, transpose transa, transpose transb, offset offsetc,
@@ -321,12 +403,17 @@ sycl::event gemm_bias(sycl::queue& queue, transpose transa, transpose transb, of
                       uint8_t ao, const int8_t* b, int64_t ldb, int8_t bo, float beta, int32_t* c,
                       int64_t ldc, const int32_t* co,
                       const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_bias", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_bias", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_gemm_bias_u8s8s32_usm>(queue, cgh, [=]() {
+            gemm_bias_blocked(MAJOR, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb,
+                              bo, beta, c, ldc, co, get_workspace(queue));
+        });
+    });
+    return done;
 }
 
 sycl::event gemm_bias(sycl::queue& queue, transpose transa, transpose transb, offset offsetc,
@@ -334,36 +421,51 @@ sycl::event gemm_bias(sycl::queue& queue, transpose transa, transpose transb, of
                       uint8_t ao, const uint8_t* b, int64_t ldb, uint8_t bo, float beta, int32_t* c,
                       int64_t ldc, const int32_t* co,
                       const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm_bias", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm_bias", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_gemm_bias_u8u8s32_usm>(queue, cgh, [=]() {
+            gemm_bias_blocked(MAJOR, transa, transb, offsetc, m, n, k, alpha, a, lda, ao, b, ldb,
+                              bo, beta, c, ldc, co, get_workspace(queue));
+        });
+    });
+    return done;
 }
 
 sycl::event gemmt(sycl::queue& queue, uplo upper_lower, transpose transa, transpose transb,
                   int64_t n, int64_t k, float alpha, const float* a, int64_t lda, const float* b,
                   int64_t ldb, float beta, float* c, int64_t ldc,
                   const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemmt", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemmt", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_sgemmt_usm>(queue, cgh, [=]() {
+            gemmt_blocked(MAJOR, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta, c,
+                          ldc, get_workspace(queue));
+        });
+    });
+    return done;
 }
 
 sycl::event gemmt(sycl::queue& queue, uplo upper_lower, transpose transa, transpose transb,
                   int64_t n, int64_t k, double alpha, const double* a, int64_t lda, const double* b,
                   int64_t ldb, double beta, double* c, int64_t ldc,
                   const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemmt", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemmt", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dgemmt_usm>(queue, cgh, [=]() {
+            gemmt_blocked(MAJOR, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta, c,
+                          ldc, get_workspace(queue));
+        });
+    });
+    return done;
 }
 
 sycl::event gemmt(sycl::queue& queue, uplo upper_lower, transpose transa, transpose transb,
@@ -371,12 +473,17 @@ sycl::event gemmt(sycl::queue& queue, uplo upper_lower, transpose transa, transp
                   int64_t lda, const std::complex<float>* b, int64_t ldb, std::complex<float> beta,
                   std::complex<float>* c, int64_t ldc,
                   const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemmt", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemmt", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cgemmt_usm>(queue, cgh, [=]() {
+            gemmt_blocked(MAJOR, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta, c,
+                          ldc, get_workspace(queue));
+        });
+    });
+    return done;
 }
 
 sycl::event gemmt(sycl::queue& queue, uplo upper_lower, transpose transa, transpose transb,
@@ -384,172 +491,233 @@ sycl::event gemmt(sycl::queue& queue, uplo upper_lower, transpose transa, transp
                   int64_t lda, const std::complex<double>* b, int64_t ldb,
                   std::complex<double> beta, std::complex<double>* c, int64_t ldc,
                   const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemmt", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemmt", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zgemmt_usm>(queue, cgh, [=]() {
+            gemmt_blocked(MAJOR, upper_lower, transa, transb, n, k, alpha, a, lda, b, ldb, beta, c,
+                          ldc, get_workspace(queue));
+        });
+    });
+    return done;
 }
 
 sycl::event omatcopy(sycl::queue& queue, transpose trans, int64_t m, int64_t n, float alpha,
                      const float* a, int64_t lda, float* b, int64_t ldb,
                      const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "omatcopy", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "omatcopy", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_somatcopy_usm>(queue, cgh, [=]() {
+            omatcopy_tiled(MAJOR, trans, m, n, alpha, a, lda, 1, b, ldb, 1);
+        });
+    });
+    return done;
 }
 
 sycl::event omatcopy(sycl::queue& queue, transpose trans, int64_t m, int64_t n, double alpha,
                      const double* a, int64_t lda, double* b, int64_t ldb,
                      const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "omatcopy", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "omatcopy", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_domatcopy_usm>(queue, cgh, [=]() {
+            omatcopy_tiled(MAJOR, trans, m, n, alpha, a, lda, 1, b, ldb, 1);
+        });
+    });
+    return done;
 }
 
 sycl::event omatcopy(sycl::queue& queue, transpose trans, int64_t m, int64_t n,
                      std::complex<float> alpha, const std::complex<float>* a, int64_t lda,
                      std::complex<float>* b, int64_t ldb,
                      const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "omatcopy", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "omatcopy", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_comatcopy_usm>(queue, cgh, [=]() {
+            omatcopy_tiled(MAJOR, trans, m, n, alpha, a, lda, 1, b, ldb, 1);
+        });
+    });
+    return done;
 }
 
 sycl::event omatcopy(sycl::queue& queue, transpose trans, int64_t m, int64_t n,
                      std::complex<double> alpha, const std::complex<double>* a, int64_t lda,
                      std::complex<double>* b, int64_t ldb,
                      const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "omatcopy", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "omatcopy", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zomatcopy_usm>(queue, cgh, [=]() {
+            omatcopy_tiled(MAJOR, trans, m, n, alpha, a, lda, 1, b, ldb, 1);
+        });
+    });
+    return done;
 }
 
 sycl::event omatcopy2(sycl::queue& queue, transpose trans, int64_t m, int64_t n, float alpha,
                       const float* a, int64_t lda, std::int64_t stridea, float* b, int64_t ldb,
                       std::int64_t strideb, const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "omatcopy2", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "omatcopy2", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_somatcopy2_usm>(queue, cgh, [=]() {
+            omatcopy_tiled(MAJOR, trans, m, n, alpha, a, lda, stridea, b, ldb, strideb);
+        });
+    });
+    return done;
 }
 
 sycl::event omatcopy2(sycl::queue& queue, transpose trans, int64_t m, int64_t n, double alpha,
                       const double* a, int64_t lda, std::int64_t stridea, double* b, int64_t ldb,
                       std::int64_t strideb, const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "omatcopy2", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "omatcopy2", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_domatcopy2_usm>(queue, cgh, [=]() {
+            omatcopy_tiled(MAJOR, trans, m, n, alpha, a, lda, stridea, b, ldb, strideb);
+        });
+    });
+    return done;
 }
 
 sycl::event omatcopy2(sycl::queue& queue, transpose trans, int64_t m, int64_t n,
                       std::complex<float> alpha, const std::complex<float>* a, int64_t lda,
                       std::int64_t stridea, std::complex<float>* b, int64_t ldb,
                       std::int64_t strideb, const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "omatcopy2", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "omatcopy2", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_comatcopy2_usm>(queue, cgh, [=]() {
+            omatcopy_tiled(MAJOR, trans, m, n, alpha, a, lda, stridea, b, ldb, strideb);
+        });
+    });
+    return done;
 }
 
 sycl::event omatcopy2(sycl::queue& queue, transpose trans, int64_t m, int64_t n,
                       std::complex<double> alpha, const std::complex<double>* a, int64_t lda,
                       std::int64_t stridea, std::complex<double>* b, int64_t ldb,
                       std::int64_t strideb, const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "omatcopy2", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "omatcopy2", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zomatcopy2_usm>(queue, cgh, [=]() {
+            omatcopy_tiled(MAJOR, trans, m, n, alpha, a, lda, stridea, b, ldb, strideb);
+        });
+    });
+    return done;
 }
 
 sycl::event imatcopy(sycl::queue& queue, transpose trans, int64_t m, int64_t n, float alpha,
                      float* ab, int64_t lda, int64_t ldb,
                      const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "imatcopy", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "imatcopy", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_simatcopy_usm>(queue, cgh, [=]() {
+            imatcopy_tiled(MAJOR, trans, m, n, alpha, ab, lda, ldb, get_workspace(queue));
+        });
+    });
+    return done;
 }
 
 sycl::event imatcopy(sycl::queue& queue, transpose trans, int64_t m, int64_t n, double alpha,
                      double* ab, int64_t lda, int64_t ldb,
                      const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "imatcopy", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "imatcopy", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_dimatcopy_usm>(queue, cgh, [=]() {
+            imatcopy_tiled(MAJOR, trans, m, n, alpha, ab, lda, ldb, get_workspace(queue));
+        });
+    });
+    return done;
 }
 
 sycl::event imatcopy(sycl::queue& queue, transpose trans, int64_t m, int64_t n,
                      std::complex<float> alpha, std::complex<float>* ab, int64_t lda, int64_t ldb,
                      const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "imatcopy", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "imatcopy", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_cimatcopy_usm>(queue, cgh, [=]() {
+            imatcopy_tiled(MAJOR, trans, m, n, alpha, ab, lda, ldb, get_workspace(queue));
+        });
+    });
+    return done;
 }
 
 sycl::event imatcopy(sycl::queue& queue, transpose trans, int64_t m, int64_t n,
                      std::complex<double> alpha, std::complex<double>* ab, int64_t lda, int64_t ldb,
                      const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "imatcopy", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "imatcopy", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zimatcopy_usm>(queue, cgh, [=]() {
+            imatcopy_tiled(MAJOR, trans, m, n, alpha, ab, lda, ldb, get_workspace(queue));
+        });
+    });
+    return done;
 }
 
 sycl::event omatadd(sycl::queue& queue, transpose transa, transpose transb, int64_t m, int64_t n,
                     float alpha, const float* a, int64_t lda, float beta, const float* b,
                     int64_t ldb, float* c, int64_t ldc,
                     const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "omatadd", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "omatadd", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_somatadd_usm>(queue, cgh, [=]() {
+            omatadd_tiled(MAJOR, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc);
+        });
+    });
+    return done;
 }
 
 sycl::event omatadd(sycl::queue& queue, transpose transa, transpose transb, int64_t m, int64_t n,
                     double alpha, const double* a, int64_t lda, double beta, const double* b,
                     int64_t ldb, double* c, int64_t ldc,
                     const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "omatadd", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "omatadd", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_domatadd_usm>(queue, cgh, [=]() {
+            omatadd_tiled(MAJOR, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc);
+        });
+    });
+    return done;
 }
 
 sycl::event omatadd(sycl::queue& queue, transpose transa, transpose transb, int64_t m, int64_t n,
@@ -557,12 +725,16 @@ sycl::event omatadd(sycl::queue& queue, transpose transa, transpose transb, int6
                     std::complex<float> beta, const std::complex<float>* b, int64_t ldb,
                     std::complex<float>* c, int64_t ldc,
                     const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "omatadd", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "omatadd", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_comatadd_usm>(queue, cgh, [=]() {
+            omatadd_tiled(MAJOR, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc);
+        });
+    });
+    return done;
 }
 
 sycl::event omatadd(sycl::queue& queue, transpose transa, transpose transb, int64_t m, int64_t n,
@@ -570,10 +742,14 @@ sycl::event omatadd(sycl::queue& queue, transpose transa, transpose transb, int6
                     std::complex<double> beta, const std::complex<double>* b, int64_t ldb,
                     std::complex<double>* c, int64_t ldc,
                     const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "omatadd", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "omatadd", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_zomatadd_usm>(queue, cgh, [=]() {
+            omatadd_tiled(MAJOR, transa, transb, m, n, alpha, a, lda, beta, b, ldb, c, ldc);
+        });
+    });
+    return done;
 }
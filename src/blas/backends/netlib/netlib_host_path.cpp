@@ -0,0 +1,182 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdlib>
+#include <exception>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "netlib_host_path.hpp"
+
+namespace oneapi {
+namespace math {
+namespace blas {
+namespace netlib {
+
+// Calls added to a host task, which it takes when it starts
+struct pending_calls {
+    std::vector<std::function<void()>> calls;
+    bool started = false;
+};
+
+struct pending_task {
+    std::shared_ptr<pending_calls> pending;
+    sycl::event event;
+    // Commands the host task waits for
+    std::vector<sycl::event> dependencies;
+};
+
+// Most calls run by one host task, so that a host task waiting on a long dependency does
+// not collect calls without bound
+static constexpr std::size_t max_pending_calls = 256;
+
+// Guards the pending tasks and their calls
+static std::mutex& pending_mutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+// Host task of each queue that calls can still be added to. An entry is removed when its
+// host task starts, and until then the host task holds the queue anyway, so the map does
+// not extend the life of the queues it holds. Never destroyed, as entries may still hold
+// events at exit.
+static std::unordered_map<sycl::queue, pending_task>& pending_tasks() {
+    static auto& tasks = *new std::unordered_map<sycl::queue, pending_task>();
+    return tasks;
+}
+
+host_path get_host_path() {
+    static const host_path path = []() {
+        const char* value = std::getenv("ONEMATH_NETLIB_HOST_PATH");
+        if (!value)
+            return host_path::submit;
+        const std::string name(value);
+        if (name == "inline")
+            return host_path::inline_call;
+        if (name == "deferred")
+            return host_path::deferred;
+        return host_path::submit;
+    }();
+    return path;
+}
+
+static bool is_complete(const sycl::event& event) {
+    return event.get_info<sycl::info::event::command_execution_status>() ==
+           sycl::info::event_command_status::complete;
+}
+
+static bool contains(const std::vector<sycl::event>& events, const sycl::event& event) {
+    return std::find(events.begin(), events.end(), event) != events.end();
+}
+
+// A call can be added to a pending host task if that changes neither what the call waits for
+// nor what the task waits for: each command the call waits for is an earlier call of the
+// task, one of the task's dependencies or complete, and unless the call waits for the task,
+// each command the task waits for is also a dependency of the call or complete.
+static bool can_add_to(const pending_task& task, const std::vector<sycl::event>& dependencies) {
+    bool after_task = false;
+    for (const auto& dependency : dependencies) {
+        if (dependency == task.event)
+            after_task = true;
+        else if (!contains(task.dependencies, dependency) && !is_complete(dependency))
+            return false;
+    }
+    if (after_task)
+        return true;
+    for (const auto& dependency : task.dependencies) {
+        if (!contains(dependencies, dependency) && !is_complete(dependency))
+            return false;
+    }
+    return true;
+}
+
+bool is_host_accessible(const sycl::queue& queue, std::initializer_list<const void*> pointers) {
+    const sycl::context context = queue.get_context();
+    for (const void* pointer : pointers) {
+        const sycl::usm::alloc kind = sycl::get_pointer_type(pointer, context);
+        if (kind != sycl::usm::alloc::host && kind != sycl::usm::alloc::shared)
+            return false;
+    }
+    return true;
+}
+
+static void run_pending(const sycl::queue& queue, const std::shared_ptr<pending_calls>& pending) {
+    std::vector<std::function<void()>> calls;
+    {
+        std::lock_guard<std::mutex> lock(pending_mutex());
+        pending->started = true;
+        auto it = pending_tasks().find(queue);
+        if (it != pending_tasks().end() && it->second.pending == pending)
+            pending_tasks().erase(it);
+        calls = std::move(pending->calls);
+    }
+    // A failing call does not keep the later calls from running, as it would not if each
+    // call had its own host task. The host task reports the first error.
+    std::exception_ptr error;
+    for (auto& call : calls) {
+        try {
+            call();
+        }
+        catch (...) {
+            if (!error)
+                error = std::current_exception();
+        }
+    }
+    if (error)
+        std::rethrow_exception(error);
+}
+
+sycl::event submit_deferred(sycl::queue& queue, const std::vector<sycl::event>& dependencies,
+                            std::function<void()> call) {
+    {
+        std::lock_guard<std::mutex> lock(pending_mutex());
+        auto it = pending_tasks().find(queue);
+        if (it != pending_tasks().end() &&
+            it->second.pending->calls.size() < max_pending_calls &&
+            can_add_to(it->second, dependencies)) {
+            it->second.pending->calls.push_back(std::move(call));
+            return it->second.event;
+        }
+    }
+    auto pending = std::make_shared<pending_calls>();
+    pending->calls.push_back(std::move(call));
+    // Submitted without holding the lock, as the host task takes it when it starts
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_deferred_usm>(queue, cgh, [=]() { run_pending(queue, pending); });
+    });
+    std::lock_guard<std::mutex> lock(pending_mutex());
+    if (!pending->started)
+        pending_tasks()[queue] = { pending, done, dependencies };
+    return done;
+}
+
+} // namespace netlib
+} // namespace blas
+} // namespace math
+} // namespace oneapi
@@ -0,0 +1,179 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _NETLIB_HOST_PATH_HPP_
+#define _NETLIB_HOST_PATH_HPP_
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <tuple>
+#include <vector>
+
+#include "netlib_common.hpp"
+
+namespace oneapi {
+namespace math {
+namespace blas {
+namespace netlib {
+
+/**
+ * How the level 1 routines run their CBLAS call, set by the ONEMATH_NETLIB_HOST_PATH
+ * environment variable. For vectors of a few hundred elements, submitting a host task
+ * costs much more than the call itself.
+ */
+enum class host_path {
+    // Default: one host task per call
+    submit,
+    // "inline": on CPU devices, wait for the dependencies and make the call on the calling
+    // thread. USM routines on host or shared allocations return a completed event, buffer
+    // routines make the call on host accessors. The buffer gemm routines also make their
+    // call on host accessors, as they do in every mode when their buffers were all created
+    // with use_host_ptr.
+    inline_call,
+    // "deferred": on out-of-order queues, add the call of a USM routine to the host task of
+    // an earlier call that has not started yet, when both wait for the same commands.
+    // Buffer routines submit a host task per call, as the accessors of a command group
+    // cannot be extended after its submission.
+    deferred
+};
+
+host_path get_host_path();
+
+// Adds call to the pending host task of the queue if it has one and the dependencies do not
+// prevent it, else submits a host task for it. Returns the event of the host task.
+sycl::event submit_deferred(sycl::queue& queue, const std::vector<sycl::event>& dependencies,
+                            std::function<void()> call);
+
+// Returns true if every pointer is a host or shared USM allocation of the context of the
+// queue, which the calling thread can access
+bool is_host_accessible(const sycl::queue& queue, std::initializer_list<const void*> pointers);
+
+// Runs f, a USM level 1 CBLAS call on pointers, on the host after the dependencies, as set
+// by get_host_path(). The inline call is only made if the calling thread can access the
+// pointers, else the call is submitted.
+template <typename K, typename F>
+sycl::event submit_host_call(sycl::queue& queue, const std::vector<sycl::event>& dependencies,
+                             std::initializer_list<const void*> pointers, F f) {
+    const host_path path = get_host_path();
+    if (path == host_path::inline_call && queue.get_device().is_cpu() &&
+        is_host_accessible(queue, pointers)) {
+        if (queue.is_in_order())
+            queue.wait();
+        sycl::event::wait(dependencies);
+        policy_scope scope(get_execution_policy(queue));
+        f();
+        return sycl::event();
+    }
+    // The host task of an earlier call may run before commands submitted after it to an
+    // in-order queue, so calls are only added to it on out-of-order queues
+    if (path == host_path::deferred && !queue.is_in_order())
+        return submit_deferred(queue, dependencies, f);
+    return queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<K>(queue, cgh, f);
+    });
+}
+
+// A buffer of a buffer routine, with the access mode of the routine's CBLAS call
+template <typename T, sycl::access::mode Mode>
+struct buffer_use {
+    sycl::buffer<T, 1>& buffer;
+
+    auto get_host_access() const {
+        return sycl::host_accessor<T, 1, Mode>(buffer);
+    }
+    auto get_access(sycl::handler& cgh) const {
+        return buffer.template get_access<Mode>(cgh);
+    }
+    bool uses_host_ptr() const {
+        return buffer.template has_property<sycl::property::buffer::use_host_ptr>();
+    }
+};
+
+template <typename T>
+buffer_use<T, sycl::access::mode::read> in(sycl::buffer<T, 1>& buffer) {
+    return { buffer };
+}
+
+template <typename T>
+buffer_use<T, sycl::access::mode::write> out(sycl::buffer<T, 1>& buffer) {
+    return { buffer };
+}
+
+template <typename T>
+buffer_use<T, sycl::access::mode::read_write> in_out(sycl::buffer<T, 1>& buffer) {
+    return { buffer };
+}
+
+// Runs f, a level 1 or gemm CBLAS call, on pointers to the data of the buffers, as set by
+// get_host_path(). Host accessors wait for the commands that use the buffers, so the inline
+// call keeps the order of the queue's commands on them, and its errors are thrown here.
+template <typename K, typename... Uses, typename F>
+void submit_buffer_call(sycl::queue& queue, std::tuple<Uses...> buffers, F f) {
+    if (get_host_path() == host_path::inline_call && queue.get_device().is_cpu()) {
+        auto accessors = std::apply(
+            [](const auto&... use) { return std::make_tuple(use.get_host_access()...); },
+            buffers);
+        policy_scope scope(get_execution_policy(queue));
+        std::apply([&](auto&... accessor) { f(accessor.get_pointer()...); }, accessors);
+        return;
+    }
+    queue.submit([&](sycl::handler& cgh) {
+        auto accessors = std::apply(
+            [&](const auto&... use) { return std::make_tuple(use.get_access(cgh)...); }, buffers);
+        host_task<K>(queue, cgh, [=]() {
+            std::apply([&](const auto&... accessor) { f(accessor.GET_MULTI_PTR...); }, accessors);
+        });
+    });
+}
+
+// Runs f, a gemm CBLAS call, on the memory the buffers were created from when they were all
+// created with use_host_ptr on a CPU device, else as submit_buffer_call does. The host
+// accessors of such buffers point to that memory, so the call reads and writes it in place,
+// whereas the runtime may copy the data to another allocation for the accessors of a host
+// task. The call is made on the calling thread, after the commands that use the buffers.
+template <typename K, typename... Uses, typename F>
+void submit_host_ptr_call(sycl::queue& queue, std::tuple<Uses...> buffers, F f) {
+    const bool host_ptrs =
+        std::apply([](const auto&... use) { return (use.uses_host_ptr() && ...); }, buffers);
+    if (!host_ptrs || !queue.get_device().is_cpu()) {
+        submit_buffer_call<K>(queue, buffers, f);
+        return;
+    }
+    auto accessors = std::apply(
+        [](const auto&... use) { return std::make_tuple(use.get_host_access()...); }, buffers);
+    policy_scope scope(get_execution_policy(queue));
+    std::apply([&](auto&... accessor) { f(accessor.get_pointer()...); }, accessors);
+}
+
+} // namespace netlib
+} // namespace blas
+} // namespace math
+} // namespace oneapi
+
+#endif //_NETLIB_HOST_PATH_HPP_
@@ -24,6 +24,7 @@
 #endif
 
 #include "netlib_common.hpp"
+#include "netlib_host_path.hpp"
 #include "oneapi/math/exceptions.hpp"
 #include "oneapi/math/blas/detail/netlib/onemath_blas_netlib.hpp"
 
@@ -43,17 +44,17 @@ inline double abs_val(std::complex<double> val) {
     return std::abs(val.real()) + std::abs(val.imag());
 }
 
-int cblas_isamin(int n, const float* x, int incx) {
+int64_t cblas_isamin(int64_t n, const float* x, int64_t incx) {
     if (n < 1 || incx < 1) {
         return 0;
     }
-    int min_idx = 0;
+    int64_t min_idx = 0;
     auto min_val = abs_val(x[0]);
     if (sycl::isnan(min_val))
         return 0;
 
-    for (int logical_i = 1; logical_i < n; ++logical_i) {
-        int i = logical_i * std::abs(incx);
+    for (int64_t logical_i = 1; logical_i < n; ++logical_i) {
+        int64_t i = logical_i * std::abs(incx);
         auto curr_val = abs_val(x[i]);
         if (sycl::isnan(curr_val))
             return logical_i;
@@ -65,17 +66,17 @@ int cblas_isamin(int n, const float* x, int incx) {
     return min_idx;
 }
 
-int cblas_idamin(int n, const double* x, int incx) {
+int64_t cblas_idamin(int64_t n, const double* x, int64_t incx) {
     if (n < 1 || incx < 1) {
         return 0;
     }
-    int min_idx = 0;
+    int64_t min_idx = 0;
     auto min_val = abs_val(x[0]);
     if (sycl::isnan(min_val))
         return 0;
 
-    for (int logical_i = 1; logical_i < n; ++logical_i) {
-        int i = logical_i * std::abs(incx);
+    for (int64_t logical_i = 1; logical_i < n; ++logical_i) {
+        int64_t i = logical_i * std::abs(incx);
         auto curr_val = abs_val(x[i]);
         if (sycl::isnan(curr_val))
             return logical_i;
@@ -87,17 +88,17 @@ int cblas_idamin(int n, const double* x, int incx) {
     return min_idx;
 }
 
-int cblas_icamin(int n, const std::complex<float>* x, int incx) {
+int64_t cblas_icamin(int64_t n, const std::complex<float>* x, int64_t incx) {
     if (n < 1 || incx < 1) {
         return 0;
     }
-    int min_idx = 0;
+    int64_t min_idx = 0;
     auto min_val = abs_val(x[0]);
     if (sycl::isnan(min_val))
         return 0;
 
-    for (int logical_i = 1; logical_i < n; ++logical_i) {
-        int i = logical_i * std::abs(incx);
+    for (int64_t logical_i = 1; logical_i < n; ++logical_i) {
+        int64_t i = logical_i * std::abs(incx);
         auto curr_val = abs_val(x[i]);
         if (sycl::isnan(curr_val))
             return logical_i;
@@ -109,17 +110,17 @@ int cblas_icamin(int n, const std::complex<float>* x, int incx) {
     return min_idx;
 }
 
-int cblas_izamin(int n, const std::complex<double>* x, int incx) {
+int64_t cblas_izamin(int64_t n, const std::complex<double>* x, int64_t incx) {
     if (n < 1 || incx < 1) {
         return 0;
     }
-    int min_idx = 0;
+    int64_t min_idx = 0;
     auto min_val = abs_val(x[0]);
     if (sycl::isnan(min_val))
         return 0;
 
-    for (int logical_i = 1; logical_i < n; ++logical_i) {
-        int i = logical_i * std::abs(incx);
+    for (int64_t logical_i = 1; logical_i < n; ++logical_i) {
+        int64_t i = logical_i * std::abs(incx);
         auto curr_val = abs_val(x[i]);
         if (sycl::isnan(curr_val))
             return logical_i;
@@ -131,24 +132,24 @@ int cblas_izamin(int n, const std::complex<double>* x, int incx) {
     return min_idx;
 }
 
-void cblas_csrot(const int n, std::complex<float>* cx, const int incx, std::complex<float>* cy,
-                 const int incy, const float c, const float s) {
+void cblas_csrot(const int64_t n, std::complex<float>* cx, const int64_t incx,
+                 std::complex<float>* cy, const int64_t incy, const float c, const float s) {
     if (n < 1)
         return;
     if (incx == 1 && incy == 1) {
-        for (int i = 0; i < n; i++) {
+        for (int64_t i = 0; i < n; i++) {
             std::complex<float> ctemp = c * cx[i] + s * cy[i];
             cy[i] = c * cy[i] - s * cx[i];
             cx[i] = ctemp;
         }
     }
     else {
-        int ix = 0, iy = 0;
+        int64_t ix = 0, iy = 0;
         if (incx < 0)
             ix = (-n + 1) * incx;
         if (incy < 0)
             iy = (-n + 1) * incy;
-        for (int i = 0; i < n; i++) {
+        for (int64_t i = 0; i < n; i++) {
             std::complex<float> ctemp = c * cx[ix] + s * cy[iy];
             cy[iy] = c * cy[iy] - s * cx[ix];
             cx[ix] = ctemp;
@@ -158,24 +159,24 @@ void cblas_csrot(const int n, std::complex<float>* cx, const int incx, std::comp
     }
 }
 
-void cblas_zdrot(const int n, std::complex<double>* zx, const int incx, std::complex<double>* zy,
-                 const int incy, const double c, const double s) {
+void cblas_zdrot(const int64_t n, std::complex<double>* zx, const int64_t incx,
+                 std::complex<double>* zy, const int64_t incy, const double c, const double s) {
     if (n < 1)
         return;
     if (incx == 1 && incy == 1) {
-        for (int i = 0; i < n; i++) {
+        for (int64_t i = 0; i < n; i++) {
             std::complex<double> ctemp = c * zx[i] + s * zy[i];
             zy[i] = c * zy[i] - s * zx[i];
             zx[i] = ctemp;
         }
     }
     else {
-        int ix = 0, iy = 0;
+        int64_t ix = 0, iy = 0;
         if (incx < 0)
             ix = (-n + 1) * incx;
         if (incy < 0)
             iy = (-n + 1) * incy;
-        for (int i = 0; i < n; i++) {
+        for (int64_t i = 0; i < n; i++) {
             std::complex<double> ctemp = c * zx[ix] + s * zy[iy];
             zy[iy] = c * zy[iy] - s * zx[ix];
             zx[ix] = ctemp;
@@ -225,6 +226,32 @@ namespace oneapi {
 namespace math {
 namespace blas {
 namespace netlib {
+
+// y = alpha * x + beta * y, which CBLAS does not provide
+template <typename T, typename IncX, typename IncY>
+static void axpby_loop(int64_t n, T alpha, const T* x, IncX incx, T beta, T* y, IncY incy) {
+    if (beta == T(0)) {
+        for (int64_t i = 0; i < n; ++i)
+            y[i * incy] = alpha * x[i * incx];
+    }
+    else {
+        for (int64_t i = 0; i < n; ++i)
+            y[i * incy] = alpha * x[i * incx] + beta * y[i * incy];
+    }
+}
+
+template <typename T>
+static void axpby_vector(int64_t n, T alpha, const T* x, int64_t incx, T beta, T* y,
+                         int64_t incy) {
+    if (n <= 0)
+        return;
+    if (incx == 1 && incy == 1)
+        axpby_loop(n, alpha, x, unit_inc(), beta, y, unit_inc());
+    else
+        axpby_loop(n, alpha, x + first_element(n, incx), incx, beta, y + first_element(n, incy),
+                   incy);
+}
+
 namespace column_major {
 
 #define COLUMN_MAJOR
@@ -22,16 +22,17 @@
 void gbmv(sycl::queue& queue, transpose trans, int64_t m, int64_t n, int64_t kl, int64_t ku,
           float alpha, sycl::buffer<float, 1>& a, int64_t lda, sycl::buffer<float, 1>& x,
           int64_t incx, float beta, sycl::buffer<float, 1>& y, int64_t incy) {
+    check_cblas_ints(m, n, kl, ku, lda, incx, incy);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_sgbmv>(cgh, [=]() {
-            ::cblas_sgbmv(MAJOR, convert_to_cblas_trans(trans), (const int)m, (const int)n,
-                          (const int)kl, (const int)ku, (const float)alpha,
-                          accessor_a.GET_MULTI_PTR, (const int)lda, accessor_x.GET_MULTI_PTR,
-                          (const int)incx, (const float)beta, accessor_y.GET_MULTI_PTR,
-                          (const int)incy);
+        host_task<class netlib_sgbmv>(queue, cgh, [=]() {
+            ::cblas_sgbmv(MAJOR, convert_to_cblas_trans(trans), to_cblas_int(m), to_cblas_int(n),
+                          to_cblas_int(kl), to_cblas_int(ku), (const float)alpha,
+                          accessor_a.GET_MULTI_PTR, to_cblas_int(lda), accessor_x.GET_MULTI_PTR,
+                          to_cblas_int(incx), (const float)beta, accessor_y.GET_MULTI_PTR,
+                          to_cblas_int(incy));
         });
     });
 }
@@ -39,16 +40,17 @@ void gbmv(sycl::queue& queue, transpose trans, int64_t m, int64_t n, int64_t kl,
 void gbmv(sycl::queue& queue, transpose trans, int64_t m, int64_t n, int64_t kl, int64_t ku,
           double alpha, sycl::buffer<double, 1>& a, int64_t lda, sycl::buffer<double, 1>& x,
           int64_t incx, double beta, sycl::buffer<double, 1>& y, int64_t incy) {
+    check_cblas_ints(m, n, kl, ku, lda, incx, incy);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_dgbmv>(cgh, [=]() {
-            ::cblas_dgbmv(MAJOR, convert_to_cblas_trans(trans), (const int)m, (const int)n,
-                          (const int)kl, (const int)ku, (const double)alpha,
-                          accessor_a.GET_MULTI_PTR, (const int)lda, accessor_x.GET_MULTI_PTR,
-                          (const int)incx, (const double)beta, accessor_y.GET_MULTI_PTR,
-                          (const int)incy);
+        host_task<class netlib_dgbmv>(queue, cgh, [=]() {
+            ::cblas_dgbmv(MAJOR, convert_to_cblas_trans(trans), to_cblas_int(m), to_cblas_int(n),
+                          to_cblas_int(kl), to_cblas_int(ku), (const double)alpha,
+                          accessor_a.GET_MULTI_PTR, to_cblas_int(lda), accessor_x.GET_MULTI_PTR,
+                          to_cblas_int(incx), (const double)beta, accessor_y.GET_MULTI_PTR,
+                          to_cblas_int(incy));
         });
     });
 }
@@ -57,16 +59,17 @@ void gbmv(sycl::queue& queue, transpose trans, int64_t m, int64_t n, int64_t kl,
           std::complex<float> alpha, sycl::buffer<std::complex<float>, 1>& a, int64_t lda,
           sycl::buffer<std::complex<float>, 1>& x, int64_t incx, std::complex<float> beta,
           sycl::buffer<std::complex<float>, 1>& y, int64_t incy) {
+    check_cblas_ints(m, n, kl, ku, lda, incx, incy);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_cgbmv>(cgh, [=]() {
-            ::cblas_cgbmv(MAJOR, convert_to_cblas_trans(trans), (const int)m, (const int)n,
-                          (const int)kl, (const int)ku, (const void*)&alpha,
-                          accessor_a.GET_MULTI_PTR, (const int)lda, accessor_x.GET_MULTI_PTR,
-                          (const int)incx, (const void*)&beta, accessor_y.GET_MULTI_PTR,
-                          (const int)incy);
+        host_task<class netlib_cgbmv>(queue, cgh, [=]() {
+            ::cblas_cgbmv(MAJOR, convert_to_cblas_trans(trans), to_cblas_int(m), to_cblas_int(n),
+                          to_cblas_int(kl), to_cblas_int(ku), (const void*)&alpha,
+                          accessor_a.GET_MULTI_PTR, to_cblas_int(lda), accessor_x.GET_MULTI_PTR,
+                          to_cblas_int(incx), (const void*)&beta, accessor_y.GET_MULTI_PTR,
+                          to_cblas_int(incy));
         });
     });
 }
@@ -75,16 +78,17 @@ void gbmv(sycl::queue& queue, transpose trans, int64_t m, int64_t n, int64_t kl,
           std::complex<double> alpha, sycl::buffer<std::complex<double>, 1>& a, int64_t lda,
           sycl::buffer<std::complex<double>, 1>& x, int64_t incx, std::complex<double> beta,
           sycl::buffer<std::complex<double>, 1>& y, int64_t incy) {
+    check_cblas_ints(m, n, kl, ku, lda, incx, incy);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_zgbmv>(cgh, [=]() {
-            ::cblas_zgbmv(MAJOR, convert_to_cblas_trans(trans), (const int)m, (const int)n,
-                          (const int)kl, (const int)ku, (const void*)&alpha,
-                          accessor_a.GET_MULTI_PTR, (const int)lda, accessor_x.GET_MULTI_PTR,
-                          (const int)incx, (const void*)&beta, accessor_y.GET_MULTI_PTR,
-                          (const int)incy);
+        host_task<class netlib_zgbmv>(queue, cgh, [=]() {
+            ::cblas_zgbmv(MAJOR, convert_to_cblas_trans(trans), to_cblas_int(m), to_cblas_int(n),
+                          to_cblas_int(kl), to_cblas_int(ku), (const void*)&alpha,
+                          accessor_a.GET_MULTI_PTR, to_cblas_int(lda), accessor_x.GET_MULTI_PTR,
+                          to_cblas_int(incx), (const void*)&beta, accessor_y.GET_MULTI_PTR,
+                          to_cblas_int(incy));
         });
     });
 }
@@ -92,15 +96,16 @@ void gbmv(sycl::queue& queue, transpose trans, int64_t m, int64_t n, int64_t kl,
 void gemv(sycl::queue& queue, transpose trans, int64_t m, int64_t n, float alpha,
           sycl::buffer<float, 1>& a, int64_t lda, sycl::buffer<float, 1>& x, int64_t incx,
           float beta, sycl::buffer<float, 1>& y, int64_t incy) {
+    check_cblas_ints(m, n, lda, incx, incy);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_sgemv>(cgh, [=]() {
-            ::cblas_sgemv(MAJOR, convert_to_cblas_trans(trans), (const int)m, (const int)n,
-                          (const float)alpha, accessor_a.GET_MULTI_PTR, (const int)lda,
-                          accessor_x.GET_MULTI_PTR, (const int)incx, (const float)beta,
-                          accessor_y.GET_MULTI_PTR, (const int)incy);
+        host_task<class netlib_sgemv>(queue, cgh, [=]() {
+            ::cblas_sgemv(MAJOR, convert_to_cblas_trans(trans), to_cblas_int(m), to_cblas_int(n),
+                          (const float)alpha, accessor_a.GET_MULTI_PTR, to_cblas_int(lda),
+                          accessor_x.GET_MULTI_PTR, to_cblas_int(incx), (const float)beta,
+                          accessor_y.GET_MULTI_PTR, to_cblas_int(incy));
         });
     });
 }
@@ -108,15 +113,16 @@ void gemv(sycl::queue& queue, transpose trans, int64_t m, int64_t n, float alpha
 void gemv(sycl::queue& queue, transpose trans, int64_t m, int64_t n, double alpha,
           sycl::buffer<double, 1>& a, int64_t lda, sycl::buffer<double, 1>& x, int64_t incx,
           double beta, sycl::buffer<double, 1>& y, int64_t incy) {
+    check_cblas_ints(m, n, lda, incx, incy);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_dgemv>(cgh, [=]() {
-            ::cblas_dgemv(MAJOR, convert_to_cblas_trans(trans), (const int)m, (const int)n,
-                          (const double)alpha, accessor_a.GET_MULTI_PTR, (const int)lda,
-                          accessor_x.GET_MULTI_PTR, (const int)incx, (const double)beta,
-                          accessor_y.GET_MULTI_PTR, (const int)incy);
+        host_task<class netlib_dgemv>(queue, cgh, [=]() {
+            ::cblas_dgemv(MAJOR, convert_to_cblas_trans(trans), to_cblas_int(m), to_cblas_int(n),
+                          (const double)alpha, accessor_a.GET_MULTI_PTR, to_cblas_int(lda),
+                          accessor_x.GET_MULTI_PTR, to_cblas_int(incx), (const double)beta,
+                          accessor_y.GET_MULTI_PTR, to_cblas_int(incy));
         });
     });
 }
@@ -125,15 +131,16 @@ void gemv(sycl::queue& queue, transpose trans, int64_t m, int64_t n, std::comple
           sycl::buffer<std::complex<float>, 1>& a, int64_t lda,
           sycl::buffer<std::complex<float>, 1>& x, int64_t incx, std::complex<float> beta,
           sycl::buffer<std::complex<float>, 1>& y, int64_t incy) {
+    check_cblas_ints(m, n, lda, incx, incy);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_cgemv>(cgh, [=]() {
-            ::cblas_cgemv(MAJOR, convert_to_cblas_trans(trans), (const int)m, (const int)n,
-                          (const void*)&alpha, accessor_a.GET_MULTI_PTR, (const int)lda,
-                          accessor_x.GET_MULTI_PTR, (const int)incx, (const void*)&beta,
-                          accessor_y.GET_MULTI_PTR, (const int)incy);
+        host_task<class netlib_cgemv>(queue, cgh, [=]() {
+            ::cblas_cgemv(MAJOR, convert_to_cblas_trans(trans), to_cblas_int(m), to_cblas_int(n),
+                          (const void*)&alpha, accessor_a.GET_MULTI_PTR, to_cblas_int(lda),
+                          accessor_x.GET_MULTI_PTR, to_cblas_int(incx), (const void*)&beta,
+                          accessor_y.GET_MULTI_PTR, to_cblas_int(incy));
         });
     });
 }
@@ -142,15 +149,16 @@ void gemv(sycl::queue& queue, transpose trans, int64_t m, int64_t n, std::comple
           sycl::buffer<std::complex<double>, 1>& a, int64_t lda,
           sycl::buffer<std::complex<double>, 1>& x, int64_t incx, std::complex<double> beta,
           sycl::buffer<std::complex<double>, 1>& y, int64_t incy) {
+    check_cblas_ints(m, n, lda, incx, incy);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_zgemv>(cgh, [=]() {
-            ::cblas_zgemv(MAJOR, convert_to_cblas_trans(trans), (const int)m, (const int)n,
-                          (const void*)&alpha, accessor_a.GET_MULTI_PTR, (const int)lda,
-                          accessor_x.GET_MULTI_PTR, (const int)incx, (const void*)&beta,
-                          accessor_y.GET_MULTI_PTR, (const int)incy);
+        host_task<class netlib_zgemv>(queue, cgh, [=]() {
+            ::cblas_zgemv(MAJOR, convert_to_cblas_trans(trans), to_cblas_int(m), to_cblas_int(n),
+                          (const void*)&alpha, accessor_a.GET_MULTI_PTR, to_cblas_int(lda),
+                          accessor_x.GET_MULTI_PTR, to_cblas_int(incx), (const void*)&beta,
+                          accessor_y.GET_MULTI_PTR, to_cblas_int(incy));
         });
     });
 }
@@ -158,14 +166,15 @@ void gemv(sycl::queue& queue, transpose trans, int64_t m, int64_t n, std::comple
 void ger(sycl::queue& queue, int64_t m, int64_t n, float alpha, sycl::buffer<float, 1>& x,
          int64_t incx, sycl::buffer<float, 1>& y, int64_t incy, sycl::buffer<float, 1>& a,
          int64_t lda) {
+    check_cblas_ints(m, n, incx, incy, lda);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<sycl::access::mode::read>(cgh);
         auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_sger>(cgh, [=]() {
-            ::cblas_sger(MAJOR, (const int)m, (const int)n, (const float)alpha,
-                         accessor_x.GET_MULTI_PTR, (const int)incx, accessor_y.GET_MULTI_PTR,
-                         (const int)incy, accessor_a.GET_MULTI_PTR, (const int)lda);
+        host_task<class netlib_sger>(queue, cgh, [=]() {
+            ::cblas_sger(MAJOR, to_cblas_int(m), to_cblas_int(n), (const float)alpha,
+                         accessor_x.GET_MULTI_PTR, to_cblas_int(incx), accessor_y.GET_MULTI_PTR,
+                         to_cblas_int(incy), accessor_a.GET_MULTI_PTR, to_cblas_int(lda));
         });
     });
 }
@@ -173,14 +182,15 @@ void ger(sycl::queue& queue, int64_t m, int64_t n, float alpha, sycl::buffer<flo
 void ger(sycl::queue& queue, int64_t m, int64_t n, double alpha, sycl::buffer<double, 1>& x,
          int64_t incx, sycl::buffer<double, 1>& y, int64_t incy, sycl::buffer<double, 1>& a,
          int64_t lda) {
+    check_cblas_ints(m, n, incx, incy, lda);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<sycl::access::mode::read>(cgh);
         auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_dger>(cgh, [=]() {
-            ::cblas_dger(MAJOR, (const int)m, (const int)n, (const double)alpha,
-                         accessor_x.GET_MULTI_PTR, (const int)incx, accessor_y.GET_MULTI_PTR,
-                         (const int)incy, accessor_a.GET_MULTI_PTR, (const int)lda);
+        host_task<class netlib_dger>(queue, cgh, [=]() {
+            ::cblas_dger(MAJOR, to_cblas_int(m), to_cblas_int(n), (const double)alpha,
+                         accessor_x.GET_MULTI_PTR, to_cblas_int(incx), accessor_y.GET_MULTI_PTR,
+                         to_cblas_int(incy), accessor_a.GET_MULTI_PTR, to_cblas_int(lda));
         });
     });
 }
@@ -189,14 +199,15 @@ void gerc(sycl::queue& queue, int64_t m, int64_t n, std::complex<float> alpha,
           sycl::buffer<std::complex<float>, 1>& x, int64_t incx,
           sycl::buffer<std::complex<float>, 1>& y, int64_t incy,
           sycl::buffer<std::complex<float>, 1>& a, int64_t lda) {
+    check_cblas_ints(m, n, incx, incy, lda);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<sycl::access::mode::read>(cgh);
         auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_cgerc>(cgh, [=]() {
-            ::cblas_cgerc(MAJOR, (const int)m, (const int)n, (const void*)&alpha,
-                          accessor_x.GET_MULTI_PTR, (const int)incx, accessor_y.GET_MULTI_PTR,
-                          (const int)incy, accessor_a.GET_MULTI_PTR, (const int)lda);
+        host_task<class netlib_cgerc>(queue, cgh, [=]() {
+            ::cblas_cgerc(MAJOR, to_cblas_int(m), to_cblas_int(n), (const void*)&alpha,
+                          accessor_x.GET_MULTI_PTR, to_cblas_int(incx), accessor_y.GET_MULTI_PTR,
+                          to_cblas_int(incy), accessor_a.GET_MULTI_PTR, to_cblas_int(lda));
         });
     });
 }
@@ -205,14 +216,15 @@ void gerc(sycl::queue& queue, int64_t m, int64_t n, std::complex<double> alpha,
           sycl::buffer<std::complex<double>, 1>& x, int64_t incx,
           sycl::buffer<std::complex<double>, 1>& y, int64_t incy,
           sycl::buffer<std::complex<double>, 1>& a, int64_t lda) {
+    check_cblas_ints(m, n, incx, incy, lda);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<sycl::access::mode::read>(cgh);
         auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_zgerc>(cgh, [=]() {
-            ::cblas_zgerc(MAJOR, (const int)m, (const int)n, (const void*)&alpha,
-                          accessor_x.GET_MULTI_PTR, (const int)incx, accessor_y.GET_MULTI_PTR,
-                          (const int)incy, accessor_a.GET_MULTI_PTR, (const int)lda);
+        host_task<class netlib_zgerc>(queue, cgh, [=]() {
+            ::cblas_zgerc(MAJOR, to_cblas_int(m), to_cblas_int(n), (const void*)&alpha,
+                          accessor_x.GET_MULTI_PTR, to_cblas_int(incx), accessor_y.GET_MULTI_PTR,
+                          to_cblas_int(incy), accessor_a.GET_MULTI_PTR, to_cblas_int(lda));
         });
     });
 }
@@ -221,14 +233,15 @@ void geru(sycl::queue& queue, int64_t m, int64_t n, std::complex<float> alpha,
           sycl::buffer<std::complex<float>, 1>& x, int64_t incx,
           sycl::buffer<std::complex<float>, 1>& y, int64_t incy,
           sycl::buffer<std::complex<float>, 1>& a, int64_t lda) {
+    check_cblas_ints(m, n, incx, incy, lda);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<sycl::access::mode::read>(cgh);
         auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_cgeru>(cgh, [=]() {
-            ::cblas_cgeru(MAJOR, (const int)m, (const int)n, (const void*)&alpha,
-                          accessor_x.GET_MULTI_PTR, (const int)incx, accessor_y.GET_MULTI_PTR,
-                          (const int)incy, accessor_a.GET_MULTI_PTR, (const int)lda);
+        host_task<class netlib_cgeru>(queue, cgh, [=]() {
+            ::cblas_cgeru(MAJOR, to_cblas_int(m), to_cblas_int(n), (const void*)&alpha,
+                          accessor_x.GET_MULTI_PTR, to_cblas_int(incx), accessor_y.GET_MULTI_PTR,
+                          to_cblas_int(incy), accessor_a.GET_MULTI_PTR, to_cblas_int(lda));
         });
     });
 }
@@ -237,14 +250,15 @@ void geru(sycl::queue& queue, int64_t m, int64_t n, std::complex<double> alpha,
           sycl::buffer<std::complex<double>, 1>& x, int64_t incx,
           sycl::buffer<std::complex<double>, 1>& y, int64_t incy,
           sycl::buffer<std::complex<double>, 1>& a, int64_t lda) {
+    check_cblas_ints(m, n, incx, incy, lda);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<sycl::access::mode::read>(cgh);
         auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_zgeru>(cgh, [=]() {
-            ::cblas_zgeru(MAJOR, (const int)m, (const int)n, (const void*)&alpha,
-                          accessor_x.GET_MULTI_PTR, (const int)incx, accessor_y.GET_MULTI_PTR,
-                          (const int)incy, accessor_a.GET_MULTI_PTR, (const int)lda);
+        host_task<class netlib_zgeru>(queue, cgh, [=]() {
+            ::cblas_zgeru(MAJOR, to_cblas_int(m), to_cblas_int(n), (const void*)&alpha,
+                          accessor_x.GET_MULTI_PTR, to_cblas_int(incx), accessor_y.GET_MULTI_PTR,
+                          to_cblas_int(incy), accessor_a.GET_MULTI_PTR, to_cblas_int(lda));
         });
     });
 }
@@ -253,15 +267,16 @@ void hbmv(sycl::queue& queue, uplo upper_lower, int64_t n, int64_t k, std::compl
           sycl::buffer<std::complex<float>, 1>& a, int64_t lda,
           sycl::buffer<std::complex<float>, 1>& x, int64_t incx, std::complex<float> beta,
           sycl::buffer<std::complex<float>, 1>& y, int64_t incy) {
+    check_cblas_ints(n, k, lda, incx, incy);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_chbmv>(cgh, [=]() {
-            ::cblas_chbmv(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n, (const int)k,
-                          (const void*)&alpha, accessor_a.GET_MULTI_PTR, (const int)lda,
-                          accessor_x.GET_MULTI_PTR, (const int)incx, (const void*)&beta,
-                          accessor_y.GET_MULTI_PTR, (const int)incy);
+        host_task<class netlib_chbmv>(queue, cgh, [=]() {
+            ::cblas_chbmv(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          to_cblas_int(k), (const void*)&alpha, accessor_a.GET_MULTI_PTR,
+                          to_cblas_int(lda), accessor_x.GET_MULTI_PTR, to_cblas_int(incx),
+                          (const void*)&beta, accessor_y.GET_MULTI_PTR, to_cblas_int(incy));
         });
     });
 }
@@ -270,15 +285,16 @@ void hbmv(sycl::queue& queue, uplo upper_lower, int64_t n, int64_t k, std::compl
           sycl::buffer<std::complex<double>, 1>& a, int64_t lda,
           sycl::buffer<std::complex<double>, 1>& x, int64_t incx, std::complex<double> beta,
           sycl::buffer<std::complex<double>, 1>& y, int64_t incy) {
+    check_cblas_ints(n, k, lda, incx, incy);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_zhbmv>(cgh, [=]() {
-            ::cblas_zhbmv(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n, (const int)k,
-                          (const void*)&alpha, accessor_a.GET_MULTI_PTR, (const int)lda,
-                          accessor_x.GET_MULTI_PTR, (const int)incx, (const void*)&beta,
-                          accessor_y.GET_MULTI_PTR, (const int)incy);
+        host_task<class netlib_zhbmv>(queue, cgh, [=]() {
+            ::cblas_zhbmv(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          to_cblas_int(k), (const void*)&alpha, accessor_a.GET_MULTI_PTR,
+                          to_cblas_int(lda), accessor_x.GET_MULTI_PTR, to_cblas_int(incx),
+                          (const void*)&beta, accessor_y.GET_MULTI_PTR, to_cblas_int(incy));
         });
     });
 }
@@ -287,15 +303,16 @@ void hemv(sycl::queue& queue, uplo upper_lower, int64_t n, std::complex<float> a
           sycl::buffer<std::complex<float>, 1>& a, int64_t lda,
           sycl::buffer<std::complex<float>, 1>& x, int64_t incx, std::complex<float> beta,
           sycl::buffer<std::complex<float>, 1>& y, int64_t incy) {
+    check_cblas_ints(n, lda, incx, incy);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_chemv>(cgh, [=]() {
-            ::cblas_chemv(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                          (const void*)&alpha, accessor_a.GET_MULTI_PTR, (const int)lda,
-                          accessor_x.GET_MULTI_PTR, (const int)incx, (const void*)&beta,
-                          accessor_y.GET_MULTI_PTR, (const int)incy);
+        host_task<class netlib_chemv>(queue, cgh, [=]() {
+            ::cblas_chemv(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          (const void*)&alpha, accessor_a.GET_MULTI_PTR, to_cblas_int(lda),
+                          accessor_x.GET_MULTI_PTR, to_cblas_int(incx), (const void*)&beta,
+                          accessor_y.GET_MULTI_PTR, to_cblas_int(incy));
         });
     });
 }
@@ -304,15 +321,16 @@ void hemv(sycl::queue& queue, uplo upper_lower, int64_t n, std::complex<double>
           sycl::buffer<std::complex<double>, 1>& a, int64_t lda,
           sycl::buffer<std::complex<double>, 1>& x, int64_t incx, std::complex<double> beta,
           sycl::buffer<std::complex<double>, 1>& y, int64_t incy) {
+    check_cblas_ints(n, lda, incx, incy);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_zhemv>(cgh, [=]() {
-            ::cblas_zhemv(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                          (const void*)&alpha, accessor_a.GET_MULTI_PTR, (const int)lda,
-                          accessor_x.GET_MULTI_PTR, (const int)incx, (const void*)&beta,
-                          accessor_y.GET_MULTI_PTR, (const int)incy);
+        host_task<class netlib_zhemv>(queue, cgh, [=]() {
+            ::cblas_zhemv(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          (const void*)&alpha, accessor_a.GET_MULTI_PTR, to_cblas_int(lda),
+                          accessor_x.GET_MULTI_PTR, to_cblas_int(incx), (const void*)&beta,
+                          accessor_y.GET_MULTI_PTR, to_cblas_int(incy));
         });
     });
 }
@@ -320,13 +338,14 @@ void hemv(sycl::queue& queue, uplo upper_lower, int64_t n, std::complex<double>
 void her(sycl::queue& queue, uplo upper_lower, int64_t n, float alpha,
          sycl::buffer<std::complex<float>, 1>& x, int64_t incx,
          sycl::buffer<std::complex<float>, 1>& a, int64_t lda) {
+    check_cblas_ints(n, incx, lda);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
         auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_cher>(cgh, [=]() {
-            ::cblas_cher(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                         (const float)alpha, accessor_x.GET_MULTI_PTR, (const int)incx,
-                         accessor_a.GET_MULTI_PTR, (const int)lda);
+        host_task<class netlib_cher>(queue, cgh, [=]() {
+            ::cblas_cher(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                         (const float)alpha, accessor_x.GET_MULTI_PTR, to_cblas_int(incx),
+                         accessor_a.GET_MULTI_PTR, to_cblas_int(lda));
         });
     });
 }
@@ -334,13 +353,14 @@ void her(sycl::queue& queue, uplo upper_lower, int64_t n, float alpha,
 void her(sycl::queue& queue, uplo upper_lower, int64_t n, double alpha,
          sycl::buffer<std::complex<double>, 1>& x, int64_t incx,
          sycl::buffer<std::complex<double>, 1>& a, int64_t lda) {
+    check_cblas_ints(n, incx, lda);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
         auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_zher>(cgh, [=]() {
-            ::cblas_zher(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                         (const double)alpha, accessor_x.GET_MULTI_PTR, (const int)incx,
-                         accessor_a.GET_MULTI_PTR, (const int)lda);
+        host_task<class netlib_zher>(queue, cgh, [=]() {
+            ::cblas_zher(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                         (const double)alpha, accessor_x.GET_MULTI_PTR, to_cblas_int(incx),
+                         accessor_a.GET_MULTI_PTR, to_cblas_int(lda));
         });
     });
 }
@@ -349,15 +369,16 @@ void her2(sycl::queue& queue, uplo upper_lower, int64_t n, std::complex<float> a
           sycl::buffer<std::complex<float>, 1>& x, int64_t incx,
           sycl::buffer<std::complex<float>, 1>& y, int64_t incy,
           sycl::buffer<std::complex<float>, 1>& a, int64_t lda) {
+    check_cblas_ints(n, incx, incy, lda);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<sycl::access::mode::read>(cgh);
         auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_cher2>(cgh, [=]() {
-            ::cblas_cher2(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                          (const void*)&alpha, accessor_x.GET_MULTI_PTR, (const int)incx,
-                          accessor_y.GET_MULTI_PTR, (const int)incy, accessor_a.GET_MULTI_PTR,
-                          (const int)lda);
+        host_task<class netlib_cher2>(queue, cgh, [=]() {
+            ::cblas_cher2(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          (const void*)&alpha, accessor_x.GET_MULTI_PTR, to_cblas_int(incx),
+                          accessor_y.GET_MULTI_PTR, to_cblas_int(incy), accessor_a.GET_MULTI_PTR,
+                          to_cblas_int(lda));
         });
     });
 }
@@ -366,15 +387,16 @@ void her2(sycl::queue& queue, uplo upper_lower, int64_t n, std::complex<double>
           sycl::buffer<std::complex<double>, 1>& x, int64_t incx,
           sycl::buffer<std::complex<double>, 1>& y, int64_t incy,
           sycl::buffer<std::complex<double>, 1>& a, int64_t lda) {
+    check_cblas_ints(n, incx, incy, lda);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<sycl::access::mode::read>(cgh);
         auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_zher2>(cgh, [=]() {
-            ::cblas_zher2(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                          (const void*)&alpha, accessor_x.GET_MULTI_PTR, (const int)incx,
-                          accessor_y.GET_MULTI_PTR, (const int)incy, accessor_a.GET_MULTI_PTR,
-                          (const int)lda);
+        host_task<class netlib_zher2>(queue, cgh, [=]() {
+            ::cblas_zher2(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          (const void*)&alpha, accessor_x.GET_MULTI_PTR, to_cblas_int(incx),
+                          accessor_y.GET_MULTI_PTR, to_cblas_int(incy), accessor_a.GET_MULTI_PTR,
+                          to_cblas_int(lda));
         });
     });
 }
@@ -383,15 +405,16 @@ void hpmv(sycl::queue& queue, uplo upper_lower, int64_t n, std::complex<float> a
           sycl::buffer<std::complex<float>, 1>& ap, sycl::buffer<std::complex<float>, 1>& x,
           int64_t incx, std::complex<float> beta, sycl::buffer<std::complex<float>, 1>& y,
           int64_t incy) {
+    check_cblas_ints(n, incx, incy);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_ap = ap.get_access<sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_chpmv>(cgh, [=]() {
-            ::cblas_chpmv(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
+        host_task<class netlib_chpmv>(queue, cgh, [=]() {
+            ::cblas_chpmv(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
                           (const void*)&alpha, accessor_ap.GET_MULTI_PTR, accessor_x.GET_MULTI_PTR,
-                          (const int)incx, (const void*)&beta, accessor_y.GET_MULTI_PTR,
-                          (const int)incy);
+                          to_cblas_int(incx), (const void*)&beta, accessor_y.GET_MULTI_PTR,
+                          to_cblas_int(incy));
         });
     });
 }
@@ -400,15 +423,16 @@ void hpmv(sycl::queue& queue, uplo upper_lower, int64_t n, std::complex<double>
           sycl::buffer<std::complex<double>, 1>& ap, sycl::buffer<std::complex<double>, 1>& x,
           int64_t incx, std::complex<double> beta, sycl::buffer<std::complex<double>, 1>& y,
           int64_t incy) {
+    check_cblas_ints(n, incx, incy);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_ap = ap.get_access<sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_zhpmv>(cgh, [=]() {
-            ::cblas_zhpmv(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
+        host_task<class netlib_zhpmv>(queue, cgh, [=]() {
+            ::cblas_zhpmv(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
                           (const void*)&alpha, accessor_ap.GET_MULTI_PTR, accessor_x.GET_MULTI_PTR,
-                          (const int)incx, (const void*)&beta, accessor_y.GET_MULTI_PTR,
-                          (const int)incy);
+                          to_cblas_int(incx), (const void*)&beta, accessor_y.GET_MULTI_PTR,
+                          to_cblas_int(incy));
         });
     });
 }
@@ -416,12 +440,13 @@ void hpmv(sycl::queue& queue, uplo upper_lower, int64_t n, std::complex<double>
 void hpr(sycl::queue& queue, uplo upper_lower, int64_t n, float alpha,
          sycl::buffer<std::complex<float>, 1>& x, int64_t incx,
          sycl::buffer<std::complex<float>, 1>& ap) {
+    check_cblas_ints(n, incx);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
         auto accessor_ap = ap.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_chpr>(cgh, [=]() {
-            ::cblas_chpr(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                         (const float)alpha, accessor_x.GET_MULTI_PTR, (const int)incx,
+        host_task<class netlib_chpr>(queue, cgh, [=]() {
+            ::cblas_chpr(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                         (const float)alpha, accessor_x.GET_MULTI_PTR, to_cblas_int(incx),
                          accessor_ap.GET_MULTI_PTR);
         });
     });
@@ -430,12 +455,13 @@ void hpr(sycl::queue& queue, uplo upper_lower, int64_t n, float alpha,
 void hpr(sycl::queue& queue, uplo upper_lower, int64_t n, double alpha,
          sycl::buffer<std::complex<double>, 1>& x, int64_t incx,
          sycl::buffer<std::complex<double>, 1>& ap) {
+    check_cblas_ints(n, incx);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
         auto accessor_ap = ap.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_zhpr>(cgh, [=]() {
-            ::cblas_zhpr(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                         (const double)alpha, accessor_x.GET_MULTI_PTR, (const int)incx,
+        host_task<class netlib_zhpr>(queue, cgh, [=]() {
+            ::cblas_zhpr(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                         (const double)alpha, accessor_x.GET_MULTI_PTR, to_cblas_int(incx),
                          accessor_ap.GET_MULTI_PTR);
         });
     });
@@ -445,14 +471,15 @@ void hpr2(sycl::queue& queue, uplo upper_lower, int64_t n, std::complex<float> a
           sycl::buffer<std::complex<float>, 1>& x, int64_t incx,
           sycl::buffer<std::complex<float>, 1>& y, int64_t incy,
           sycl::buffer<std::complex<float>, 1>& ap) {
+    check_cblas_ints(n, incx, incy);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<sycl::access::mode::read>(cgh);
         auto accessor_ap = ap.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_chpr2>(cgh, [=]() {
-            ::cblas_chpr2(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                          (const void*)&alpha, accessor_x.GET_MULTI_PTR, (const int)incx,
-                          accessor_y.GET_MULTI_PTR, (const int)incy, accessor_ap.GET_MULTI_PTR);
+        host_task<class netlib_chpr2>(queue, cgh, [=]() {
+            ::cblas_chpr2(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          (const void*)&alpha, accessor_x.GET_MULTI_PTR, to_cblas_int(incx),
+                          accessor_y.GET_MULTI_PTR, to_cblas_int(incy), accessor_ap.GET_MULTI_PTR);
         });
     });
 }
@@ -461,14 +488,15 @@ void hpr2(sycl::queue& queue, uplo upper_lower, int64_t n, std::complex<double>
           sycl::buffer<std::complex<double>, 1>& x, int64_t incx,
           sycl::buffer<std::complex<double>, 1>& y, int64_t incy,
           sycl::buffer<std::complex<double>, 1>& ap) {
+    check_cblas_ints(n, incx, incy);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<sycl::access::mode::read>(cgh);
         auto accessor_ap = ap.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_zhpr2>(cgh, [=]() {
-            ::cblas_zhpr2(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                          (const void*)&alpha, accessor_x.GET_MULTI_PTR, (const int)incx,
-                          accessor_y.GET_MULTI_PTR, (const int)incy, accessor_ap.GET_MULTI_PTR);
+        host_task<class netlib_zhpr2>(queue, cgh, [=]() {
+            ::cblas_zhpr2(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          (const void*)&alpha, accessor_x.GET_MULTI_PTR, to_cblas_int(incx),
+                          accessor_y.GET_MULTI_PTR, to_cblas_int(incy), accessor_ap.GET_MULTI_PTR);
         });
     });
 }
@@ -476,15 +504,16 @@ void hpr2(sycl::queue& queue, uplo upper_lower, int64_t n, std::complex<double>
 void sbmv(sycl::queue& queue, uplo upper_lower, int64_t n, int64_t k, float alpha,
           sycl::buffer<float, 1>& a, int64_t lda, sycl::buffer<float, 1>& x, int64_t incx,
           float beta, sycl::buffer<float, 1>& y, int64_t incy) {
+    check_cblas_ints(n, k, lda, incx, incy);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_ssbmv>(cgh, [=]() {
-            ::cblas_ssbmv(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n, (const int)k,
-                          (const float)alpha, accessor_a.GET_MULTI_PTR, (const int)lda,
-                          accessor_x.GET_MULTI_PTR, (const int)incx, (const float)beta,
-                          accessor_y.GET_MULTI_PTR, (const int)incy);
+        host_task<class netlib_ssbmv>(queue, cgh, [=]() {
+            ::cblas_ssbmv(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          to_cblas_int(k), (const float)alpha, accessor_a.GET_MULTI_PTR,
+                          to_cblas_int(lda), accessor_x.GET_MULTI_PTR, to_cblas_int(incx),
+                          (const float)beta, accessor_y.GET_MULTI_PTR, to_cblas_int(incy));
         });
     });
 }
@@ -492,15 +521,16 @@ void sbmv(sycl::queue& queue, uplo upper_lower, int64_t n, int64_t k, float alph
 void sbmv(sycl::queue& queue, uplo upper_lower, int64_t n, int64_t k, double alpha,
           sycl::buffer<double, 1>& a, int64_t lda, sycl::buffer<double, 1>& x, int64_t incx,
           double beta, sycl::buffer<double, 1>& y, int64_t incy) {
+    check_cblas_ints(n, k, lda, incx, incy);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_dsbmv>(cgh, [=]() {
-            ::cblas_dsbmv(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n, (const int)k,
-                          (const double)alpha, accessor_a.GET_MULTI_PTR, (const int)lda,
-                          accessor_x.GET_MULTI_PTR, (const int)incx, (const double)beta,
-                          accessor_y.GET_MULTI_PTR, (const int)incy);
+        host_task<class netlib_dsbmv>(queue, cgh, [=]() {
+            ::cblas_dsbmv(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          to_cblas_int(k), (const double)alpha, accessor_a.GET_MULTI_PTR,
+                          to_cblas_int(lda), accessor_x.GET_MULTI_PTR, to_cblas_int(incx),
+                          (const double)beta, accessor_y.GET_MULTI_PTR, to_cblas_int(incy));
         });
     });
 }
@@ -508,15 +538,16 @@ void sbmv(sycl::queue& queue, uplo upper_lower, int64_t n, int64_t k, double alp
 void spmv(sycl::queue& queue, uplo upper_lower, int64_t n, float alpha, sycl::buffer<float, 1>& ap,
           sycl::buffer<float, 1>& x, int64_t incx, float beta, sycl::buffer<float, 1>& y,
           int64_t incy) {
+    check_cblas_ints(n, incx, incy);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_ap = ap.get_access<sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_sspmv>(cgh, [=]() {
-            ::cblas_sspmv(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
+        host_task<class netlib_sspmv>(queue, cgh, [=]() {
+            ::cblas_sspmv(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
                           (const float)alpha, accessor_ap.GET_MULTI_PTR, accessor_x.GET_MULTI_PTR,
-                          (const int)incx, (const float)beta, accessor_y.GET_MULTI_PTR,
-                          (const int)incy);
+                          to_cblas_int(incx), (const float)beta, accessor_y.GET_MULTI_PTR,
+                          to_cblas_int(incy));
         });
     });
 }
@@ -524,27 +555,29 @@ void spmv(sycl::queue& queue, uplo upper_lower, int64_t n, float alpha, sycl::bu
 void spmv(sycl::queue& queue, uplo upper_lower, int64_t n, double alpha,
           sycl::buffer<double, 1>& ap, sycl::buffer<double, 1>& x, int64_t incx, double beta,
           sycl::buffer<double, 1>& y, int64_t incy) {
+    check_cblas_ints(n, incx, incy);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_ap = ap.get_access<sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_dspmv>(cgh, [=]() {
-            ::cblas_dspmv(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
+        host_task<class netlib_dspmv>(queue, cgh, [=]() {
+            ::cblas_dspmv(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
                           (const double)alpha, accessor_ap.GET_MULTI_PTR, accessor_x.GET_MULTI_PTR,
-                          (const int)incx, (const double)beta, accessor_y.GET_MULTI_PTR,
-                          (const int)incy);
+                          to_cblas_int(incx), (const double)beta, accessor_y.GET_MULTI_PTR,
+                          to_cblas_int(incy));
         });
     });
 }
 
 void spr(sycl::queue& queue, uplo upper_lower, int64_t n, float alpha, sycl::buffer<float, 1>& x,
          int64_t incx, sycl::buffer<float, 1>& ap) {
+    check_cblas_ints(n, incx);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
         auto accessor_ap = ap.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_sspr>(cgh, [=]() {
-            ::cblas_sspr(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                         (const float)alpha, accessor_x.GET_MULTI_PTR, (const int)incx,
+        host_task<class netlib_sspr>(queue, cgh, [=]() {
+            ::cblas_sspr(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                         (const float)alpha, accessor_x.GET_MULTI_PTR, to_cblas_int(incx),
                          accessor_ap.GET_MULTI_PTR);
         });
     });
@@ -552,12 +585,13 @@ void spr(sycl::queue& queue, uplo upper_lower, int64_t n, float alpha, sycl::buf
 
 void spr(sycl::queue& queue, uplo upper_lower, int64_t n, double alpha, sycl::buffer<double, 1>& x,
          int64_t incx, sycl::buffer<double, 1>& ap) {
+    check_cblas_ints(n, incx);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
         auto accessor_ap = ap.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_dspr>(cgh, [=]() {
-            ::cblas_dspr(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                         (const double)alpha, accessor_x.GET_MULTI_PTR, (const int)incx,
+        host_task<class netlib_dspr>(queue, cgh, [=]() {
+            ::cblas_dspr(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                         (const double)alpha, accessor_x.GET_MULTI_PTR, to_cblas_int(incx),
                          accessor_ap.GET_MULTI_PTR);
         });
     });
@@ -565,28 +599,30 @@ void spr(sycl::queue& queue, uplo upper_lower, int64_t n, double alpha, sycl::bu
 
 void spr2(sycl::queue& queue, uplo upper_lower, int64_t n, float alpha, sycl::buffer<float, 1>& x,
           int64_t incx, sycl::buffer<float, 1>& y, int64_t incy, sycl::buffer<float, 1>& ap) {
+    check_cblas_ints(n, incx, incy);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<sycl::access::mode::read>(cgh);
         auto accessor_ap = ap.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_sspr2>(cgh, [=]() {
-            ::cblas_sspr2(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                          (const float)alpha, accessor_x.GET_MULTI_PTR, (const int)incx,
-                          accessor_y.GET_MULTI_PTR, (const int)incy, accessor_ap.GET_MULTI_PTR);
+        host_task<class netlib_sspr2>(queue, cgh, [=]() {
+            ::cblas_sspr2(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          (const float)alpha, accessor_x.GET_MULTI_PTR, to_cblas_int(incx),
+                          accessor_y.GET_MULTI_PTR, to_cblas_int(incy), accessor_ap.GET_MULTI_PTR);
         });
     });
 }
 
 void spr2(sycl::queue& queue, uplo upper_lower, int64_t n, double alpha, sycl::buffer<double, 1>& x,
           int64_t incx, sycl::buffer<double, 1>& y, int64_t incy, sycl::buffer<double, 1>& ap) {
+    check_cblas_ints(n, incx, incy);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<sycl::access::mode::read>(cgh);
         auto accessor_ap = ap.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_dspr2>(cgh, [=]() {
-            ::cblas_dspr2(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                          (const double)alpha, accessor_x.GET_MULTI_PTR, (const int)incx,
-                          accessor_y.GET_MULTI_PTR, (const int)incy, accessor_ap.GET_MULTI_PTR);
+        host_task<class netlib_dspr2>(queue, cgh, [=]() {
+            ::cblas_dspr2(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          (const double)alpha, accessor_x.GET_MULTI_PTR, to_cblas_int(incx),
+                          accessor_y.GET_MULTI_PTR, to_cblas_int(incy), accessor_ap.GET_MULTI_PTR);
         });
     });
 }
@@ -594,15 +630,16 @@ void spr2(sycl::queue& queue, uplo upper_lower, int64_t n, double alpha, sycl::b
 void symv(sycl::queue& queue, uplo upper_lower, int64_t n, float alpha, sycl::buffer<float, 1>& a,
           int64_t lda, sycl::buffer<float, 1>& x, int64_t incx, float beta,
           sycl::buffer<float, 1>& y, int64_t incy) {
+    check_cblas_ints(n, lda, incx, incy);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_ssymv>(cgh, [=]() {
-            ::cblas_ssymv(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                          (const float)alpha, accessor_a.GET_MULTI_PTR, (const int)lda,
-                          accessor_x.GET_MULTI_PTR, (const int)incx, (const float)beta,
-                          accessor_y.GET_MULTI_PTR, (const int)incy);
+        host_task<class netlib_ssymv>(queue, cgh, [=]() {
+            ::cblas_ssymv(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          (const float)alpha, accessor_a.GET_MULTI_PTR, to_cblas_int(lda),
+                          accessor_x.GET_MULTI_PTR, to_cblas_int(incx), (const float)beta,
+                          accessor_y.GET_MULTI_PTR, to_cblas_int(incy));
         });
     });
 }
@@ -610,41 +647,44 @@ void symv(sycl::queue& queue, uplo upper_lower, int64_t n, float alpha, sycl::bu
 void symv(sycl::queue& queue, uplo upper_lower, int64_t n, double alpha, sycl::buffer<double, 1>& a,
           int64_t lda, sycl::buffer<double, 1>& x, int64_t incx, double beta,
           sycl::buffer<double, 1>& y, int64_t incy) {
+    check_cblas_ints(n, lda, incx, incy);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_dsymv>(cgh, [=]() {
-            ::cblas_dsymv(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                          (const double)alpha, accessor_a.GET_MULTI_PTR, (const int)lda,
-                          accessor_x.GET_MULTI_PTR, (const int)incx, (const double)beta,
-                          accessor_y.GET_MULTI_PTR, (const int)incy);
+        host_task<class netlib_dsymv>(queue, cgh, [=]() {
+            ::cblas_dsymv(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          (const double)alpha, accessor_a.GET_MULTI_PTR, to_cblas_int(lda),
+                          accessor_x.GET_MULTI_PTR, to_cblas_int(incx), (const double)beta,
+                          accessor_y.GET_MULTI_PTR, to_cblas_int(incy));
         });
     });
 }
 
 void syr(sycl::queue& queue, uplo upper_lower, int64_t n, float alpha, sycl::buffer<float, 1>& x,
          int64_t incx, sycl::buffer<float, 1>& a, int64_t lda) {
+    check_cblas_ints(n, incx, lda);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
         auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_ssyr>(cgh, [=]() {
-            ::cblas_ssyr(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                         (const float)alpha, accessor_x.GET_MULTI_PTR, (const int)incx,
-                         accessor_a.GET_MULTI_PTR, (const int)lda);
+        host_task<class netlib_ssyr>(queue, cgh, [=]() {
+            ::cblas_ssyr(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                         (const float)alpha, accessor_x.GET_MULTI_PTR, to_cblas_int(incx),
+                         accessor_a.GET_MULTI_PTR, to_cblas_int(lda));
         });
     });
 }
 
 void syr(sycl::queue& queue, uplo upper_lower, int64_t n, double alpha, sycl::buffer<double, 1>& x,
          int64_t incx, sycl::buffer<double, 1>& a, int64_t lda) {
+    check_cblas_ints(n, incx, lda);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
         auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_dsyr>(cgh, [=]() {
-            ::cblas_dsyr(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                         (const double)alpha, accessor_x.GET_MULTI_PTR, (const int)incx,
-                         accessor_a.GET_MULTI_PTR, (const int)lda);
+        host_task<class netlib_dsyr>(queue, cgh, [=]() {
+            ::cblas_dsyr(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                         (const double)alpha, accessor_x.GET_MULTI_PTR, to_cblas_int(incx),
+                         accessor_a.GET_MULTI_PTR, to_cblas_int(lda));
         });
     });
 }
@@ -652,15 +692,16 @@ void syr(sycl::queue& queue, uplo upper_lower, int64_t n, double alpha, sycl::bu
 void syr2(sycl::queue& queue, uplo upper_lower, int64_t n, float alpha, sycl::buffer<float, 1>& x,
           int64_t incx, sycl::buffer<float, 1>& y, int64_t incy, sycl::buffer<float, 1>& a,
           int64_t lda) {
+    check_cblas_ints(n, incx, incy, lda);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<sycl::access::mode::read>(cgh);
         auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_ssyr2>(cgh, [=]() {
-            ::cblas_ssyr2(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                          (const float)alpha, accessor_x.GET_MULTI_PTR, (const int)incx,
-                          accessor_y.GET_MULTI_PTR, (const int)incy, accessor_a.GET_MULTI_PTR,
-                          (const int)lda);
+        host_task<class netlib_ssyr2>(queue, cgh, [=]() {
+            ::cblas_ssyr2(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          (const float)alpha, accessor_x.GET_MULTI_PTR, to_cblas_int(incx),
+                          accessor_y.GET_MULTI_PTR, to_cblas_int(incy), accessor_a.GET_MULTI_PTR,
+                          to_cblas_int(lda));
         });
     });
 }
@@ -668,15 +709,16 @@ void syr2(sycl::queue& queue, uplo upper_lower, int64_t n, float alpha, sycl::bu
 void syr2(sycl::queue& queue, uplo upper_lower, int64_t n, double alpha, sycl::buffer<double, 1>& x,
           int64_t incx, sycl::buffer<double, 1>& y, int64_t incy, sycl::buffer<double, 1>& a,
           int64_t lda) {
+    check_cblas_ints(n, incx, incy, lda);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_x = x.get_access<sycl::access::mode::read>(cgh);
         auto accessor_y = y.get_access<sycl::access::mode::read>(cgh);
         auto accessor_a = a.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_dsyr2>(cgh, [=]() {
-            ::cblas_dsyr2(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                          (const double)alpha, accessor_x.GET_MULTI_PTR, (const int)incx,
-                          accessor_y.GET_MULTI_PTR, (const int)incy, accessor_a.GET_MULTI_PTR,
-                          (const int)lda);
+        host_task<class netlib_dsyr2>(queue, cgh, [=]() {
+            ::cblas_dsyr2(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          (const double)alpha, accessor_x.GET_MULTI_PTR, to_cblas_int(incx),
+                          accessor_y.GET_MULTI_PTR, to_cblas_int(incy), accessor_a.GET_MULTI_PTR,
+                          to_cblas_int(lda));
         });
     });
 }
@@ -684,14 +726,15 @@ void syr2(sycl::queue& queue, uplo upper_lower, int64_t n, double alpha, sycl::b
 void tbmv(sycl::queue& queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
           int64_t k, sycl::buffer<float, 1>& a, int64_t lda, sycl::buffer<float, 1>& x,
           int64_t incx) {
+    check_cblas_ints(n, k, lda, incx);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_stbmv>(cgh, [=]() {
+        host_task<class netlib_stbmv>(queue, cgh, [=]() {
             ::cblas_stbmv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, (const int)k,
-                          accessor_a.GET_MULTI_PTR, (const int)lda, accessor_x.GET_MULTI_PTR,
-                          (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n), to_cblas_int(k),
+                          accessor_a.GET_MULTI_PTR, to_cblas_int(lda), accessor_x.GET_MULTI_PTR,
+                          to_cblas_int(incx));
         });
     });
 }
@@ -699,14 +742,15 @@ void tbmv(sycl::queue& queue, uplo upper_lower, transpose trans, diag unit_diag,
 void tbmv(sycl::queue& queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
           int64_t k, sycl::buffer<double, 1>& a, int64_t lda, sycl::buffer<double, 1>& x,
           int64_t incx) {
+    check_cblas_ints(n, k, lda, incx);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_dtbmv>(cgh, [=]() {
+        host_task<class netlib_dtbmv>(queue, cgh, [=]() {
             ::cblas_dtbmv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, (const int)k,
-                          accessor_a.GET_MULTI_PTR, (const int)lda, accessor_x.GET_MULTI_PTR,
-                          (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n), to_cblas_int(k),
+                          accessor_a.GET_MULTI_PTR, to_cblas_int(lda), accessor_x.GET_MULTI_PTR,
+                          to_cblas_int(incx));
         });
     });
 }
@@ -714,14 +758,15 @@ void tbmv(sycl::queue& queue, uplo upper_lower, transpose trans, diag unit_diag,
 void tbmv(sycl::queue& queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
           int64_t k, sycl::buffer<std::complex<float>, 1>& a, int64_t lda,
           sycl::buffer<std::complex<float>, 1>& x, int64_t incx) {
+    check_cblas_ints(n, k, lda, incx);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_ctbmv>(cgh, [=]() {
+        host_task<class netlib_ctbmv>(queue, cgh, [=]() {
             ::cblas_ctbmv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, (const int)k,
-                          accessor_a.GET_MULTI_PTR, (const int)lda, accessor_x.GET_MULTI_PTR,
-                          (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n), to_cblas_int(k),
+                          accessor_a.GET_MULTI_PTR, to_cblas_int(lda), accessor_x.GET_MULTI_PTR,
+                          to_cblas_int(incx));
         });
     });
 }
@@ -729,14 +774,15 @@ void tbmv(sycl::queue& queue, uplo upper_lower, transpose trans, diag unit_diag,
 void tbmv(sycl::queue& queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
           int64_t k, sycl::buffer<std::complex<double>, 1>& a, int64_t lda,
           sycl::buffer<std::complex<double>, 1>& x, int64_t incx) {
+    check_cblas_ints(n, k, lda, incx);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_ztbmv>(cgh, [=]() {
+        host_task<class netlib_ztbmv>(queue, cgh, [=]() {
             ::cblas_ztbmv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, (const int)k,
-                          accessor_a.GET_MULTI_PTR, (const int)lda, accessor_x.GET_MULTI_PTR,
-                          (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n), to_cblas_int(k),
+                          accessor_a.GET_MULTI_PTR, to_cblas_int(lda), accessor_x.GET_MULTI_PTR,
+                          to_cblas_int(incx));
         });
     });
 }
@@ -744,14 +790,15 @@ void tbmv(sycl::queue& queue, uplo upper_lower, transpose trans, diag unit_diag,
 void tbsv(sycl::queue& queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
           int64_t k, sycl::buffer<float, 1>& a, int64_t lda, sycl::buffer<float, 1>& x,
           int64_t incx) {
+    check_cblas_ints(n, k, lda, incx);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_stbsv>(cgh, [=]() {
+        host_task<class netlib_stbsv>(queue, cgh, [=]() {
             ::cblas_stbsv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, (const int)k,
-                          accessor_a.GET_MULTI_PTR, (const int)lda, accessor_x.GET_MULTI_PTR,
-                          (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n), to_cblas_int(k),
+                          accessor_a.GET_MULTI_PTR, to_cblas_int(lda), accessor_x.GET_MULTI_PTR,
+                          to_cblas_int(incx));
         });
     });
 }
@@ -759,14 +806,15 @@ void tbsv(sycl::queue& queue, uplo upper_lower, transpose trans, diag unit_diag,
 void tbsv(sycl::queue& queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
           int64_t k, sycl::buffer<double, 1>& a, int64_t lda, sycl::buffer<double, 1>& x,
           int64_t incx) {
+    check_cblas_ints(n, k, lda, incx);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_dtbsv>(cgh, [=]() {
+        host_task<class netlib_dtbsv>(queue, cgh, [=]() {
             ::cblas_dtbsv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, (const int)k,
-                          accessor_a.GET_MULTI_PTR, (const int)lda, accessor_x.GET_MULTI_PTR,
-                          (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n), to_cblas_int(k),
+                          accessor_a.GET_MULTI_PTR, to_cblas_int(lda), accessor_x.GET_MULTI_PTR,
+                          to_cblas_int(incx));
         });
     });
 }
@@ -774,14 +822,15 @@ void tbsv(sycl::queue& queue, uplo upper_lower, transpose trans, diag unit_diag,
 void tbsv(sycl::queue& queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
           int64_t k, sycl::buffer<std::complex<float>, 1>& a, int64_t lda,
           sycl::buffer<std::complex<float>, 1>& x, int64_t incx) {
+    check_cblas_ints(n, k, lda, incx);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_ctbsv>(cgh, [=]() {
+        host_task<class netlib_ctbsv>(queue, cgh, [=]() {
             ::cblas_ctbsv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, (const int)k,
-                          accessor_a.GET_MULTI_PTR, (const int)lda, accessor_x.GET_MULTI_PTR,
-                          (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n), to_cblas_int(k),
+                          accessor_a.GET_MULTI_PTR, to_cblas_int(lda), accessor_x.GET_MULTI_PTR,
+                          to_cblas_int(incx));
         });
     });
 }
@@ -789,40 +838,43 @@ void tbsv(sycl::queue& queue, uplo upper_lower, transpose trans, diag unit_diag,
 void tbsv(sycl::queue& queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
           int64_t k, sycl::buffer<std::complex<double>, 1>& a, int64_t lda,
           sycl::buffer<std::complex<double>, 1>& x, int64_t incx) {
+    check_cblas_ints(n, k, lda, incx);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_ztbsv>(cgh, [=]() {
+        host_task<class netlib_ztbsv>(queue, cgh, [=]() {
             ::cblas_ztbsv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, (const int)k,
-                          accessor_a.GET_MULTI_PTR, (const int)lda, accessor_x.GET_MULTI_PTR,
-                          (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n), to_cblas_int(k),
+                          accessor_a.GET_MULTI_PTR, to_cblas_int(lda), accessor_x.GET_MULTI_PTR,
+                          to_cblas_int(incx));
         });
     });
 }
 
 void tpmv(sycl::queue& queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
           sycl::buffer<float, 1>& ap, sycl::buffer<float, 1>& x, int64_t incx) {
+    check_cblas_ints(n, incx);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_ap = ap.get_access<sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_stpmv>(cgh, [=]() {
+        host_task<class netlib_stpmv>(queue, cgh, [=]() {
             ::cblas_stpmv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, accessor_ap.GET_MULTI_PTR,
-                          accessor_x.GET_MULTI_PTR, (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n),
+                          accessor_ap.GET_MULTI_PTR, accessor_x.GET_MULTI_PTR, to_cblas_int(incx));
         });
     });
 }
 
 void tpmv(sycl::queue& queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
           sycl::buffer<double, 1>& ap, sycl::buffer<double, 1>& x, int64_t incx) {
+    check_cblas_ints(n, incx);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_ap = ap.get_access<sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_dtpmv>(cgh, [=]() {
+        host_task<class netlib_dtpmv>(queue, cgh, [=]() {
             ::cblas_dtpmv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, accessor_ap.GET_MULTI_PTR,
-                          accessor_x.GET_MULTI_PTR, (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n),
+                          accessor_ap.GET_MULTI_PTR, accessor_x.GET_MULTI_PTR, to_cblas_int(incx));
         });
     });
 }
@@ -830,13 +882,14 @@ void tpmv(sycl::queue& queue, uplo upper_lower, transpose trans, diag unit_diag,
 void tpmv(sycl::queue& queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
           sycl::buffer<std::complex<float>, 1>& ap, sycl::buffer<std::complex<float>, 1>& x,
           int64_t incx) {
+    check_cblas_ints(n, incx);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_ap = ap.get_access<sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_ctpmv>(cgh, [=]() {
+        host_task<class netlib_ctpmv>(queue, cgh, [=]() {
             ::cblas_ctpmv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, accessor_ap.GET_MULTI_PTR,
-                          accessor_x.GET_MULTI_PTR, (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n),
+                          accessor_ap.GET_MULTI_PTR, accessor_x.GET_MULTI_PTR, to_cblas_int(incx));
         });
     });
 }
@@ -844,39 +897,42 @@ void tpmv(sycl::queue& queue, uplo upper_lower, transpose trans, diag unit_diag,
 void tpmv(sycl::queue& queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
           sycl::buffer<std::complex<double>, 1>& ap, sycl::buffer<std::complex<double>, 1>& x,
           int64_t incx) {
+    check_cblas_ints(n, incx);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_ap = ap.get_access<sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_ztpmv>(cgh, [=]() {
+        host_task<class netlib_ztpmv>(queue, cgh, [=]() {
             ::cblas_ztpmv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, accessor_ap.GET_MULTI_PTR,
-                          accessor_x.GET_MULTI_PTR, (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n),
+                          accessor_ap.GET_MULTI_PTR, accessor_x.GET_MULTI_PTR, to_cblas_int(incx));
         });
     });
 }
 
 void tpsv(sycl::queue& queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
           sycl::buffer<float, 1>& ap, sycl::buffer<float, 1>& x, int64_t incx) {
+    check_cblas_ints(n, incx);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_ap = ap.get_access<sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_stpsv>(cgh, [=]() {
+        host_task<class netlib_stpsv>(queue, cgh, [=]() {
             ::cblas_stpsv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, accessor_ap.GET_MULTI_PTR,
-                          accessor_x.GET_MULTI_PTR, (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n),
+                          accessor_ap.GET_MULTI_PTR, accessor_x.GET_MULTI_PTR, to_cblas_int(incx));
         });
     });
 }
 
 void tpsv(sycl::queue& queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
           sycl::buffer<double, 1>& ap, sycl::buffer<double, 1>& x, int64_t incx) {
+    check_cblas_ints(n, incx);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_ap = ap.get_access<sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_dtpsv>(cgh, [=]() {
+        host_task<class netlib_dtpsv>(queue, cgh, [=]() {
             ::cblas_dtpsv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, accessor_ap.GET_MULTI_PTR,
-                          accessor_x.GET_MULTI_PTR, (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n),
+                          accessor_ap.GET_MULTI_PTR, accessor_x.GET_MULTI_PTR, to_cblas_int(incx));
         });
     });
 }
@@ -884,13 +940,14 @@ void tpsv(sycl::queue& queue, uplo upper_lower, transpose trans, diag unit_diag,
 void tpsv(sycl::queue& queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
           sycl::buffer<std::complex<float>, 1>& ap, sycl::buffer<std::complex<float>, 1>& x,
           int64_t incx) {
+    check_cblas_ints(n, incx);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_ap = ap.get_access<sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_ctpsv>(cgh, [=]() {
+        host_task<class netlib_ctpsv>(queue, cgh, [=]() {
             ::cblas_ctpsv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, accessor_ap.GET_MULTI_PTR,
-                          accessor_x.GET_MULTI_PTR, (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n),
+                          accessor_ap.GET_MULTI_PTR, accessor_x.GET_MULTI_PTR, to_cblas_int(incx));
         });
     });
 }
@@ -898,39 +955,44 @@ void tpsv(sycl::queue& queue, uplo upper_lower, transpose trans, diag unit_diag,
 void tpsv(sycl::queue& queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
           sycl::buffer<std::complex<double>, 1>& ap, sycl::buffer<std::complex<double>, 1>& x,
           int64_t incx) {
+    check_cblas_ints(n, incx);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_ap = ap.get_access<sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_ztpsv>(cgh, [=]() {
+        host_task<class netlib_ztpsv>(queue, cgh, [=]() {
             ::cblas_ztpsv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, accessor_ap.GET_MULTI_PTR,
-                          accessor_x.GET_MULTI_PTR, (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n),
+                          accessor_ap.GET_MULTI_PTR, accessor_x.GET_MULTI_PTR, to_cblas_int(incx));
         });
     });
 }
 
 void trmv(sycl::queue& queue, uplo upper_lower, transpose transa, diag unit_diag, int64_t n,
           sycl::buffer<float, 1>& a, int64_t lda, sycl::buffer<float, 1>& b, int64_t incx) {
+    check_cblas_ints(n, lda, incx);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_strmv>(cgh, [=]() {
+        host_task<class netlib_strmv>(queue, cgh, [=]() {
             ::cblas_strmv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)n, accessor_a.GET_MULTI_PTR,
-                          (const int)lda, accessor_b.GET_MULTI_PTR, (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n),
+                          accessor_a.GET_MULTI_PTR, to_cblas_int(lda), accessor_b.GET_MULTI_PTR,
+                          to_cblas_int(incx));
         });
     });
 }
 
 void trmv(sycl::queue& queue, uplo upper_lower, transpose transa, diag unit_diag, int64_t n,
           sycl::buffer<double, 1>& a, int64_t lda, sycl::buffer<double, 1>& b, int64_t incx) {
+    check_cblas_ints(n, lda, incx);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_dtrmv>(cgh, [=]() {
+        host_task<class netlib_dtrmv>(queue, cgh, [=]() {
             ::cblas_dtrmv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)n, accessor_a.GET_MULTI_PTR,
-                          (const int)lda, accessor_b.GET_MULTI_PTR, (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n),
+                          accessor_a.GET_MULTI_PTR, to_cblas_int(lda), accessor_b.GET_MULTI_PTR,
+                          to_cblas_int(incx));
         });
     });
 }
@@ -938,13 +1000,15 @@ void trmv(sycl::queue& queue, uplo upper_lower, transpose transa, diag unit_diag
 void trmv(sycl::queue& queue, uplo upper_lower, transpose transa, diag unit_diag, int64_t n,
           sycl::buffer<std::complex<float>, 1>& a, int64_t lda,
           sycl::buffer<std::complex<float>, 1>& b, int64_t incx) {
+    check_cblas_ints(n, lda, incx);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_ctrmv>(cgh, [=]() {
+        host_task<class netlib_ctrmv>(queue, cgh, [=]() {
             ::cblas_ctrmv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)n, accessor_a.GET_MULTI_PTR,
-                          (const int)lda, accessor_b.GET_MULTI_PTR, (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n),
+                          accessor_a.GET_MULTI_PTR, to_cblas_int(lda), accessor_b.GET_MULTI_PTR,
+                          to_cblas_int(incx));
         });
     });
 }
@@ -952,39 +1016,45 @@ void trmv(sycl::queue& queue, uplo upper_lower, transpose transa, diag unit_diag
 void trmv(sycl::queue& queue, uplo upper_lower, transpose transa, diag unit_diag, int64_t n,
           sycl::buffer<std::complex<double>, 1>& a, int64_t lda,
           sycl::buffer<std::complex<double>, 1>& b, int64_t incx) {
+    check_cblas_ints(n, lda, incx);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_ztrmv>(cgh, [=]() {
+        host_task<class netlib_ztrmv>(queue, cgh, [=]() {
             ::cblas_ztrmv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)n, accessor_a.GET_MULTI_PTR,
-                          (const int)lda, accessor_b.GET_MULTI_PTR, (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n),
+                          accessor_a.GET_MULTI_PTR, to_cblas_int(lda), accessor_b.GET_MULTI_PTR,
+                          to_cblas_int(incx));
         });
     });
 }
 
 void trsv(sycl::queue& queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
           sycl::buffer<float, 1>& a, int64_t lda, sycl::buffer<float, 1>& x, int64_t incx) {
+    check_cblas_ints(n, lda, incx);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_strsv>(cgh, [=]() {
+        host_task<class netlib_strsv>(queue, cgh, [=]() {
             ::cblas_strsv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, accessor_a.GET_MULTI_PTR,
-                          (const int)lda, accessor_x.GET_MULTI_PTR, (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n),
+                          accessor_a.GET_MULTI_PTR, to_cblas_int(lda), accessor_x.GET_MULTI_PTR,
+                          to_cblas_int(incx));
         });
     });
 }
 
 void trsv(sycl::queue& queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
           sycl::buffer<double, 1>& a, int64_t lda, sycl::buffer<double, 1>& x, int64_t incx) {
+    check_cblas_ints(n, lda, incx);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_dtrsv>(cgh, [=]() {
+        host_task<class netlib_dtrsv>(queue, cgh, [=]() {
             ::cblas_dtrsv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, accessor_a.GET_MULTI_PTR,
-                          (const int)lda, accessor_x.GET_MULTI_PTR, (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n),
+                          accessor_a.GET_MULTI_PTR, to_cblas_int(lda), accessor_x.GET_MULTI_PTR,
+                          to_cblas_int(incx));
         });
     });
 }
@@ -992,13 +1062,15 @@ void trsv(sycl::queue& queue, uplo upper_lower, transpose trans, diag unit_diag,
 void trsv(sycl::queue& queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
           sycl::buffer<std::complex<float>, 1>& a, int64_t lda,
           sycl::buffer<std::complex<float>, 1>& x, int64_t incx) {
+    check_cblas_ints(n, lda, incx);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_ctrsv>(cgh, [=]() {
+        host_task<class netlib_ctrsv>(queue, cgh, [=]() {
             ::cblas_ctrsv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, accessor_a.GET_MULTI_PTR,
-                          (const int)lda, accessor_x.GET_MULTI_PTR, (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n),
+                          accessor_a.GET_MULTI_PTR, to_cblas_int(lda), accessor_x.GET_MULTI_PTR,
+                          to_cblas_int(incx));
         });
     });
 }
@@ -1006,13 +1078,15 @@ void trsv(sycl::queue& queue, uplo upper_lower, transpose trans, diag unit_diag,
 void trsv(sycl::queue& queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
           sycl::buffer<std::complex<double>, 1>& a, int64_t lda,
           sycl::buffer<std::complex<double>, 1>& x, int64_t incx) {
+    check_cblas_ints(n, lda, incx);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
         auto accessor_x = x.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_ztrsv>(cgh, [=]() {
+        host_task<class netlib_ztrsv>(queue, cgh, [=]() {
             ::cblas_ztrsv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, accessor_a.GET_MULTI_PTR,
-                          (const int)lda, accessor_x.GET_MULTI_PTR, (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n),
+                          accessor_a.GET_MULTI_PTR, to_cblas_int(lda), accessor_x.GET_MULTI_PTR,
+                          to_cblas_int(incx));
         });
     });
 }
@@ -1022,15 +1096,17 @@ void trsv(sycl::queue& queue, uplo upper_lower, transpose trans, diag unit_diag,
 sycl::event gbmv(sycl::queue& queue, transpose trans, int64_t m, int64_t n, int64_t kl, int64_t ku,
                  float alpha, const float* a, int64_t lda, const float* x, int64_t incx, float beta,
                  float* y, int64_t incy, const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(m, n, kl, ku, lda, incx, incy);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_sgbmv_usm>(cgh, [=]() {
-            ::cblas_sgbmv(MAJOR, convert_to_cblas_trans(trans), (const int)m, (const int)n,
-                          (const int)kl, (const int)ku, (const float)alpha, a, (const int)lda, x,
-                          (const int)incx, (const float)beta, y, (const int)incy);
+        host_task<class netlib_sgbmv_usm>(queue, cgh, [=]() {
+            ::cblas_sgbmv(MAJOR, convert_to_cblas_trans(trans), to_cblas_int(m), to_cblas_int(n),
+                          to_cblas_int(kl), to_cblas_int(ku), (const float)alpha, a,
+                          to_cblas_int(lda), x, to_cblas_int(incx), (const float)beta, y,
+                          to_cblas_int(incy));
         });
     });
     return done;
@@ -1040,15 +1116,17 @@ sycl::event gbmv(sycl::queue& queue, transpose trans, int64_t m, int64_t n, int6
                  double alpha, const double* a, int64_t lda, const double* x, int64_t incx,
                  double beta, double* y, int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(m, n, kl, ku, lda, incx, incy);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_dgbmv_usm>(cgh, [=]() {
-            ::cblas_dgbmv(MAJOR, convert_to_cblas_trans(trans), (const int)m, (const int)n,
-                          (const int)kl, (const int)ku, (const double)alpha, a, (const int)lda, x,
-                          (const int)incx, (const double)beta, y, (const int)incy);
+        host_task<class netlib_dgbmv_usm>(queue, cgh, [=]() {
+            ::cblas_dgbmv(MAJOR, convert_to_cblas_trans(trans), to_cblas_int(m), to_cblas_int(n),
+                          to_cblas_int(kl), to_cblas_int(ku), (const double)alpha, a,
+                          to_cblas_int(lda), x, to_cblas_int(incx), (const double)beta, y,
+                          to_cblas_int(incy));
         });
     });
     return done;
@@ -1059,15 +1137,17 @@ sycl::event gbmv(sycl::queue& queue, transpose trans, int64_t m, int64_t n, int6
                  const std::complex<float>* x, int64_t incx, std::complex<float> beta,
                  std::complex<float>* y, int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(m, n, kl, ku, lda, incx, incy);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_cgbmv_usm>(cgh, [=]() {
-            ::cblas_cgbmv(MAJOR, convert_to_cblas_trans(trans), (const int)m, (const int)n,
-                          (const int)kl, (const int)ku, (const void*)&alpha, a, (const int)lda, x,
-                          (const int)incx, (const void*)&beta, y, (const int)incy);
+        host_task<class netlib_cgbmv_usm>(queue, cgh, [=]() {
+            ::cblas_cgbmv(MAJOR, convert_to_cblas_trans(trans), to_cblas_int(m), to_cblas_int(n),
+                          to_cblas_int(kl), to_cblas_int(ku), (const void*)&alpha, a,
+                          to_cblas_int(lda), x, to_cblas_int(incx), (const void*)&beta, y,
+                          to_cblas_int(incy));
         });
     });
     return done;
@@ -1078,15 +1158,17 @@ sycl::event gbmv(sycl::queue& queue, transpose trans, int64_t m, int64_t n, int6
                  const std::complex<double>* x, int64_t incx, std::complex<double> beta,
                  std::complex<double>* y, int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(m, n, kl, ku, lda, incx, incy);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_zgbmv_usm>(cgh, [=]() {
-            ::cblas_zgbmv(MAJOR, convert_to_cblas_trans(trans), (const int)m, (const int)n,
-                          (const int)kl, (const int)ku, (const void*)&alpha, a, (const int)lda, x,
-                          (const int)incx, (const void*)&beta, y, (const int)incy);
+        host_task<class netlib_zgbmv_usm>(queue, cgh, [=]() {
+            ::cblas_zgbmv(MAJOR, convert_to_cblas_trans(trans), to_cblas_int(m), to_cblas_int(n),
+                          to_cblas_int(kl), to_cblas_int(ku), (const void*)&alpha, a,
+                          to_cblas_int(lda), x, to_cblas_int(incx), (const void*)&beta, y,
+                          to_cblas_int(incy));
         });
     });
     return done;
@@ -1095,15 +1177,16 @@ sycl::event gbmv(sycl::queue& queue, transpose trans, int64_t m, int64_t n, int6
 sycl::event gemv(sycl::queue& queue, transpose trans, int64_t m, int64_t n, float alpha,
                  const float* a, int64_t lda, const float* x, int64_t incx, float beta, float* y,
                  int64_t incy, const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(m, n, lda, incx, incy);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_sgemv_usm>(cgh, [=]() {
-            ::cblas_sgemv(MAJOR, convert_to_cblas_trans(trans), (const int)m, (const int)n,
-                          (const float)alpha, a, (const int)lda, x, (const int)incx,
-                          (const float)beta, y, (const int)incy);
+        host_task<class netlib_sgemv_usm>(queue, cgh, [=]() {
+            ::cblas_sgemv(MAJOR, convert_to_cblas_trans(trans), to_cblas_int(m), to_cblas_int(n),
+                          (const float)alpha, a, to_cblas_int(lda), x, to_cblas_int(incx),
+                          (const float)beta, y, to_cblas_int(incy));
         });
     });
     return done;
@@ -1112,15 +1195,16 @@ sycl::event gemv(sycl::queue& queue, transpose trans, int64_t m, int64_t n, floa
 sycl::event gemv(sycl::queue& queue, transpose trans, int64_t m, int64_t n, double alpha,
                  const double* a, int64_t lda, const double* x, int64_t incx, double beta,
                  double* y, int64_t incy, const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(m, n, lda, incx, incy);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_dgemv_usm>(cgh, [=]() {
-            ::cblas_dgemv(MAJOR, convert_to_cblas_trans(trans), (const int)m, (const int)n,
-                          (const double)alpha, a, (const int)lda, x, (const int)incx,
-                          (const double)beta, y, (const int)incy);
+        host_task<class netlib_dgemv_usm>(queue, cgh, [=]() {
+            ::cblas_dgemv(MAJOR, convert_to_cblas_trans(trans), to_cblas_int(m), to_cblas_int(n),
+                          (const double)alpha, a, to_cblas_int(lda), x, to_cblas_int(incx),
+                          (const double)beta, y, to_cblas_int(incy));
         });
     });
     return done;
@@ -1131,15 +1215,16 @@ sycl::event gemv(sycl::queue& queue, transpose trans, int64_t m, int64_t n,
                  const std::complex<float>* x, int64_t incx, std::complex<float> beta,
                  std::complex<float>* y, int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(m, n, lda, incx, incy);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_cgemv_usm>(cgh, [=]() {
-            ::cblas_cgemv(MAJOR, convert_to_cblas_trans(trans), (const int)m, (const int)n,
-                          (const void*)&alpha, a, (const int)lda, x, (const int)incx,
-                          (const void*)&beta, y, (const int)incy);
+        host_task<class netlib_cgemv_usm>(queue, cgh, [=]() {
+            ::cblas_cgemv(MAJOR, convert_to_cblas_trans(trans), to_cblas_int(m), to_cblas_int(n),
+                          (const void*)&alpha, a, to_cblas_int(lda), x, to_cblas_int(incx),
+                          (const void*)&beta, y, to_cblas_int(incy));
         });
     });
     return done;
@@ -1150,15 +1235,16 @@ sycl::event gemv(sycl::queue& queue, transpose trans, int64_t m, int64_t n,
                  const std::complex<double>* x, int64_t incx, std::complex<double> beta,
                  std::complex<double>* y, int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(m, n, lda, incx, incy);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_zgemv_usm>(cgh, [=]() {
-            ::cblas_zgemv(MAJOR, convert_to_cblas_trans(trans), (const int)m, (const int)n,
-                          (const void*)&alpha, a, (const int)lda, x, (const int)incx,
-                          (const void*)&beta, y, (const int)incy);
+        host_task<class netlib_zgemv_usm>(queue, cgh, [=]() {
+            ::cblas_zgemv(MAJOR, convert_to_cblas_trans(trans), to_cblas_int(m), to_cblas_int(n),
+                          (const void*)&alpha, a, to_cblas_int(lda), x, to_cblas_int(incx),
+                          (const void*)&beta, y, to_cblas_int(incy));
         });
     });
     return done;
@@ -1167,14 +1253,15 @@ sycl::event gemv(sycl::queue& queue, transpose trans, int64_t m, int64_t n,
 sycl::event ger(sycl::queue& queue, int64_t m, int64_t n, float alpha, const float* x, int64_t incx,
                 const float* y, int64_t incy, float* a, int64_t lda,
                 const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(m, n, incx, incy, lda);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_sger_usm>(cgh, [=]() {
-            ::cblas_sger(MAJOR, (const int)m, (const int)n, (const float)alpha, x, (const int)incx,
-                         y, (const int)incy, a, (const int)lda);
+        host_task<class netlib_sger_usm>(queue, cgh, [=]() {
+            ::cblas_sger(MAJOR, to_cblas_int(m), to_cblas_int(n), (const float)alpha, x,
+                         to_cblas_int(incx), y, to_cblas_int(incy), a, to_cblas_int(lda));
         });
     });
     return done;
@@ -1183,14 +1270,15 @@ sycl::event ger(sycl::queue& queue, int64_t m, int64_t n, float alpha, const flo
 sycl::event ger(sycl::queue& queue, int64_t m, int64_t n, double alpha, const double* x,
                 int64_t incx, const double* y, int64_t incy, double* a, int64_t lda,
                 const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(m, n, incx, incy, lda);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_dger_usm>(cgh, [=]() {
-            ::cblas_dger(MAJOR, (const int)m, (const int)n, (const double)alpha, x, (const int)incx,
-                         y, (const int)incy, a, (const int)lda);
+        host_task<class netlib_dger_usm>(queue, cgh, [=]() {
+            ::cblas_dger(MAJOR, to_cblas_int(m), to_cblas_int(n), (const double)alpha, x,
+                         to_cblas_int(incx), y, to_cblas_int(incy), a, to_cblas_int(lda));
         });
     });
     return done;
@@ -1200,14 +1288,15 @@ sycl::event gerc(sycl::queue& queue, int64_t m, int64_t n, std::complex<float> a
                  const std::complex<float>* x, int64_t incx, const std::complex<float>* y,
                  int64_t incy, std::complex<float>* a, int64_t lda,
                  const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(m, n, incx, incy, lda);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_cgerc_usm>(cgh, [=]() {
-            ::cblas_cgerc(MAJOR, (const int)m, (const int)n, (const void*)&alpha, x,
-                          (const int)incx, y, (const int)incy, a, (const int)lda);
+        host_task<class netlib_cgerc_usm>(queue, cgh, [=]() {
+            ::cblas_cgerc(MAJOR, to_cblas_int(m), to_cblas_int(n), (const void*)&alpha, x,
+                          to_cblas_int(incx), y, to_cblas_int(incy), a, to_cblas_int(lda));
         });
     });
     return done;
@@ -1217,14 +1306,15 @@ sycl::event gerc(sycl::queue& queue, int64_t m, int64_t n, std::complex<double>
                  const std::complex<double>* x, int64_t incx, const std::complex<double>* y,
                  int64_t incy, std::complex<double>* a, int64_t lda,
                  const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(m, n, incx, incy, lda);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_zgerc_usm>(cgh, [=]() {
-            ::cblas_zgerc(MAJOR, (const int)m, (const int)n, (const void*)&alpha, x,
-                          (const int)incx, y, (const int)incy, a, (const int)lda);
+        host_task<class netlib_zgerc_usm>(queue, cgh, [=]() {
+            ::cblas_zgerc(MAJOR, to_cblas_int(m), to_cblas_int(n), (const void*)&alpha, x,
+                          to_cblas_int(incx), y, to_cblas_int(incy), a, to_cblas_int(lda));
         });
     });
     return done;
@@ -1234,14 +1324,15 @@ sycl::event geru(sycl::queue& queue, int64_t m, int64_t n, std::complex<float> a
                  const std::complex<float>* x, int64_t incx, const std::complex<float>* y,
                  int64_t incy, std::complex<float>* a, int64_t lda,
                  const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(m, n, incx, incy, lda);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_cgeru_usm>(cgh, [=]() {
-            ::cblas_cgeru(MAJOR, (const int)m, (const int)n, (const void*)&alpha, x,
-                          (const int)incx, y, (const int)incy, a, (const int)lda);
+        host_task<class netlib_cgeru_usm>(queue, cgh, [=]() {
+            ::cblas_cgeru(MAJOR, to_cblas_int(m), to_cblas_int(n), (const void*)&alpha, x,
+                          to_cblas_int(incx), y, to_cblas_int(incy), a, to_cblas_int(lda));
         });
     });
     return done;
@@ -1251,14 +1342,15 @@ sycl::event geru(sycl::queue& queue, int64_t m, int64_t n, std::complex<double>
                  const std::complex<double>* x, int64_t incx, const std::complex<double>* y,
                  int64_t incy, std::complex<double>* a, int64_t lda,
                  const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(m, n, incx, incy, lda);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_zgeru_usm>(cgh, [=]() {
-            ::cblas_zgeru(MAJOR, (const int)m, (const int)n, (const void*)&alpha, x,
-                          (const int)incx, y, (const int)incy, a, (const int)lda);
+        host_task<class netlib_zgeru_usm>(queue, cgh, [=]() {
+            ::cblas_zgeru(MAJOR, to_cblas_int(m), to_cblas_int(n), (const void*)&alpha, x,
+                          to_cblas_int(incx), y, to_cblas_int(incy), a, to_cblas_int(lda));
         });
     });
     return done;
@@ -1269,15 +1361,16 @@ sycl::event hbmv(sycl::queue& queue, uplo upper_lower, int64_t n, int64_t k,
                  const std::complex<float>* x, int64_t incx, std::complex<float> beta,
                  std::complex<float>* y, int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(n, k, lda, incx, incy);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_chbmv_usm>(cgh, [=]() {
-            ::cblas_chbmv(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n, (const int)k,
-                          (const void*)&alpha, a, (const int)lda, x, (const int)incx,
-                          (const void*)&beta, y, (const int)incy);
+        host_task<class netlib_chbmv_usm>(queue, cgh, [=]() {
+            ::cblas_chbmv(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          to_cblas_int(k), (const void*)&alpha, a, to_cblas_int(lda), x,
+                          to_cblas_int(incx), (const void*)&beta, y, to_cblas_int(incy));
         });
     });
     return done;
@@ -1288,15 +1381,16 @@ sycl::event hbmv(sycl::queue& queue, uplo upper_lower, int64_t n, int64_t k,
                  const std::complex<double>* x, int64_t incx, std::complex<double> beta,
                  std::complex<double>* y, int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(n, k, lda, incx, incy);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_zhbmv_usm>(cgh, [=]() {
-            ::cblas_zhbmv(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n, (const int)k,
-                          (const void*)&alpha, a, (const int)lda, x, (const int)incx,
-                          (const void*)&beta, y, (const int)incy);
+        host_task<class netlib_zhbmv_usm>(queue, cgh, [=]() {
+            ::cblas_zhbmv(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          to_cblas_int(k), (const void*)&alpha, a, to_cblas_int(lda), x,
+                          to_cblas_int(incx), (const void*)&beta, y, to_cblas_int(incy));
         });
     });
     return done;
@@ -1306,15 +1400,16 @@ sycl::event hemv(sycl::queue& queue, uplo upper_lower, int64_t n, std::complex<f
                  const std::complex<float>* a, int64_t lda, const std::complex<float>* x,
                  int64_t incx, std::complex<float> beta, std::complex<float>* y, int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(n, lda, incx, incy);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_chemv_usm>(cgh, [=]() {
-            ::cblas_chemv(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                          (const void*)&alpha, a, (const int)lda, x, (const int)incx,
-                          (const void*)&beta, y, (const int)incy);
+        host_task<class netlib_chemv_usm>(queue, cgh, [=]() {
+            ::cblas_chemv(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          (const void*)&alpha, a, to_cblas_int(lda), x, to_cblas_int(incx),
+                          (const void*)&beta, y, to_cblas_int(incy));
         });
     });
     return done;
@@ -1324,15 +1419,16 @@ sycl::event hemv(sycl::queue& queue, uplo upper_lower, int64_t n, std::complex<d
                  const std::complex<double>* a, int64_t lda, const std::complex<double>* x,
                  int64_t incx, std::complex<double> beta, std::complex<double>* y, int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(n, lda, incx, incy);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_zhemv_usm>(cgh, [=]() {
-            ::cblas_zhemv(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                          (const void*)&alpha, a, (const int)lda, x, (const int)incx,
-                          (const void*)&beta, y, (const int)incy);
+        host_task<class netlib_zhemv_usm>(queue, cgh, [=]() {
+            ::cblas_zhemv(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          (const void*)&alpha, a, to_cblas_int(lda), x, to_cblas_int(incx),
+                          (const void*)&beta, y, to_cblas_int(incy));
         });
     });
     return done;
@@ -1341,14 +1437,15 @@ sycl::event hemv(sycl::queue& queue, uplo upper_lower, int64_t n, std::complex<d
 sycl::event her(sycl::queue& queue, uplo upper_lower, int64_t n, float alpha,
                 const std::complex<float>* x, int64_t incx, std::complex<float>* a, int64_t lda,
                 const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(n, incx, lda);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_cher_usm>(cgh, [=]() {
-            ::cblas_cher(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                         (const float)alpha, x, (const int)incx, a, (const int)lda);
+        host_task<class netlib_cher_usm>(queue, cgh, [=]() {
+            ::cblas_cher(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                         (const float)alpha, x, to_cblas_int(incx), a, to_cblas_int(lda));
         });
     });
     return done;
@@ -1357,14 +1454,15 @@ sycl::event her(sycl::queue& queue, uplo upper_lower, int64_t n, float alpha,
 sycl::event her(sycl::queue& queue, uplo upper_lower, int64_t n, double alpha,
                 const std::complex<double>* x, int64_t incx, std::complex<double>* a, int64_t lda,
                 const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(n, incx, lda);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_zher_usm>(cgh, [=]() {
-            ::cblas_zher(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                         (const double)alpha, x, (const int)incx, a, (const int)lda);
+        host_task<class netlib_zher_usm>(queue, cgh, [=]() {
+            ::cblas_zher(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                         (const double)alpha, x, to_cblas_int(incx), a, to_cblas_int(lda));
         });
     });
     return done;
@@ -1374,15 +1472,16 @@ sycl::event her2(sycl::queue& queue, uplo upper_lower, int64_t n, std::complex<f
                  const std::complex<float>* x, int64_t incx, const std::complex<float>* y,
                  int64_t incy, std::complex<float>* a, int64_t lda,
                  const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(n, incx, incy, lda);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_cher2_usm>(cgh, [=]() {
-            ::cblas_cher2(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                          (const void*)&alpha, x, (const int)incx, y, (const int)incy, a,
-                          (const int)lda);
+        host_task<class netlib_cher2_usm>(queue, cgh, [=]() {
+            ::cblas_cher2(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          (const void*)&alpha, x, to_cblas_int(incx), y, to_cblas_int(incy), a,
+                          to_cblas_int(lda));
         });
     });
     return done;
@@ -1392,15 +1491,16 @@ sycl::event her2(sycl::queue& queue, uplo upper_lower, int64_t n, std::complex<d
                  const std::complex<double>* x, int64_t incx, const std::complex<double>* y,
                  int64_t incy, std::complex<double>* a, int64_t lda,
                  const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(n, incx, incy, lda);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_zher2_usm>(cgh, [=]() {
-            ::cblas_zher2(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                          (const void*)&alpha, x, (const int)incx, y, (const int)incy, a,
-                          (const int)lda);
+        host_task<class netlib_zher2_usm>(queue, cgh, [=]() {
+            ::cblas_zher2(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          (const void*)&alpha, x, to_cblas_int(incx), y, to_cblas_int(incy), a,
+                          to_cblas_int(lda));
         });
     });
     return done;
@@ -1410,15 +1510,16 @@ sycl::event hpmv(sycl::queue& queue, uplo upper_lower, int64_t n, std::complex<f
                  const std::complex<float>* ap, const std::complex<float>* x, int64_t incx,
                  std::complex<float> beta, std::complex<float>* y, int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(n, incx, incy);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_chpmv_usm>(cgh, [=]() {
-            ::cblas_chpmv(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                          (const void*)&alpha, ap, x, (const int)incx, (const void*)&beta, y,
-                          (const int)incy);
+        host_task<class netlib_chpmv_usm>(queue, cgh, [=]() {
+            ::cblas_chpmv(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          (const void*)&alpha, ap, x, to_cblas_int(incx), (const void*)&beta, y,
+                          to_cblas_int(incy));
         });
     });
     return done;
@@ -1428,15 +1529,16 @@ sycl::event hpmv(sycl::queue& queue, uplo upper_lower, int64_t n, std::complex<d
                  const std::complex<double>* ap, const std::complex<double>* x, int64_t incx,
                  std::complex<double> beta, std::complex<double>* y, int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(n, incx, incy);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_zhpmv_usm>(cgh, [=]() {
-            ::cblas_zhpmv(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                          (const void*)&alpha, ap, x, (const int)incx, (const void*)&beta, y,
-                          (const int)incy);
+        host_task<class netlib_zhpmv_usm>(queue, cgh, [=]() {
+            ::cblas_zhpmv(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          (const void*)&alpha, ap, x, to_cblas_int(incx), (const void*)&beta, y,
+                          to_cblas_int(incy));
         });
     });
     return done;
@@ -1445,14 +1547,15 @@ sycl::event hpmv(sycl::queue& queue, uplo upper_lower, int64_t n, std::complex<d
 sycl::event hpr(sycl::queue& queue, uplo upper_lower, int64_t n, float alpha,
                 const std::complex<float>* x, int64_t incx, std::complex<float>* ap,
                 const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(n, incx);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_chpr_usm>(cgh, [=]() {
-            ::cblas_chpr(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                         (const float)alpha, x, (const int)incx, ap);
+        host_task<class netlib_chpr_usm>(queue, cgh, [=]() {
+            ::cblas_chpr(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                         (const float)alpha, x, to_cblas_int(incx), ap);
         });
     });
     return done;
@@ -1461,14 +1564,15 @@ sycl::event hpr(sycl::queue& queue, uplo upper_lower, int64_t n, float alpha,
 sycl::event hpr(sycl::queue& queue, uplo upper_lower, int64_t n, double alpha,
                 const std::complex<double>* x, int64_t incx, std::complex<double>* ap,
                 const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(n, incx);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_zhpr_usm>(cgh, [=]() {
-            ::cblas_zhpr(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                         (const double)alpha, x, (const int)incx, ap);
+        host_task<class netlib_zhpr_usm>(queue, cgh, [=]() {
+            ::cblas_zhpr(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                         (const double)alpha, x, to_cblas_int(incx), ap);
         });
     });
     return done;
@@ -1478,14 +1582,15 @@ sycl::event hpr2(sycl::queue& queue, uplo upper_lower, int64_t n, std::complex<f
                  const std::complex<float>* x, int64_t incx, const std::complex<float>* y,
                  int64_t incy, std::complex<float>* ap,
                  const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(n, incx, incy);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_chpr2_usm>(cgh, [=]() {
-            ::cblas_chpr2(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                          (const void*)&alpha, x, (const int)incx, y, (const int)incy, ap);
+        host_task<class netlib_chpr2_usm>(queue, cgh, [=]() {
+            ::cblas_chpr2(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          (const void*)&alpha, x, to_cblas_int(incx), y, to_cblas_int(incy), ap);
         });
     });
     return done;
@@ -1495,14 +1600,15 @@ sycl::event hpr2(sycl::queue& queue, uplo upper_lower, int64_t n, std::complex<d
                  const std::complex<double>* x, int64_t incx, const std::complex<double>* y,
                  int64_t incy, std::complex<double>* ap,
                  const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(n, incx, incy);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_zhpr2_usm>(cgh, [=]() {
-            ::cblas_zhpr2(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                          (const void*)&alpha, x, (const int)incx, y, (const int)incy, ap);
+        host_task<class netlib_zhpr2_usm>(queue, cgh, [=]() {
+            ::cblas_zhpr2(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          (const void*)&alpha, x, to_cblas_int(incx), y, to_cblas_int(incy), ap);
         });
     });
     return done;
@@ -1511,15 +1617,16 @@ sycl::event hpr2(sycl::queue& queue, uplo upper_lower, int64_t n, std::complex<d
 sycl::event sbmv(sycl::queue& queue, uplo upper_lower, int64_t n, int64_t k, float alpha,
                  const float* a, int64_t lda, const float* x, int64_t incx, float beta, float* y,
                  int64_t incy, const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(n, k, lda, incx, incy);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_ssbmv_usm>(cgh, [=]() {
-            ::cblas_ssbmv(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n, (const int)k,
-                          (const float)alpha, a, (const int)lda, x, (const int)incx,
-                          (const float)beta, y, (const int)incy);
+        host_task<class netlib_ssbmv_usm>(queue, cgh, [=]() {
+            ::cblas_ssbmv(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          to_cblas_int(k), (const float)alpha, a, to_cblas_int(lda), x,
+                          to_cblas_int(incx), (const float)beta, y, to_cblas_int(incy));
         });
     });
     return done;
@@ -1528,15 +1635,16 @@ sycl::event sbmv(sycl::queue& queue, uplo upper_lower, int64_t n, int64_t k, flo
 sycl::event sbmv(sycl::queue& queue, uplo upper_lower, int64_t n, int64_t k, double alpha,
                  const double* a, int64_t lda, const double* x, int64_t incx, double beta,
                  double* y, int64_t incy, const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(n, k, lda, incx, incy);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_dsbmv_usm>(cgh, [=]() {
-            ::cblas_dsbmv(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n, (const int)k,
-                          (const double)alpha, a, (const int)lda, x, (const int)incx,
-                          (const double)beta, y, (const int)incy);
+        host_task<class netlib_dsbmv_usm>(queue, cgh, [=]() {
+            ::cblas_dsbmv(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          to_cblas_int(k), (const double)alpha, a, to_cblas_int(lda), x,
+                          to_cblas_int(incx), (const double)beta, y, to_cblas_int(incy));
         });
     });
     return done;
@@ -1545,15 +1653,16 @@ sycl::event sbmv(sycl::queue& queue, uplo upper_lower, int64_t n, int64_t k, dou
 sycl::event spmv(sycl::queue& queue, uplo upper_lower, int64_t n, float alpha, const float* ap,
                  const float* x, int64_t incx, float beta, float* y, int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(n, incx, incy);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_sspmv_usm>(cgh, [=]() {
-            ::cblas_sspmv(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                          (const float)alpha, ap, x, (const int)incx, (const float)beta, y,
-                          (const int)incy);
+        host_task<class netlib_sspmv_usm>(queue, cgh, [=]() {
+            ::cblas_sspmv(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          (const float)alpha, ap, x, to_cblas_int(incx), (const float)beta, y,
+                          to_cblas_int(incy));
         });
     });
     return done;
@@ -1562,15 +1671,16 @@ sycl::event spmv(sycl::queue& queue, uplo upper_lower, int64_t n, float alpha, c
 sycl::event spmv(sycl::queue& queue, uplo upper_lower, int64_t n, double alpha, const double* ap,
                  const double* x, int64_t incx, double beta, double* y, int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(n, incx, incy);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_dspmv_usm>(cgh, [=]() {
-            ::cblas_dspmv(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                          (const double)alpha, ap, x, (const int)incx, (const double)beta, y,
-                          (const int)incy);
+        host_task<class netlib_dspmv_usm>(queue, cgh, [=]() {
+            ::cblas_dspmv(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          (const double)alpha, ap, x, to_cblas_int(incx), (const double)beta, y,
+                          to_cblas_int(incy));
         });
     });
     return done;
@@ -1578,14 +1688,15 @@ sycl::event spmv(sycl::queue& queue, uplo upper_lower, int64_t n, double alpha,
 
 sycl::event spr(sycl::queue& queue, uplo upper_lower, int64_t n, float alpha, const float* x,
                 int64_t incx, float* ap, const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(n, incx);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_sspr_usm>(cgh, [=]() {
-            ::cblas_sspr(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                         (const float)alpha, x, (const int)incx, ap);
+        host_task<class netlib_sspr_usm>(queue, cgh, [=]() {
+            ::cblas_sspr(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                         (const float)alpha, x, to_cblas_int(incx), ap);
         });
     });
     return done;
@@ -1593,14 +1704,15 @@ sycl::event spr(sycl::queue& queue, uplo upper_lower, int64_t n, float alpha, co
 
 sycl::event spr(sycl::queue& queue, uplo upper_lower, int64_t n, double alpha, const double* x,
                 int64_t incx, double* ap, const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(n, incx);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_dspr_usm>(cgh, [=]() {
-            ::cblas_dspr(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                         (const double)alpha, x, (const int)incx, ap);
+        host_task<class netlib_dspr_usm>(queue, cgh, [=]() {
+            ::cblas_dspr(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                         (const double)alpha, x, to_cblas_int(incx), ap);
         });
     });
     return done;
@@ -1609,14 +1721,15 @@ sycl::event spr(sycl::queue& queue, uplo upper_lower, int64_t n, double alpha, c
 sycl::event spr2(sycl::queue& queue, uplo upper_lower, int64_t n, float alpha, const float* x,
                  int64_t incx, const float* y, int64_t incy, float* ap,
                  const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(n, incx, incy);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_sspr2_usm>(cgh, [=]() {
-            ::cblas_sspr2(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                          (const float)alpha, x, (const int)incx, y, (const int)incy, ap);
+        host_task<class netlib_sspr2_usm>(queue, cgh, [=]() {
+            ::cblas_sspr2(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          (const float)alpha, x, to_cblas_int(incx), y, to_cblas_int(incy), ap);
         });
     });
     return done;
@@ -1625,14 +1738,15 @@ sycl::event spr2(sycl::queue& queue, uplo upper_lower, int64_t n, float alpha, c
 sycl::event spr2(sycl::queue& queue, uplo upper_lower, int64_t n, double alpha, const double* x,
                  int64_t incx, const double* y, int64_t incy, double* ap,
                  const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(n, incx, incy);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_dspr2_usm>(cgh, [=]() {
-            ::cblas_dspr2(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                          (const double)alpha, x, (const int)incx, y, (const int)incy, ap);
+        host_task<class netlib_dspr2_usm>(queue, cgh, [=]() {
+            ::cblas_dspr2(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          (const double)alpha, x, to_cblas_int(incx), y, to_cblas_int(incy), ap);
         });
     });
     return done;
@@ -1641,15 +1755,16 @@ sycl::event spr2(sycl::queue& queue, uplo upper_lower, int64_t n, double alpha,
 sycl::event symv(sycl::queue& queue, uplo upper_lower, int64_t n, float alpha, const float* a,
                  int64_t lda, const float* x, int64_t incx, float beta, float* y, int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(n, lda, incx, incy);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_ssymv_usm>(cgh, [=]() {
-            ::cblas_ssymv(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                          (const float)alpha, a, (const int)lda, x, (const int)incx,
-                          (const float)beta, y, (const int)incy);
+        host_task<class netlib_ssymv_usm>(queue, cgh, [=]() {
+            ::cblas_ssymv(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          (const float)alpha, a, to_cblas_int(lda), x, to_cblas_int(incx),
+                          (const float)beta, y, to_cblas_int(incy));
         });
     });
     return done;
@@ -1658,15 +1773,16 @@ sycl::event symv(sycl::queue& queue, uplo upper_lower, int64_t n, float alpha, c
 sycl::event symv(sycl::queue& queue, uplo upper_lower, int64_t n, double alpha, const double* a,
                  int64_t lda, const double* x, int64_t incx, double beta, double* y, int64_t incy,
                  const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(n, lda, incx, incy);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_dsymv_usm>(cgh, [=]() {
-            ::cblas_dsymv(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                          (const double)alpha, a, (const int)lda, x, (const int)incx,
-                          (const double)beta, y, (const int)incy);
+        host_task<class netlib_dsymv_usm>(queue, cgh, [=]() {
+            ::cblas_dsymv(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          (const double)alpha, a, to_cblas_int(lda), x, to_cblas_int(incx),
+                          (const double)beta, y, to_cblas_int(incy));
         });
     });
     return done;
@@ -1674,14 +1790,15 @@ sycl::event symv(sycl::queue& queue, uplo upper_lower, int64_t n, double alpha,
 
 sycl::event syr(sycl::queue& queue, uplo upper_lower, int64_t n, float alpha, const float* x,
                 int64_t incx, float* a, int64_t lda, const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(n, incx, lda);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_ssyr_usm>(cgh, [=]() {
-            ::cblas_ssyr(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                         (const float)alpha, x, (const int)incx, a, (const int)lda);
+        host_task<class netlib_ssyr_usm>(queue, cgh, [=]() {
+            ::cblas_ssyr(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                         (const float)alpha, x, to_cblas_int(incx), a, to_cblas_int(lda));
         });
     });
     return done;
@@ -1690,14 +1807,15 @@ sycl::event syr(sycl::queue& queue, uplo upper_lower, int64_t n, float alpha, co
 sycl::event syr(sycl::queue& queue, uplo upper_lower, int64_t n, double alpha, const double* x,
                 int64_t incx, double* a, int64_t lda,
                 const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(n, incx, lda);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_dsyr_usm>(cgh, [=]() {
-            ::cblas_dsyr(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                         (const double)alpha, x, (const int)incx, a, (const int)lda);
+        host_task<class netlib_dsyr_usm>(queue, cgh, [=]() {
+            ::cblas_dsyr(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                         (const double)alpha, x, to_cblas_int(incx), a, to_cblas_int(lda));
         });
     });
     return done;
@@ -1706,15 +1824,16 @@ sycl::event syr(sycl::queue& queue, uplo upper_lower, int64_t n, double alpha, c
 sycl::event syr2(sycl::queue& queue, uplo upper_lower, int64_t n, float alpha, const float* x,
                  int64_t incx, const float* y, int64_t incy, float* a, int64_t lda,
                  const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(n, incx, incy, lda);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_ssyr2_usm>(cgh, [=]() {
-            ::cblas_ssyr2(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                          (const float)alpha, x, (const int)incx, y, (const int)incy, a,
-                          (const int)lda);
+        host_task<class netlib_ssyr2_usm>(queue, cgh, [=]() {
+            ::cblas_ssyr2(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          (const float)alpha, x, to_cblas_int(incx), y, to_cblas_int(incy), a,
+                          to_cblas_int(lda));
         });
     });
     return done;
@@ -1723,15 +1842,16 @@ sycl::event syr2(sycl::queue& queue, uplo upper_lower, int64_t n, float alpha, c
 sycl::event syr2(sycl::queue& queue, uplo upper_lower, int64_t n, double alpha, const double* x,
                  int64_t incx, const double* y, int64_t incy, double* a, int64_t lda,
                  const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(n, incx, incy, lda);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_dsyr2_usm>(cgh, [=]() {
-            ::cblas_dsyr2(MAJOR, convert_to_cblas_uplo(upper_lower), (const int)n,
-                          (const double)alpha, x, (const int)incx, y, (const int)incy, a,
-                          (const int)lda);
+        host_task<class netlib_dsyr2_usm>(queue, cgh, [=]() {
+            ::cblas_dsyr2(MAJOR, convert_to_cblas_uplo(upper_lower), to_cblas_int(n),
+                          (const double)alpha, x, to_cblas_int(incx), y, to_cblas_int(incy), a,
+                          to_cblas_int(lda));
         });
     });
     return done;
@@ -1740,15 +1860,16 @@ sycl::event syr2(sycl::queue& queue, uplo upper_lower, int64_t n, double alpha,
 sycl::event tbmv(sycl::queue& queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
                  int64_t k, const float* a, int64_t lda, float* x, int64_t incx,
                  const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(n, k, lda, incx);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_stbmv_usm>(cgh, [=]() {
+        host_task<class netlib_stbmv_usm>(queue, cgh, [=]() {
             ::cblas_stbmv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, (const int)k, a,
-                          (const int)lda, x, (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n), to_cblas_int(k), a,
+                          to_cblas_int(lda), x, to_cblas_int(incx));
         });
     });
     return done;
@@ -1757,15 +1878,16 @@ sycl::event tbmv(sycl::queue& queue, uplo upper_lower, transpose trans, diag uni
 sycl::event tbmv(sycl::queue& queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
                  int64_t k, const double* a, int64_t lda, double* x, int64_t incx,
                  const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(n, k, lda, incx);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_dtbmv_usm>(cgh, [=]() {
+        host_task<class netlib_dtbmv_usm>(queue, cgh, [=]() {
             ::cblas_dtbmv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, (const int)k, a,
-                          (const int)lda, x, (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n), to_cblas_int(k), a,
+                          to_cblas_int(lda), x, to_cblas_int(incx));
         });
     });
     return done;
@@ -1774,15 +1896,16 @@ sycl::event tbmv(sycl::queue& queue, uplo upper_lower, transpose trans, diag uni
 sycl::event tbmv(sycl::queue& queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
                  int64_t k, const std::complex<float>* a, int64_t lda, std::complex<float>* x,
                  int64_t incx, const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(n, k, lda, incx);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_ctbmv_usm>(cgh, [=]() {
+        host_task<class netlib_ctbmv_usm>(queue, cgh, [=]() {
             ::cblas_ctbmv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, (const int)k, a,
-                          (const int)lda, x, (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n), to_cblas_int(k), a,
+                          to_cblas_int(lda), x, to_cblas_int(incx));
         });
     });
     return done;
@@ -1791,15 +1914,16 @@ sycl::event tbmv(sycl::queue& queue, uplo upper_lower, transpose trans, diag uni
 sycl::event tbmv(sycl::queue& queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
                  int64_t k, const std::complex<double>* a, int64_t lda, std::complex<double>* x,
                  int64_t incx, const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(n, k, lda, incx);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_ztbmv_usm>(cgh, [=]() {
+        host_task<class netlib_ztbmv_usm>(queue, cgh, [=]() {
             ::cblas_ztbmv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, (const int)k, a,
-                          (const int)lda, x, (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n), to_cblas_int(k), a,
+                          to_cblas_int(lda), x, to_cblas_int(incx));
         });
     });
     return done;
@@ -1808,15 +1932,16 @@ sycl::event tbmv(sycl::queue& queue, uplo upper_lower, transpose trans, diag uni
 sycl::event tbsv(sycl::queue& queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
                  int64_t k, const float* a, int64_t lda, float* x, int64_t incx,
                  const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(n, k, lda, incx);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_stbsv_usm>(cgh, [=]() {
+        host_task<class netlib_stbsv_usm>(queue, cgh, [=]() {
             ::cblas_stbsv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, (const int)k, a,
-                          (const int)lda, x, (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n), to_cblas_int(k), a,
+                          to_cblas_int(lda), x, to_cblas_int(incx));
         });
     });
     return done;
@@ -1825,15 +1950,16 @@ sycl::event tbsv(sycl::queue& queue, uplo upper_lower, transpose trans, diag uni
 sycl::event tbsv(sycl::queue& queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
                  int64_t k, const double* a, int64_t lda, double* x, int64_t incx,
                  const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(n, k, lda, incx);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_dtbsv_usm>(cgh, [=]() {
+        host_task<class netlib_dtbsv_usm>(queue, cgh, [=]() {
             ::cblas_dtbsv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, (const int)k, a,
-                          (const int)lda, x, (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n), to_cblas_int(k), a,
+                          to_cblas_int(lda), x, to_cblas_int(incx));
         });
     });
     return done;
@@ -1842,15 +1968,16 @@ sycl::event tbsv(sycl::queue& queue, uplo upper_lower, transpose trans, diag uni
 sycl::event tbsv(sycl::queue& queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
                  int64_t k, const std::complex<float>* a, int64_t lda, std::complex<float>* x,
                  int64_t incx, const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(n, k, lda, incx);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_ctbsv_usm>(cgh, [=]() {
+        host_task<class netlib_ctbsv_usm>(queue, cgh, [=]() {
             ::cblas_ctbsv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, (const int)k, a,
-                          (const int)lda, x, (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n), to_cblas_int(k), a,
+                          to_cblas_int(lda), x, to_cblas_int(incx));
         });
     });
     return done;
@@ -1859,15 +1986,16 @@ sycl::event tbsv(sycl::queue& queue, uplo upper_lower, transpose trans, diag uni
 sycl::event tbsv(sycl::queue& queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
                  int64_t k, const std::complex<double>* a, int64_t lda, std::complex<double>* x,
                  int64_t incx, const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(n, k, lda, incx);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_ztbsv_usm>(cgh, [=]() {
+        host_task<class netlib_ztbsv_usm>(queue, cgh, [=]() {
             ::cblas_ztbsv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, (const int)k, a,
-                          (const int)lda, x, (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n), to_cblas_int(k), a,
+                          to_cblas_int(lda), x, to_cblas_int(incx));
         });
     });
     return done;
@@ -1876,14 +2004,16 @@ sycl::event tbsv(sycl::queue& queue, uplo upper_lower, transpose trans, diag uni
 sycl::event tpmv(sycl::queue& queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
                  const float* ap, float* x, int64_t incx,
                  const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(n, incx);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_stpmv_usm>(cgh, [=]() {
+        host_task<class netlib_stpmv_usm>(queue, cgh, [=]() {
             ::cblas_stpmv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, ap, x, (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n), ap, x,
+                          to_cblas_int(incx));
         });
     });
     return done;
@@ -1892,14 +2022,16 @@ sycl::event tpmv(sycl::queue& queue, uplo upper_lower, transpose trans, diag uni
 sycl::event tpmv(sycl::queue& queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
                  const double* ap, double* x, int64_t incx,
                  const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(n, incx);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_dtpmv_usm>(cgh, [=]() {
+        host_task<class netlib_dtpmv_usm>(queue, cgh, [=]() {
             ::cblas_dtpmv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, ap, x, (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n), ap, x,
+                          to_cblas_int(incx));
         });
     });
     return done;
@@ -1908,14 +2040,16 @@ sycl::event tpmv(sycl::queue& queue, uplo upper_lower, transpose trans, diag uni
 sycl::event tpmv(sycl::queue& queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
                  const std::complex<float>* ap, std::complex<float>* x, int64_t incx,
                  const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(n, incx);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_ctpmv_usm>(cgh, [=]() {
+        host_task<class netlib_ctpmv_usm>(queue, cgh, [=]() {
             ::cblas_ctpmv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, ap, x, (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n), ap, x,
+                          to_cblas_int(incx));
         });
     });
     return done;
@@ -1924,14 +2058,16 @@ sycl::event tpmv(sycl::queue& queue, uplo upper_lower, transpose trans, diag uni
 sycl::event tpmv(sycl::queue& queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
                  const std::complex<double>* ap, std::complex<double>* x, int64_t incx,
                  const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(n, incx);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_ztpmv_usm>(cgh, [=]() {
+        host_task<class netlib_ztpmv_usm>(queue, cgh, [=]() {
             ::cblas_ztpmv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, ap, x, (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n), ap, x,
+                          to_cblas_int(incx));
         });
     });
     return done;
@@ -1940,14 +2076,16 @@ sycl::event tpmv(sycl::queue& queue, uplo upper_lower, transpose trans, diag uni
 sycl::event tpsv(sycl::queue& queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
                  const float* ap, float* x, int64_t incx,
                  const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(n, incx);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_stpsv_usm>(cgh, [=]() {
+        host_task<class netlib_stpsv_usm>(queue, cgh, [=]() {
             ::cblas_stpsv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, ap, x, (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n), ap, x,
+                          to_cblas_int(incx));
         });
     });
     return done;
@@ -1956,14 +2094,16 @@ sycl::event tpsv(sycl::queue& queue, uplo upper_lower, transpose trans, diag uni
 sycl::event tpsv(sycl::queue& queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
                  const double* ap, double* x, int64_t incx,
                  const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(n, incx);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_dtpsv_usm>(cgh, [=]() {
+        host_task<class netlib_dtpsv_usm>(queue, cgh, [=]() {
             ::cblas_dtpsv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, ap, x, (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n), ap, x,
+                          to_cblas_int(incx));
         });
     });
     return done;
@@ -1972,14 +2112,16 @@ sycl::event tpsv(sycl::queue& queue, uplo upper_lower, transpose trans, diag uni
 sycl::event tpsv(sycl::queue& queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
                  const std::complex<float>* ap, std::complex<float>* x, int64_t incx,
                  const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(n, incx);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_ctpsv_usm>(cgh, [=]() {
+        host_task<class netlib_ctpsv_usm>(queue, cgh, [=]() {
             ::cblas_ctpsv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, ap, x, (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n), ap, x,
+                          to_cblas_int(incx));
         });
     });
     return done;
@@ -1988,14 +2130,16 @@ sycl::event tpsv(sycl::queue& queue, uplo upper_lower, transpose trans, diag uni
 sycl::event tpsv(sycl::queue& queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
                  const std::complex<double>* ap, std::complex<double>* x, int64_t incx,
                  const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(n, incx);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_ztpsv_usm>(cgh, [=]() {
+        host_task<class netlib_ztpsv_usm>(queue, cgh, [=]() {
             ::cblas_ztpsv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, ap, x, (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n), ap, x,
+                          to_cblas_int(incx));
         });
     });
     return done;
@@ -2004,15 +2148,16 @@ sycl::event tpsv(sycl::queue& queue, uplo upper_lower, transpose trans, diag uni
 sycl::event trmv(sycl::queue& queue, uplo upper_lower, transpose transa, diag unit_diag, int64_t n,
                  const float* a, int64_t lda, float* b, int64_t incx,
                  const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(n, lda, incx);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_strmv_usm>(cgh, [=]() {
+        host_task<class netlib_strmv_usm>(queue, cgh, [=]() {
             ::cblas_strmv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)n, a, (const int)lda, b,
-                          (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n), a, to_cblas_int(lda),
+                          b, to_cblas_int(incx));
         });
     });
     return done;
@@ -2021,15 +2166,16 @@ sycl::event trmv(sycl::queue& queue, uplo upper_lower, transpose transa, diag un
 sycl::event trmv(sycl::queue& queue, uplo upper_lower, transpose transa, diag unit_diag, int64_t n,
                  const double* a, int64_t lda, double* b, int64_t incx,
                  const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(n, lda, incx);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_dtrmv_usm>(cgh, [=]() {
+        host_task<class netlib_dtrmv_usm>(queue, cgh, [=]() {
             ::cblas_dtrmv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)n, a, (const int)lda, b,
-                          (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n), a, to_cblas_int(lda),
+                          b, to_cblas_int(incx));
         });
     });
     return done;
@@ -2038,15 +2184,16 @@ sycl::event trmv(sycl::queue& queue, uplo upper_lower, transpose transa, diag un
 sycl::event trmv(sycl::queue& queue, uplo upper_lower, transpose transa, diag unit_diag, int64_t n,
                  const std::complex<float>* a, int64_t lda, std::complex<float>* b, int64_t incx,
                  const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(n, lda, incx);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_ctrmv_usm>(cgh, [=]() {
+        host_task<class netlib_ctrmv_usm>(queue, cgh, [=]() {
             ::cblas_ctrmv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)n, a, (const int)lda, b,
-                          (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n), a, to_cblas_int(lda),
+                          b, to_cblas_int(incx));
         });
     });
     return done;
@@ -2055,15 +2202,16 @@ sycl::event trmv(sycl::queue& queue, uplo upper_lower, transpose transa, diag un
 sycl::event trmv(sycl::queue& queue, uplo upper_lower, transpose transa, diag unit_diag, int64_t n,
                  const std::complex<double>* a, int64_t lda, std::complex<double>* b, int64_t incx,
                  const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(n, lda, incx);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_ztrmv_usm>(cgh, [=]() {
+        host_task<class netlib_ztrmv_usm>(queue, cgh, [=]() {
             ::cblas_ztrmv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)n, a, (const int)lda, b,
-                          (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n), a, to_cblas_int(lda),
+                          b, to_cblas_int(incx));
         });
     });
     return done;
@@ -2072,15 +2220,16 @@ sycl::event trmv(sycl::queue& queue, uplo upper_lower, transpose transa, diag un
 sycl::event trsv(sycl::queue& queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
                  const float* a, int64_t lda, float* x, int64_t incx,
                  const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(n, lda, incx);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_strsv_usm>(cgh, [=]() {
+        host_task<class netlib_strsv_usm>(queue, cgh, [=]() {
             ::cblas_strsv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, a, (const int)lda, x,
-                          (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n), a, to_cblas_int(lda),
+                          x, to_cblas_int(incx));
         });
     });
     return done;
@@ -2089,15 +2238,16 @@ sycl::event trsv(sycl::queue& queue, uplo upper_lower, transpose trans, diag uni
 sycl::event trsv(sycl::queue& queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
                  const double* a, int64_t lda, double* x, int64_t incx,
                  const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(n, lda, incx);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_dtrsv_usm>(cgh, [=]() {
+        host_task<class netlib_dtrsv_usm>(queue, cgh, [=]() {
             ::cblas_dtrsv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, a, (const int)lda, x,
-                          (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n), a, to_cblas_int(lda),
+                          x, to_cblas_int(incx));
         });
     });
     return done;
@@ -2106,15 +2256,16 @@ sycl::event trsv(sycl::queue& queue, uplo upper_lower, transpose trans, diag uni
 sycl::event trsv(sycl::queue& queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
                  const std::complex<float>* a, int64_t lda, std::complex<float>* x, int64_t incx,
                  const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(n, lda, incx);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_ctrsv_usm>(cgh, [=]() {
+        host_task<class netlib_ctrsv_usm>(queue, cgh, [=]() {
             ::cblas_ctrsv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, a, (const int)lda, x,
-                          (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n), a, to_cblas_int(lda),
+                          x, to_cblas_int(incx));
         });
     });
     return done;
@@ -2123,15 +2274,16 @@ sycl::event trsv(sycl::queue& queue, uplo upper_lower, transpose trans, diag uni
 sycl::event trsv(sycl::queue& queue, uplo upper_lower, transpose trans, diag unit_diag, int64_t n,
                  const std::complex<double>* a, int64_t lda, std::complex<double>* x, int64_t incx,
                  const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(n, lda, incx);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_ztrsv_usm>(cgh, [=]() {
+        host_task<class netlib_ztrsv_usm>(queue, cgh, [=]() {
             ::cblas_ztrsv(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          convert_to_cblas_diag(unit_diag), (const int)n, a, (const int)lda, x,
-                          (const int)incx);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(n), a, to_cblas_int(lda),
+                          x, to_cblas_int(incx));
         });
     });
     return done;
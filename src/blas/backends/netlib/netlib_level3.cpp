@@ -22,8 +22,12 @@
 #else
 #include <CL/sycl.hpp>
 #endif
+#include <algorithm>
+#include <type_traits>
+#include <utility>
 
 #include "netlib_common.hpp"
+#include "netlib_host_path.hpp"
 #include "oneapi/math/exceptions.hpp"
 #include "oneapi/math/blas/detail/netlib/onemath_blas_netlib.hpp"
 
@@ -31,6 +35,65 @@ namespace oneapi {
 namespace math {
 namespace blas {
 namespace netlib {
+
+// c = alpha * op(a) * op(b) + beta * c for the half and bfloat16 types, which CBLAS has no
+// gemm for. Each panel of c is computed by sgemm calls on panels of a and b converted to
+// float in the workspace, and c is converted too unless it is float.
+template <typename Tab, typename Tc>
+static void gemm_converted(CBLAS_LAYOUT layout, transpose transa, transpose transb, int64_t m,
+                           int64_t n, int64_t k, float alpha, const Tab* a, int64_t lda,
+                           const Tab* b, int64_t ldb, float beta, Tc* c, int64_t ldc,
+                           workspace& ws) {
+    // Row-major c = op(a) * op(b) is the column-major c^T = op(b)^T * op(a)^T
+    if (layout == CblasRowMajor) {
+        std::swap(m, n);
+        std::swap(transa, transb);
+        std::swap(a, b);
+        std::swap(lda, ldb);
+    }
+    constexpr bool float_c = std::is_same<Tc, float>::value;
+    float* a_panel = ws.get<float>(3 * gemm_panel * gemm_panel);
+    float* b_panel = a_panel + gemm_panel * gemm_panel;
+    float* c_panel = b_panel + gemm_panel * gemm_panel;
+    for (int64_t j0 = 0; j0 < n; j0 += gemm_panel) {
+        const int64_t nb = std::min(gemm_panel, n - j0);
+        for (int64_t i0 = 0; i0 < m; i0 += gemm_panel) {
+            const int64_t mb = std::min(gemm_panel, m - i0);
+            // A float c is updated in place, unless its leading dimension does not fit the
+            // CBLAS integers
+            float* c_block = c_panel;
+            int64_t ldc_block = mb;
+            bool in_place = false;
+            if constexpr (float_c) {
+                in_place = fits_cblas_int(ldc);
+                if (in_place) {
+                    c_block = c + i0 + j0 * ldc;
+                    ldc_block = ldc;
+                }
+            }
+            if (!in_place && beta != 0.0f)
+                pack_panel(transpose::nontrans, c, ldc, i0, j0, mb, nb, 0.0f, c_panel);
+            // Once with kb = 0 when k is 0, for c = beta * c
+            for (int64_t p0 = 0; p0 == 0 || p0 < k; p0 += gemm_panel) {
+                const int64_t kb = std::min(gemm_panel, k - p0);
+                pack_panel(transa, a, lda, i0, p0, mb, kb, 0.0f, a_panel);
+                pack_panel(transb, b, ldb, p0, j0, kb, nb, 0.0f, b_panel);
+                ::cblas_sgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, to_cblas_int(mb),
+                              to_cblas_int(nb), to_cblas_int(kb), alpha, a_panel, to_cblas_int(mb),
+                              b_panel, to_cblas_int(std::max<int64_t>(kb, 1)),
+                              p0 == 0 ? beta : 1.0f, c_block, to_cblas_int(ldc_block));
+            }
+            if (!in_place) {
+                for (int64_t j = 0; j < nb; ++j) {
+                    Tc* c_j = c + i0 + (j0 + j) * ldc;
+                    for (int64_t i = 0; i < mb; ++i)
+                        c_j[i] = static_cast<Tc>(c_panel[i + j * mb]);
+                }
+            }
+        }
+    }
+}
+
 namespace column_major {
 
 #define MAJOR CblasColMajor
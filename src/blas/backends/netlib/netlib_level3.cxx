@@ -22,121 +22,91 @@
 void gemm(sycl::queue& queue, transpose transa, transpose transb, int64_t m, int64_t n, int64_t k,
           float alpha, sycl::buffer<float, 1>& a, int64_t lda, sycl::buffer<float, 1>& b,
           int64_t ldb, float beta, sycl::buffer<float, 1>& c, int64_t ldc) {
-    queue.submit([&](sycl::handler& cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_sgemm>(cgh, [=]() {
-            ::cblas_sgemm(MAJOR, convert_to_cblas_trans(transa), convert_to_cblas_trans(transb),
-                          (const int)m, (const int)n, (const int)k, (const float)alpha,
-                          accessor_a.GET_MULTI_PTR, (const int)lda, accessor_b.GET_MULTI_PTR,
-                          (const int)ldb, (const float)beta, accessor_c.GET_MULTI_PTR,
-                          (const int)ldc);
+    submit_host_ptr_call<class netlib_sgemm>(
+        queue, std::make_tuple(in(a), in(b), in_out(c)), [=](auto a_ptr, auto b_ptr, auto c_ptr) {
+            gemm_in_tiles(MAJOR, transa, transb, m, n, k, alpha, a_ptr, lda, b_ptr, ldb, beta,
+                          c_ptr, ldc);
         });
-    });
 }
 
 void gemm(sycl::queue& queue, transpose transa, transpose transb, int64_t m, int64_t n, int64_t k,
           double alpha, sycl::buffer<double, 1>& a, int64_t lda, sycl::buffer<double, 1>& b,
           int64_t ldb, double beta, sycl::buffer<double, 1>& c, int64_t ldc) {
-    queue.submit([&](sycl::handler& cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_dgemm>(cgh, [=]() {
-            ::cblas_dgemm(MAJOR, convert_to_cblas_trans(transa), convert_to_cblas_trans(transb),
-                          (const int)m, (const int)n, (const int)k, (const double)alpha,
-                          accessor_a.GET_MULTI_PTR, (const int)lda, accessor_b.GET_MULTI_PTR,
-                          (const int)ldb, (const double)beta, accessor_c.GET_MULTI_PTR,
-                          (const int)ldc);
+    submit_host_ptr_call<class netlib_dgemm>(
+        queue, std::make_tuple(in(a), in(b), in_out(c)), [=](auto a_ptr, auto b_ptr, auto c_ptr) {
+            gemm_in_tiles(MAJOR, transa, transb, m, n, k, alpha, a_ptr, lda, b_ptr, ldb, beta,
+                          c_ptr, ldc);
         });
-    });
 }
 
 void gemm(sycl::queue& queue, transpose transa, transpose transb, int64_t m, int64_t n, int64_t k,
           std::complex<float> alpha, sycl::buffer<std::complex<float>, 1>& a, int64_t lda,
           sycl::buffer<std::complex<float>, 1>& b, int64_t ldb, std::complex<float> beta,
           sycl::buffer<std::complex<float>, 1>& c, int64_t ldc) {
-    queue.submit([&](sycl::handler& cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_cgemm>(cgh, [=]() {
-            ::cblas_cgemm(MAJOR, convert_to_cblas_trans(transa), convert_to_cblas_trans(transb),
-                          (const int)m, (const int)n, (const int)k, (const void*)&alpha,
-                          accessor_a.GET_MULTI_PTR, (const int)lda, accessor_b.GET_MULTI_PTR,
-                          (const int)ldb, (const void*)&beta, accessor_c.GET_MULTI_PTR,
-                          (const int)ldc);
+    submit_host_ptr_call<class netlib_cgemm>(
+        queue, std::make_tuple(in(a), in(b), in_out(c)), [=](auto a_ptr, auto b_ptr, auto c_ptr) {
+            gemm_in_tiles(MAJOR, transa, transb, m, n, k, alpha, a_ptr, lda, b_ptr, ldb, beta,
+                          c_ptr, ldc);
         });
-    });
 }
 
 void gemm(sycl::queue& queue, transpose transa, transpose transb, int64_t m, int64_t n, int64_t k,
           std::complex<double> alpha, sycl::buffer<std::complex<double>, 1>& a, int64_t lda,
           sycl::buffer<std::complex<double>, 1>& b, int64_t ldb, std::complex<double> beta,
           sycl::buffer<std::complex<double>, 1>& c, int64_t ldc) {
-    queue.submit([&](sycl::handler& cgh) {
-        auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
-        auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_zgemm>(cgh, [=]() {
-            ::cblas_zgemm(MAJOR, convert_to_cblas_trans(transa), convert_to_cblas_trans(transb),
-                          (const int)m, (const int)n, (const int)k, (const void*)&alpha,
-                          accessor_a.GET_MULTI_PTR, (const int)lda, accessor_b.GET_MULTI_PTR,
-                          (const int)ldb, (const void*)&beta, accessor_c.GET_MULTI_PTR,
-                          (const int)ldc);
+    submit_host_ptr_call<class netlib_zgemm>(
+        queue, std::make_tuple(in(a), in(b), in_out(c)), [=](auto a_ptr, auto b_ptr, auto c_ptr) {
+            gemm_in_tiles(MAJOR, transa, transb, m, n, k, alpha, a_ptr, lda, b_ptr, ldb, beta,
+                          c_ptr, ldc);
         });
-    });
 }
 
 void gemm(sycl::queue& queue, transpose transa, transpose transb, int64_t m, int64_t n, int64_t k,
           sycl::half alpha, sycl::buffer<sycl::half, 1>& a, int64_t lda,
           sycl::buffer<sycl::half, 1>& b, int64_t ldb, sycl::half beta,
           sycl::buffer<sycl::half, 1>& c, int64_t ldc) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm", "for row_major layout");
-#endif
+    submit_host_ptr_call<class netlib_hgemm>(
+        queue, std::make_tuple(in(a), in(b), in_out(c)), [=](auto a_ptr, auto b_ptr, auto c_ptr) {
+            gemm_converted(MAJOR, transa, transb, m, n, k, (float)alpha, a_ptr, lda, b_ptr, ldb,
+                           (float)beta, c_ptr, ldc, get_workspace(queue));
+        });
 }
 
 void gemm(sycl::queue& queue, transpose transa, transpose transb, int64_t m, int64_t n, int64_t k,
           float alpha, sycl::buffer<sycl::half, 1>& a, int64_t lda, sycl::buffer<sycl::half, 1>& b,
           int64_t ldb, float beta, sycl::buffer<float, 1>& c, int64_t ldc) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm", "for row_major layout");
-#endif
+    submit_host_ptr_call<class netlib_gemm_f16f16f32>(
+        queue, std::make_tuple(in(a), in(b), in_out(c)), [=](auto a_ptr, auto b_ptr, auto c_ptr) {
+            gemm_converted(MAJOR, transa, transb, m, n, k, alpha, a_ptr, lda, b_ptr, ldb, beta,
+                           c_ptr, ldc, get_workspace(queue));
+        });
 }
 
 void gemm(sycl::queue& queue, transpose transa, transpose transb, int64_t m, int64_t n, int64_t k,
           float alpha, sycl::buffer<bfloat16, 1>& a, int64_t lda, sycl::buffer<bfloat16, 1>& b,
           int64_t ldb, float beta, sycl::buffer<float, 1>& c, int64_t ldc) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm", "for row_major layout");
-#endif
+    submit_host_ptr_call<class netlib_gemm_bf16bf16f32>(
+        queue, std::make_tuple(in(a), in(b), in_out(c)), [=](auto a_ptr, auto b_ptr, auto c_ptr) {
+            gemm_converted(MAJOR, transa, transb, m, n, k, alpha, a_ptr, lda, b_ptr, ldb, beta,
+                           c_ptr, ldc, get_workspace(queue));
+        });
 }
 
 void hemm(sycl::queue& queue, side left_right, uplo upper_lower, int64_t m, int64_t n,
           std::complex<float> alpha, sycl::buffer<std::complex<float>, 1>& a, int64_t lda,
           sycl::buffer<std::complex<float>, 1>& b, int64_t ldb, std::complex<float> beta,
           sycl::buffer<std::complex<float>, 1>& c, int64_t ldc) {
+    check_cblas_ints(m, n, lda, ldb, ldc);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_chemm>(cgh, [=]() {
+        host_task<class netlib_chemm>(queue, cgh, [=]() {
             ::cblas_chemm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), (const int)m, (const int)n,
-                          (const void*)&alpha, accessor_a.GET_MULTI_PTR, (const int)lda,
-                          accessor_b.GET_MULTI_PTR, (const int)ldb, (const void*)&beta,
-                          accessor_c.GET_MULTI_PTR, (const int)ldc);
+                          convert_to_cblas_uplo(upper_lower), to_cblas_int(m), to_cblas_int(n),
+                          (const void*)&alpha, accessor_a.GET_MULTI_PTR, to_cblas_int(lda),
+                          accessor_b.GET_MULTI_PTR, to_cblas_int(ldb), (const void*)&beta,
+                          accessor_c.GET_MULTI_PTR, to_cblas_int(ldc));
         });
     });
 }
@@ -145,16 +115,17 @@ void hemm(sycl::queue& queue, side left_right, uplo upper_lower, int64_t m, int6
           std::complex<double> alpha, sycl::buffer<std::complex<double>, 1>& a, int64_t lda,
           sycl::buffer<std::complex<double>, 1>& b, int64_t ldb, std::complex<double> beta,
           sycl::buffer<std::complex<double>, 1>& c, int64_t ldc) {
+    check_cblas_ints(m, n, lda, ldb, ldc);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_zhemm>(cgh, [=]() {
+        host_task<class netlib_zhemm>(queue, cgh, [=]() {
             ::cblas_zhemm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), (const int)m, (const int)n,
-                          (const void*)&alpha, accessor_a.GET_MULTI_PTR, (const int)lda,
-                          accessor_b.GET_MULTI_PTR, (const int)ldb, (const void*)&beta,
-                          accessor_c.GET_MULTI_PTR, (const int)ldc);
+                          convert_to_cblas_uplo(upper_lower), to_cblas_int(m), to_cblas_int(n),
+                          (const void*)&alpha, accessor_a.GET_MULTI_PTR, to_cblas_int(lda),
+                          accessor_b.GET_MULTI_PTR, to_cblas_int(ldb), (const void*)&beta,
+                          accessor_c.GET_MULTI_PTR, to_cblas_int(ldc));
         });
     });
 }
@@ -162,14 +133,15 @@ void hemm(sycl::queue& queue, side left_right, uplo upper_lower, int64_t m, int6
 void herk(sycl::queue& queue, uplo upper_lower, transpose trans, int64_t n, int64_t k, float alpha,
           sycl::buffer<std::complex<float>, 1>& a, int64_t lda, float beta,
           sycl::buffer<std::complex<float>, 1>& c, int64_t ldc) {
+    check_cblas_ints(n, k, lda, ldc);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_cherk>(cgh, [=]() {
+        host_task<class netlib_cherk>(queue, cgh, [=]() {
             ::cblas_cherk(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          (const int)n, (const int)k, (const float)alpha, accessor_a.GET_MULTI_PTR,
-                          (const int)lda, (const float)beta, accessor_c.GET_MULTI_PTR,
-                          (const int)ldc);
+                          to_cblas_int(n), to_cblas_int(k), (const float)alpha,
+                          accessor_a.GET_MULTI_PTR, to_cblas_int(lda), (const float)beta,
+                          accessor_c.GET_MULTI_PTR, to_cblas_int(ldc));
         });
     });
 }
@@ -177,14 +149,15 @@ void herk(sycl::queue& queue, uplo upper_lower, transpose trans, int64_t n, int6
 void herk(sycl::queue& queue, uplo upper_lower, transpose trans, int64_t n, int64_t k, double alpha,
           sycl::buffer<std::complex<double>, 1>& a, int64_t lda, double beta,
           sycl::buffer<std::complex<double>, 1>& c, int64_t ldc) {
+    check_cblas_ints(n, k, lda, ldc);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_zherk>(cgh, [=]() {
+        host_task<class netlib_zherk>(queue, cgh, [=]() {
             ::cblas_zherk(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          (const int)n, (const int)k, (const double)alpha, accessor_a.GET_MULTI_PTR,
-                          (const int)lda, (const double)beta, accessor_c.GET_MULTI_PTR,
-                          (const int)ldc);
+                          to_cblas_int(n), to_cblas_int(k), (const double)alpha,
+                          accessor_a.GET_MULTI_PTR, to_cblas_int(lda), (const double)beta,
+                          accessor_c.GET_MULTI_PTR, to_cblas_int(ldc));
         });
     });
 }
@@ -193,16 +166,17 @@ void her2k(sycl::queue& queue, uplo upper_lower, transpose trans, int64_t n, int
            std::complex<float> alpha, sycl::buffer<std::complex<float>, 1>& a, int64_t lda,
            sycl::buffer<std::complex<float>, 1>& b, int64_t ldb, float beta,
            sycl::buffer<std::complex<float>, 1>& c, int64_t ldc) {
+    check_cblas_ints(n, k, lda, ldb, ldc);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_cher2k>(cgh, [=]() {
+        host_task<class netlib_cher2k>(queue, cgh, [=]() {
             ::cblas_cher2k(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                           (const int)n, (const int)k, (const void*)&alpha,
-                           accessor_a.GET_MULTI_PTR, (const int)lda, accessor_b.GET_MULTI_PTR,
-                           (const int)ldb, (const float)beta, accessor_c.GET_MULTI_PTR,
-                           (const int)ldc);
+                           to_cblas_int(n), to_cblas_int(k), (const void*)&alpha,
+                           accessor_a.GET_MULTI_PTR, to_cblas_int(lda), accessor_b.GET_MULTI_PTR,
+                           to_cblas_int(ldb), (const float)beta, accessor_c.GET_MULTI_PTR,
+                           to_cblas_int(ldc));
         });
     });
 }
@@ -211,16 +185,17 @@ void her2k(sycl::queue& queue, uplo upper_lower, transpose trans, int64_t n, int
            std::complex<double> alpha, sycl::buffer<std::complex<double>, 1>& a, int64_t lda,
            sycl::buffer<std::complex<double>, 1>& b, int64_t ldb, double beta,
            sycl::buffer<std::complex<double>, 1>& c, int64_t ldc) {
+    check_cblas_ints(n, k, lda, ldb, ldc);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_zher2k>(cgh, [=]() {
+        host_task<class netlib_zher2k>(queue, cgh, [=]() {
             ::cblas_zher2k(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                           (const int)n, (const int)k, (const void*)&alpha,
-                           accessor_a.GET_MULTI_PTR, (const int)lda, accessor_b.GET_MULTI_PTR,
-                           (const int)ldb, (const double)beta, accessor_c.GET_MULTI_PTR,
-                           (const int)ldc);
+                           to_cblas_int(n), to_cblas_int(k), (const void*)&alpha,
+                           accessor_a.GET_MULTI_PTR, to_cblas_int(lda), accessor_b.GET_MULTI_PTR,
+                           to_cblas_int(ldb), (const double)beta, accessor_c.GET_MULTI_PTR,
+                           to_cblas_int(ldc));
         });
     });
 }
@@ -228,16 +203,17 @@ void her2k(sycl::queue& queue, uplo upper_lower, transpose trans, int64_t n, int
 void symm(sycl::queue& queue, side left_right, uplo upper_lower, int64_t m, int64_t n, float alpha,
           sycl::buffer<float, 1>& a, int64_t lda, sycl::buffer<float, 1>& b, int64_t ldb,
           float beta, sycl::buffer<float, 1>& c, int64_t ldc) {
+    check_cblas_ints(m, n, lda, ldb, ldc);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_ssymm>(cgh, [=]() {
+        host_task<class netlib_ssymm>(queue, cgh, [=]() {
             ::cblas_ssymm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), (const int)m, (const int)n,
-                          (const float)alpha, accessor_a.GET_MULTI_PTR, (const int)lda,
-                          accessor_b.GET_MULTI_PTR, (const int)ldb, (const float)beta,
-                          accessor_c.GET_MULTI_PTR, (const int)ldc);
+                          convert_to_cblas_uplo(upper_lower), to_cblas_int(m), to_cblas_int(n),
+                          (const float)alpha, accessor_a.GET_MULTI_PTR, to_cblas_int(lda),
+                          accessor_b.GET_MULTI_PTR, to_cblas_int(ldb), (const float)beta,
+                          accessor_c.GET_MULTI_PTR, to_cblas_int(ldc));
         });
     });
 }
@@ -245,16 +221,17 @@ void symm(sycl::queue& queue, side left_right, uplo upper_lower, int64_t m, int6
 void symm(sycl::queue& queue, side left_right, uplo upper_lower, int64_t m, int64_t n, double alpha,
           sycl::buffer<double, 1>& a, int64_t lda, sycl::buffer<double, 1>& b, int64_t ldb,
           double beta, sycl::buffer<double, 1>& c, int64_t ldc) {
+    check_cblas_ints(m, n, lda, ldb, ldc);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_dsymm>(cgh, [=]() {
+        host_task<class netlib_dsymm>(queue, cgh, [=]() {
             ::cblas_dsymm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), (const int)m, (const int)n,
-                          (const double)alpha, accessor_a.GET_MULTI_PTR, (const int)lda,
-                          accessor_b.GET_MULTI_PTR, (const int)ldb, (const double)beta,
-                          accessor_c.GET_MULTI_PTR, (const int)ldc);
+                          convert_to_cblas_uplo(upper_lower), to_cblas_int(m), to_cblas_int(n),
+                          (const double)alpha, accessor_a.GET_MULTI_PTR, to_cblas_int(lda),
+                          accessor_b.GET_MULTI_PTR, to_cblas_int(ldb), (const double)beta,
+                          accessor_c.GET_MULTI_PTR, to_cblas_int(ldc));
         });
     });
 }
@@ -263,16 +240,17 @@ void symm(sycl::queue& queue, side left_right, uplo upper_lower, int64_t m, int6
           std::complex<float> alpha, sycl::buffer<std::complex<float>, 1>& a, int64_t lda,
           sycl::buffer<std::complex<float>, 1>& b, int64_t ldb, std::complex<float> beta,
           sycl::buffer<std::complex<float>, 1>& c, int64_t ldc) {
+    check_cblas_ints(m, n, lda, ldb, ldc);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_csymm>(cgh, [=]() {
+        host_task<class netlib_csymm>(queue, cgh, [=]() {
             ::cblas_csymm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), (const int)m, (const int)n,
-                          (const void*)&alpha, accessor_a.GET_MULTI_PTR, (const int)lda,
-                          accessor_b.GET_MULTI_PTR, (const int)ldb, (const void*)&beta,
-                          accessor_c.GET_MULTI_PTR, (const int)ldc);
+                          convert_to_cblas_uplo(upper_lower), to_cblas_int(m), to_cblas_int(n),
+                          (const void*)&alpha, accessor_a.GET_MULTI_PTR, to_cblas_int(lda),
+                          accessor_b.GET_MULTI_PTR, to_cblas_int(ldb), (const void*)&beta,
+                          accessor_c.GET_MULTI_PTR, to_cblas_int(ldc));
         });
     });
 }
@@ -281,16 +259,17 @@ void symm(sycl::queue& queue, side left_right, uplo upper_lower, int64_t m, int6
           std::complex<double> alpha, sycl::buffer<std::complex<double>, 1>& a, int64_t lda,
           sycl::buffer<std::complex<double>, 1>& b, int64_t ldb, std::complex<double> beta,
           sycl::buffer<std::complex<double>, 1>& c, int64_t ldc) {
+    check_cblas_ints(m, n, lda, ldb, ldc);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_zsymm>(cgh, [=]() {
+        host_task<class netlib_zsymm>(queue, cgh, [=]() {
             ::cblas_zsymm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), (const int)m, (const int)n,
-                          (const void*)&alpha, accessor_a.GET_MULTI_PTR, (const int)lda,
-                          accessor_b.GET_MULTI_PTR, (const int)ldb, (const void*)&beta,
-                          accessor_c.GET_MULTI_PTR, (const int)ldc);
+                          convert_to_cblas_uplo(upper_lower), to_cblas_int(m), to_cblas_int(n),
+                          (const void*)&alpha, accessor_a.GET_MULTI_PTR, to_cblas_int(lda),
+                          accessor_b.GET_MULTI_PTR, to_cblas_int(ldb), (const void*)&beta,
+                          accessor_c.GET_MULTI_PTR, to_cblas_int(ldc));
         });
     });
 }
@@ -298,14 +277,15 @@ void symm(sycl::queue& queue, side left_right, uplo upper_lower, int64_t m, int6
 void syrk(sycl::queue& queue, uplo upper_lower, transpose trans, int64_t n, int64_t k, float alpha,
           sycl::buffer<float, 1>& a, int64_t lda, float beta, sycl::buffer<float, 1>& c,
           int64_t ldc) {
+    check_cblas_ints(n, k, lda, ldc);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_ssyrk>(cgh, [=]() {
+        host_task<class netlib_ssyrk>(queue, cgh, [=]() {
             ::cblas_ssyrk(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          (const int)n, (const int)k, (const float)alpha, accessor_a.GET_MULTI_PTR,
-                          (const int)lda, (const float)beta, accessor_c.GET_MULTI_PTR,
-                          (const int)ldc);
+                          to_cblas_int(n), to_cblas_int(k), (const float)alpha,
+                          accessor_a.GET_MULTI_PTR, to_cblas_int(lda), (const float)beta,
+                          accessor_c.GET_MULTI_PTR, to_cblas_int(ldc));
         });
     });
 }
@@ -313,14 +293,15 @@ void syrk(sycl::queue& queue, uplo upper_lower, transpose trans, int64_t n, int6
 void syrk(sycl::queue& queue, uplo upper_lower, transpose trans, int64_t n, int64_t k, double alpha,
           sycl::buffer<double, 1>& a, int64_t lda, double beta, sycl::buffer<double, 1>& c,
           int64_t ldc) {
+    check_cblas_ints(n, k, lda, ldc);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_dsyrk>(cgh, [=]() {
+        host_task<class netlib_dsyrk>(queue, cgh, [=]() {
             ::cblas_dsyrk(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          (const int)n, (const int)k, (const double)alpha, accessor_a.GET_MULTI_PTR,
-                          (const int)lda, (const double)beta, accessor_c.GET_MULTI_PTR,
-                          (const int)ldc);
+                          to_cblas_int(n), to_cblas_int(k), (const double)alpha,
+                          accessor_a.GET_MULTI_PTR, to_cblas_int(lda), (const double)beta,
+                          accessor_c.GET_MULTI_PTR, to_cblas_int(ldc));
         });
     });
 }
@@ -328,14 +309,15 @@ void syrk(sycl::queue& queue, uplo upper_lower, transpose trans, int64_t n, int6
 void syrk(sycl::queue& queue, uplo upper_lower, transpose trans, int64_t n, int64_t k,
           std::complex<float> alpha, sycl::buffer<std::complex<float>, 1>& a, int64_t lda,
           std::complex<float> beta, sycl::buffer<std::complex<float>, 1>& c, int64_t ldc) {
+    check_cblas_ints(n, k, lda, ldc);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_csyrk>(cgh, [=]() {
+        host_task<class netlib_csyrk>(queue, cgh, [=]() {
             ::cblas_csyrk(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          (const int)n, (const int)k, (const void*)&alpha, accessor_a.GET_MULTI_PTR,
-                          (const int)lda, (const void*)&beta, accessor_c.GET_MULTI_PTR,
-                          (const int)ldc);
+                          to_cblas_int(n), to_cblas_int(k), (const void*)&alpha,
+                          accessor_a.GET_MULTI_PTR, to_cblas_int(lda), (const void*)&beta,
+                          accessor_c.GET_MULTI_PTR, to_cblas_int(ldc));
         });
     });
 }
@@ -343,14 +325,15 @@ void syrk(sycl::queue& queue, uplo upper_lower, transpose trans, int64_t n, int6
 void syrk(sycl::queue& queue, uplo upper_lower, transpose trans, int64_t n, int64_t k,
           std::complex<double> alpha, sycl::buffer<std::complex<double>, 1>& a, int64_t lda,
           std::complex<double> beta, sycl::buffer<std::complex<double>, 1>& c, int64_t ldc) {
+    check_cblas_ints(n, k, lda, ldc);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_zsyrk>(cgh, [=]() {
+        host_task<class netlib_zsyrk>(queue, cgh, [=]() {
             ::cblas_zsyrk(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          (const int)n, (const int)k, (const void*)&alpha, accessor_a.GET_MULTI_PTR,
-                          (const int)lda, (const void*)&beta, accessor_c.GET_MULTI_PTR,
-                          (const int)ldc);
+                          to_cblas_int(n), to_cblas_int(k), (const void*)&alpha,
+                          accessor_a.GET_MULTI_PTR, to_cblas_int(lda), (const void*)&beta,
+                          accessor_c.GET_MULTI_PTR, to_cblas_int(ldc));
         });
     });
 }
@@ -358,15 +341,17 @@ void syrk(sycl::queue& queue, uplo upper_lower, transpose trans, int64_t n, int6
 void syr2k(sycl::queue& queue, uplo upper_lower, transpose trans, int64_t n, int64_t k, float alpha,
            sycl::buffer<float, 1>& a, int64_t lda, sycl::buffer<float, 1>& b, int64_t ldb,
            float beta, sycl::buffer<float, 1>& c, int64_t ldc) {
+    check_cblas_ints(n, k, lda, ldb, ldc);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_ssyr2k>(cgh, [=]() {
+        host_task<class netlib_ssyr2k>(queue, cgh, [=]() {
             ::cblas_ssyr2k(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                           (const int)n, (const int)k, (const float)alpha, accessor_a.GET_MULTI_PTR,
-                           (const int)lda, accessor_b.GET_MULTI_PTR, (const int)ldb,
-                           (const float)beta, accessor_c.GET_MULTI_PTR, (const int)ldc);
+                           to_cblas_int(n), to_cblas_int(k), (const float)alpha,
+                           accessor_a.GET_MULTI_PTR, to_cblas_int(lda), accessor_b.GET_MULTI_PTR,
+                           to_cblas_int(ldb), (const float)beta, accessor_c.GET_MULTI_PTR,
+                           to_cblas_int(ldc));
         });
     });
 }
@@ -374,16 +359,17 @@ void syr2k(sycl::queue& queue, uplo upper_lower, transpose trans, int64_t n, int
 void syr2k(sycl::queue& queue, uplo upper_lower, transpose trans, int64_t n, int64_t k,
            double alpha, sycl::buffer<double, 1>& a, int64_t lda, sycl::buffer<double, 1>& b,
            int64_t ldb, double beta, sycl::buffer<double, 1>& c, int64_t ldc) {
+    check_cblas_ints(n, k, lda, ldb, ldc);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_dsyr2k>(cgh, [=]() {
+        host_task<class netlib_dsyr2k>(queue, cgh, [=]() {
             ::cblas_dsyr2k(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                           (const int)n, (const int)k, (const double)alpha,
-                           accessor_a.GET_MULTI_PTR, (const int)lda, accessor_b.GET_MULTI_PTR,
-                           (const int)ldb, (const double)beta, accessor_c.GET_MULTI_PTR,
-                           (const int)ldc);
+                           to_cblas_int(n), to_cblas_int(k), (const double)alpha,
+                           accessor_a.GET_MULTI_PTR, to_cblas_int(lda), accessor_b.GET_MULTI_PTR,
+                           to_cblas_int(ldb), (const double)beta, accessor_c.GET_MULTI_PTR,
+                           to_cblas_int(ldc));
         });
     });
 }
@@ -392,16 +378,17 @@ void syr2k(sycl::queue& queue, uplo upper_lower, transpose trans, int64_t n, int
            std::complex<float> alpha, sycl::buffer<std::complex<float>, 1>& a, int64_t lda,
            sycl::buffer<std::complex<float>, 1>& b, int64_t ldb, std::complex<float> beta,
            sycl::buffer<std::complex<float>, 1>& c, int64_t ldc) {
+    check_cblas_ints(n, k, lda, ldb, ldc);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_csyr2k>(cgh, [=]() {
+        host_task<class netlib_csyr2k>(queue, cgh, [=]() {
             ::cblas_csyr2k(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                           (const int)n, (const int)k, (const void*)&alpha,
-                           accessor_a.GET_MULTI_PTR, (const int)lda, accessor_b.GET_MULTI_PTR,
-                           (const int)ldb, (const void*)&beta, accessor_c.GET_MULTI_PTR,
-                           (const int)ldc);
+                           to_cblas_int(n), to_cblas_int(k), (const void*)&alpha,
+                           accessor_a.GET_MULTI_PTR, to_cblas_int(lda), accessor_b.GET_MULTI_PTR,
+                           to_cblas_int(ldb), (const void*)&beta, accessor_c.GET_MULTI_PTR,
+                           to_cblas_int(ldc));
         });
     });
 }
@@ -410,16 +397,17 @@ void syr2k(sycl::queue& queue, uplo upper_lower, transpose trans, int64_t n, int
            std::complex<double> alpha, sycl::buffer<std::complex<double>, 1>& a, int64_t lda,
            sycl::buffer<std::complex<double>, 1>& b, int64_t ldb, std::complex<double> beta,
            sycl::buffer<std::complex<double>, 1>& c, int64_t ldc) {
+    check_cblas_ints(n, k, lda, ldb, ldc);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<sycl::access::mode::read>(cgh);
         auto accessor_c = c.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_zsyr2k>(cgh, [=]() {
+        host_task<class netlib_zsyr2k>(queue, cgh, [=]() {
             ::cblas_zsyr2k(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                           (const int)n, (const int)k, (const void*)&alpha,
-                           accessor_a.GET_MULTI_PTR, (const int)lda, accessor_b.GET_MULTI_PTR,
-                           (const int)ldb, (const void*)&beta, accessor_c.GET_MULTI_PTR,
-                           (const int)ldc);
+                           to_cblas_int(n), to_cblas_int(k), (const void*)&alpha,
+                           accessor_a.GET_MULTI_PTR, to_cblas_int(lda), accessor_b.GET_MULTI_PTR,
+                           to_cblas_int(ldb), (const void*)&beta, accessor_c.GET_MULTI_PTR,
+                           to_cblas_int(ldc));
         });
     });
 }
@@ -427,15 +415,16 @@ void syr2k(sycl::queue& queue, uplo upper_lower, transpose trans, int64_t n, int
 void trmm(sycl::queue& queue, side left_right, uplo upper_lower, transpose transa, diag unit_diag,
           int64_t m, int64_t n, float alpha, sycl::buffer<float, 1>& a, int64_t lda,
           sycl::buffer<float, 1>& b, int64_t ldb) {
+    check_cblas_ints(m, n, lda, ldb);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_strmm>(cgh, [=]() {
+        host_task<class netlib_strmm>(queue, cgh, [=]() {
             ::cblas_strmm(MAJOR, convert_to_cblas_side(left_right),
                           convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
-                          (const float)alpha, accessor_a.GET_MULTI_PTR, (const int)lda,
-                          accessor_b.GET_MULTI_PTR, (const int)ldb);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(m), to_cblas_int(n),
+                          (const float)alpha, accessor_a.GET_MULTI_PTR, to_cblas_int(lda),
+                          accessor_b.GET_MULTI_PTR, to_cblas_int(ldb));
         });
     });
 }
@@ -443,15 +432,16 @@ void trmm(sycl::queue& queue, side left_right, uplo upper_lower, transpose trans
 void trmm(sycl::queue& queue, side left_right, uplo upper_lower, transpose transa, diag unit_diag,
           int64_t m, int64_t n, double alpha, sycl::buffer<double, 1>& a, int64_t lda,
           sycl::buffer<double, 1>& b, int64_t ldb) {
+    check_cblas_ints(m, n, lda, ldb);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_dtrmm>(cgh, [=]() {
+        host_task<class netlib_dtrmm>(queue, cgh, [=]() {
             ::cblas_dtrmm(MAJOR, convert_to_cblas_side(left_right),
                           convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
-                          (const double)alpha, accessor_a.GET_MULTI_PTR, (const int)lda,
-                          accessor_b.GET_MULTI_PTR, (const int)ldb);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(m), to_cblas_int(n),
+                          (const double)alpha, accessor_a.GET_MULTI_PTR, to_cblas_int(lda),
+                          accessor_b.GET_MULTI_PTR, to_cblas_int(ldb));
         });
     });
 }
@@ -459,15 +449,16 @@ void trmm(sycl::queue& queue, side left_right, uplo upper_lower, transpose trans
 void trmm(sycl::queue& queue, side left_right, uplo upper_lower, transpose transa, diag unit_diag,
           int64_t m, int64_t n, std::complex<float> alpha, sycl::buffer<std::complex<float>, 1>& a,
           int64_t lda, sycl::buffer<std::complex<float>, 1>& b, int64_t ldb) {
+    check_cblas_ints(m, n, lda, ldb);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_ctrmm>(cgh, [=]() {
+        host_task<class netlib_ctrmm>(queue, cgh, [=]() {
             ::cblas_ctrmm(MAJOR, convert_to_cblas_side(left_right),
                           convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
-                          (const void*)&alpha, accessor_a.GET_MULTI_PTR, (const int)lda,
-                          accessor_b.GET_MULTI_PTR, (const int)ldb);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(m), to_cblas_int(n),
+                          (const void*)&alpha, accessor_a.GET_MULTI_PTR, to_cblas_int(lda),
+                          accessor_b.GET_MULTI_PTR, to_cblas_int(ldb));
         });
     });
 }
@@ -476,15 +467,16 @@ void trmm(sycl::queue& queue, side left_right, uplo upper_lower, transpose trans
           int64_t m, int64_t n, std::complex<double> alpha,
           sycl::buffer<std::complex<double>, 1>& a, int64_t lda,
           sycl::buffer<std::complex<double>, 1>& b, int64_t ldb) {
+    check_cblas_ints(m, n, lda, ldb);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_ztrmm>(cgh, [=]() {
+        host_task<class netlib_ztrmm>(queue, cgh, [=]() {
             ::cblas_ztrmm(MAJOR, convert_to_cblas_side(left_right),
                           convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
-                          (const void*)&alpha, accessor_a.GET_MULTI_PTR, (const int)lda,
-                          accessor_b.GET_MULTI_PTR, (const int)ldb);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(m), to_cblas_int(n),
+                          (const void*)&alpha, accessor_a.GET_MULTI_PTR, to_cblas_int(lda),
+                          accessor_b.GET_MULTI_PTR, to_cblas_int(ldb));
         });
     });
 }
@@ -492,15 +484,16 @@ void trmm(sycl::queue& queue, side left_right, uplo upper_lower, transpose trans
 void trsm(sycl::queue& queue, side left_right, uplo upper_lower, transpose transa, diag unit_diag,
           int64_t m, int64_t n, float alpha, sycl::buffer<float, 1>& a, int64_t lda,
           sycl::buffer<float, 1>& b, int64_t ldb) {
+    check_cblas_ints(m, n, lda, ldb);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_strsm>(cgh, [=]() {
+        host_task<class netlib_strsm>(queue, cgh, [=]() {
             ::cblas_strsm(MAJOR, convert_to_cblas_side(left_right),
                           convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
-                          (const float)alpha, accessor_a.GET_MULTI_PTR, (const int)lda,
-                          accessor_b.GET_MULTI_PTR, (const int)ldb);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(m), to_cblas_int(n),
+                          (const float)alpha, accessor_a.GET_MULTI_PTR, to_cblas_int(lda),
+                          accessor_b.GET_MULTI_PTR, to_cblas_int(ldb));
         });
     });
 }
@@ -508,15 +501,16 @@ void trsm(sycl::queue& queue, side left_right, uplo upper_lower, transpose trans
 void trsm(sycl::queue& queue, side left_right, uplo upper_lower, transpose transa, diag unit_diag,
           int64_t m, int64_t n, double alpha, sycl::buffer<double, 1>& a, int64_t lda,
           sycl::buffer<double, 1>& b, int64_t ldb) {
+    check_cblas_ints(m, n, lda, ldb);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_dtrsm>(cgh, [=]() {
+        host_task<class netlib_dtrsm>(queue, cgh, [=]() {
             ::cblas_dtrsm(MAJOR, convert_to_cblas_side(left_right),
                           convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
-                          (const double)alpha, accessor_a.GET_MULTI_PTR, (const int)lda,
-                          accessor_b.GET_MULTI_PTR, (const int)ldb);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(m), to_cblas_int(n),
+                          (const double)alpha, accessor_a.GET_MULTI_PTR, to_cblas_int(lda),
+                          accessor_b.GET_MULTI_PTR, to_cblas_int(ldb));
         });
     });
 }
@@ -524,15 +518,16 @@ void trsm(sycl::queue& queue, side left_right, uplo upper_lower, transpose trans
 void trsm(sycl::queue& queue, side left_right, uplo upper_lower, transpose transa, diag unit_diag,
           int64_t m, int64_t n, std::complex<float> alpha, sycl::buffer<std::complex<float>, 1>& a,
           int64_t lda, sycl::buffer<std::complex<float>, 1>& b, int64_t ldb) {
+    check_cblas_ints(m, n, lda, ldb);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_ctrsm>(cgh, [=]() {
+        host_task<class netlib_ctrsm>(queue, cgh, [=]() {
             ::cblas_ctrsm(MAJOR, convert_to_cblas_side(left_right),
                           convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
-                          (const void*)&alpha, accessor_a.GET_MULTI_PTR, (const int)lda,
-                          accessor_b.GET_MULTI_PTR, (const int)ldb);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(m), to_cblas_int(n),
+                          (const void*)&alpha, accessor_a.GET_MULTI_PTR, to_cblas_int(lda),
+                          accessor_b.GET_MULTI_PTR, to_cblas_int(ldb));
         });
     });
 }
@@ -541,15 +536,16 @@ void trsm(sycl::queue& queue, side left_right, uplo upper_lower, transpose trans
           int64_t m, int64_t n, std::complex<double> alpha,
           sycl::buffer<std::complex<double>, 1>& a, int64_t lda,
           sycl::buffer<std::complex<double>, 1>& b, int64_t ldb) {
+    check_cblas_ints(m, n, lda, ldb);
     queue.submit([&](sycl::handler& cgh) {
         auto accessor_a = a.get_access<sycl::access::mode::read>(cgh);
         auto accessor_b = b.get_access<sycl::access::mode::read_write>(cgh);
-        host_task<class netlib_ztrsm>(cgh, [=]() {
+        host_task<class netlib_ztrsm>(queue, cgh, [=]() {
             ::cblas_ztrsm(MAJOR, convert_to_cblas_side(left_right),
                           convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
-                          (const void*)&alpha, accessor_a.GET_MULTI_PTR, (const int)lda,
-                          accessor_b.GET_MULTI_PTR, (const int)ldb);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(m), to_cblas_int(n),
+                          (const void*)&alpha, accessor_a.GET_MULTI_PTR, to_cblas_int(lda),
+                          accessor_b.GET_MULTI_PTR, to_cblas_int(ldb));
         });
     });
 }
@@ -564,10 +560,8 @@ sycl::event gemm(sycl::queue& queue, transpose transa, transpose transb, int64_t
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_sgemm_usm>(cgh, [=]() {
-            ::cblas_sgemm(MAJOR, convert_to_cblas_trans(transa), convert_to_cblas_trans(transb),
-                          (const int)m, (const int)n, (const int)k, (const float)alpha, a,
-                          (const int)lda, b, (const int)ldb, (const float)beta, c, (const int)ldc);
+        host_task<class netlib_sgemm_usm>(queue, cgh, [=]() {
+            gemm_in_tiles(MAJOR, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
         });
     });
     return done;
@@ -582,10 +576,8 @@ sycl::event gemm(sycl::queue& queue, transpose transa, transpose transb, int64_t
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_dgemm_usm>(cgh, [=]() {
-            ::cblas_dgemm(MAJOR, convert_to_cblas_trans(transa), convert_to_cblas_trans(transb),
-                          (const int)m, (const int)n, (const int)k, (const double)alpha, a,
-                          (const int)lda, b, (const int)ldb, (const double)beta, c, (const int)ldc);
+        host_task<class netlib_dgemm_usm>(queue, cgh, [=]() {
+            gemm_in_tiles(MAJOR, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
         });
     });
     return done;
@@ -601,10 +593,8 @@ sycl::event gemm(sycl::queue& queue, transpose transa, transpose transb, int64_t
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_cgemm_usm>(cgh, [=]() {
-            ::cblas_cgemm(MAJOR, convert_to_cblas_trans(transa), convert_to_cblas_trans(transb),
-                          (const int)m, (const int)n, (const int)k, (const void*)&alpha, a,
-                          (const int)lda, b, (const int)ldb, (const void*)&beta, c, (const int)ldc);
+        host_task<class netlib_cgemm_usm>(queue, cgh, [=]() {
+            gemm_in_tiles(MAJOR, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
         });
     });
     return done;
@@ -620,10 +610,8 @@ sycl::event gemm(sycl::queue& queue, transpose transa, transpose transb, int64_t
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_zgemm_usm>(cgh, [=]() {
-            ::cblas_zgemm(MAJOR, convert_to_cblas_trans(transa), convert_to_cblas_trans(transb),
-                          (const int)m, (const int)n, (const int)k, (const void*)&alpha, a,
-                          (const int)lda, b, (const int)ldb, (const void*)&beta, c, (const int)ldc);
+        host_task<class netlib_zgemm_usm>(queue, cgh, [=]() {
+            gemm_in_tiles(MAJOR, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
         });
     });
     return done;
@@ -633,36 +621,51 @@ sycl::event gemm(sycl::queue& queue, transpose transa, transpose transb, int64_t
                  int64_t k, sycl::half alpha, const sycl::half* a, int64_t lda, const sycl::half* b,
                  int64_t ldb, sycl::half beta, sycl::half* c, int64_t ldc,
                  const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_hgemm_usm>(queue, cgh, [=]() {
+            gemm_converted(MAJOR, transa, transb, m, n, k, (float)alpha, a, lda, b, ldb,
+                           (float)beta, c, ldc, get_workspace(queue));
+        });
+    });
+    return done;
 }
 
 sycl::event gemm(sycl::queue& queue, transpose transa, transpose transb, int64_t m, int64_t n,
                  int64_t k, float alpha, const sycl::half* a, int64_t lda, const sycl::half* b,
                  int64_t ldb, float beta, float* c, int64_t ldc,
                  const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_gemm_f16f16f32_usm>(queue, cgh, [=]() {
+            gemm_converted(MAJOR, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                           get_workspace(queue));
+        });
+    });
+    return done;
 }
 
 sycl::event gemm(sycl::queue& queue, transpose transa, transpose transb, int64_t m, int64_t n,
                  int64_t k, float alpha, const bfloat16* a, int64_t lda, const bfloat16* b,
                  int64_t ldb, float beta, float* c, int64_t ldc,
                  const std::vector<sycl::event>& dependencies) {
-#ifdef COLUMN_MAJOR
-    throw unimplemented("blas", "gemm", "for column_major layout");
-#endif
-#ifdef ROW_MAJOR
-    throw unimplemented("blas", "gemm", "for row_major layout");
-#endif
+    auto done = queue.submit([&](sycl::handler& cgh) {
+        int64_t num_events = dependencies.size();
+        for (int64_t i = 0; i < num_events; i++) {
+            cgh.depends_on(dependencies[i]);
+        }
+        host_task<class netlib_gemm_bf16bf16f32_usm>(queue, cgh, [=]() {
+            gemm_converted(MAJOR, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,
+                           get_workspace(queue));
+        });
+    });
+    return done;
 }
 
 sycl::event hemm(sycl::queue& queue, side left_right, uplo upper_lower, int64_t m, int64_t n,
@@ -670,16 +673,17 @@ sycl::event hemm(sycl::queue& queue, side left_right, uplo upper_lower, int64_t
                  const std::complex<float>* b, int64_t ldb, std::complex<float> beta,
                  std::complex<float>* c, int64_t ldc,
                  const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(m, n, lda, ldb, ldc);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_chemm_usm>(cgh, [=]() {
+        host_task<class netlib_chemm_usm>(queue, cgh, [=]() {
             ::cblas_chemm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), (const int)m, (const int)n,
-                          (const void*)&alpha, a, (const int)lda, b, (const int)ldb,
-                          (const void*)&beta, c, (const int)ldc);
+                          convert_to_cblas_uplo(upper_lower), to_cblas_int(m), to_cblas_int(n),
+                          (const void*)&alpha, a, to_cblas_int(lda), b, to_cblas_int(ldb),
+                          (const void*)&beta, c, to_cblas_int(ldc));
         });
     });
     return done;
@@ -690,16 +694,17 @@ sycl::event hemm(sycl::queue& queue, side left_right, uplo upper_lower, int64_t
                  const std::complex<double>* b, int64_t ldb, std::complex<double> beta,
                  std::complex<double>* c, int64_t ldc,
                  const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(m, n, lda, ldb, ldc);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_zhemm_usm>(cgh, [=]() {
+        host_task<class netlib_zhemm_usm>(queue, cgh, [=]() {
             ::cblas_zhemm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), (const int)m, (const int)n,
-                          (const void*)&alpha, a, (const int)lda, b, (const int)ldb,
-                          (const void*)&beta, c, (const int)ldc);
+                          convert_to_cblas_uplo(upper_lower), to_cblas_int(m), to_cblas_int(n),
+                          (const void*)&alpha, a, to_cblas_int(lda), b, to_cblas_int(ldb),
+                          (const void*)&beta, c, to_cblas_int(ldc));
         });
     });
     return done;
@@ -709,15 +714,16 @@ sycl::event herk(sycl::queue& queue, uplo upper_lower, transpose trans, int64_t
                  float alpha, const std::complex<float>* a, int64_t lda, float beta,
                  std::complex<float>* c, int64_t ldc,
                  const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(n, k, lda, ldc);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_cherk_usm>(cgh, [=]() {
+        host_task<class netlib_cherk_usm>(queue, cgh, [=]() {
             ::cblas_cherk(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          (const int)n, (const int)k, (const float)alpha, a, (const int)lda,
-                          (const float)beta, c, (const int)ldc);
+                          to_cblas_int(n), to_cblas_int(k), (const float)alpha, a,
+                          to_cblas_int(lda), (const float)beta, c, to_cblas_int(ldc));
         });
     });
     return done;
@@ -727,15 +733,16 @@ sycl::event herk(sycl::queue& queue, uplo upper_lower, transpose trans, int64_t
                  double alpha, const std::complex<double>* a, int64_t lda, double beta,
                  std::complex<double>* c, int64_t ldc,
                  const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(n, k, lda, ldc);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_zherk_usm>(cgh, [=]() {
+        host_task<class netlib_zherk_usm>(queue, cgh, [=]() {
             ::cblas_zherk(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          (const int)n, (const int)k, (const double)alpha, a, (const int)lda,
-                          (const double)beta, c, (const int)ldc);
+                          to_cblas_int(n), to_cblas_int(k), (const double)alpha, a,
+                          to_cblas_int(lda), (const double)beta, c, to_cblas_int(ldc));
         });
     });
     return done;
@@ -745,15 +752,17 @@ sycl::event her2k(sycl::queue& queue, uplo upper_lower, transpose trans, int64_t
                   std::complex<float> alpha, const std::complex<float>* a, int64_t lda,
                   const std::complex<float>* b, int64_t ldb, float beta, std::complex<float>* c,
                   int64_t ldc, const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(n, k, lda, ldb, ldc);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_cher2k_usm>(cgh, [=]() {
+        host_task<class netlib_cher2k_usm>(queue, cgh, [=]() {
             ::cblas_cher2k(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                           (const int)n, (const int)k, (const void*)&alpha, a, (const int)lda, b,
-                           (const int)ldb, (const float)beta, c, (const int)ldc);
+                           to_cblas_int(n), to_cblas_int(k), (const void*)&alpha, a,
+                           to_cblas_int(lda), b, to_cblas_int(ldb), (const float)beta, c,
+                           to_cblas_int(ldc));
         });
     });
     return done;
@@ -763,15 +772,17 @@ sycl::event her2k(sycl::queue& queue, uplo upper_lower, transpose trans, int64_t
                   std::complex<double> alpha, const std::complex<double>* a, int64_t lda,
                   const std::complex<double>* b, int64_t ldb, double beta, std::complex<double>* c,
                   int64_t ldc, const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(n, k, lda, ldb, ldc);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_zher2k_usm>(cgh, [=]() {
+        host_task<class netlib_zher2k_usm>(queue, cgh, [=]() {
             ::cblas_zher2k(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                           (const int)n, (const int)k, (const void*)&alpha, a, (const int)lda, b,
-                           (const int)ldb, (const double)beta, c, (const int)ldc);
+                           to_cblas_int(n), to_cblas_int(k), (const void*)&alpha, a,
+                           to_cblas_int(lda), b, to_cblas_int(ldb), (const double)beta, c,
+                           to_cblas_int(ldc));
         });
     });
     return done;
@@ -780,16 +791,17 @@ sycl::event her2k(sycl::queue& queue, uplo upper_lower, transpose trans, int64_t
 sycl::event symm(sycl::queue& queue, side left_right, uplo upper_lower, int64_t m, int64_t n,
                  float alpha, const float* a, int64_t lda, const float* b, int64_t ldb, float beta,
                  float* c, int64_t ldc, const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(m, n, lda, ldb, ldc);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_ssymm_usm>(cgh, [=]() {
+        host_task<class netlib_ssymm_usm>(queue, cgh, [=]() {
             ::cblas_ssymm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), (const int)m, (const int)n,
-                          (const float)alpha, a, (const int)lda, b, (const int)ldb,
-                          (const float)beta, c, (const int)ldc);
+                          convert_to_cblas_uplo(upper_lower), to_cblas_int(m), to_cblas_int(n),
+                          (const float)alpha, a, to_cblas_int(lda), b, to_cblas_int(ldb),
+                          (const float)beta, c, to_cblas_int(ldc));
         });
     });
     return done;
@@ -799,16 +811,17 @@ sycl::event symm(sycl::queue& queue, side left_right, uplo upper_lower, int64_t
                  double alpha, const double* a, int64_t lda, const double* b, int64_t ldb,
                  double beta, double* c, int64_t ldc,
                  const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(m, n, lda, ldb, ldc);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_dsymm_usm>(cgh, [=]() {
+        host_task<class netlib_dsymm_usm>(queue, cgh, [=]() {
             ::cblas_dsymm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), (const int)m, (const int)n,
-                          (const double)alpha, a, (const int)lda, b, (const int)ldb,
-                          (const double)beta, c, (const int)ldc);
+                          convert_to_cblas_uplo(upper_lower), to_cblas_int(m), to_cblas_int(n),
+                          (const double)alpha, a, to_cblas_int(lda), b, to_cblas_int(ldb),
+                          (const double)beta, c, to_cblas_int(ldc));
         });
     });
     return done;
@@ -819,16 +832,17 @@ sycl::event symm(sycl::queue& queue, side left_right, uplo upper_lower, int64_t
                  const std::complex<float>* b, int64_t ldb, std::complex<float> beta,
                  std::complex<float>* c, int64_t ldc,
                  const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(m, n, lda, ldb, ldc);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_csymm_usm>(cgh, [=]() {
+        host_task<class netlib_csymm_usm>(queue, cgh, [=]() {
             ::cblas_csymm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), (const int)m, (const int)n,
-                          (const void*)&alpha, a, (const int)lda, b, (const int)ldb,
-                          (const void*)&beta, c, (const int)ldc);
+                          convert_to_cblas_uplo(upper_lower), to_cblas_int(m), to_cblas_int(n),
+                          (const void*)&alpha, a, to_cblas_int(lda), b, to_cblas_int(ldb),
+                          (const void*)&beta, c, to_cblas_int(ldc));
         });
     });
     return done;
@@ -839,16 +853,17 @@ sycl::event symm(sycl::queue& queue, side left_right, uplo upper_lower, int64_t
                  const std::complex<double>* b, int64_t ldb, std::complex<double> beta,
                  std::complex<double>* c, int64_t ldc,
                  const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(m, n, lda, ldb, ldc);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_zsymm_usm>(cgh, [=]() {
+        host_task<class netlib_zsymm_usm>(queue, cgh, [=]() {
             ::cblas_zsymm(MAJOR, convert_to_cblas_side(left_right),
-                          convert_to_cblas_uplo(upper_lower), (const int)m, (const int)n,
-                          (const void*)&alpha, a, (const int)lda, b, (const int)ldb,
-                          (const void*)&beta, c, (const int)ldc);
+                          convert_to_cblas_uplo(upper_lower), to_cblas_int(m), to_cblas_int(n),
+                          (const void*)&alpha, a, to_cblas_int(lda), b, to_cblas_int(ldb),
+                          (const void*)&beta, c, to_cblas_int(ldc));
         });
     });
     return done;
@@ -857,15 +872,16 @@ sycl::event symm(sycl::queue& queue, side left_right, uplo upper_lower, int64_t
 sycl::event syrk(sycl::queue& queue, uplo upper_lower, transpose trans, int64_t n, int64_t k,
                  float alpha, const float* a, int64_t lda, float beta, float* c, int64_t ldc,
                  const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(n, k, lda, ldc);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_ssyrk_usm>(cgh, [=]() {
+        host_task<class netlib_ssyrk_usm>(queue, cgh, [=]() {
             ::cblas_ssyrk(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          (const int)n, (const int)k, (const float)alpha, a, (const int)lda,
-                          (const float)beta, c, (const int)ldc);
+                          to_cblas_int(n), to_cblas_int(k), (const float)alpha, a,
+                          to_cblas_int(lda), (const float)beta, c, to_cblas_int(ldc));
         });
     });
     return done;
@@ -874,15 +890,16 @@ sycl::event syrk(sycl::queue& queue, uplo upper_lower, transpose trans, int64_t
 sycl::event syrk(sycl::queue& queue, uplo upper_lower, transpose trans, int64_t n, int64_t k,
                  double alpha, const double* a, int64_t lda, double beta, double* c, int64_t ldc,
                  const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(n, k, lda, ldc);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_dsyrk_usm>(cgh, [=]() {
+        host_task<class netlib_dsyrk_usm>(queue, cgh, [=]() {
             ::cblas_dsyrk(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          (const int)n, (const int)k, (const double)alpha, a, (const int)lda,
-                          (const double)beta, c, (const int)ldc);
+                          to_cblas_int(n), to_cblas_int(k), (const double)alpha, a,
+                          to_cblas_int(lda), (const double)beta, c, to_cblas_int(ldc));
         });
     });
     return done;
@@ -892,15 +909,16 @@ sycl::event syrk(sycl::queue& queue, uplo upper_lower, transpose trans, int64_t
                  std::complex<float> alpha, const std::complex<float>* a, int64_t lda,
                  std::complex<float> beta, std::complex<float>* c, int64_t ldc,
                  const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(n, k, lda, ldc);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_csyrk_usm>(cgh, [=]() {
+        host_task<class netlib_csyrk_usm>(queue, cgh, [=]() {
             ::cblas_csyrk(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          (const int)n, (const int)k, (const void*)&alpha, a, (const int)lda,
-                          (const void*)&beta, c, (const int)ldc);
+                          to_cblas_int(n), to_cblas_int(k), (const void*)&alpha, a,
+                          to_cblas_int(lda), (const void*)&beta, c, to_cblas_int(ldc));
         });
     });
     return done;
@@ -910,15 +928,16 @@ sycl::event syrk(sycl::queue& queue, uplo upper_lower, transpose trans, int64_t
                  std::complex<double> alpha, const std::complex<double>* a, int64_t lda,
                  std::complex<double> beta, std::complex<double>* c, int64_t ldc,
                  const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(n, k, lda, ldc);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_zsyrk_usm>(cgh, [=]() {
+        host_task<class netlib_zsyrk_usm>(queue, cgh, [=]() {
             ::cblas_zsyrk(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                          (const int)n, (const int)k, (const void*)&alpha, a, (const int)lda,
-                          (const void*)&beta, c, (const int)ldc);
+                          to_cblas_int(n), to_cblas_int(k), (const void*)&alpha, a,
+                          to_cblas_int(lda), (const void*)&beta, c, to_cblas_int(ldc));
         });
     });
     return done;
@@ -927,15 +946,17 @@ sycl::event syrk(sycl::queue& queue, uplo upper_lower, transpose trans, int64_t
 sycl::event syr2k(sycl::queue& queue, uplo upper_lower, transpose trans, int64_t n, int64_t k,
                   float alpha, const float* a, int64_t lda, const float* b, int64_t ldb, float beta,
                   float* c, int64_t ldc, const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(n, k, lda, ldb, ldc);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_ssyr2k_usm>(cgh, [=]() {
+        host_task<class netlib_ssyr2k_usm>(queue, cgh, [=]() {
             ::cblas_ssyr2k(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                           (const int)n, (const int)k, (const float)alpha, a, (const int)lda, b,
-                           (const int)ldb, (const float)beta, c, (const int)ldc);
+                           to_cblas_int(n), to_cblas_int(k), (const float)alpha, a,
+                           to_cblas_int(lda), b, to_cblas_int(ldb), (const float)beta, c,
+                           to_cblas_int(ldc));
         });
     });
     return done;
@@ -945,15 +966,17 @@ sycl::event syr2k(sycl::queue& queue, uplo upper_lower, transpose trans, int64_t
                   double alpha, const double* a, int64_t lda, const double* b, int64_t ldb,
                   double beta, double* c, int64_t ldc,
                   const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(n, k, lda, ldb, ldc);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_dsyr2k_usm>(cgh, [=]() {
+        host_task<class netlib_dsyr2k_usm>(queue, cgh, [=]() {
             ::cblas_dsyr2k(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                           (const int)n, (const int)k, (const double)alpha, a, (const int)lda, b,
-                           (const int)ldb, (const double)beta, c, (const int)ldc);
+                           to_cblas_int(n), to_cblas_int(k), (const double)alpha, a,
+                           to_cblas_int(lda), b, to_cblas_int(ldb), (const double)beta, c,
+                           to_cblas_int(ldc));
         });
     });
     return done;
@@ -964,15 +987,17 @@ sycl::event syr2k(sycl::queue& queue, uplo upper_lower, transpose trans, int64_t
                   const std::complex<float>* b, int64_t ldb, std::complex<float> beta,
                   std::complex<float>* c, int64_t ldc,
                   const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(n, k, lda, ldb, ldc);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_csyr2k_usm>(cgh, [=]() {
+        host_task<class netlib_csyr2k_usm>(queue, cgh, [=]() {
             ::cblas_csyr2k(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                           (const int)n, (const int)k, (const void*)&alpha, a, (const int)lda, b,
-                           (const int)ldb, (const void*)&beta, c, (const int)ldc);
+                           to_cblas_int(n), to_cblas_int(k), (const void*)&alpha, a,
+                           to_cblas_int(lda), b, to_cblas_int(ldb), (const void*)&beta, c,
+                           to_cblas_int(ldc));
         });
     });
     return done;
@@ -983,15 +1008,17 @@ sycl::event syr2k(sycl::queue& queue, uplo upper_lower, transpose trans, int64_t
                   const std::complex<double>* b, int64_t ldb, std::complex<double> beta,
                   std::complex<double>* c, int64_t ldc,
                   const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(n, k, lda, ldb, ldc);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_zsyr2k_usm>(cgh, [=]() {
+        host_task<class netlib_zsyr2k_usm>(queue, cgh, [=]() {
             ::cblas_zsyr2k(MAJOR, convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(trans),
-                           (const int)n, (const int)k, (const void*)&alpha, a, (const int)lda, b,
-                           (const int)ldb, (const void*)&beta, c, (const int)ldc);
+                           to_cblas_int(n), to_cblas_int(k), (const void*)&alpha, a,
+                           to_cblas_int(lda), b, to_cblas_int(ldb), (const void*)&beta, c,
+                           to_cblas_int(ldc));
         });
     });
     return done;
@@ -1000,16 +1027,17 @@ sycl::event syr2k(sycl::queue& queue, uplo upper_lower, transpose trans, int64_t
 sycl::event trmm(sycl::queue& queue, side left_right, uplo upper_lower, transpose transa,
                  diag unit_diag, int64_t m, int64_t n, float alpha, const float* a, int64_t lda,
                  float* b, int64_t ldb, const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(m, n, lda, ldb);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_strmm_usm>(cgh, [=]() {
+        host_task<class netlib_strmm_usm>(queue, cgh, [=]() {
             ::cblas_strmm(MAJOR, convert_to_cblas_side(left_right),
                           convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
-                          (const float)alpha, a, (const int)lda, b, (const int)ldb);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(m), to_cblas_int(n),
+                          (const float)alpha, a, to_cblas_int(lda), b, to_cblas_int(ldb));
         });
     });
     return done;
@@ -1018,16 +1046,17 @@ sycl::event trmm(sycl::queue& queue, side left_right, uplo upper_lower, transpos
 sycl::event trmm(sycl::queue& queue, side left_right, uplo upper_lower, transpose transa,
                  diag unit_diag, int64_t m, int64_t n, double alpha, const double* a, int64_t lda,
                  double* b, int64_t ldb, const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(m, n, lda, ldb);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_dtrmm_usm>(cgh, [=]() {
+        host_task<class netlib_dtrmm_usm>(queue, cgh, [=]() {
             ::cblas_dtrmm(MAJOR, convert_to_cblas_side(left_right),
                           convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
-                          (const double)alpha, a, (const int)lda, b, (const int)ldb);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(m), to_cblas_int(n),
+                          (const double)alpha, a, to_cblas_int(lda), b, to_cblas_int(ldb));
         });
     });
     return done;
@@ -1037,16 +1066,17 @@ sycl::event trmm(sycl::queue& queue, side left_right, uplo upper_lower, transpos
                  diag unit_diag, int64_t m, int64_t n, std::complex<float> alpha,
                  const std::complex<float>* a, int64_t lda, std::complex<float>* b, int64_t ldb,
                  const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(m, n, lda, ldb);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_ctrmm_usm>(cgh, [=]() {
+        host_task<class netlib_ctrmm_usm>(queue, cgh, [=]() {
             ::cblas_ctrmm(MAJOR, convert_to_cblas_side(left_right),
                           convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
-                          (const void*)&alpha, a, (const int)lda, b, (const int)ldb);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(m), to_cblas_int(n),
+                          (const void*)&alpha, a, to_cblas_int(lda), b, to_cblas_int(ldb));
         });
     });
     return done;
@@ -1056,16 +1086,17 @@ sycl::event trmm(sycl::queue& queue, side left_right, uplo upper_lower, transpos
                  diag unit_diag, int64_t m, int64_t n, std::complex<double> alpha,
                  const std::complex<double>* a, int64_t lda, std::complex<double>* b, int64_t ldb,
                  const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(m, n, lda, ldb);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_ztrmm_usm>(cgh, [=]() {
+        host_task<class netlib_ztrmm_usm>(queue, cgh, [=]() {
             ::cblas_ztrmm(MAJOR, convert_to_cblas_side(left_right),
                           convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
-                          (const void*)&alpha, a, (const int)lda, b, (const int)ldb);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(m), to_cblas_int(n),
+                          (const void*)&alpha, a, to_cblas_int(lda), b, to_cblas_int(ldb));
         });
     });
     return done;
@@ -1074,16 +1105,17 @@ sycl::event trmm(sycl::queue& queue, side left_right, uplo upper_lower, transpos
 sycl::event trsm(sycl::queue& queue, side left_right, uplo upper_lower, transpose transa,
                  diag unit_diag, int64_t m, int64_t n, float alpha, const float* a, int64_t lda,
                  float* b, int64_t ldb, const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(m, n, lda, ldb);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_strsm_usm>(cgh, [=]() {
+        host_task<class netlib_strsm_usm>(queue, cgh, [=]() {
             ::cblas_strsm(MAJOR, convert_to_cblas_side(left_right),
                           convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
-                          (const float)alpha, a, (const int)lda, b, (const int)ldb);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(m), to_cblas_int(n),
+                          (const float)alpha, a, to_cblas_int(lda), b, to_cblas_int(ldb));
         });
     });
     return done;
@@ -1092,16 +1124,17 @@ sycl::event trsm(sycl::queue& queue, side left_right, uplo upper_lower, transpos
 sycl::event trsm(sycl::queue& queue, side left_right, uplo upper_lower, transpose transa,
                  diag unit_diag, int64_t m, int64_t n, double alpha, const double* a, int64_t lda,
                  double* b, int64_t ldb, const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(m, n, lda, ldb);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_dtrsm_usm>(cgh, [=]() {
+        host_task<class netlib_dtrsm_usm>(queue, cgh, [=]() {
             ::cblas_dtrsm(MAJOR, convert_to_cblas_side(left_right),
                           convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
-                          (const double)alpha, a, (const int)lda, b, (const int)ldb);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(m), to_cblas_int(n),
+                          (const double)alpha, a, to_cblas_int(lda), b, to_cblas_int(ldb));
         });
     });
     return done;
@@ -1111,16 +1144,17 @@ sycl::event trsm(sycl::queue& queue, side left_right, uplo upper_lower, transpos
                  diag unit_diag, int64_t m, int64_t n, std::complex<float> alpha,
                  const std::complex<float>* a, int64_t lda, std::complex<float>* b, int64_t ldb,
                  const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(m, n, lda, ldb);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_ctrsm_usm>(cgh, [=]() {
+        host_task<class netlib_ctrsm_usm>(queue, cgh, [=]() {
             ::cblas_ctrsm(MAJOR, convert_to_cblas_side(left_right),
                           convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
-                          (const void*)&alpha, a, (const int)lda, b, (const int)ldb);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(m), to_cblas_int(n),
+                          (const void*)&alpha, a, to_cblas_int(lda), b, to_cblas_int(ldb));
         });
     });
     return done;
@@ -1130,16 +1164,17 @@ sycl::event trsm(sycl::queue& queue, side left_right, uplo upper_lower, transpos
                  diag unit_diag, int64_t m, int64_t n, std::complex<double> alpha,
                  const std::complex<double>* a, int64_t lda, std::complex<double>* b, int64_t ldb,
                  const std::vector<sycl::event>& dependencies) {
+    check_cblas_ints(m, n, lda, ldb);
     auto done = queue.submit([&](sycl::handler& cgh) {
         int64_t num_events = dependencies.size();
         for (int64_t i = 0; i < num_events; i++) {
             cgh.depends_on(dependencies[i]);
         }
-        host_task<class netlib_ztrsm_usm>(cgh, [=]() {
+        host_task<class netlib_ztrsm_usm>(queue, cgh, [=]() {
             ::cblas_ztrsm(MAJOR, convert_to_cblas_side(left_right),
                           convert_to_cblas_uplo(upper_lower), convert_to_cblas_trans(transa),
-                          convert_to_cblas_diag(unit_diag), (const int)m, (const int)n,
-                          (const void*)&alpha, a, (const int)lda, b, (const int)ldb);
+                          convert_to_cblas_diag(unit_diag), to_cblas_int(m), to_cblas_int(n),
+                          (const void*)&alpha, a, to_cblas_int(lda), b, to_cblas_int(ldb));
         });
     });
     return done;
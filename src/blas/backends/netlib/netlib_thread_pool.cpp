@@ -0,0 +1,219 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+
+#include "netlib_thread_pool.hpp"
+
+#include <algorithm>
+#ifdef __linux__
+#include <pthread.h>
+#endif
+
+#include "oneapi/math/exceptions.hpp"
+
+namespace oneapi {
+namespace math {
+namespace blas {
+namespace netlib {
+
+// Execution policy of the host task running on the thread, if any
+static thread_local const cpu_execution_policy* current_policy = nullptr;
+
+// Set on the pool threads, and on a thread while it runs a parallel_for on the pool
+static thread_local bool in_pool = false;
+
+#ifdef __linux__
+static cpu_set_t to_cpu_set(const std::vector<int>& cpus) {
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (int cpu : cpus) {
+        if (cpu >= 0 && cpu < CPU_SETSIZE)
+            CPU_SET(cpu, &cpu_set);
+    }
+    return cpu_set;
+}
+
+// Returns false if none of the CPUs are valid or available to the thread
+static bool bind_thread(const cpu_set_t& cpus) {
+    return CPU_COUNT(&cpus) > 0 &&
+           pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus) == 0;
+}
+#endif
+
+thread_pool& thread_pool::get() {
+    static thread_pool pool([]() -> std::size_t {
+        const unsigned num_cores = std::thread::hardware_concurrency();
+        return num_cores > 1 ? num_cores - 1 : 0;
+    }());
+    return pool;
+}
+
+thread_pool::thread_pool(std::size_t num_workers) {
+#ifdef __linux__
+    if (pthread_getaffinity_np(pthread_self(), sizeof(default_cpus_), &default_cpus_) != 0)
+        CPU_ZERO(&default_cpus_);
+#endif
+    workers_.reserve(num_workers);
+    for (std::size_t i = 0; i < num_workers; ++i)
+        workers_.emplace_back([this, i]() { work(i); });
+}
+
+thread_pool::~thread_pool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    start_.notify_all();
+    for (auto& worker : workers_)
+        worker.join();
+}
+
+std::size_t thread_pool::num_threads() const {
+    const std::size_t max_threads = current_policy ? current_policy->num_threads : 0;
+    return max_threads > 0 ? std::min(max_threads, workers_.size() + 1) : workers_.size() + 1;
+}
+
+bool thread_pool::try_acquire() {
+    if (in_pool)
+        return false;
+    bool idle = false;
+    return busy_.compare_exchange_strong(idle, true, std::memory_order_acquire);
+}
+
+void thread_pool::run(std::int64_t count, item_fn_t fn, void* f) {
+    // Releases the pool once the items are done, or one of them has thrown
+    struct release_guard {
+        std::atomic<bool>& busy;
+        ~release_guard() {
+            in_pool = false;
+            busy.store(false, std::memory_order_release);
+        }
+    } release{ busy_ };
+    in_pool = true;
+    const std::size_t num_active = num_threads() - 1;
+    if (num_active == 0) {
+        for (std::int64_t i = 0; i < count; ++i)
+            fn(f, i);
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        fn_ = fn;
+        f_ = f;
+        count_ = count;
+        next_.store(0, std::memory_order_relaxed);
+        num_active_ = num_active;
+        policy_ = current_policy;
+        running_ = num_active + 1;
+        error_ = nullptr;
+        ++generation_;
+    }
+    start_.notify_all();
+    run_items();
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_.wait(lock, [this]() { return running_ == 0; });
+    if (error_)
+        std::rethrow_exception(error_);
+}
+
+void thread_pool::run_items() {
+    try {
+        for (std::int64_t i = next_.fetch_add(1); i < count_; i = next_.fetch_add(1))
+            fn_(f_, i);
+    }
+    catch (...) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!error_)
+            error_ = std::current_exception();
+        next_.store(count_);
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (--running_ == 0)
+        done_.notify_one();
+}
+
+void thread_pool::work(std::size_t index) {
+    in_pool = true;
+#ifdef __linux__
+    // CPUs the worker is bound to by the policy of the last items it ran, if any
+    bool bound = false;
+    cpu_set_t cpus;
+#endif
+    std::uint64_t generation = 0;
+    while (true) {
+        const cpu_execution_policy* policy;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            start_.wait(lock, [&]() { return stop_ || generation_ != generation; });
+            if (stop_)
+                return;
+            generation = generation_;
+            if (index >= num_active_)
+                continue;
+            policy = policy_;
+        }
+#ifdef __linux__
+        if (policy && !policy->cpus.empty()) {
+            const cpu_set_t policy_cpus = to_cpu_set(policy->cpus);
+            if (!bound || !CPU_EQUAL(&policy_cpus, &cpus)) {
+                cpus = policy_cpus;
+                bind_thread(cpus);
+                bound = true;
+            }
+        }
+        else if (bound) {
+            pthread_setaffinity_np(pthread_self(), sizeof(default_cpus_), &default_cpus_);
+            bound = false;
+        }
+#endif
+        run_items();
+    }
+}
+
+policy_scope::policy_scope(std::shared_ptr<const cpu_execution_policy> policy)
+        : policy_(std::move(policy)),
+          previous_(current_policy) {
+    if (!policy_)
+        return;
+#ifdef __linux__
+    if (!policy_->cpus.empty()) {
+        // The pool threads are created unbound, with the CPUs of the thread creating the pool
+        (void)thread_pool::get();
+        pthread_getaffinity_np(pthread_self(), sizeof(previous_cpus_), &previous_cpus_);
+        if (!bind_thread(to_cpu_set(policy_->cpus)))
+            throw invalid_argument("blas", "cpu_execution_policy",
+                                   "none of the CPUs of the policy are available");
+        bound_ = true;
+    }
+#endif
+    current_policy = policy_.get();
+}
+
+policy_scope::~policy_scope() {
+#ifdef __linux__
+    if (bound_)
+        pthread_setaffinity_np(pthread_self(), sizeof(previous_cpus_), &previous_cpus_);
+#endif
+    current_policy = previous_;
+}
+
+} // namespace netlib
+} // namespace blas
+} // namespace math
+} // namespace oneapi
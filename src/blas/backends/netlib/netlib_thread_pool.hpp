@@ -0,0 +1,147 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _NETLIB_THREAD_POOL_HPP_
+#define _NETLIB_THREAD_POOL_HPP_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+#include "oneapi/math/cpu_execution_policy.hpp"
+
+namespace oneapi {
+namespace math {
+namespace blas {
+namespace netlib {
+
+/**
+ * Host threads spreading the independent items of a batch routine over the cores. The
+ * reference CBLAS routines are single threaded, so without it a batch runs on the one
+ * host task thread.
+ */
+class thread_pool {
+public:
+    static thread_pool& get();
+
+    ~thread_pool();
+    thread_pool(const thread_pool&) = delete;
+    thread_pool& operator=(const thread_pool&) = delete;
+
+    // Number of threads running the items of a parallel_for, the calling one included. At
+    // most the num_threads of the execution policy of the calling thread.
+    std::size_t num_threads() const;
+
+    // Calls f(i) for every i in [0, count) from the pool threads and the calling thread,
+    // and returns once all the calls have returned. Items are handed out one at a time, so
+    // that items of different cost balance out. If a call throws, the remaining items are
+    // skipped and the first exception is rethrown. While the pool runs another
+    // parallel_for, including from within f, the items run on the calling thread only. The
+    // pool threads running the items are bound to the CPUs of the execution policy of the
+    // calling thread.
+    template <typename F>
+    void parallel_for(std::int64_t count, F&& f) {
+        if (count > 1 && !workers_.empty() && try_acquire()) {
+            run(count, &call<std::remove_reference_t<F>>, &f);
+            return;
+        }
+        for (std::int64_t i = 0; i < count; ++i)
+            f(i);
+    }
+
+private:
+    using item_fn_t = void (*)(void*, std::int64_t);
+
+    explicit thread_pool(std::size_t num_workers);
+
+    template <typename F>
+    static void call(void* f, std::int64_t i) {
+        (*static_cast<F*>(f))(i);
+    }
+
+    // Takes the pool for a parallel_for of the calling thread. Fails if another thread has
+    // it, or if the calling thread is a pool thread or is running a parallel_for already.
+    bool try_acquire();
+    // Runs a parallel_for on the acquired pool, and releases it
+    void run(std::int64_t count, item_fn_t fn, void* f);
+    void run_items();
+    void work(std::size_t index);
+
+    std::vector<std::thread> workers_;
+
+    // Set while a thread runs a parallel_for on the pool
+    std::atomic<bool> busy_{ false };
+
+    // Current parallel_for, published under mutex_ by incrementing generation_
+    std::mutex mutex_;
+    std::condition_variable start_;
+    std::condition_variable done_;
+    std::uint64_t generation_ = 0;
+    bool stop_ = false;
+    item_fn_t fn_ = nullptr;
+    void* f_ = nullptr;
+    std::int64_t count_ = 0;
+    std::atomic<std::int64_t> next_{ 0 };
+    std::size_t running_ = 0;
+    std::exception_ptr error_;
+    // Workers with a lower index run the items, with the execution policy of the caller
+    std::size_t num_active_ = 0;
+    const cpu_execution_policy* policy_ = nullptr;
+#ifdef __linux__
+    // CPUs of the thread creating the pool, which unbound workers run on
+    cpu_set_t default_cpus_;
+#endif
+};
+
+/**
+ * Applies the execution policy of the queue a host task was submitted to, if any, to the
+ * thread running the task until the end of the scope: the thread is bound to the CPUs of the
+ * policy, and the parallel_for calls it makes run on at most num_threads threads.
+ */
+class policy_scope {
+public:
+    explicit policy_scope(std::shared_ptr<const cpu_execution_policy> policy);
+    ~policy_scope();
+    policy_scope(const policy_scope&) = delete;
+    policy_scope& operator=(const policy_scope&) = delete;
+
+private:
+    std::shared_ptr<const cpu_execution_policy> policy_;
+    const cpu_execution_policy* previous_;
+#ifdef __linux__
+    bool bound_ = false;
+    cpu_set_t previous_cpus_;
+#endif
+};
+
+} // namespace netlib
+} // namespace blas
+} // namespace math
+} // namespace oneapi
+
+#endif //_NETLIB_THREAD_POOL_HPP_
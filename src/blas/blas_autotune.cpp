@@ -0,0 +1,71 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <cstdlib>
+
+#include "blas/blas_autotune.hpp"
+
+namespace oneapi {
+namespace math {
+namespace blas {
+namespace detail {
+
+static std::string default_cache_path() {
+#ifdef _WIN64
+    const char* dir = std::getenv("LOCALAPPDATA");
+    return dir ? std::string(dir) + "\\onemath_blas_autotune.txt" : "";
+#else
+    if (const char* dir = std::getenv("XDG_CACHE_HOME"))
+        return std::string(dir) + "/onemath_blas_autotune.txt";
+    const char* home = std::getenv("HOME");
+    return home ? std::string(home) + "/.cache/onemath_blas_autotune.txt" : "";
+#endif
+}
+
+// Names the BLAS backend libraries of the build and the devices of the machine
+static std::string cache_identity() {
+    std::string identity;
+    for (const auto& device_libs : libraries.find(oneapi::math::domain::blas)->second) {
+        for (const char* libname : device_libs.second)
+            identity += std::string(libname) + ',';
+    }
+    for (const auto& device : sycl::device::get_devices()) {
+        identity += ';' + device.get_info<sycl::info::device::name>() + ' ' +
+                    device.get_info<sycl::info::device::driver_version>();
+    }
+    return identity;
+}
+
+static autotune_cache make_cache_from_environment() {
+    const char* value = std::getenv("ONEMATH_BLAS_AUTOTUNE");
+    if (!value || std::string(value) == "0")
+        return autotune_cache(false, "", "");
+    const char* path = std::getenv("ONEMATH_BLAS_AUTOTUNE_CACHE");
+    return autotune_cache(true, path ? path : default_cache_path(), cache_identity());
+}
+
+autotune_cache& autotune_cache::get() {
+    static autotune_cache cache = make_cache_from_environment();
+    return cache;
+}
+
+} // namespace detail
+} // namespace blas
+} // namespace math
+} // namespace oneapi
@@ -0,0 +1,450 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMATH_BLAS_AUTOTUNE_HPP_
+#define _ONEMATH_BLAS_AUTOTUNE_HPP_
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include <atomic>
+#include <chrono>
+#include <complex>
+#include <cstdint>
+#include <fstream>
+#include <initializer_list>
+#include <istream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+#include "oneapi/math/detail/backends_table.hpp"
+#include "oneapi/math/detail/dispatch_key.hpp"
+#include "oneapi/math/exceptions.hpp"
+#include "oneapi/math/types.hpp"
+
+// Opt-in selection of the fastest BLAS backend per routine, data type and problem size
+// when several backend libraries are available for a device. It is enabled by setting
+// ONEMATH_BLAS_AUTOTUNE=1. The first call in a size bucket times every candidate on
+// scratch operands of the same shape and the winner is appended to the cache file named
+// by ONEMATH_BLAS_AUTOTUNE_CACHE, by default onemath_blas_autotune.txt in the user cache
+// directory, so that later runs reuse it without timing again. The file is only reused by
+// the same backend libraries on the same devices. Once a bucket is tuned, its backend is
+// looked up without locking.
+
+namespace oneapi {
+namespace math {
+namespace blas {
+namespace detail {
+
+enum class autotune_routine : std::uint64_t { gemm = 0, trsm = 1, syrk = 2 };
+
+struct autotune_entry {
+    std::string libname;
+    // Position of the library in the loader's backend order, once known in this process
+    std::size_t level = 0;
+    bool resolved = false;
+};
+
+using autotune_entries = std::unordered_map<std::uint64_t, autotune_entry>;
+
+// First line of the cache file. The identity names the backend libraries and the devices
+// the winners were timed with, so that a cache written by another build or on another
+// machine is not reused.
+inline std::string autotune_cache_header(const std::string& identity) {
+    return "onemath_blas_autotune " + identity;
+}
+
+// Reads the "<key in hex> <library>" lines that follow the header, later lines overriding
+// earlier ones. Returns false and reads nothing if the header does not match the identity.
+inline bool read_autotune_cache(std::istream& in, const std::string& identity,
+                                autotune_entries& entries) {
+    std::string line;
+    if (!std::getline(in, line) || line != autotune_cache_header(identity))
+        return false;
+    while (std::getline(in, line)) {
+        std::istringstream fields(line);
+        std::uint64_t key;
+        std::string libname;
+        if (fields >> std::hex >> key >> libname)
+            entries[key] = { libname };
+    }
+    return true;
+}
+
+// Levels of the resolved keys, readable without locking. Keys are inserted by one thread
+// at a time and never removed. Slots hold key + 1 so that 0 marks an empty slot.
+class autotune_level_index {
+public:
+    static constexpr std::size_t capacity = 4096;
+
+    autotune_level_index() : slots_(new slot[capacity]) {}
+
+    bool find(std::uint64_t key, std::size_t& level) const {
+        for (std::size_t i = 0, s = first_slot(key); i < capacity; ++i, s = (s + 1) % capacity) {
+            const std::uint64_t stored = slots_[s].key.load(std::memory_order_acquire);
+            if (stored == 0)
+                return false;
+            if (stored == key + 1) {
+                level = slots_[s].level.load(std::memory_order_relaxed);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Returns false once the index is three quarters full
+    bool insert(std::uint64_t key, std::size_t level) {
+        for (std::size_t s = first_slot(key);; s = (s + 1) % capacity) {
+            const std::uint64_t stored = slots_[s].key.load(std::memory_order_relaxed);
+            if (stored == key + 1) {
+                slots_[s].level.store(level, std::memory_order_relaxed);
+                return true;
+            }
+            if (stored == 0) {
+                if (size_ >= capacity / 4 * 3)
+                    return false;
+                slots_[s].level.store(level, std::memory_order_relaxed);
+                slots_[s].key.store(key + 1, std::memory_order_release);
+                ++size_;
+                return true;
+            }
+        }
+    }
+
+private:
+    struct slot {
+        std::atomic<std::uint64_t> key{ 0 };
+        std::atomic<std::size_t> level{ 0 };
+    };
+
+    static std::size_t first_slot(std::uint64_t key) {
+        return static_cast<std::size_t>((key * 0x9e3779b97f4a7c15ull) >> 52) % capacity;
+    }
+
+    std::unique_ptr<slot[]> slots_;
+    std::size_t size_ = 0;
+};
+
+// Winners of previous tuning runs, keyed by make_autotune_key()
+class autotune_cache {
+public:
+    // Cache configured from ONEMATH_BLAS_AUTOTUNE and ONEMATH_BLAS_AUTOTUNE_CACHE
+    static autotune_cache& get();
+
+    // Cache kept in the file at path, or in memory only if path is empty. Entries written
+    // for another identity are dropped and the file is rewritten on the first insert.
+    autotune_cache(bool enabled, std::string path, const std::string& identity)
+            : enabled_(enabled),
+              path_(std::move(path)),
+              header_(autotune_cache_header(identity)) {
+        if (!enabled_ || path_.empty())
+            return;
+        std::ifstream file(path_);
+        file_matches_ = read_autotune_cache(file, identity, entries_);
+    }
+
+    bool enabled() const {
+        return enabled_;
+    }
+
+    // Lock-free lookup of the level recorded for the key in this process
+    bool find_level(std::uint64_t key, std::size_t& level) const {
+        return index_.find(key, level);
+    }
+
+    // Lookup that also returns the entries read from the cache file but not resolved yet
+    bool find(std::uint64_t key, autotune_entry& entry) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = entries_.find(key);
+        if (it == entries_.end())
+            return false;
+        entry = it->second;
+        return true;
+    }
+
+    // Records the library selected for the key, appending it to the cache file if persist
+    void insert(std::uint64_t key, const std::string& libname, std::size_t level, bool persist) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        entries_[key] = { libname, level, true };
+        index_.insert(key, level);
+        if (persist && !path_.empty()) {
+            std::ofstream file(path_, file_matches_ ? std::ios::app : std::ios::trunc);
+            if (!file_matches_)
+                file << header_ << '\n';
+            file << std::hex << key << ' ' << libname << '\n';
+            file_matches_ = static_cast<bool>(file);
+        }
+    }
+
+private:
+    bool enabled_ = false;
+    std::string path_;
+    std::string header_;
+    // Whether the cache file exists and starts with header_
+    bool file_matches_ = false;
+    autotune_entries entries_;
+    autotune_level_index index_;
+    mutable std::mutex mutex_;
+};
+
+template <typename T>
+constexpr std::uint64_t autotune_type_code() {
+    if constexpr (std::is_same_v<T, float>)
+        return 0;
+    else if constexpr (std::is_same_v<T, double>)
+        return 1;
+    else if constexpr (std::is_same_v<T, std::complex<float>>)
+        return 2;
+    else
+        return 3;
+}
+
+// Problem sizes are bucketed by the next power of two of each dimension
+inline std::uint64_t autotune_bucket(std::int64_t dim) {
+    std::uint64_t bucket = 0;
+    while (bucket < 63 && (std::int64_t(1) << bucket) < dim)
+        ++bucket;
+    return bucket;
+}
+
+// Packs the routine, data type, device, layout, the (up to four) enumerated arguments
+// and the bucket of the (up to three) dimensions into one key.
+template <typename T>
+std::uint64_t make_autotune_key(autotune_routine routine, oneapi::math::device libkey,
+                                oneapi::math::layout layout, std::initializer_list<char> flags,
+                                std::initializer_list<std::int64_t> dims) {
+    std::uint64_t key = static_cast<std::uint64_t>(routine);
+    key = (key << 2) | autotune_type_code<T>();
+    key = (key << 4) | static_cast<std::uint64_t>(libkey);
+    key = (key << 1) | static_cast<std::uint64_t>(layout);
+    for (char flag : flags)
+        key = (key << 2) | (static_cast<std::uint64_t>(flag) & 3);
+    for (std::int64_t dim : dims)
+        key = (key << 6) | autotune_bucket(dim);
+    return key;
+}
+
+// Device allocation used as an operand while timing the candidates
+template <typename T>
+class autotune_scratch {
+public:
+    autotune_scratch(sycl::queue& queue, std::int64_t size)
+            : queue_(queue),
+              ptr_(sycl::malloc_device<T>(static_cast<std::size_t>(size), queue)) {
+        if (ptr_)
+            queue_.fill(ptr_, T(1), static_cast<std::size_t>(size)).wait();
+    }
+    ~autotune_scratch() {
+        if (ptr_)
+            sycl::free(ptr_, queue_);
+    }
+    autotune_scratch(const autotune_scratch&) = delete;
+    autotune_scratch& operator=(const autotune_scratch&) = delete;
+
+    T* get() const {
+        return ptr_;
+    }
+
+private:
+    sycl::queue queue_;
+    T* ptr_;
+};
+
+// Returns the level (see table_initializer::get_table) of the backend selected for the
+// key. found is cleared if the key still needs tuning.
+template <typename tables_t>
+std::size_t find_tuned_level(autotune_cache& cache, tables_t& function_tables,
+                             std::pair<oneapi::math::device, sycl::queue&> device_queue_pair,
+                             std::uint64_t key, bool& found) {
+    found = true;
+    std::size_t level;
+    if (cache.find_level(key, level))
+        return level;
+    autotune_entry entry;
+    if (cache.find(key, entry)) {
+        if (entry.resolved)
+            return entry.level;
+        // Entry read from the cache file: look up the library among the loaded ones
+        for (std::size_t level = 0; function_tables.get_table(device_queue_pair, level);
+             ++level) {
+            if (entry.libname == function_tables.get_library_name(device_queue_pair.first, level)) {
+                cache.insert(key, entry.libname, level, false);
+                return level;
+            }
+        }
+    }
+    if (!function_tables.get_table(device_queue_pair, 1)) {
+        // Nothing to choose from; not persisted so that tuning happens if backends are added
+        cache.insert(key, function_tables.get_library_name(device_queue_pair.first, 0), 0, false);
+        return 0;
+    }
+    found = false;
+    return 0;
+}
+
+// Times run(table) with every backend available for the device, records the fastest one
+// for the key and returns its level. Backends that cannot run the routine are skipped.
+template <typename tables_t, typename run_t>
+std::size_t tune_level(autotune_cache& cache, tables_t& function_tables,
+                       std::pair<oneapi::math::device, sycl::queue&> device_queue_pair,
+                       std::uint64_t key, run_t&& run) {
+    std::size_t best_level = 0;
+    auto best_time = std::chrono::steady_clock::duration::max();
+    const char* best_libname = nullptr;
+    for (std::size_t level = 0;; ++level) {
+        auto* table = function_tables.get_table(device_queue_pair, level);
+        if (!table)
+            break;
+        try {
+            // The first run absorbs one-time backend initialization
+            run(*table).wait_and_throw();
+            const auto start = std::chrono::steady_clock::now();
+            run(*table).wait_and_throw();
+            const auto time = std::chrono::steady_clock::now() - start;
+            if (time < best_time) {
+                best_time = time;
+                best_level = level;
+                best_libname = function_tables.get_library_name(device_queue_pair.first, level);
+            }
+        }
+        catch (const oneapi::math::exception&) {
+        }
+        catch (const sycl::exception&) {
+        }
+    }
+    if (best_libname)
+        cache.insert(key, best_libname, best_level, true);
+    return best_level;
+}
+
+template <typename T, typename tables_t, typename fn_t>
+std::size_t tuned_gemm_level(
+    tables_t& function_tables,
+    std::pair<oneapi::math::detail::dispatch_key, sycl::queue&> key_queue_pair, fn_t usm_fn,
+    oneapi::math::layout layout, transpose transa, transpose transb, std::int64_t m, std::int64_t n,
+    std::int64_t k) {
+    auto& cache = autotune_cache::get();
+    // Calls through a bound handle stay on its backend
+    if (!cache.enabled() || key_queue_pair.first.table)
+        return 0;
+    std::pair<oneapi::math::device, sycl::queue&> device_queue_pair{ key_queue_pair.first.device_id,
+                                                                      key_queue_pair.second };
+    const auto key = make_autotune_key<T>(autotune_routine::gemm, device_queue_pair.first, layout,
+                                          { static_cast<char>(transa), static_cast<char>(transb) },
+                                          { m, n, k });
+    bool found;
+    const auto level = find_tuned_level(cache, function_tables, device_queue_pair, key, found);
+    if (found || m <= 0 || n <= 0 || k <= 0)
+        return level;
+    const bool col_major = layout == oneapi::math::layout::col_major;
+    const std::int64_t rows_a = transa == transpose::nontrans ? m : k;
+    const std::int64_t cols_a = transa == transpose::nontrans ? k : m;
+    const std::int64_t rows_b = transb == transpose::nontrans ? k : n;
+    const std::int64_t cols_b = transb == transpose::nontrans ? n : k;
+    sycl::queue& queue = device_queue_pair.second;
+    autotune_scratch<T> a(queue, m * k), b(queue, k * n), c(queue, m * n);
+    if (!a.get() || !b.get() || !c.get())
+        return level;
+    return tune_level(cache, function_tables, device_queue_pair, key, [&](auto& table) {
+        return (table.*usm_fn)(queue, transa, transb, m, n, k, T(1), a.get(),
+                               col_major ? rows_a : cols_a, b.get(), col_major ? rows_b : cols_b,
+                               T(0), c.get(), col_major ? m : n, {});
+    });
+}
+
+template <typename T, typename tables_t, typename fn_t>
+std::size_t tuned_trsm_level(
+    tables_t& function_tables,
+    std::pair<oneapi::math::detail::dispatch_key, sycl::queue&> key_queue_pair, fn_t usm_fn,
+    oneapi::math::layout layout, side left_right, uplo upper_lower, transpose trans, diag unit_diag,
+    std::int64_t m, std::int64_t n) {
+    auto& cache = autotune_cache::get();
+    // Calls through a bound handle stay on its backend
+    if (!cache.enabled() || key_queue_pair.first.table)
+        return 0;
+    std::pair<oneapi::math::device, sycl::queue&> device_queue_pair{ key_queue_pair.first.device_id,
+                                                                      key_queue_pair.second };
+    const auto key = make_autotune_key<T>(
+        autotune_routine::trsm, device_queue_pair.first, layout,
+        { static_cast<char>(left_right), static_cast<char>(upper_lower), static_cast<char>(trans),
+          static_cast<char>(unit_diag) },
+        { m, n });
+    bool found;
+    const auto level = find_tuned_level(cache, function_tables, device_queue_pair, key, found);
+    if (found || m <= 0 || n <= 0)
+        return level;
+    const bool col_major = layout == oneapi::math::layout::col_major;
+    const std::int64_t dim_a = left_right == side::left ? m : n;
+    sycl::queue& queue = device_queue_pair.second;
+    // A is filled with ones so that the solves stay finite
+    autotune_scratch<T> a(queue, dim_a * dim_a), b(queue, m * n);
+    if (!a.get() || !b.get())
+        return level;
+    return tune_level(cache, function_tables, device_queue_pair, key, [&](auto& table) {
+        return (table.*usm_fn)(queue, left_right, upper_lower, trans, unit_diag, m, n, T(1),
+                               a.get(), dim_a, b.get(), col_major ? m : n, {});
+    });
+}
+
+template <typename T, typename tables_t, typename fn_t>
+std::size_t tuned_syrk_level(
+    tables_t& function_tables,
+    std::pair<oneapi::math::detail::dispatch_key, sycl::queue&> key_queue_pair, fn_t usm_fn,
+    oneapi::math::layout layout, uplo upper_lower, transpose trans, std::int64_t n,
+    std::int64_t k) {
+    auto& cache = autotune_cache::get();
+    // Calls through a bound handle stay on its backend
+    if (!cache.enabled() || key_queue_pair.first.table)
+        return 0;
+    std::pair<oneapi::math::device, sycl::queue&> device_queue_pair{ key_queue_pair.first.device_id,
+                                                                      key_queue_pair.second };
+    const auto key = make_autotune_key<T>(
+        autotune_routine::syrk, device_queue_pair.first, layout,
+        { static_cast<char>(upper_lower), static_cast<char>(trans) }, { n, k });
+    bool found;
+    const auto level = find_tuned_level(cache, function_tables, device_queue_pair, key, found);
+    if (found || n <= 0 || k <= 0)
+        return level;
+    const bool col_major = layout == oneapi::math::layout::col_major;
+    const std::int64_t rows_a = trans == transpose::nontrans ? n : k;
+    const std::int64_t cols_a = trans == transpose::nontrans ? k : n;
+    sycl::queue& queue = device_queue_pair.second;
+    autotune_scratch<T> a(queue, n * k), c(queue, n * n);
+    if (!a.get() || !c.get())
+        return level;
+    return tune_level(cache, function_tables, device_queue_pair, key, [&](auto& table) {
+        return (table.*usm_fn)(queue, upper_lower, trans, n, k, T(1), a.get(),
+                               col_major ? rows_a : cols_a, T(0), c.get(), n, {});
+    });
+}
+
+} // namespace detail
+} // namespace blas
+} // namespace math
+} // namespace oneapi
+
+#endif //_ONEMATH_BLAS_AUTOTUNE_HPP_
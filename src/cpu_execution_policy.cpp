@@ -0,0 +1,121 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <atomic>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+#include "oneapi/math/cpu_execution_policy.hpp"
+
+namespace oneapi {
+namespace math {
+namespace detail {
+
+class cpu_execution_policy_registry {
+public:
+    // Never destroyed, as it may hold queues that must not be released after the SYCL runtime
+    // is torn down
+    static cpu_execution_policy_registry& get() {
+        static cpu_execution_policy_registry& registry = *new cpu_execution_policy_registry();
+        return registry;
+    }
+
+    void set(const sycl::queue& queue, cpu_execution_policy policy) {
+        auto shared_policy = std::make_shared<const cpu_execution_policy>(std::move(policy));
+        std::lock_guard<std::mutex> lock(mutex_);
+        remove_expired();
+        policies_[queue_key(queue)] = std::move(shared_policy);
+        any_.store(true, std::memory_order_release);
+    }
+
+    void reset(const sycl::queue& queue) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        policies_.erase(queue_key(queue));
+        remove_expired();
+        any_.store(!policies_.empty(), std::memory_order_release);
+    }
+
+    // The policy of the queue, or nullptr if it has none. Work submitted to the queue keeps the
+    // policy it was submitted with.
+    std::shared_ptr<const cpu_execution_policy> find(const sycl::queue& queue) {
+        if (!any_.load(std::memory_order_acquire))
+            return nullptr;
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = policies_.find(queue_key(queue));
+        return it != policies_.end() ? it->second : nullptr;
+    }
+
+private:
+#ifdef SYCL_EXT_ONEAPI_WEAK_OBJECT
+    // The policies are found through weak references to their queues, so that a queue is
+    // released once the application is done with it, even if its policy was not reset. The
+    // policies of released queues are removed when a policy is set or reset.
+    using queue_key = sycl::ext::oneapi::weak_object<sycl::queue>;
+    using policy_map = std::map<queue_key, std::shared_ptr<const cpu_execution_policy>,
+                                sycl::ext::oneapi::owner_less<sycl::queue>>;
+
+    void remove_expired() {
+        for (auto it = policies_.begin(); it != policies_.end();) {
+            it = it->first.expired() ? policies_.erase(it) : std::next(it);
+        }
+    }
+#else
+    // Without weak references to SYCL objects, a queue with a policy is kept until its policy
+    // is reset
+    using queue_key = sycl::queue;
+    using policy_map = std::unordered_map<queue_key, std::shared_ptr<const cpu_execution_policy>>;
+
+    void remove_expired() {}
+#endif
+
+    cpu_execution_policy_registry() = default;
+
+    std::mutex mutex_;
+    // Set while any queue has a policy, so that the lookup is a single load in the common case
+    std::atomic<bool> any_{ false };
+    policy_map policies_;
+};
+
+} // namespace detail
+
+void set_cpu_execution_policy(const sycl::queue& queue, cpu_execution_policy policy) {
+    detail::cpu_execution_policy_registry::get().set(queue, std::move(policy));
+}
+
+cpu_execution_policy get_cpu_execution_policy(const sycl::queue& queue) {
+    auto policy = detail::cpu_execution_policy_registry::get().find(queue);
+    return policy ? *policy : cpu_execution_policy{};
+}
+
+void reset_cpu_execution_policy(const sycl::queue& queue) {
+    detail::cpu_execution_policy_registry::get().reset(queue);
+}
+
+} // namespace math
+} // namespace oneapi
+
+// Looked up by name by the backends, see cpu_execution_policy_lookup.hpp
+extern "C" ONEMATH_EXPORT void onemath_find_cpu_execution_policy(
+    const sycl::queue* queue, std::shared_ptr<const oneapi::math::cpu_execution_policy>* policy) {
+    *policy = oneapi::math::detail::cpu_execution_policy_registry::get().find(*queue);
+}
@@ -23,6 +23,7 @@
 #include <CL/sycl.hpp>
 #endif
 
+#include "async_error_recorder.hpp"
 #include "oneapi/math/exceptions.hpp"
 
 #include "oneapi/math/dft/descriptor.hpp"
@@ -94,9 +95,11 @@ ONEMATH_EXPORT void compute_backward(descriptor_type& desc,
             DFT_ERROR status =
                 DftiComputeBackward(desc_acc[detail::DIR::bwd], detail::acc_to_ptr(inout_acc));
             if (status != DFTI_NO_ERROR) {
-                throw oneapi::math::exception(
-                    "dft/backends/mklcpu", "compute_backward",
-                    std::string("DftiComputeBackward failed : ") + DftiErrorMessage(status));
+                oneapi::math::detail::raise_async_error(
+                    cpu_queue,
+                    oneapi::math::exception(
+                        "dft/backends/mklcpu", "compute_backward",
+                        std::string("DftiComputeBackward failed : ") + DftiErrorMessage(status)));
             }
         });
     });
@@ -126,9 +129,11 @@ ONEMATH_EXPORT void compute_backward(descriptor_type& desc,
             DFT_ERROR status = DftiComputeBackward(
                 desc_acc[detail::DIR::bwd], detail::acc_to_ptr(re_acc), detail::acc_to_ptr(im_acc));
             if (status != DFTI_NO_ERROR) {
-                throw oneapi::math::exception(
-                    "dft/backends/mklcpu", "compute_backward",
-                    std::string("DftiComputeBackward failed : ") + DftiErrorMessage(status));
+                oneapi::math::detail::raise_async_error(
+                    cpu_queue,
+                    oneapi::math::exception(
+                        "dft/backends/mklcpu", "compute_backward",
+                        std::string("DftiComputeBackward failed : ") + DftiErrorMessage(status)));
             }
         });
     });
@@ -159,9 +164,11 @@ ONEMATH_EXPORT void compute_backward(descriptor_type& desc,
             DFT_ERROR status = DftiComputeBackward(desc_acc[detail::DIR::bwd], in_ptr,
                                                    detail::acc_to_ptr(out_acc));
             if (status != DFTI_NO_ERROR) {
-                throw oneapi::math::exception(
-                    "dft/backends/mklcpu", "compute_backward",
-                    std::string("DftiComputeBackward failed : ") + DftiErrorMessage(status));
+                oneapi::math::detail::raise_async_error(
+                    cpu_queue,
+                    oneapi::math::exception(
+                        "dft/backends/mklcpu", "compute_backward",
+                        std::string("DftiComputeBackward failed : ") + DftiErrorMessage(status)));
             }
         });
     });
@@ -198,9 +205,11 @@ ONEMATH_EXPORT void compute_backward(descriptor_type& desc,
                 DftiComputeBackward(desc_acc[detail::DIR::bwd], inre_ptr, inim_ptr,
                                     detail::acc_to_ptr(outre_acc), detail::acc_to_ptr(outim_acc));
             if (status != DFTI_NO_ERROR) {
-                throw oneapi::math::exception(
-                    "dft/backends/mklcpu", "compute_backward",
-                    std::string("DftiComputeBackward failed : ") + DftiErrorMessage(status));
+                oneapi::math::detail::raise_async_error(
+                    cpu_queue,
+                    oneapi::math::exception(
+                        "dft/backends/mklcpu", "compute_backward",
+                        std::string("DftiComputeBackward failed : ") + DftiErrorMessage(status)));
             }
         });
     });
@@ -227,9 +236,11 @@ ONEMATH_EXPORT sycl::event compute_backward(descriptor_type& desc, fwd<descripto
         detail::host_task<class host_usm_kernel_back_inplace>(cgh, [=]() {
             DFT_ERROR status = DftiComputeBackward(desc_acc[detail::DIR::bwd], inout);
             if (status != DFTI_NO_ERROR) {
-                throw oneapi::math::exception(
-                    "dft/backends/mklcpu", "compute_backward",
-                    std::string("DftiComputeBackward failed : ") + DftiErrorMessage(status));
+                oneapi::math::detail::raise_async_error(
+                    cpu_queue,
+                    oneapi::math::exception(
+                        "dft/backends/mklcpu", "compute_backward",
+                        std::string("DftiComputeBackward failed : ") + DftiErrorMessage(status)));
             }
         });
     });
@@ -256,9 +267,11 @@ ONEMATH_EXPORT sycl::event compute_backward(descriptor_type& desc,
         detail::host_task<class host_usm_kernel_split_back_inplace>(cgh, [=]() {
             DFT_ERROR status = DftiComputeBackward(desc_acc[detail::DIR::bwd], inout_re, inout_im);
             if (status != DFTI_NO_ERROR) {
-                throw oneapi::math::exception(
-                    "dft/backends/mklcpu", "compute_backward",
-                    std::string("DftiComputeBackward failed : ") + DftiErrorMessage(status));
+                oneapi::math::detail::raise_async_error(
+                    cpu_queue,
+                    oneapi::math::exception(
+                        "dft/backends/mklcpu", "compute_backward",
+                        std::string("DftiComputeBackward failed : ") + DftiErrorMessage(status)));
             }
         });
     });
@@ -286,9 +299,11 @@ ONEMATH_EXPORT sycl::event compute_backward(descriptor_type& desc, bwd<descripto
         detail::host_task<class host_usm_kernel_back_outofplace>(cgh, [=]() {
             DFT_ERROR status = DftiComputeBackward(desc_acc[detail::DIR::bwd], in, out);
             if (status != DFTI_NO_ERROR) {
-                throw oneapi::math::exception(
-                    "dft/backends/mklcpu", "compute_backward",
-                    std::string("DftiComputeBackward failed : ") + DftiErrorMessage(status));
+                oneapi::math::detail::raise_async_error(
+                    cpu_queue,
+                    oneapi::math::exception(
+                        "dft/backends/mklcpu", "compute_backward",
+                        std::string("DftiComputeBackward failed : ") + DftiErrorMessage(status)));
             }
         });
     });
@@ -317,9 +332,11 @@ ONEMATH_EXPORT sycl::event compute_backward(descriptor_type& desc, scalar<descri
             DFT_ERROR status =
                 DftiComputeBackward(desc_acc[detail::DIR::bwd], in_re, in_im, out_re, out_im);
             if (status != DFTI_NO_ERROR) {
-                throw oneapi::math::exception(
-                    "dft/backends/mklcpu", "compute_backward",
-                    std::string("DftiComputeBackward failed : ") + DftiErrorMessage(status));
+                oneapi::math::detail::raise_async_error(
+                    cpu_queue,
+                    oneapi::math::exception(
+                        "dft/backends/mklcpu", "compute_backward",
+                        std::string("DftiComputeBackward failed : ") + DftiErrorMessage(status)));
             }
         });
     });
@@ -23,6 +23,7 @@
 #include <CL/sycl.hpp>
 #endif
 
+#include "async_error_recorder.hpp"
 #include "oneapi/math/types.hpp"
 #include "oneapi/math/detail/backends.hpp"
 #include "oneapi/math/dft/types.hpp"
@@ -88,7 +89,8 @@ void commit_derived_impl<prec, dom>::commit(
             oneapi::math::dft::detail::config_value::WORKSPACE_EXTERNAL);
     set_value(bidirection_handle.data(), config_values);
 
-    this->get_queue()
+    sycl::queue& queue = this->get_queue();
+    queue
         .submit([&](sycl::handler& cgh) {
             auto bidir_handle_obj =
                 bidirection_buffer.get_access<sycl::access::mode::read_write>(cgh);
@@ -106,7 +108,8 @@ void commit_derived_impl<prec, dom>::commit(
                     std::string err = std::string("DftiCommitDescriptor failed with status : ") +
                                       DftiErrorMessage(status[0]) + std::string(", ") +
                                       DftiErrorMessage(status[1]);
-                    throw oneapi::math::exception("dft/backends/mklcpu", "commit", err);
+                    oneapi::math::detail::raise_async_error(
+                        queue, oneapi::math::exception("dft/backends/mklcpu", "commit", err));
                 }
             });
         })
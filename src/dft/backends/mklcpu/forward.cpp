@@ -23,6 +23,7 @@
 #include <CL/sycl.hpp>
 #endif
 
+#include "async_error_recorder.hpp"
 #include "oneapi/math/exceptions.hpp"
 
 #include "oneapi/math/dft/descriptor.hpp"
@@ -95,9 +96,11 @@ ONEMATH_EXPORT void compute_forward(descriptor_type& desc,
             DFT_ERROR status =
                 DftiComputeForward(desc_acc[detail::DIR::fwd], detail::acc_to_ptr(inout_acc));
             if (status != DFTI_NO_ERROR) {
-                throw oneapi::math::exception(
-                    "dft/forward/mklcpu", "compute_forward",
-                    std::string("DftiComputeForward failed : ") + DftiErrorMessage(status));
+                oneapi::math::detail::raise_async_error(
+                    cpu_queue,
+                    oneapi::math::exception(
+                        "dft/forward/mklcpu", "compute_forward",
+                        std::string("DftiComputeForward failed : ") + DftiErrorMessage(status)));
             }
         });
     });
@@ -127,9 +130,11 @@ ONEMATH_EXPORT void compute_forward(descriptor_type& desc,
             DFT_ERROR status = DftiComputeForward(
                 desc_acc[detail::DIR::fwd], detail::acc_to_ptr(re_acc), detail::acc_to_ptr(im_acc));
             if (status != DFTI_NO_ERROR) {
-                throw oneapi::math::exception(
-                    "dft/forward/mklcpu", "compute_forward",
-                    std::string("DftiComputeForward failed : ") + DftiErrorMessage(status));
+                oneapi::math::detail::raise_async_error(
+                    cpu_queue,
+                    oneapi::math::exception(
+                        "dft/forward/mklcpu", "compute_forward",
+                        std::string("DftiComputeForward failed : ") + DftiErrorMessage(status)));
             }
         });
     });
@@ -160,9 +165,11 @@ ONEMATH_EXPORT void compute_forward(descriptor_type& desc,
             DFT_ERROR status =
                 DftiComputeForward(desc_acc[detail::DIR::fwd], in_ptr, detail::acc_to_ptr(out_acc));
             if (status != DFTI_NO_ERROR) {
-                throw oneapi::math::exception(
-                    "dft/forward/mklcpu", "compute_forward",
-                    std::string("DftiComputeForward failed : ") + DftiErrorMessage(status));
+                oneapi::math::detail::raise_async_error(
+                    cpu_queue,
+                    oneapi::math::exception(
+                        "dft/forward/mklcpu", "compute_forward",
+                        std::string("DftiComputeForward failed : ") + DftiErrorMessage(status)));
             }
         });
     });
@@ -199,9 +206,11 @@ ONEMATH_EXPORT void compute_forward(descriptor_type& desc,
                 DftiComputeForward(desc_acc[detail::DIR::fwd], inre_ptr, inim_ptr,
                                    detail::acc_to_ptr(outre_acc), detail::acc_to_ptr(outim_acc));
             if (status != DFTI_NO_ERROR) {
-                throw oneapi::math::exception(
-                    "dft/forward/mklcpu", "compute_forward",
-                    std::string("DftiComputeForward failed : ") + DftiErrorMessage(status));
+                oneapi::math::detail::raise_async_error(
+                    cpu_queue,
+                    oneapi::math::exception(
+                        "dft/forward/mklcpu", "compute_forward",
+                        std::string("DftiComputeForward failed : ") + DftiErrorMessage(status)));
             }
         });
     });
@@ -229,9 +238,11 @@ ONEMATH_EXPORT sycl::event compute_forward(descriptor_type& desc, fwd<descriptor
         detail::host_task<class host_usm_kernel_inplace>(cgh, [=]() {
             DFT_ERROR status = DftiComputeForward(desc_acc[detail::DIR::fwd], inout);
             if (status != DFTI_NO_ERROR) {
-                throw oneapi::math::exception(
-                    "dft/forward/mklcpu", "compute_forward",
-                    std::string("DftiComputeForward failed : ") + DftiErrorMessage(status));
+                oneapi::math::detail::raise_async_error(
+                    cpu_queue,
+                    oneapi::math::exception(
+                        "dft/forward/mklcpu", "compute_forward",
+                        std::string("DftiComputeForward failed : ") + DftiErrorMessage(status)));
             }
         });
     });
@@ -259,9 +270,11 @@ ONEMATH_EXPORT sycl::event compute_forward(descriptor_type& desc, scalar<descrip
         detail::host_task<class host_usm_kernel_split_inplace>(cgh, [=]() {
             DFT_ERROR status = DftiComputeForward(desc_acc[detail::DIR::fwd], inout_re, inout_im);
             if (status != DFTI_NO_ERROR) {
-                throw oneapi::math::exception(
-                    "dft/forward/mklcpu", "compute_forward",
-                    std::string("DftiComputeForward failed : ") + DftiErrorMessage(status));
+                oneapi::math::detail::raise_async_error(
+                    cpu_queue,
+                    oneapi::math::exception(
+                        "dft/forward/mklcpu", "compute_forward",
+                        std::string("DftiComputeForward failed : ") + DftiErrorMessage(status)));
             }
         });
     });
@@ -290,9 +303,11 @@ ONEMATH_EXPORT sycl::event compute_forward(descriptor_type& desc, fwd<descriptor
         detail::host_task<class host_usm_kernel_outofplace>(cgh, [=]() {
             DFT_ERROR status = DftiComputeForward(desc_acc[detail::DIR::fwd], in, out);
             if (status != DFTI_NO_ERROR) {
-                throw oneapi::math::exception(
-                    "dft/forward/mklcpu", "compute_forward",
-                    std::string("DftiComputeForward failed : ") + DftiErrorMessage(status));
+                oneapi::math::detail::raise_async_error(
+                    cpu_queue,
+                    oneapi::math::exception(
+                        "dft/forward/mklcpu", "compute_forward",
+                        std::string("DftiComputeForward failed : ") + DftiErrorMessage(status)));
             }
         });
     });
@@ -323,9 +338,11 @@ ONEMATH_EXPORT sycl::event compute_forward(descriptor_type& desc, scalar<descrip
             DFT_ERROR status =
                 DftiComputeForward(desc_acc[detail::DIR::fwd], in_re, in_im, out_re, out_im);
             if (status != DFTI_NO_ERROR) {
-                throw oneapi::math::exception(
-                    "dft/forward/mklcpu", "compute_forward",
-                    std::string("DftiComputeForward failed : ") + DftiErrorMessage(status));
+                oneapi::math::detail::raise_async_error(
+                    cpu_queue,
+                    oneapi::math::exception(
+                        "dft/forward/mklcpu", "compute_forward",
+                        std::string("DftiComputeForward failed : ") + DftiErrorMessage(status)));
             }
         });
     });
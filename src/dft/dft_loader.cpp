@@ -27,8 +27,14 @@
 
 namespace oneapi::math::dft::detail {
 
+#ifdef ONEMATH_ENABLE_STATIC_DISPATCH
+extern "C" dft_function_table_t onemath_dft_table;
+static oneapi::math::detail::table_initializer<math::domain::dft, dft_function_table_t>
+    function_tables(&onemath_dft_table);
+#else
 static oneapi::math::detail::table_initializer<math::domain::dft, dft_function_table_t>
     function_tables;
+#endif
 
 template <>
 commit_impl<precision::SINGLE, domain::COMPLEX>* create_commit<precision::SINGLE, domain::COMPLEX>(
@@ -0,0 +1,95 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMATH_ASYNC_ERROR_RECORDER_HPP_
+#define _ONEMATH_ASYNC_ERROR_RECORDER_HPP_
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include <exception>
+#include <string>
+
+#ifdef __linux__
+#include <dlfcn.h>
+#elif defined(_WIN64)
+#include <windows.h>
+#endif
+
+namespace oneapi {
+namespace math {
+namespace detail {
+
+using record_async_error_t = void (*)(const sycl::queue*, const char*, const std::exception_ptr*);
+
+// The backend libraries do not link to onemath, so they look up its recording function,
+// onemath_record_async_error, in the process. Returns nullptr if onemath is not loaded.
+inline record_async_error_t find_async_error_recorder() {
+#ifdef __linux__
+    return reinterpret_cast<record_async_error_t>(
+        dlsym(RTLD_DEFAULT, "onemath_record_async_error"));
+#elif defined(_WIN64)
+    HMODULE onemath = GetModuleHandleA("onemath.dll");
+    return onemath ? reinterpret_cast<record_async_error_t>(
+                         GetProcAddress(onemath, "onemath_record_async_error"))
+                   : nullptr;
+#else
+    return nullptr;
+#endif
+}
+
+// To be called from within host tasks instead of throwing e: records e for the queue
+// and throws it.
+template <typename exception_t>
+[[noreturn]] void raise_async_error(const sycl::queue& queue, const exception_t& e) {
+    static const record_async_error_t record = find_async_error_recorder();
+    if (record) {
+        const std::exception_ptr exception = std::make_exception_ptr(e);
+        record(&queue, e.what(), &exception);
+    }
+    throw e;
+}
+
+// Same as raise_async_error for an exception caught as error, for instance one rethrown
+// from another thread
+[[noreturn]] inline void raise_async_error(const sycl::queue& queue, std::exception_ptr error) {
+    static const record_async_error_t record = find_async_error_recorder();
+    if (record) {
+        std::string message = "unknown exception";
+        try {
+            std::rethrow_exception(error);
+        }
+        catch (const std::exception& e) {
+            message = e.what();
+        }
+        catch (...) {
+        }
+        record(&queue, message.c_str(), &error);
+    }
+    std::rethrow_exception(error);
+}
+
+} // namespace detail
+} // namespace math
+} // namespace oneapi
+
+#endif //_ONEMATH_ASYNC_ERROR_RECORDER_HPP_
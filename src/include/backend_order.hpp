@@ -0,0 +1,86 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMATH_BACKEND_ORDER_HPP_
+#define _ONEMATH_BACKEND_ORDER_HPP_
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace oneapi {
+namespace math {
+namespace detail {
+
+// Parses a comma separated list of backend names, as found in ONEMATH_BACKEND_PRIORITY
+inline std::vector<std::string> parse_backend_priority(const char* value) {
+    std::vector<std::string> backends;
+    if (value) {
+        std::stringstream stream(value);
+        std::string name;
+        while (std::getline(stream, name, ',')) {
+            if (!name.empty())
+                backends.push_back(name);
+        }
+    }
+    return backends;
+}
+
+// Suffixes of the libraries built per device type for a backend, such as
+// libonemath_blas_generic_nvidia_gpu.so for the generic BLAS backend tuned for NVIDIA GPUs
+constexpr const char* per_device_library_suffixes[] = { "_intel_gpu", "_amd_gpu",
+                                                        "_nvidia_gpu" };
+
+// Returns the name of the backend of a library: the last part of its name before the
+// extension and the per-device suffix, "generic" for libonemath_blas_generic_nvidia_gpu.so
+inline std::string backend_of_library(const std::string& libname) {
+    std::string name = libname.substr(0, libname.find('.'));
+    for (const std::string suffix : per_device_library_suffixes) {
+        if (name.size() > suffix.size() &&
+            name.compare(name.size() - suffix.size(), suffix.size(), suffix) == 0) {
+            name.resize(name.size() - suffix.size());
+            break;
+        }
+    }
+    return name.substr(name.rfind('_') + 1);
+}
+
+// Returns the libraries in the order set by the backend priority. Backends missing from the
+// priority list keep their order from the libraries table after the listed ones.
+inline std::vector<const char*> order_by_priority(std::vector<const char*> libs,
+                                                  const std::vector<std::string>& priority) {
+    auto rank = [&](const char* libname) {
+        const std::string backend = backend_of_library(libname);
+        for (std::size_t i = 0; i < priority.size(); ++i) {
+            if (backend == priority[i])
+                return i;
+        }
+        return priority.size();
+    };
+    std::stable_sort(libs.begin(), libs.end(),
+                     [&](const char* a, const char* b) { return rank(a) < rank(b); });
+    return libs;
+}
+
+} // namespace detail
+} // namespace math
+} // namespace oneapi
+
+#endif //_ONEMATH_BACKEND_ORDER_HPP_
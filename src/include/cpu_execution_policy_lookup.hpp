@@ -0,0 +1,77 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMATH_CPU_EXECUTION_POLICY_LOOKUP_HPP_
+#define _ONEMATH_CPU_EXECUTION_POLICY_LOOKUP_HPP_
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include <memory>
+
+#ifdef __linux__
+#include <dlfcn.h>
+#elif defined(_WIN64)
+#include <windows.h>
+#endif
+
+#include "oneapi/math/cpu_execution_policy.hpp"
+
+namespace oneapi {
+namespace math {
+namespace detail {
+
+using find_cpu_execution_policy_t = void (*)(const sycl::queue*,
+                                             std::shared_ptr<const cpu_execution_policy>*);
+
+// The backend libraries do not link to onemath, so they look up its lookup function,
+// onemath_find_cpu_execution_policy, in the process. Returns nullptr if onemath is not loaded.
+inline find_cpu_execution_policy_t find_cpu_execution_policy_lookup() {
+#ifdef __linux__
+    return reinterpret_cast<find_cpu_execution_policy_t>(
+        dlsym(RTLD_DEFAULT, "onemath_find_cpu_execution_policy"));
+#elif defined(_WIN64)
+    HMODULE onemath = GetModuleHandleA("onemath.dll");
+    return onemath ? reinterpret_cast<find_cpu_execution_policy_t>(
+                         GetProcAddress(onemath, "onemath_find_cpu_execution_policy"))
+                   : nullptr;
+#else
+    return nullptr;
+#endif
+}
+
+// The policy of the queue, or nullptr if it has none or onemath is not loaded. Work submitted
+// to the queue keeps the policy returned at its submission.
+inline std::shared_ptr<const cpu_execution_policy> find_cpu_execution_policy(
+    const sycl::queue& queue) {
+    static const find_cpu_execution_policy_t find = find_cpu_execution_policy_lookup();
+    std::shared_ptr<const cpu_execution_policy> policy;
+    if (find)
+        find(&queue, &policy);
+    return policy;
+}
+
+} // namespace detail
+} // namespace math
+} // namespace oneapi
+
+#endif //_ONEMATH_CPU_EXECUTION_POLICY_LOOKUP_HPP_
@@ -20,11 +20,24 @@
 #ifndef _LOADER_HPP_
 #define _LOADER_HPP_
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <cstdint>
-#include <map>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #include "oneapi/math/detail/backends_table.hpp"
 #include "oneapi/math/detail/exceptions.hpp"
+#include "oneapi/math/backend_priority.hpp"
+#include "oneapi/math/detail/dispatch_key.hpp"
+#include "backend_order.hpp"
+#include "preload_registry.hpp"
+#include "trace.hpp"
 
 #define SPEC_VERSION 1
 
@@ -49,7 +62,7 @@ namespace math {
 namespace detail {
 
 template <oneapi::math::domain domain_id, typename function_table_t>
-class table_initializer {
+class table_initializer : public function_table_preloader {
     struct handle_deleter {
         using pointer = LIB_TYPE;
         void operator()(pointer p) const {
@@ -59,11 +72,105 @@ class table_initializer {
     using dlhandle = std::unique_ptr<LIB_TYPE, handle_deleter>;
 
 public:
-    function_table_t& operator[](std::pair<oneapi::math::device, sycl::queue> device_queue_pair) {
-        auto lib = tables.find(device_queue_pair.first);
-        if (lib != tables.end())
-            return lib->second;
-        return add_table(device_queue_pair.first, device_queue_pair.second);
+    table_initializer() {
+        register_preloader(this);
+    }
+
+    // Uses the table of the backend linked into the library instead of loading one at run
+    // time. The table serves the devices listed for the backend in the libraries table.
+    explicit table_initializer(function_table_t* table) : linked_table(table) {
+        register_preloader(this);
+    }
+
+    // Lookups are lock-free once the table for a device has been published. The first
+    // call for a given device loads the backend library under a per-device once_flag so
+    // that concurrent first calls from several host threads load it exactly once.
+    function_table_t& operator[](std::pair<oneapi::math::device, sycl::queue&> device_queue_pair) {
+        const auto idx = static_cast<std::size_t>(device_queue_pair.first);
+        function_table_t* t = table_ptrs[idx].load(std::memory_order_acquire);
+        if (t)
+            return *t;
+        std::call_once(init_flags[idx], [&]() {
+            add_table(device_queue_pair.first, &device_queue_pair.second);
+        });
+        return *table_ptrs[idx].load(std::memory_order_acquire);
+    }
+
+    // Calls the function fn of the table for the device. If the backend throws
+    // math::unimplemented, the call is retried with the next backend library available
+    // for the device, in priority order. Only exceptions thrown before the backend
+    // returns can be forwarded this way, not those raised asynchronously by its kernels.
+    // routine is the name under which the call is traced.
+    template <typename fn_t, typename... args_t>
+    auto call(const char* routine, std::pair<dispatch_key, sycl::queue&> key_queue_pair,
+              fn_t function_table_t::*fn, args_t&&... args) {
+        return call_from(routine, key_queue_pair, 0, fn, std::forward<args_t>(args)...);
+    }
+
+    // Same as call() but starting from the level-th backend for the device, as returned
+    // by get_table(). Falls back to the loaded backend if there is no such level. A key
+    // carrying the table of a bound handle selects that table only, without fallback.
+    template <typename fn_t, typename... args_t>
+    auto call_from(const char* routine, std::pair<dispatch_key, sycl::queue&> key_queue_pair,
+                   std::size_t level, fn_t function_table_t::*fn, args_t&&... args) {
+        const dispatch_key key = key_queue_pair.first;
+        if (key.table) {
+            const auto& table = *static_cast<const function_table_t*>(key.table);
+#ifdef ONEMATH_ENABLE_TRACING
+            if (trace_enabled())
+                return traced_call(routine, key.device_id, 0, table, fn, args...);
+#endif
+            return (table.*fn)(args...);
+        }
+        std::pair<oneapi::math::device, sycl::queue&> device_queue_pair{ key.device_id,
+                                                                          key_queue_pair.second };
+        const function_table_t* t = get_table(device_queue_pair, level);
+        if (!t) {
+            t = &(*this)[device_queue_pair];
+            level = 0;
+        }
+        for (++level;; ++level) {
+            try {
+#ifdef ONEMATH_ENABLE_TRACING
+                if (trace_enabled())
+                    return traced_call(routine, key.device_id, level - 1, *t, fn, args...);
+#endif
+                return (t->*fn)(args...);
+            }
+            catch (const math::unimplemented&) {
+                t = get_fallback_table(key.device_id, level);
+                if (!t)
+                    throw;
+            }
+        }
+    }
+
+    // Returns the table of the level-th backend for the device in priority order, level 0
+    // being the loaded one, or nullptr if fewer backends are available.
+    function_table_t* get_table(std::pair<oneapi::math::device, sycl::queue&> device_queue_pair,
+                                std::size_t level) {
+        function_table_t* t = &(*this)[device_queue_pair];
+        return level == 0 ? t : get_fallback_table(device_queue_pair.first, level);
+    }
+
+    // Name of the library providing the level-th table, which must have been obtained
+    // from get_table() first.
+    const char* get_library_name(oneapi::math::device key, std::size_t level) {
+        const auto idx = static_cast<std::size_t>(key);
+        if (level == 0)
+            return lib_names[idx];
+        std::lock_guard<std::mutex> lock(fallback_mutex);
+        return fallbacks[idx][level - 1].libname;
+    }
+
+    oneapi::math::domain get_domain() const override {
+        return domain_id;
+    }
+
+    const char* preload(oneapi::math::device key) override {
+        const auto idx = static_cast<std::size_t>(key);
+        std::call_once(init_flags[idx], [&]() { add_table(key, nullptr); });
+        return lib_names[idx];
     }
 
 private:
@@ -96,25 +203,83 @@ private:
     }
 #endif
 
-    function_table_t& add_table(oneapi::math::device key, sycl::queue& q) {
+#ifdef ONEMATH_ENABLE_TRACING
+    template <typename fn_t, typename... args_t>
+    auto traced_call(const char* routine, oneapi::math::device key, std::size_t level,
+                     const function_table_t& table, fn_t function_table_t::*fn, args_t&... args) {
+        trace_record record;
+        record.domain_id = domain_id;
+        record.routine = routine;
+        record.backend = get_library_name(key, level);
+        record.thread = std::this_thread::get_id();
+        trace_arguments(record, args...);
+        record.start = std::chrono::steady_clock::now();
+        using result_t = decltype((table.*fn)(args...));
+        if constexpr (std::is_void_v<result_t>) {
+            (table.*fn)(args...);
+            record.host_time = std::chrono::steady_clock::now() - record.start;
+            trace_push(std::move(record));
+        }
+        else {
+            result_t result = (table.*fn)(args...);
+            record.host_time = std::chrono::steady_clock::now() - record.start;
+            if constexpr (std::is_same_v<result_t, sycl::event>) {
+                if (record.profiling) {
+                    record.event = result;
+                    record.has_event = true;
+                }
+            }
+            trace_push(std::move(record));
+            return result;
+        }
+    }
+#endif
+
+    // Called at most once per device, from within std::call_once. If it throws, the
+    // once_flag is left unset and the next call for the device retries the load.
+    // q is null when the table is preloaded without a queue.
+    void add_table(oneapi::math::device key, const sycl::queue* q) {
+        const auto idx = static_cast<std::size_t>(key);
         dlhandle handle;
-        // check all available libraries for the key(device)
-        for (const char* libname : libraries[domain_id][key]) {
+        const char* loaded_libname = nullptr;
+        // check all available libraries for the key(device), in priority order
+        library_order[idx] = get_ordered_libraries(key);
+        if (linked_table) {
+            // Only one backend is built, so there is nothing to fall back to
+            if (library_order[idx].empty()) {
+                if (q)
+                    throw math::unsupported_device("", "", q->get_device());
+                throw math::backend_not_found();
+            }
+            if (linked_table->version != SPEC_VERSION)
+                throw math::specification_mismatch();
+            lib_names[idx] = library_order[idx].front();
+            next_library[idx] = library_order[idx].size();
+            table_ptrs[idx].store(linked_table, std::memory_order_release);
+            return;
+        }
+        std::size_t next = 0;
+        while (next < library_order[idx].size()) {
+            const char* libname = library_order[idx][next++];
             handle = dlhandle{ ::GET_LIB_HANDLE(libname) };
-            if (handle)
+            if (handle) {
+                loaded_libname = libname;
                 break;
+            }
         }
         if (!handle) {
-            if (!is_generic_device_supported && key == oneapi::math::device::generic_device) {
-                throw math::unsupported_device("", "", q.get_device());
+            if (!is_generic_device_supported && key == oneapi::math::device::generic_device &&
+                q) {
+                throw math::unsupported_device("", "", q->get_device());
             }
             else {
-                std::cerr << ERROR_MSG << '\n';
+                if (q)
+                    std::cerr << ERROR_MSG << '\n';
                 throw math::backend_not_found();
             }
         }
-        auto t =
-            reinterpret_cast<function_table_t*>(::GET_FUNC(handle.get(), table_names[domain_id]));
+        auto t = reinterpret_cast<function_table_t*>(
+            ::GET_FUNC(handle.get(), table_names.find(domain_id)->second));
 
         if (!t) {
             std::cerr << ERROR_MSG << '\n';
@@ -123,13 +288,66 @@ private:
         if (t->version != SPEC_VERSION)
             throw math::specification_mismatch();
 
-        handles[key] = std::move(handle);
-        tables[key] = *t;
-        return *t;
+        handles[idx] = std::move(handle);
+        tables[idx] = *t;
+        lib_names[idx] = loaded_libname;
+        next_library[idx] = next;
+        table_ptrs[idx].store(&tables[idx], std::memory_order_release);
     }
 
-    std::map<oneapi::math::device, function_table_t> tables;
-    std::map<oneapi::math::device, dlhandle> handles;
+    // Libraries built for the device, in the order set by the backend priority
+    std::vector<const char*> get_ordered_libraries(oneapi::math::device key) {
+        // find() is used rather than operator[] so that loading tables for different
+        // devices concurrently never inserts into the shared libraries map
+        const auto& domain_libs = libraries.find(domain_id)->second;
+        const auto device_libs = domain_libs.find(key);
+        if (device_libs == domain_libs.end())
+            return {};
+        return order_by_priority(device_libs->second, get_backend_priority());
+    }
+
+    // Returns the table of the level-th fallback backend for the device, loading the
+    // next libraries in priority order as needed, or nullptr if there are none left.
+    function_table_t* get_fallback_table(oneapi::math::device key, std::size_t level) {
+        const auto idx = static_cast<std::size_t>(key);
+        std::lock_guard<std::mutex> lock(fallback_mutex);
+        auto& chain = fallbacks[idx];
+        while (chain.size() < level && next_library[idx] < library_order[idx].size()) {
+            const char* libname = library_order[idx][next_library[idx]++];
+            dlhandle handle{ ::GET_LIB_HANDLE(libname) };
+            if (!handle)
+                continue;
+            auto t = reinterpret_cast<function_table_t*>(
+                ::GET_FUNC(handle.get(), table_names.find(domain_id)->second));
+            if (!t || t->version != SPEC_VERSION)
+                continue;
+            chain.push_back({ *t, std::move(handle), libname });
+        }
+        return chain.size() >= level ? &chain[level - 1].table : nullptr;
+    }
+
+    struct fallback_entry {
+        function_table_t table;
+        dlhandle handle;
+        const char* libname;
+    };
+
+    static constexpr std::size_t num_devices =
+        static_cast<std::size_t>(oneapi::math::device::generic_device) + 1;
+
+    function_table_t* linked_table = nullptr;
+
+    std::array<function_table_t, num_devices> tables{};
+    std::array<dlhandle, num_devices> handles;
+    std::array<const char*, num_devices> lib_names{};
+    std::array<std::atomic<function_table_t*>, num_devices> table_ptrs{};
+    std::array<std::once_flag, num_devices> init_flags;
+
+    // Backends tried when the loaded one throws math::unimplemented
+    std::array<std::vector<const char*>, num_devices> library_order;
+    std::array<std::size_t, num_devices> next_library{};
+    std::array<std::deque<fallback_entry>, num_devices> fallbacks;
+    std::mutex fallback_mutex;
 };
 
 } //namespace detail
@@ -0,0 +1,125 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMATH_HANDLE_POOL_HPP_
+#define _ONEMATH_HANDLE_POOL_HPP_
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include <cstddef>
+#include <deque>
+#include <mutex>
+
+namespace oneapi {
+namespace math {
+namespace detail {
+
+// Returns the copy of the device kept for the whole process, the same for all devices
+// comparing equal. The copies are never destroyed, so that holding one does not release
+// a SYCL object after the SYCL runtime has shut down.
+inline const sycl::device* intern_device(const sycl::device& device) {
+    static std::mutex& mutex = *new std::mutex();
+    static std::deque<sycl::device>& devices = *new std::deque<sycl::device>();
+    std::lock_guard<std::mutex> lock(mutex);
+    for (const auto& interned : devices) {
+        if (interned == device)
+            return &interned;
+    }
+    devices.push_back(device);
+    return &devices.back();
+}
+
+// Per-thread pool of backend handles (library handles, scratch workspaces, ...) keyed by
+// device. Each host thread owns its own handles, so lookups take no lock and a handle is
+// never used by two threads at once. The handle of the last device used by the thread is
+// checked first, which makes repeated calls on one device a single comparison; other
+// devices are searched linearly, as a thread uses few devices.
+//
+// Devices are compared with ==, through the copies returned by intern_device, so the pool
+// itself holds no SYCL objects. There is at most one handle per device and thread.
+// Handles are destroyed on clear() or when their thread exits, possibly after the SYCL
+// runtime has shut down, so destroying a handle must not call into the runtime.
+//
+// handle_t must be move constructible. Backends give each kind of state its own handle_t,
+// which selects the pool.
+template <typename handle_t>
+class handle_pool {
+public:
+    // Returns the calling thread's handle for the device of the queue, creating it with
+    // create(queue) on first use.
+    template <typename create_t>
+    static handle_t& get(const sycl::queue& queue, create_t&& create) {
+        cache& c = local_cache();
+        const sycl::device device = queue.get_device();
+        if (c.last && *c.last->device == device)
+            return c.last->handle;
+        for (auto& e : c.handles) {
+            if (*e.device == device) {
+                c.last = &e;
+                return e.handle;
+            }
+        }
+        c.handles.push_back({ intern_device(device), create(queue) });
+        c.last = &c.handles.back();
+        return c.last->handle;
+    }
+
+    static handle_t& get(const sycl::queue& queue) {
+        return get(queue, [](const sycl::queue& q) { return handle_t(q); });
+    }
+
+    // Number of handles held by the calling thread
+    static std::size_t size() {
+        return local_cache().handles.size();
+    }
+
+    // Destroys the handles of the calling thread
+    static void clear() {
+        cache& c = local_cache();
+        c.last = nullptr;
+        c.handles.clear();
+    }
+
+private:
+    struct entry {
+        const sycl::device* device;
+        handle_t handle;
+    };
+
+    struct cache {
+        // Elements of a deque keep their address when others are appended
+        std::deque<entry> handles;
+        entry* last = nullptr;
+    };
+
+    static cache& local_cache() {
+        static thread_local cache c;
+        return c;
+    }
+};
+
+} // namespace detail
+} // namespace math
+} // namespace oneapi
+
+#endif // _ONEMATH_HANDLE_POOL_HPP_
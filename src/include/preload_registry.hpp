@@ -0,0 +1,48 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMATH_PRELOAD_REGISTRY_HPP_
+#define _ONEMATH_PRELOAD_REGISTRY_HPP_
+
+#include "oneapi/math/detail/backends_table.hpp"
+
+namespace oneapi {
+namespace math {
+namespace detail {
+
+// Interface of the per-domain function tables used by oneapi::math::preload
+class function_table_preloader {
+public:
+    virtual oneapi::math::domain get_domain() const = 0;
+    // Loads the table for the device if needed and returns the name of its library.
+    // Throws if no backend library could be loaded.
+    virtual const char* preload(oneapi::math::device key) = 0;
+
+protected:
+    ~function_table_preloader() = default;
+};
+
+// Registers a function table so that it can be reached by oneapi::math::preload
+void register_preloader(function_table_preloader* preloader);
+
+} //namespace detail
+} // namespace math
+} // namespace oneapi
+
+#endif //_ONEMATH_PRELOAD_REGISTRY_HPP_
@@ -0,0 +1,146 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _ONEMATH_TRACE_HPP_
+#define _ONEMATH_TRACE_HPP_
+
+// Tracing of the calls made through the run-time dispatch loaders. It is compiled in only
+// with the ENABLE_TRACING CMake option and, when compiled in, records calls only if the
+// ONEMATH_TRACE environment variable names an output file. Records are kept in a ring
+// buffer of ONEMATH_TRACE_BUFFER_SIZE entries (65536 by default) and written by
+// oneapi::math::flush_trace() and at exit, as Chrome trace JSON if the file name ends with
+// .json and as a CSV summary otherwise. Execution times of calls on profiling queues are
+// read while later calls are traced, once their events have completed, and by
+// flush_trace(). Events are never queried at exit.
+
+#include "oneapi/math/detail/backends_table.hpp"
+
+#ifdef ONEMATH_ENABLE_TRACING
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include <array>
+#include <chrono>
+#include <complex>
+#include <cstdint>
+#include <thread>
+#include <type_traits>
+
+namespace oneapi {
+namespace math {
+namespace detail {
+
+struct trace_record {
+    oneapi::math::domain domain_id;
+    const char* routine = "";
+    const char* dtype = "";
+    const char* backend = "";
+    // First std::int64_t arguments of the call, which are the problem sizes for most routines
+    std::array<std::int64_t, 3> dims{};
+    std::size_t num_dims = 0;
+    std::thread::id thread;
+    std::chrono::steady_clock::time_point start;
+    std::chrono::steady_clock::duration host_time{};
+    // Whether the call was made on a queue with profiling enabled
+    bool profiling = false;
+    // Event returned by the backend on a profiling queue, released once its execution
+    // time is known
+    sycl::event event;
+    bool has_event = false;
+    // Execution time of the event in microseconds, negative while it is not known
+    double device_us = -1.0;
+};
+
+// Cheap to call: reads the environment only once
+bool trace_enabled();
+
+void trace_push(trace_record&& record);
+
+template <typename T>
+struct trace_value_type {
+    static constexpr const char* name = nullptr;
+};
+template <>
+struct trace_value_type<sycl::half> {
+    static constexpr const char* name = "f16";
+};
+template <>
+struct trace_value_type<float> {
+    static constexpr const char* name = "f32";
+};
+template <>
+struct trace_value_type<double> {
+    static constexpr const char* name = "f64";
+};
+template <>
+struct trace_value_type<std::complex<float>> {
+    static constexpr const char* name = "c64";
+};
+template <>
+struct trace_value_type<std::complex<double>> {
+    static constexpr const char* name = "c128";
+};
+
+// Data type of the routine, taken from its first pointer or buffer argument to a
+// floating point type
+template <typename T>
+struct trace_dtype {
+    static constexpr const char* name = nullptr;
+};
+template <typename T>
+struct trace_dtype<T*> {
+    static constexpr const char* name = trace_value_type<std::remove_cv_t<T>>::name
+                                            ? trace_value_type<std::remove_cv_t<T>>::name
+                                            : trace_dtype<std::remove_cv_t<T>>::name;
+};
+template <typename T, int dimensions, typename... buffer_args_t>
+struct trace_dtype<sycl::buffer<T, dimensions, buffer_args_t...>> {
+    static constexpr const char* name = trace_value_type<std::remove_cv_t<T>>::name;
+};
+
+template <typename... args_t>
+void trace_arguments(trace_record& record, const args_t&... args) {
+    const char* dtype = nullptr;
+    ((dtype = dtype ? dtype : trace_dtype<std::decay_t<args_t>>::name), ...);
+    if (dtype)
+        record.dtype = dtype;
+    auto add_dim = [&record](const auto& arg) {
+        using arg_t = std::decay_t<decltype(arg)>;
+        if constexpr (std::is_same_v<arg_t, std::int64_t>) {
+            if (record.num_dims < record.dims.size())
+                record.dims[record.num_dims++] = arg;
+        }
+        else if constexpr (std::is_same_v<arg_t, sycl::queue>) {
+            record.profiling = arg.template has_property<sycl::property::queue::enable_profiling>();
+        }
+    };
+    (add_dim(args), ...);
+}
+
+} // namespace detail
+} // namespace math
+} // namespace oneapi
+
+#endif // ONEMATH_ENABLE_TRACING
+
+#endif // _ONEMATH_TRACE_HPP_
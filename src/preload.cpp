@@ -0,0 +1,159 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdlib>
+#include <exception>
+#include <future>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "oneapi/math/preload.hpp"
+#include "oneapi/math/detail/get_device_id.hpp"
+
+#include "preload_registry.hpp"
+
+namespace oneapi {
+namespace math {
+namespace detail {
+
+static std::mutex& registry_mutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+static std::vector<function_table_preloader*>& registry() {
+    static std::vector<function_table_preloader*> preloaders;
+    return preloaders;
+}
+
+void register_preloader(function_table_preloader* preloader) {
+    std::lock_guard<std::mutex> lock(registry_mutex());
+    registry().push_back(preloader);
+}
+
+static const std::map<std::string, domain> domain_names = { { "blas", domain::blas },
+                                                            { "dft", domain::dft },
+                                                            { "lapack", domain::lapack },
+                                                            { "rng", domain::rng },
+                                                            { "sparse_blas",
+                                                              domain::sparse_blas } };
+
+static std::vector<domain> registered_domains() {
+    std::set<domain> domains;
+    std::lock_guard<std::mutex> lock(registry_mutex());
+    for (auto preloader : registry()) {
+        domains.insert(preloader->get_domain());
+    }
+    return { domains.begin(), domains.end() };
+}
+
+static std::vector<device> available_devices() {
+    std::set<device> devices;
+    for (auto& dev : sycl::device::get_devices()) {
+        sycl::queue queue(dev);
+        devices.insert(get_device_id(queue));
+    }
+    return { devices.begin(), devices.end() };
+}
+
+// Parses a comma separated list of domain names, "all" selects every built domain
+static std::vector<domain> parse_domains(const std::string& value) {
+    std::vector<domain> domains;
+    std::stringstream stream(value);
+    std::string name;
+    while (std::getline(stream, name, ',')) {
+        if (name == "all") {
+            return registered_domains();
+        }
+        auto it = domain_names.find(name);
+        if (it == domain_names.end()) {
+            throw math::invalid_argument("", "preload", "unknown domain '" + name + "'");
+        }
+        domains.push_back(it->second);
+    }
+    return domains;
+}
+
+// Loads every table of one domain for each device. BLAS registers one table per
+// layout; the library is only opened once, later loads reuse the open handle.
+static std::vector<preload_info> preload_domain(domain domain_id,
+                                                const std::vector<device>& devices) {
+    std::vector<function_table_preloader*> preloaders;
+    {
+        std::lock_guard<std::mutex> lock(registry_mutex());
+        std::copy_if(registry().begin(), registry().end(), std::back_inserter(preloaders),
+                     [=](function_table_preloader* p) { return p->get_domain() == domain_id; });
+    }
+    std::vector<preload_info> infos;
+    for (auto device_id : devices) {
+        preload_info info;
+        info.domain_id = domain_id;
+        info.device_id = device_id;
+        if (preloaders.empty()) {
+            info.error = "domain is not built";
+            infos.push_back(info);
+            continue;
+        }
+        auto start = std::chrono::steady_clock::now();
+        try {
+            for (auto preloader : preloaders) {
+                info.library = preloader->preload(device_id);
+            }
+            info.loaded = true;
+        }
+        catch (const std::exception& e) {
+            info.error = e.what();
+        }
+        info.load_time = std::chrono::steady_clock::now() - start;
+        infos.push_back(info);
+    }
+    return infos;
+}
+
+} //namespace detail
+
+std::vector<preload_info> preload(const std::vector<domain>& domains,
+                                  const std::vector<device>& devices) {
+    std::vector<std::future<std::vector<preload_info>>> tasks;
+    for (auto domain_id : domains) {
+        tasks.push_back(
+            std::async(std::launch::async, detail::preload_domain, domain_id, std::cref(devices)));
+    }
+    std::vector<preload_info> infos;
+    for (auto& task : tasks) {
+        auto domain_infos = task.get();
+        infos.insert(infos.end(), domain_infos.begin(), domain_infos.end());
+    }
+    return infos;
+}
+
+std::vector<preload_info> preload() {
+    const char* value = std::getenv("ONEMATH_PRELOAD");
+    auto domains = (value && *value) ? detail::parse_domains(value) : detail::registered_domains();
+    return preload(domains, detail::available_devices());
+}
+
+} // namespace math
+} // namespace oneapi
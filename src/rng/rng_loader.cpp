@@ -27,7 +27,13 @@ namespace math {
 namespace rng {
 namespace detail {
 
+#ifdef ONEMATH_ENABLE_STATIC_DISPATCH
+extern "C" rng_function_table_t onemath_rng_table;
+static oneapi::math::detail::table_initializer<domain::rng, rng_function_table_t> function_tables(
+    &onemath_rng_table);
+#else
 static oneapi::math::detail::table_initializer<domain::rng, rng_function_table_t> function_tables;
+#endif
 
 engine_impl* create_philox4x32x10(oneapi::math::device libkey, sycl::queue queue,
                                   std::uint64_t seed) {
@@ -26,9 +26,16 @@
 
 namespace oneapi::math::sparse {
 
+#ifdef ONEMATH_ENABLE_STATIC_DISPATCH
+extern "C" sparse_blas_function_table_t onemath_sparse_blas_table;
+static oneapi::math::detail::table_initializer<math::domain::sparse_blas,
+                                               sparse_blas_function_table_t>
+    function_tables(&onemath_sparse_blas_table);
+#else
 static oneapi::math::detail::table_initializer<math::domain::sparse_blas,
                                                sparse_blas_function_table_t>
     function_tables;
+#endif
 
 // Dense vector
 #define DEFINE_DENSE_VECTOR_FUNCS(FP_TYPE, FP_SUFFIX)                                             \
@@ -0,0 +1,274 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#include "oneapi/math/trace.hpp"
+#include "trace.hpp"
+
+#ifdef ONEMATH_ENABLE_TRACING
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace oneapi {
+namespace math {
+namespace detail {
+
+struct trace_slot {
+    std::atomic_flag busy = ATOMIC_FLAG_INIT;
+    bool used = false;
+    trace_record record;
+};
+
+// Reads the execution time of the record's event and releases the event. Unless wait is
+// set, events that have not completed yet are left for later.
+static void resolve_device_time(trace_record& record, bool wait) {
+    if (!record.has_event)
+        return;
+    try {
+        if (wait)
+            record.event.wait();
+        else if (record.event.get_info<sycl::info::event::command_execution_status>() !=
+                 sycl::info::event_command_status::complete)
+            return;
+        const auto start =
+            record.event.get_profiling_info<sycl::info::event_profiling::command_start>();
+        const auto end =
+            record.event.get_profiling_info<sycl::info::event_profiling::command_end>();
+        record.device_us = static_cast<double>(end - start) * 1e-3;
+    }
+    catch (const sycl::exception&) {
+        // No profiling information, for instance from a host task
+    }
+    record.event = sycl::event();
+    record.has_event = false;
+}
+
+// Records are written to the slot following the last one claimed, overwriting the oldest
+// records once the buffer is full. Claiming a slot is a single atomic increment; the
+// per-slot flag only matters when writers wrap around onto the same slot. Each push also
+// reads the execution time of the record pushed half a buffer earlier if its event has
+// completed, so that events are not held until the records are written.
+class trace_buffer {
+public:
+    trace_buffer(std::size_t size) : size_(size), slots_(new trace_slot[size]) {}
+
+    void push(trace_record&& record) {
+        const std::size_t next = next_.fetch_add(1, std::memory_order_relaxed);
+        trace_slot& slot = slots_[next % size_];
+        lock(slot);
+        slot.record = std::move(record);
+        slot.used = true;
+        slot.busy.clear(std::memory_order_release);
+
+        trace_slot& older = slots_[(next + size_ - size_ / 2) % size_];
+        if (&older != &slot && !older.busy.test_and_set(std::memory_order_acquire)) {
+            resolve_device_time(older.record, false);
+            older.busy.clear(std::memory_order_release);
+        }
+    }
+
+    // Waits for the events of all the records and reads their execution times
+    void resolve() {
+        for (std::size_t i = 0; i < size_; ++i) {
+            lock(slots_[i]);
+            resolve_device_time(slots_[i].record, true);
+            slots_[i].busy.clear(std::memory_order_release);
+        }
+    }
+
+    // Copies of the records, without their events, in the order of the calls
+    std::vector<trace_record> records() {
+        std::vector<trace_record> result;
+        for (std::size_t i = 0; i < size_; ++i) {
+            lock(slots_[i]);
+            if (slots_[i].used) {
+                result.push_back(slots_[i].record);
+                result.back().event = sycl::event();
+                result.back().has_event = false;
+            }
+            slots_[i].busy.clear(std::memory_order_release);
+        }
+        std::sort(result.begin(), result.end(),
+                  [](const trace_record& a, const trace_record& b) { return a.start < b.start; });
+        return result;
+    }
+
+private:
+    static void lock(trace_slot& slot) {
+        while (slot.busy.test_and_set(std::memory_order_acquire))
+            ;
+    }
+
+    std::size_t size_;
+    std::unique_ptr<trace_slot[]> slots_;
+    std::atomic<std::size_t> next_{ 0 };
+};
+
+static const char* trace_path() {
+    static const char* path = std::getenv("ONEMATH_TRACE");
+    return path;
+}
+
+// Never destroyed, so that the events still held at exit are not released after the SYCL
+// runtime is torn down
+static trace_buffer& buffer() {
+    static trace_buffer& instance = *new trace_buffer([]() {
+        const char* value = std::getenv("ONEMATH_TRACE_BUFFER_SIZE");
+        const long long size = value ? std::atoll(value) : 0;
+        return size > 0 ? static_cast<std::size_t>(size) : std::size_t(65536);
+    }());
+    return instance;
+}
+
+static const char* domain_name(oneapi::math::domain domain_id) {
+    switch (domain_id) {
+        case oneapi::math::domain::blas: return "blas";
+        case oneapi::math::domain::dft: return "dft";
+        case oneapi::math::domain::lapack: return "lapack";
+        case oneapi::math::domain::rng: return "rng";
+        case oneapi::math::domain::sparse_blas: return "sparse_blas";
+        default: return "";
+    }
+}
+
+static std::string dims_string(const trace_record& record) {
+    std::string dims;
+    for (std::size_t i = 0; i < record.num_dims; ++i)
+        dims += (i ? "x" : "") + std::to_string(record.dims[i]);
+    return dims;
+}
+
+static double to_us(std::chrono::steady_clock::duration time) {
+    return std::chrono::duration<double, std::micro>(time).count();
+}
+
+static void write_chrome_trace(std::ostream& out, const std::vector<trace_record>& records) {
+    out << "{\"traceEvents\":[";
+    const auto origin = records.empty() ? std::chrono::steady_clock::time_point{}
+                                        : records.front().start;
+    std::hash<std::thread::id> thread_hash;
+    for (std::size_t i = 0; i < records.size(); ++i) {
+        const trace_record& record = records[i];
+        out << (i ? ",\n" : "\n") << "{\"name\":\"" << record.routine << "\",\"cat\":\""
+            << domain_name(record.domain_id) << "\",\"ph\":\"X\",\"pid\":0,\"tid\":"
+            << thread_hash(record.thread) % 1000000 << ",\"ts\":" << to_us(record.start - origin)
+            << ",\"dur\":" << to_us(record.host_time) << ",\"args\":{\"dtype\":\""
+            << record.dtype << "\",\"dims\":\"" << dims_string(record) << "\",\"backend\":\""
+            << record.backend << "\"";
+        if (record.device_us >= 0.0)
+            out << ",\"device_us\":" << record.device_us;
+        out << "}}";
+    }
+    out << "\n]}\n";
+}
+
+static void write_csv_summary(std::ostream& out, const std::vector<trace_record>& records) {
+    struct summary {
+        std::size_t calls = 0;
+        double host_us = 0.0;
+        std::size_t device_calls = 0;
+        double device_us = 0.0;
+    };
+    using key_t = std::tuple<std::string, std::string, std::string, std::string, std::string>;
+    std::map<key_t, summary> summaries;
+    for (const trace_record& record : records) {
+        auto& entry = summaries[{ domain_name(record.domain_id), record.routine, record.dtype,
+                                  dims_string(record), record.backend }];
+        ++entry.calls;
+        entry.host_us += to_us(record.host_time);
+        if (record.device_us >= 0.0) {
+            ++entry.device_calls;
+            entry.device_us += record.device_us;
+        }
+    }
+    out << "domain,routine,dtype,dims,backend,calls,host_us_total,host_us_mean,device_us_total,"
+           "device_us_mean\n";
+    for (const auto& [key, entry] : summaries) {
+        out << std::get<0>(key) << ',' << std::get<1>(key) << ',' << std::get<2>(key) << ','
+            << std::get<3>(key) << ',' << std::get<4>(key) << ',' << entry.calls << ','
+            << entry.host_us << ',' << entry.host_us / entry.calls << ',';
+        if (entry.device_calls)
+            out << entry.device_us << ',' << entry.device_us / entry.device_calls;
+        else
+            out << ',';
+        out << '\n';
+    }
+}
+
+static void write_trace() {
+    const std::string path = trace_path();
+    std::ofstream out(path);
+    if (!out) {
+        std::cerr << "oneMath: cannot write trace to " << path << '\n';
+        return;
+    }
+    const std::vector<trace_record> records = buffer().records();
+    const std::string json = ".json";
+    if (path.size() >= json.size() && path.compare(path.size() - json.size(), json.size(), json) == 0)
+        write_chrome_trace(out, records);
+    else
+        write_csv_summary(out, records);
+}
+
+bool trace_enabled() {
+    // The trace is written by an exit handler, which only uses the execution times read
+    // before exit: the SYCL runtime may already be shutting down when it runs
+    static const bool enabled = []() {
+        if (!trace_path() || !*trace_path())
+            return false;
+        static_cast<void>(buffer());
+        std::atexit(write_trace);
+        return true;
+    }();
+    return enabled;
+}
+
+void trace_push(trace_record&& record) {
+    buffer().push(std::move(record));
+}
+
+} // namespace detail
+} // namespace math
+} // namespace oneapi
+
+#endif // ONEMATH_ENABLE_TRACING
+
+namespace oneapi {
+namespace math {
+
+void flush_trace() {
+#ifdef ONEMATH_ENABLE_TRACING
+    if (!detail::trace_enabled())
+        return;
+    detail::buffer().resolve();
+    detail::write_trace();
+#endif
+}
+
+} // namespace math
+} // namespace oneapi
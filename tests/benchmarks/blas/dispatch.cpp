@@ -0,0 +1,180 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+/*
+*
+*  Content:
+*       Measures the host-side cost of run-time dispatch. The latency of a 4x4 USM
+*       sgemm called through the run-time API is compared with the same call made
+*       through the compile-time API of the CPU backend, first from one host thread
+*       and then from one thread per hardware thread, all sharing the queue. The
+*       cached device classification of get_device_id is compared with querying the
+*       SYCL runtime on every call, and with a handle bound to the queue, which calls
+*       the backend function table resolved when binding. The first call, which
+*       loads the backend library unless it is linked into onemath with
+*       ENABLE_STATIC_DISPATCH, is timed on its own: run the benchmark from a build
+*       with and from a build without that option to compare the two.
+*
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+#include "oneapi/math.hpp"
+
+#include "benchmark_helper.hpp"
+
+#if defined(ONEMATH_ENABLE_MKLCPU_BACKEND)
+#define BENCHMARK_CPU_BACKEND mklcpu
+#elif defined(ONEMATH_ENABLE_NETLIB_BACKEND)
+#define BENCHMARK_CPU_BACKEND netlib
+#endif
+
+#ifdef ONEMATH_ENABLE_STATIC_DISPATCH
+#define BENCHMARK_DISPATCH "static dispatch"
+#else
+#define BENCHMARK_DISPATCH "dynamic loading"
+#endif
+
+namespace {
+
+constexpr std::int64_t n = 4;
+constexpr std::int64_t iterations = 20000;
+
+// Operands of one calling thread, each thread writes its own C
+struct gemm_operands {
+    explicit gemm_operands(sycl::queue& q)
+            : queue(q),
+              a(sycl::malloc_shared<float>(n * n, q)),
+              b(sycl::malloc_shared<float>(n * n, q)),
+              c(sycl::malloc_shared<float>(n * n, q)) {
+        std::fill(a, a + n * n, 1.0f);
+        std::fill(b, b + n * n, 1.0f);
+        std::fill(c, c + n * n, 0.0f);
+    }
+    ~gemm_operands() {
+        sycl::free(a, queue);
+        sycl::free(b, queue);
+        sycl::free(c, queue);
+    }
+    gemm_operands(const gemm_operands&) = delete;
+    gemm_operands& operator=(const gemm_operands&) = delete;
+
+    sycl::queue queue;
+    float* a;
+    float* b;
+    float* c;
+};
+
+template <typename Selector>
+void gemm(Selector&& selector, gemm_operands& x) {
+    oneapi::math::blas::column_major::gemm(selector, oneapi::math::transpose::nontrans,
+                                           oneapi::math::transpose::nontrans, n, n, n, 1.0f, x.a,
+                                           n, x.b, n, 0.0f, x.c, n)
+        .wait();
+}
+
+// Run-time call classifying the device of the queue on every call
+void gemm_uncached(sycl::queue& queue, gemm_operands& x) {
+    oneapi::math::blas::column_major::detail::gemm(
+        oneapi::math::detail::get_device_id_uncached(queue), queue,
+        oneapi::math::transpose::nontrans, oneapi::math::transpose::nontrans, n, n, n, 1.0f, x.a,
+        n, x.b, n, 0.0f, x.c, n)
+        .wait();
+}
+
+// Run-time call through the function table resolved when binding the queue
+void gemm_bound(oneapi::math::blas::column_major::bound_handle& handle, gemm_operands& x) {
+    handle.gemm(oneapi::math::transpose::nontrans, oneapi::math::transpose::nontrans, n, n, n, 1.0f,
+                x.a, n, x.b, n, 0.0f, x.c, n)
+        .wait();
+}
+
+void run_benchmark(sycl::queue& queue) {
+    const int num_threads = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<std::unique_ptr<gemm_operands>> operands;
+    for (int t = 0; t < num_threads; ++t) {
+        operands.push_back(std::make_unique<gemm_operands>(queue));
+    }
+
+    // Timed before any other call of the library
+    benchmark::report("sgemm 4x4, run-time API, first call, " BENCHMARK_DISPATCH,
+                      benchmark::time_once([&]() { gemm(queue, *operands[0]); }));
+    benchmark::report("sgemm 4x4, run-time API, 1 thread",
+                      benchmark::time_per_call(iterations, [&]() { gemm(queue, *operands[0]); }));
+    benchmark::report(
+        "sgemm 4x4, run-time API, " + std::to_string(num_threads) + " threads",
+        benchmark::time_per_call_concurrent(num_threads, iterations / num_threads + 1,
+                                            [&](int t) { gemm(queue, *operands[t]); }));
+
+    benchmark::report("get_device_id, cached", benchmark::time_per_call(iterations, [&]() {
+                          static_cast<void>(oneapi::math::get_device_id(queue));
+                      }));
+    benchmark::report("get_device_id, uncached", benchmark::time_per_call(iterations, [&]() {
+                          static_cast<void>(oneapi::math::detail::get_device_id_uncached(queue));
+                      }));
+    benchmark::report(
+        "sgemm 4x4, run-time API, uncached device, 1 thread",
+        benchmark::time_per_call(iterations, [&]() { gemm_uncached(queue, *operands[0]); }));
+    auto handle = oneapi::math::blas::column_major::bind(queue);
+    benchmark::report(
+        "sgemm 4x4, bound handle, 1 thread",
+        benchmark::time_per_call(iterations, [&]() { gemm_bound(handle, *operands[0]); }));
+
+#ifdef BENCHMARK_CPU_BACKEND
+    if (!queue.get_device().is_cpu()) {
+        return;
+    }
+    using selector_t = oneapi::math::backend_selector<oneapi::math::backend::BENCHMARK_CPU_BACKEND>;
+    selector_t selector{ queue };
+    benchmark::report(
+        "sgemm 4x4, compile-time API, 1 thread",
+        benchmark::time_per_call(iterations, [&]() { gemm(selector, *operands[0]); }));
+    std::vector<selector_t> selectors(num_threads, selector);
+    benchmark::report(
+        "sgemm 4x4, compile-time API, " + std::to_string(num_threads) + " threads",
+        benchmark::time_per_call_concurrent(num_threads, iterations / num_threads + 1,
+                                            [&](int t) { gemm(selectors[t], *operands[t]); }));
+#endif
+}
+
+} // namespace
+
+int main() {
+    try {
+        sycl::queue queue;
+        benchmark::print_device(queue);
+        run_benchmark(queue);
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Caught exception: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,113 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+/*
+*
+*  Content:
+*       Measures the memory traffic saved by the buffer complex gemm of the
+*       generic backend, which works on its std::complex buffers reinterpreted in
+*       place. The call is compared with the staging it replaces: copying a, b
+*       and c to new buffers, making the product on them and copying c back.
+*       The difference is the time of the staging, reported with the bandwidth
+*       of the bytes it moves.
+*
+*******************************************************************************/
+
+#include <complex>
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+#include "oneapi/math.hpp"
+
+#include "benchmark_helper.hpp"
+
+namespace {
+
+using selector_t = oneapi::math::backend_selector<oneapi::math::backend::generic>;
+using complex_t = std::complex<float>;
+using buffer_t = sycl::buffer<complex_t, 1>;
+
+constexpr auto nontrans = oneapi::math::transpose::nontrans;
+
+void gemm(selector_t& selector, std::int64_t n, buffer_t& a, buffer_t& b, buffer_t& c) {
+    oneapi::math::blas::column_major::gemm(selector, nontrans, nontrans, n, n, n,
+                                           complex_t(1.0f), a, n, b, n, complex_t(0.0f), c, n);
+}
+
+void copy(sycl::queue& queue, buffer_t& from, buffer_t& to) {
+    queue.submit([&](sycl::handler& cgh) {
+        auto from_acc = from.get_access<sycl::access::mode::read>(cgh);
+        auto to_acc = to.get_access<sycl::access::mode::discard_write>(cgh);
+        cgh.copy(from_acc, to_acc);
+    });
+}
+
+void run_size(selector_t& selector, sycl::queue& queue, std::int64_t n) {
+    const std::size_t size = static_cast<std::size_t>(n * n);
+    std::vector<complex_t> a(size, complex_t(1.0f, 1.0f)), b(size, complex_t(1.0f, -1.0f)),
+        c(size);
+    buffer_t a_buffer(a.data(), size), b_buffer(b.data(), size), c_buffer(c.data(), size);
+    const std::string name = "cgemm " + std::to_string(n) + "x" + std::to_string(n);
+
+    const double in_place = benchmark::time_per_call(1, [&]() {
+        gemm(selector, n, a_buffer, b_buffer, c_buffer);
+        queue.wait_and_throw();
+    });
+    const double staged = benchmark::time_per_call(1, [&]() {
+        buffer_t a_staging(size), b_staging(size), c_staging(size);
+        copy(queue, a_buffer, a_staging);
+        copy(queue, b_buffer, b_staging);
+        copy(queue, c_buffer, c_staging);
+        gemm(selector, n, a_staging, b_staging, c_staging);
+        copy(queue, c_staging, c_buffer);
+        queue.wait_and_throw();
+    });
+    benchmark::report(name + ", reinterpreted in place", in_place);
+    benchmark::report(name + ", staged copies", staged);
+    // Each of the four copies reads and writes one matrix
+    const double staged_bytes = 8.0 * static_cast<double>(size * sizeof(complex_t));
+    std::printf("%-56s %14.1f GB/s\n", (name + ", bandwidth of the staging").c_str(),
+                staged_bytes / (staged - in_place));
+}
+
+} // namespace
+
+int main() {
+    try {
+        sycl::queue queue;
+        benchmark::print_device(queue);
+        selector_t selector{ queue };
+        for (std::int64_t n : { 256, 1024, 2048 }) {
+            run_size(selector, queue, n);
+        }
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Caught exception: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,100 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+/*
+*
+*  Content:
+*       Measures the complex gemm of the generic backend with a conjugate
+*       transposed operand, which conjugates the operand to a copy and hands
+*       the copy to the tuned gemm of onemath_sycl_blas. The call is compared
+*       with the product kernel of the generic backend, which conjugates the
+*       operand as it loads it and which a strided gemm_batch of one item
+*       still runs, and with the same gemm with transpose::trans, which needs
+*       no copy.
+*
+*******************************************************************************/
+
+#include <complex>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+#include "oneapi/math.hpp"
+
+#include "benchmark_helper.hpp"
+
+namespace {
+
+using selector_t = oneapi::math::backend_selector<oneapi::math::backend::generic>;
+using complex_t = std::complex<float>;
+using buffer_t = sycl::buffer<complex_t, 1>;
+
+constexpr auto nontrans = oneapi::math::transpose::nontrans;
+
+void run_size(selector_t& selector, sycl::queue& queue, std::int64_t n) {
+    const std::size_t size = static_cast<std::size_t>(n * n);
+    std::vector<complex_t> a(size, complex_t(1.0f, 1.0f)), b(size, complex_t(1.0f, -1.0f)),
+        c(size);
+    buffer_t a_buffer(a.data(), size), b_buffer(b.data(), size), c_buffer(c.data(), size);
+    const std::string name = "cgemm " + std::to_string(n) + "x" + std::to_string(n);
+
+    auto time_gemm = [&](oneapi::math::transpose transa) {
+        return benchmark::time_per_call(1, [&]() {
+            oneapi::math::blas::column_major::gemm(selector, transa, nontrans, n, n, n,
+                                                   complex_t(1.0f), a_buffer, n, b_buffer, n,
+                                                   complex_t(0.0f), c_buffer, n);
+            queue.wait_and_throw();
+        });
+    };
+    const double conjugated_copy = time_gemm(oneapi::math::transpose::conjtrans);
+    const double product_kernel = benchmark::time_per_call(1, [&]() {
+        oneapi::math::blas::column_major::gemm_batch(
+            selector, oneapi::math::transpose::conjtrans, nontrans, n, n, n, complex_t(1.0f),
+            a_buffer, n, 0, b_buffer, n, 0, complex_t(0.0f), c_buffer, n, 0, 1);
+        queue.wait_and_throw();
+    });
+    const double trans = time_gemm(oneapi::math::transpose::trans);
+    benchmark::report(name + ", conjtrans, conjugated copy", conjugated_copy);
+    benchmark::report(name + ", conjtrans, product kernel", product_kernel);
+    benchmark::report(name + ", trans", trans);
+}
+
+} // namespace
+
+int main() {
+    try {
+        sycl::queue queue;
+        benchmark::print_device(queue);
+        selector_t selector{ queue };
+        for (std::int64_t n : { 64, 256, 1024, 2048 }) {
+            run_size(selector, queue, n);
+        }
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Caught exception: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,101 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+/*
+*
+*  Content:
+*       Measures how the Netlib backend spreads a batch over the cores. A strided
+*       USM sgemm_batch, whose items run on the backend thread pool, is compared
+*       with the same products made by a loop of sgemm calls on an in-order queue,
+*       which run one after the other.
+*
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+#include "oneapi/math.hpp"
+
+#include "benchmark_helper.hpp"
+
+namespace {
+
+constexpr std::int64_t batch_size = 64;
+
+using selector_t = oneapi::math::backend_selector<oneapi::math::backend::netlib>;
+
+void run_size(selector_t& selector, sycl::queue& queue, std::int64_t n) {
+    const std::int64_t stride = n * n;
+    float* a = sycl::malloc_shared<float>(stride * batch_size, queue);
+    float* b = sycl::malloc_shared<float>(stride * batch_size, queue);
+    float* c = sycl::malloc_shared<float>(stride * batch_size, queue);
+    std::fill(a, a + stride * batch_size, 1.0f);
+    std::fill(b, b + stride * batch_size, 1.0f);
+    std::fill(c, c + stride * batch_size, 0.0f);
+    const auto nontrans = oneapi::math::transpose::nontrans;
+    const std::string size = std::to_string(batch_size) + " x " + std::to_string(n) + "x" +
+                             std::to_string(n);
+
+    benchmark::report("sgemm_batch " + size + ", thread pool",
+                      benchmark::time_per_call(1, [&]() {
+                          oneapi::math::blas::column_major::gemm_batch(
+                              selector, nontrans, nontrans, n, n, n, 1.0f, a, n, stride, b, n,
+                              stride, 0.0f, c, n, stride, batch_size)
+                              .wait();
+                      }));
+    benchmark::report("sgemm loop " + size + ", serial", benchmark::time_per_call(1, [&]() {
+                          for (std::int64_t i = 0; i < batch_size; ++i) {
+                              oneapi::math::blas::column_major::gemm(
+                                  selector, nontrans, nontrans, n, n, n, 1.0f, a + i * stride, n,
+                                  b + i * stride, n, 0.0f, c + i * stride, n);
+                          }
+                          queue.wait();
+                      }));
+
+    sycl::free(a, queue);
+    sycl::free(b, queue);
+    sycl::free(c, queue);
+}
+
+} // namespace
+
+int main() {
+    try {
+        sycl::queue queue(sycl::device(sycl::cpu_selector_v),
+                          sycl::property_list{ sycl::property::queue::in_order() });
+        benchmark::print_device(queue);
+        selector_t selector{ queue };
+        for (std::int64_t n : { 16, 64, 256 }) {
+            run_size(selector, queue, n);
+        }
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Caught exception: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
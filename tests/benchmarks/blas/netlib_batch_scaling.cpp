@@ -0,0 +1,118 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+/*
+*
+*  Content:
+*       Measures how the strided trsm_batch and syrk_batch of the Netlib backend
+*       scale with the number of threads of its thread pool, from one thread up
+*       to one per hardware thread. The number of threads is set with the CPU
+*       execution policy of the queue.
+*
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+#include "oneapi/math.hpp"
+#include "oneapi/math/cpu_execution_policy.hpp"
+
+#include "benchmark_helper.hpp"
+
+namespace {
+
+using selector_t = oneapi::math::backend_selector<oneapi::math::backend::netlib>;
+namespace blas = oneapi::math::blas::column_major;
+
+constexpr std::int64_t n = 128;
+constexpr std::int64_t batch_size = 256;
+
+// 1, 2, 4, ... threads, and the number of hardware threads
+std::vector<std::size_t> thread_counts() {
+    const std::size_t max_threads = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<std::size_t> counts;
+    for (std::size_t count = 1; count < max_threads; count *= 2) {
+        counts.push_back(count);
+    }
+    counts.push_back(max_threads);
+    return counts;
+}
+
+void run_benchmark(sycl::queue& queue) {
+    selector_t selector{ queue };
+    const std::int64_t stride = n * n;
+    float* a = sycl::malloc_shared<float>(stride * batch_size, queue);
+    float* b = sycl::malloc_shared<float>(stride * batch_size, queue);
+    // Diagonally dominant lower triangles, so that the solves stay finite
+    for (std::int64_t i = 0; i < stride * batch_size; ++i) {
+        const std::int64_t row = i % n;
+        const std::int64_t col = (i / n) % n;
+        a[i] = row == col ? static_cast<float>(n) : 1.0f;
+    }
+    const std::string size = std::to_string(batch_size) + " x " + std::to_string(n) + "x" +
+                             std::to_string(n);
+
+    for (std::size_t num_threads : thread_counts()) {
+        oneapi::math::set_cpu_execution_policy(queue, { num_threads, {} });
+        const std::string threads = ", " + std::to_string(num_threads) + " threads";
+        benchmark::report("strsm_batch " + size + threads, benchmark::time_per_call(1, [&]() {
+                              std::fill(b, b + stride * batch_size, 1.0f);
+                              blas::trsm_batch(selector, oneapi::math::side::left,
+                                               oneapi::math::uplo::lower,
+                                               oneapi::math::transpose::nontrans,
+                                               oneapi::math::diag::nonunit, n, n, 1.0f, a, n,
+                                               stride, b, n, stride, batch_size)
+                                  .wait();
+                          }));
+        benchmark::report("ssyrk_batch " + size + threads, benchmark::time_per_call(1, [&]() {
+                              blas::syrk_batch(selector, oneapi::math::uplo::lower,
+                                               oneapi::math::transpose::nontrans, n, n, 1.0f, a,
+                                               n, stride, 0.0f, b, n, stride, batch_size)
+                                  .wait();
+                          }));
+    }
+    oneapi::math::reset_cpu_execution_policy(queue);
+
+    sycl::free(a, queue);
+    sycl::free(b, queue);
+}
+
+} // namespace
+
+int main() {
+    try {
+        sycl::queue queue(sycl::device(sycl::cpu_selector_v));
+        benchmark::print_device(queue);
+        run_benchmark(queue);
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Caught exception: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,121 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+/*
+*
+*  Content:
+*       Measures the Netlib implementations of omatcopy and gemmt against the
+*       naive ways of computing them: a transposing omatcopy is compared with a
+*       double loop over the elements, and gemmt, which only computes the stored
+*       triangle, with a full gemm of the same operands.
+*
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+#include "oneapi/math.hpp"
+
+#include "benchmark_helper.hpp"
+
+namespace {
+
+using selector_t = oneapi::math::backend_selector<oneapi::math::backend::netlib>;
+namespace blas = oneapi::math::blas::column_major;
+
+constexpr auto nontrans = oneapi::math::transpose::nontrans;
+constexpr auto trans = oneapi::math::transpose::trans;
+
+void run_omatcopy(selector_t& selector, sycl::queue& queue, std::int64_t n) {
+    float* a = sycl::malloc_shared<float>(n * n, queue);
+    float* b = sycl::malloc_shared<float>(n * n, queue);
+    for (std::int64_t i = 0; i < n * n; ++i) {
+        a[i] = static_cast<float>(i % 7);
+    }
+    const std::string size = std::to_string(n) + "x" + std::to_string(n);
+
+    benchmark::report("somatcopy " + size + ", trans, netlib",
+                      benchmark::time_per_call(1, [&]() {
+                          blas::omatcopy(selector, trans, n, n, 2.0f, a, n, b, n).wait();
+                      }));
+    benchmark::report("somatcopy " + size + ", trans, naive loop",
+                      benchmark::time_per_call(1, [&]() {
+                          for (std::int64_t j = 0; j < n; ++j) {
+                              for (std::int64_t i = 0; i < n; ++i) {
+                                  b[j + i * n] = 2.0f * a[i + j * n];
+                              }
+                          }
+                      }));
+
+    sycl::free(a, queue);
+    sycl::free(b, queue);
+}
+
+void run_gemmt(selector_t& selector, sycl::queue& queue, std::int64_t n) {
+    float* a = sycl::malloc_shared<float>(n * n, queue);
+    float* b = sycl::malloc_shared<float>(n * n, queue);
+    float* c = sycl::malloc_shared<float>(n * n, queue);
+    std::fill(a, a + n * n, 1.0f);
+    std::fill(b, b + n * n, 1.0f);
+    std::fill(c, c + n * n, 0.0f);
+    const std::string size = std::to_string(n) + "x" + std::to_string(n);
+
+    benchmark::report("sgemmt " + size + ", lower, netlib", benchmark::time_per_call(1, [&]() {
+                          blas::gemmt(selector, oneapi::math::uplo::lower, nontrans, nontrans, n,
+                                      n, 1.0f, a, n, b, n, 0.0f, c, n)
+                              .wait();
+                      }));
+    benchmark::report("sgemm " + size + ", full product", benchmark::time_per_call(1, [&]() {
+                          blas::gemm(selector, nontrans, nontrans, n, n, n, 1.0f, a, n, b, n,
+                                     0.0f, c, n)
+                              .wait();
+                      }));
+
+    sycl::free(a, queue);
+    sycl::free(b, queue);
+    sycl::free(c, queue);
+}
+
+} // namespace
+
+int main() {
+    try {
+        sycl::queue queue(sycl::device(sycl::cpu_selector_v));
+        benchmark::print_device(queue);
+        selector_t selector{ queue };
+        for (std::int64_t n : { 1024, 4096 }) {
+            run_omatcopy(selector, queue, n);
+        }
+        for (std::int64_t n : { 512, 2048 }) {
+            run_gemmt(selector, queue, n);
+        }
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Caught exception: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
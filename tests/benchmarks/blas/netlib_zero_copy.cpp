@@ -0,0 +1,87 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+/*
+*
+*  Content:
+*       Measures the buffer sgemm of the Netlib backend on a CPU device with
+*       buffers created with use_host_ptr, which it computes in place on the
+*       memory of the buffers, against buffers created without it, which it
+*       computes in a host task on memory the runtime may copy the data to.
+*       Each timed call creates the buffers, makes the product and destroys
+*       them, so that any copy back to the vectors is counted.
+*
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+#include "oneapi/math.hpp"
+
+#include "benchmark_helper.hpp"
+
+namespace {
+
+using selector_t = oneapi::math::backend_selector<oneapi::math::backend::netlib>;
+
+constexpr std::int64_t n = 4096;
+
+void run_gemm(selector_t& selector, std::vector<float>& a, std::vector<float>& b,
+              std::vector<float>& c, const sycl::property_list& properties) {
+    const auto nontrans = oneapi::math::transpose::nontrans;
+    sycl::buffer<float, 1> a_buffer(a.data(), a.size(), properties);
+    sycl::buffer<float, 1> b_buffer(b.data(), b.size(), properties);
+    sycl::buffer<float, 1> c_buffer(c.data(), c.size(), properties);
+    oneapi::math::blas::column_major::gemm(selector, nontrans, nontrans, n, n, n, 1.0f, a_buffer,
+                                           n, b_buffer, n, 0.0f, c_buffer, n);
+}
+
+} // namespace
+
+int main() {
+    try {
+        sycl::queue queue(sycl::device(sycl::cpu_selector_v));
+        benchmark::print_device(queue);
+        selector_t selector{ queue };
+        std::vector<float> a(n * n, 1.0f), b(n * n, 1.0f), c(n * n, 0.0f);
+        const std::string size = std::to_string(n) + "x" + std::to_string(n);
+
+        const sycl::property_list host_ptr{ sycl::property::buffer::use_host_ptr() };
+        benchmark::report("sgemm " + size + ", use_host_ptr buffers",
+                          benchmark::time_per_call(1, [&]() {
+                              run_gemm(selector, a, b, c, host_ptr);
+                          }));
+        benchmark::report("sgemm " + size + ", other buffers", benchmark::time_per_call(1, [&]() {
+                              run_gemm(selector, a, b, c, {});
+                          }));
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Caught exception: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,120 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+#ifndef _BENCHMARK_HELPER_HPP_
+#define _BENCHMARK_HELPER_HPP_
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace benchmark {
+
+// Number of timed samples, ONEMATH_BENCHMARK_SAMPLES overrides the default
+inline int get_samples() {
+    const char* value = std::getenv("ONEMATH_BENCHMARK_SAMPLES");
+    const int samples = value ? std::atoi(value) : 0;
+    return samples > 0 ? samples : 11;
+}
+
+inline double median(std::vector<double> times) {
+    std::nth_element(times.begin(), times.begin() + times.size() / 2, times.end());
+    return times[times.size() / 2];
+}
+
+// Calls f iterations times per sample and returns the median time of one call in
+// nanoseconds. A first, untimed sample warms up the caches and loads the backends.
+template <typename F>
+double time_per_call(std::int64_t iterations, F&& f) {
+    std::vector<double> times;
+    for (int sample = -1; sample < get_samples(); ++sample) {
+        const auto start = std::chrono::steady_clock::now();
+        for (std::int64_t i = 0; i < iterations; ++i) {
+            f();
+        }
+        const std::chrono::duration<double, std::nano> elapsed =
+            std::chrono::steady_clock::now() - start;
+        if (sample >= 0) {
+            times.push_back(elapsed.count() / iterations);
+        }
+    }
+    return median(times);
+}
+
+// Same as time_per_call, with num_threads host threads calling f(thread_index)
+// concurrently. Returns the median wall time of one call as seen by each thread.
+template <typename F>
+double time_per_call_concurrent(int num_threads, std::int64_t iterations, F&& f) {
+    std::vector<double> times;
+    for (int sample = -1; sample < get_samples(); ++sample) {
+        std::vector<std::thread> threads;
+        const auto start = std::chrono::steady_clock::now();
+        for (int t = 0; t < num_threads; ++t) {
+            threads.emplace_back([&f, t, iterations]() {
+                for (std::int64_t i = 0; i < iterations; ++i) {
+                    f(t);
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        const std::chrono::duration<double, std::nano> elapsed =
+            std::chrono::steady_clock::now() - start;
+        if (sample >= 0) {
+            times.push_back(elapsed.count() / iterations);
+        }
+    }
+    return median(times);
+}
+
+// Calls f once and returns the time it took in nanoseconds, for costs only paid by a
+// first call
+template <typename F>
+double time_once(F&& f) {
+    const auto start = std::chrono::steady_clock::now();
+    f();
+    const std::chrono::duration<double, std::nano> elapsed =
+        std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+inline void print_device(const sycl::queue& queue) {
+    std::printf("Device: %s\n\n",
+                queue.get_device().get_info<sycl::info::device::name>().c_str());
+}
+
+inline void report(const std::string& name, double ns) {
+    std::printf("%-56s %14.1f ns\n", name.c_str(), ns);
+}
+
+} // namespace benchmark
+
+#endif //_BENCHMARK_HELPER_HPP_
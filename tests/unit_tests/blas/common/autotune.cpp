@@ -0,0 +1,255 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+// Run-time API only: autotuning selects among the backends loaded by the BLAS loader
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+#include "oneapi/math.hpp"
+#include "blas/blas_autotune.hpp"
+
+#include <gtest/gtest.h>
+
+namespace {
+
+using namespace oneapi::math::blas::detail;
+using oneapi::math::layout;
+using oneapi::math::transpose;
+
+constexpr auto cpu = oneapi::math::device::x86cpu;
+
+// Stands in for the loader: each level is a backend that takes delay to run, or throws
+// unimplemented
+struct fake_table {
+    std::chrono::milliseconds delay;
+    bool implemented;
+};
+
+struct fake_tables {
+    std::vector<fake_table> tables;
+    std::vector<std::string> names;
+
+    fake_table* get_table(std::pair<oneapi::math::device, sycl::queue&>, std::size_t level) {
+        return level < tables.size() ? &tables[level] : nullptr;
+    }
+    const char* get_library_name(oneapi::math::device, std::size_t level) {
+        return names[level].c_str();
+    }
+};
+
+sycl::event run(const fake_table& table) {
+    if (!table.implemented)
+        throw oneapi::math::unimplemented("blas", "gemm");
+    std::this_thread::sleep_for(table.delay);
+    return sycl::event();
+}
+
+std::string temp_path(const char* name) {
+    return ::testing::TempDir() + "onemath_autotune_" + name + ".txt";
+}
+
+TEST(AutotuneTests, BucketsArePowersOfTwo) {
+    EXPECT_EQ(autotune_bucket(0), 0u);
+    EXPECT_EQ(autotune_bucket(1), 0u);
+    EXPECT_EQ(autotune_bucket(2), 1u);
+    EXPECT_EQ(autotune_bucket(3), 2u);
+    EXPECT_EQ(autotune_bucket(1024), 10u);
+    EXPECT_EQ(autotune_bucket(1025), 11u);
+}
+
+TEST(AutotuneTests, KeysShareBucket) {
+    auto gemm_key = [](auto type, layout l, transpose transa, std::int64_t m) {
+        return make_autotune_key<decltype(type)>(
+            autotune_routine::gemm, cpu, l,
+            { static_cast<char>(transa), static_cast<char>(transpose::nontrans) }, { m, 64, 64 });
+    };
+    const auto key = gemm_key(float(), layout::col_major, transpose::nontrans, 600);
+    EXPECT_EQ(key, gemm_key(float(), layout::col_major, transpose::nontrans, 1000));
+    EXPECT_NE(key, gemm_key(float(), layout::col_major, transpose::nontrans, 1100));
+    EXPECT_NE(key, gemm_key(double(), layout::col_major, transpose::nontrans, 600));
+    EXPECT_NE(key, gemm_key(float(), layout::row_major, transpose::nontrans, 600));
+    EXPECT_NE(key, gemm_key(float(), layout::col_major, transpose::trans, 600));
+    EXPECT_NE(key, make_autotune_key<float>(autotune_routine::syrk, cpu, layout::col_major,
+                                            { static_cast<char>(transpose::nontrans), 0 },
+                                            { 600, 64, 64 }));
+}
+
+TEST(AutotuneTests, ReadCache) {
+    std::istringstream file(autotune_cache_header("libs;devices") +
+                            "\n1a libonemath_blas_mklcpu.so.0\n"
+                            "not an entry\n"
+                            "2b libonemath_blas_netlib.so.0\n"
+                            "1a libonemath_blas_generic.so.0\n");
+    autotune_entries entries;
+    ASSERT_TRUE(read_autotune_cache(file, "libs;devices", entries));
+    ASSERT_EQ(entries.size(), 2u);
+    EXPECT_EQ(entries[0x1a].libname, "libonemath_blas_generic.so.0");
+    EXPECT_EQ(entries[0x2b].libname, "libonemath_blas_netlib.so.0");
+    EXPECT_FALSE(entries[0x2b].resolved);
+}
+
+TEST(AutotuneTests, IgnoreCacheOfOtherIdentity) {
+    std::istringstream file(autotune_cache_header("other libs;devices") +
+                            "\n1a libonemath_blas_mklcpu.so.0\n");
+    autotune_entries entries;
+    EXPECT_FALSE(read_autotune_cache(file, "libs;devices", entries));
+    EXPECT_TRUE(entries.empty());
+
+    std::istringstream no_header("1a libonemath_blas_mklcpu.so.0\n");
+    EXPECT_FALSE(read_autotune_cache(no_header, "libs;devices", entries));
+    EXPECT_TRUE(entries.empty());
+}
+
+TEST(AutotuneTests, CacheFileRoundTrip) {
+    const auto path = temp_path("round_trip");
+    std::remove(path.c_str());
+    {
+        autotune_cache cache(true, path, "identity");
+        cache.insert(0x1a, "libonemath_blas_netlib.so.0", 1, true);
+        cache.insert(0x2b, "libonemath_blas_mklcpu.so.0", 0, false);
+    }
+    {
+        autotune_cache cache(true, path, "identity");
+        autotune_entry entry;
+        ASSERT_TRUE(cache.find(0x1a, entry));
+        EXPECT_EQ(entry.libname, "libonemath_blas_netlib.so.0");
+        // Levels depend on the libraries loaded by the process reading the cache
+        EXPECT_FALSE(entry.resolved);
+        std::size_t level;
+        EXPECT_FALSE(cache.find_level(0x1a, level));
+        // Not persisted
+        EXPECT_FALSE(cache.find(0x2b, entry));
+    }
+    {
+        // The file is dropped and rewritten for another identity
+        autotune_cache cache(true, path, "other identity");
+        autotune_entry entry;
+        EXPECT_FALSE(cache.find(0x1a, entry));
+        cache.insert(0x3c, "libonemath_blas_mklcpu.so.0", 0, true);
+    }
+    std::ifstream file(path);
+    autotune_entries entries;
+    ASSERT_TRUE(read_autotune_cache(file, "other identity", entries));
+    ASSERT_EQ(entries.size(), 1u);
+    EXPECT_EQ(entries[0x3c].libname, "libonemath_blas_mklcpu.so.0");
+    file.close();
+    std::remove(path.c_str());
+}
+
+TEST(AutotuneTests, LevelIndex) {
+    autotune_level_index index;
+    std::size_t level;
+    EXPECT_FALSE(index.find(0, level));
+    ASSERT_TRUE(index.insert(0, 2));
+    ASSERT_TRUE(index.find(0, level));
+    EXPECT_EQ(level, 2u);
+    ASSERT_TRUE(index.insert(0, 1));
+    ASSERT_TRUE(index.find(0, level));
+    EXPECT_EQ(level, 1u);
+
+    std::uint64_t key = 1;
+    while (index.insert(key, key % 3))
+        ++key;
+    EXPECT_EQ(key, autotune_level_index::capacity / 4 * 3);
+    for (std::uint64_t k = 1; k < key; ++k) {
+        ASSERT_TRUE(index.find(k, level)) << k;
+        EXPECT_EQ(level, k % 3);
+    }
+    EXPECT_FALSE(index.find(key, level));
+}
+
+TEST(AutotuneTests, FastestBackendWins) {
+    sycl::queue queue;
+    fake_tables tables{ { { std::chrono::milliseconds(40), true },
+                          { std::chrono::milliseconds(0), false },
+                          { std::chrono::milliseconds(0), true },
+                          { std::chrono::milliseconds(20), true } },
+                        { "slow", "unimplemented", "fast", "medium" } };
+    autotune_cache cache(true, "", "identity");
+    const auto level = tune_level(cache, tables, { cpu, queue }, 0x1a,
+                                  [](const fake_table& table) { return run(table); });
+    EXPECT_EQ(level, 2u);
+
+    // Later calls find the winner without tuning again
+    bool found;
+    EXPECT_EQ(find_tuned_level(cache, tables, { cpu, queue }, 0x1a, found), 2u);
+    EXPECT_TRUE(found);
+    std::size_t indexed_level;
+    ASSERT_TRUE(cache.find_level(0x1a, indexed_level));
+    EXPECT_EQ(indexed_level, 2u);
+
+    find_tuned_level(cache, tables, { cpu, queue }, 0x2b, found);
+    EXPECT_FALSE(found);
+}
+
+TEST(AutotuneTests, NoImplementedBackend) {
+    sycl::queue queue;
+    fake_tables tables{ { { std::chrono::milliseconds(0), false },
+                          { std::chrono::milliseconds(0), false } },
+                        { "first", "second" } };
+    autotune_cache cache(true, "", "identity");
+    EXPECT_EQ(tune_level(cache, tables, { cpu, queue }, 0x1a,
+                         [](const fake_table& table) { return run(table); }),
+              0u);
+    autotune_entry entry;
+    EXPECT_FALSE(cache.find(0x1a, entry));
+}
+
+TEST(AutotuneTests, CachedLibraryIsResolved) {
+    const auto path = temp_path("resolve");
+    {
+        std::ofstream file(path);
+        file << autotune_cache_header("identity") << "\n1a medium\n";
+    }
+    sycl::queue queue;
+    fake_tables tables{ { { std::chrono::milliseconds(0), true },
+                          { std::chrono::milliseconds(0), true },
+                          { std::chrono::milliseconds(0), true } },
+                        { "fast", "slow", "medium" } };
+    autotune_cache cache(true, path, "identity");
+    bool found;
+    EXPECT_EQ(find_tuned_level(cache, tables, { cpu, queue }, 0x1a, found), 2u);
+    EXPECT_TRUE(found);
+    std::size_t level;
+    ASSERT_TRUE(cache.find_level(0x1a, level));
+    EXPECT_EQ(level, 2u);
+    std::remove(path.c_str());
+}
+
+TEST(AutotuneTests, SingleBackendIsNotTuned) {
+    sycl::queue queue;
+    fake_tables tables{ { { std::chrono::milliseconds(0), true } }, { "only" } };
+    autotune_cache cache(true, "", "identity");
+    bool found;
+    EXPECT_EQ(find_tuned_level(cache, tables, { cpu, queue }, 0x1a, found), 0u);
+    EXPECT_TRUE(found);
+}
+
+} // anonymous namespace
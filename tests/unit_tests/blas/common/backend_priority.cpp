@@ -0,0 +1,168 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+// Run-time API only: the backend priority and fallback are applied by the loaders
+
+#include <string>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+#include "oneapi/math.hpp"
+#include "oneapi/math/backend_priority.hpp"
+#include "oneapi/math/detail/config.hpp"
+#include "oneapi/math/preload.hpp"
+#include "backend_order.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+extern std::vector<sycl::device*> devices;
+
+namespace {
+
+using oneapi::math::detail::order_by_priority;
+using oneapi::math::detail::parse_backend_priority;
+
+// Restores the priority the process started with
+class BackendPriorityTests : public ::testing::Test {
+protected:
+    void SetUp() override {
+        initial_priority = oneapi::math::get_backend_priority();
+    }
+    void TearDown() override {
+        oneapi::math::set_backend_priority(initial_priority);
+    }
+
+    std::vector<std::string> initial_priority;
+};
+
+TEST_F(BackendPriorityTests, ParseEnvironment) {
+    EXPECT_TRUE(parse_backend_priority(nullptr).empty());
+    EXPECT_TRUE(parse_backend_priority("").empty());
+    EXPECT_EQ(parse_backend_priority("netlib"), (std::vector<std::string>{ "netlib" }));
+    EXPECT_EQ(parse_backend_priority("netlib,,mklcpu,"),
+              (std::vector<std::string>{ "netlib", "mklcpu" }));
+}
+
+TEST_F(BackendPriorityTests, SetAndGet) {
+    oneapi::math::set_backend_priority({ "netlib", "mklcpu" });
+    EXPECT_EQ(oneapi::math::get_backend_priority(),
+              (std::vector<std::string>{ "netlib", "mklcpu" }));
+    oneapi::math::set_backend_priority({});
+    EXPECT_TRUE(oneapi::math::get_backend_priority().empty());
+}
+
+TEST_F(BackendPriorityTests, ListedBackendsComeFirst) {
+    const std::vector<const char*> libs = { "libonemath_blas_mklcpu.so.0",
+                                            "libonemath_blas_netlib.so.0",
+                                            "libonemath_blas_generic.so.0" };
+    EXPECT_EQ(order_by_priority(libs, {}), libs);
+    EXPECT_EQ(order_by_priority(libs, { "netlib" }),
+              (std::vector<const char*>{ libs[1], libs[0], libs[2] }));
+    EXPECT_EQ(order_by_priority(libs, { "generic", "netlib" }),
+              (std::vector<const char*>{ libs[2], libs[1], libs[0] }));
+    // Unknown names are ignored and the unlisted backends keep their order
+    EXPECT_EQ(order_by_priority(libs, { "cublas", "generic" }),
+              (std::vector<const char*>{ libs[2], libs[0], libs[1] }));
+}
+
+TEST_F(BackendPriorityTests, NamesMatchWholeBackend) {
+    const std::vector<const char*> libs = { "libonemath_blas_mklcpu.so.0",
+                                            "libonemath_blas_mkl.so.0" };
+    EXPECT_EQ(order_by_priority(libs, { "mkl" }),
+              (std::vector<const char*>{ libs[1], libs[0] }));
+
+    // Libraries built per device type belong to their backend, and the tuned library keeps
+    // its place before the untuned one
+    const std::vector<const char*> gpu_libs = { "libonemath_blas_cublas.so.0",
+                                                "libonemath_blas_generic_nvidia_gpu.so.0",
+                                                "libonemath_blas_generic.so.0" };
+    EXPECT_EQ(order_by_priority(gpu_libs, { "generic" }),
+              (std::vector<const char*>{ gpu_libs[1], gpu_libs[2], gpu_libs[0] }));
+    const std::vector<const char*> windows_libs = { "onemath_blas_cublas.dll",
+                                                    "onemath_blas_generic_nvidia_gpu.dll" };
+    EXPECT_EQ(order_by_priority(windows_libs, { "generic" }),
+              (std::vector<const char*>{ windows_libs[1], windows_libs[0] }));
+    // Neither a prefix of a backend name nor a part of a per-device suffix is a backend
+    EXPECT_EQ(order_by_priority(gpu_libs, { "gen", "nvidia", "gpu" }), gpu_libs);
+}
+
+#if defined(ONEMATH_ENABLE_NETLIB_BACKEND) && defined(ONEMATH_ENABLE_MKLCPU_BACKEND)
+
+class BackendFallbackTests : public ::testing::TestWithParam<sycl::device*> {
+protected:
+    void SetUp() override {
+        if (!GetParam()->is_cpu())
+            GTEST_SKIP() << "Backend fallback tests run on CPU devices only";
+        initial_priority = oneapi::math::get_backend_priority();
+    }
+    void TearDown() override {
+        oneapi::math::set_backend_priority(initial_priority);
+    }
+
+    std::vector<std::string> initial_priority;
+};
+
+// netlib is listed after mklcpu by default, and throws unimplemented for omatcopy_batch
+TEST_P(BackendFallbackTests, UnimplementedIsForwarded) {
+    oneapi::math::set_backend_priority({ "netlib", "mklcpu" });
+    auto infos =
+        oneapi::math::preload({ oneapi::math::domain::blas }, { oneapi::math::device::x86cpu });
+    ASSERT_EQ(infos.size(), 1u);
+    ASSERT_TRUE(infos[0].loaded) << infos[0].error;
+    // The priority only applies to tables loaded after it is set. ctest runs each test in
+    // its own process, where this test loads the BLAS table first.
+    if (infos[0].library.find("_netlib.") == std::string::npos)
+        GTEST_SKIP() << "BLAS was loaded from " << infos[0].library
+                     << " before the priority was set";
+
+    sycl::queue queue(*GetParam());
+    constexpr std::int64_t m = 5, n = 4, ld = 6, stride = ld * n, batch_size = 3;
+    constexpr float alpha = 2.0f;
+    std::vector<float> a(stride * batch_size), b(stride * batch_size, 0.0f);
+    for (std::size_t i = 0; i < a.size(); ++i)
+        a[i] = static_cast<float>(i % 17) - 8.0f;
+    {
+        sycl::buffer<float, 1> a_buffer(a.data(), a.size());
+        sycl::buffer<float, 1> b_buffer(b.data(), b.size());
+        EXPECT_NO_THROW(oneapi::math::blas::column_major::omatcopy_batch(
+            queue, oneapi::math::transpose::nontrans, m, n, alpha, a_buffer, ld, stride,
+            b_buffer, ld, stride, batch_size));
+        queue.wait_and_throw();
+    }
+    for (std::int64_t batch = 0; batch < batch_size; ++batch) {
+        for (std::int64_t j = 0; j < n; ++j) {
+            for (std::int64_t i = 0; i < m; ++i) {
+                const std::int64_t idx = batch * stride + j * ld + i;
+                EXPECT_EQ(b[idx], alpha * a[idx]) << "at index " << idx;
+            }
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(BackendFallbackTestSuite, BackendFallbackTests,
+                         testing::ValuesIn(devices), ::DeviceNamePrint());
+
+#endif
+
+} // anonymous namespace
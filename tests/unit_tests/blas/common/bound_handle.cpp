@@ -0,0 +1,243 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+// Run-time API only: checks the members of the bound handles against the free functions
+
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+#include "oneapi/math.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+extern std::vector<sycl::device*> devices;
+
+namespace {
+
+using oneapi::math::layout;
+using oneapi::math::transpose;
+
+constexpr std::int64_t m = 27, n = 13, k = 19;
+constexpr float alpha = 1.5f, beta = -0.5f;
+
+void print_async_errors(sycl::exception_list exceptions) {
+    for (std::exception_ptr const& e : exceptions) {
+        try {
+            std::rethrow_exception(e);
+        }
+        catch (sycl::exception const& e) {
+            std::cout << "Caught asynchronous SYCL exception:\n" << e.what() << std::endl;
+        }
+    }
+}
+
+std::vector<float> random_vector(std::size_t size, unsigned seed) {
+    std::mt19937 generator(seed);
+    std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+    std::vector<float> v(size);
+    for (auto& x : v)
+        x = distribution(generator);
+    return v;
+}
+
+// The handle and the free functions dispatch to the same backend, so the results only differ
+// if the backend is not deterministic
+void expect_near(const std::vector<float>& result, const std::vector<float>& reference) {
+    ASSERT_EQ(result.size(), reference.size());
+    for (std::size_t i = 0; i < result.size(); ++i)
+        EXPECT_NEAR(result[i], reference[i], 1e-5f * (1.0f + std::abs(reference[i])))
+            << "at index " << i;
+}
+
+// C = alpha * A * B^T + beta * C, with A m x k, B n x k and C m x n
+std::int64_t lda(layout l) {
+    return l == layout::col_major ? m : k;
+}
+std::int64_t ldb(layout l) {
+    return l == layout::col_major ? n : k;
+}
+std::int64_t ldc(layout l) {
+    return l == layout::col_major ? m : n;
+}
+
+class BoundHandleTests : public ::testing::TestWithParam<std::tuple<sycl::device*, layout>> {};
+
+TEST_P(BoundHandleTests, GemmBuffer) {
+    sycl::queue queue(*std::get<0>(GetParam()), print_async_errors);
+    const layout l = std::get<1>(GetParam());
+    auto A = random_vector(m * k, 1);
+    auto B = random_vector(n * k, 2);
+    auto C_bound = random_vector(m * n, 3);
+    auto C_free = C_bound;
+    {
+        sycl::buffer<float, 1> A_buffer(A.data(), A.size());
+        sycl::buffer<float, 1> B_buffer(B.data(), B.size());
+        sycl::buffer<float, 1> C_bound_buffer(C_bound.data(), C_bound.size());
+        sycl::buffer<float, 1> C_free_buffer(C_free.data(), C_free.size());
+        if (l == layout::col_major) {
+            auto handle = oneapi::math::blas::column_major::bind(queue);
+            handle.gemm(transpose::nontrans, transpose::trans, m, n, k, alpha, A_buffer, lda(l),
+                        B_buffer, ldb(l), beta, C_bound_buffer, ldc(l));
+            oneapi::math::blas::column_major::gemm(queue, transpose::nontrans, transpose::trans, m,
+                                                   n, k, alpha, A_buffer, lda(l), B_buffer, ldb(l),
+                                                   beta, C_free_buffer, ldc(l));
+        }
+        else {
+            auto handle = oneapi::math::blas::row_major::bind(queue);
+            handle.gemm(transpose::nontrans, transpose::trans, m, n, k, alpha, A_buffer, lda(l),
+                        B_buffer, ldb(l), beta, C_bound_buffer, ldc(l));
+            oneapi::math::blas::row_major::gemm(queue, transpose::nontrans, transpose::trans, m, n,
+                                                k, alpha, A_buffer, lda(l), B_buffer, ldb(l), beta,
+                                                C_free_buffer, ldc(l));
+        }
+        queue.wait_and_throw();
+    }
+    expect_near(C_bound, C_free);
+}
+
+TEST_P(BoundHandleTests, GemmUsm) {
+    sycl::queue queue(*std::get<0>(GetParam()), print_async_errors);
+    const layout l = std::get<1>(GetParam());
+    const auto A_host = random_vector(m * k, 4);
+    const auto B_host = random_vector(n * k, 5);
+    const auto C_host = random_vector(m * n, 6);
+    float* A = sycl::malloc_shared<float>(A_host.size(), queue);
+    float* B = sycl::malloc_shared<float>(B_host.size(), queue);
+    float* C_bound = sycl::malloc_shared<float>(C_host.size(), queue);
+    float* C_free = sycl::malloc_shared<float>(C_host.size(), queue);
+    std::copy(A_host.begin(), A_host.end(), A);
+    std::copy(B_host.begin(), B_host.end(), B);
+    std::copy(C_host.begin(), C_host.end(), C_bound);
+    std::copy(C_host.begin(), C_host.end(), C_free);
+
+    sycl::event bound_done, free_done;
+    if (l == layout::col_major) {
+        auto handle = oneapi::math::blas::column_major::bind(queue);
+        bound_done = handle.gemm(transpose::nontrans, transpose::trans, m, n, k, alpha, A, lda(l),
+                                 B, ldb(l), beta, C_bound, ldc(l));
+        free_done = oneapi::math::blas::column_major::gemm(queue, transpose::nontrans,
+                                                           transpose::trans, m, n, k, alpha, A,
+                                                           lda(l), B, ldb(l), beta, C_free, ldc(l));
+    }
+    else {
+        auto handle = oneapi::math::blas::row_major::bind(queue);
+        bound_done = handle.gemm(transpose::nontrans, transpose::trans, m, n, k, alpha, A, lda(l),
+                                 B, ldb(l), beta, C_bound, ldc(l));
+        free_done = oneapi::math::blas::row_major::gemm(queue, transpose::nontrans,
+                                                        transpose::trans, m, n, k, alpha, A, lda(l),
+                                                        B, ldb(l), beta, C_free, ldc(l));
+    }
+    bound_done.wait_and_throw();
+    free_done.wait_and_throw();
+
+    expect_near(std::vector<float>(C_bound, C_bound + C_host.size()),
+                std::vector<float>(C_free, C_free + C_host.size()));
+    sycl::free(A, queue);
+    sycl::free(B, queue);
+    sycl::free(C_bound, queue);
+    sycl::free(C_free, queue);
+}
+
+TEST_P(BoundHandleTests, GemvBuffer) {
+    sycl::queue queue(*std::get<0>(GetParam()), print_async_errors);
+    const layout l = std::get<1>(GetParam());
+    auto A = random_vector(m * k, 7);
+    auto x = random_vector(k, 8);
+    auto y_bound = random_vector(m, 9);
+    auto y_free = y_bound;
+    {
+        sycl::buffer<float, 1> A_buffer(A.data(), A.size());
+        sycl::buffer<float, 1> x_buffer(x.data(), x.size());
+        sycl::buffer<float, 1> y_bound_buffer(y_bound.data(), y_bound.size());
+        sycl::buffer<float, 1> y_free_buffer(y_free.data(), y_free.size());
+        if (l == layout::col_major) {
+            auto handle = oneapi::math::blas::column_major::bind(queue);
+            handle.gemv(transpose::nontrans, m, k, alpha, A_buffer, lda(l), x_buffer, 1, beta,
+                        y_bound_buffer, 1);
+            oneapi::math::blas::column_major::gemv(queue, transpose::nontrans, m, k, alpha,
+                                                   A_buffer, lda(l), x_buffer, 1, beta,
+                                                   y_free_buffer, 1);
+        }
+        else {
+            auto handle = oneapi::math::blas::row_major::bind(queue);
+            handle.gemv(transpose::nontrans, m, k, alpha, A_buffer, lda(l), x_buffer, 1, beta,
+                        y_bound_buffer, 1);
+            oneapi::math::blas::row_major::gemv(queue, transpose::nontrans, m, k, alpha, A_buffer,
+                                                lda(l), x_buffer, 1, beta, y_free_buffer, 1);
+        }
+        queue.wait_and_throw();
+    }
+    expect_near(y_bound, y_free);
+}
+
+TEST_P(BoundHandleTests, AxpyUsmWithDependencies) {
+    sycl::queue queue(*std::get<0>(GetParam()), print_async_errors);
+    const layout l = std::get<1>(GetParam());
+    const auto x_host = random_vector(n, 10);
+    const auto y_host = random_vector(n, 11);
+    float* x = sycl::malloc_shared<float>(n, queue);
+    float* y_bound = sycl::malloc_shared<float>(n, queue);
+    float* y_free = sycl::malloc_shared<float>(n, queue);
+    auto copy_done = queue.memcpy(x, x_host.data(), n * sizeof(float));
+    std::copy(y_host.begin(), y_host.end(), y_bound);
+    std::copy(y_host.begin(), y_host.end(), y_free);
+
+    sycl::event bound_done;
+    if (l == layout::col_major) {
+        auto handle = oneapi::math::blas::column_major::bind(queue);
+        bound_done = handle.axpy(n, alpha, x, 1, y_bound, 1, { copy_done });
+        oneapi::math::blas::column_major::axpy(queue, n, alpha, x, 1, y_free, 1, { copy_done })
+            .wait_and_throw();
+    }
+    else {
+        auto handle = oneapi::math::blas::row_major::bind(queue);
+        bound_done = handle.axpy(n, alpha, x, 1, y_bound, 1, { copy_done });
+        oneapi::math::blas::row_major::axpy(queue, n, alpha, x, 1, y_free, 1, { copy_done })
+            .wait_and_throw();
+    }
+    bound_done.wait_and_throw();
+
+    expect_near(std::vector<float>(y_bound, y_bound + n), std::vector<float>(y_free, y_free + n));
+    sycl::free(x, queue);
+    sycl::free(y_bound, queue);
+    sycl::free(y_free, queue);
+}
+
+TEST_P(BoundHandleTests, HandleKeepsQueue) {
+    sycl::queue queue(*std::get<0>(GetParam()), print_async_errors);
+    auto column_major_handle = oneapi::math::blas::column_major::bind(queue);
+    auto row_major_handle = oneapi::math::blas::row_major::bind(queue);
+    EXPECT_TRUE(column_major_handle.get_queue() == queue);
+    EXPECT_TRUE(row_major_handle.get_queue() == queue);
+}
+
+INSTANTIATE_TEST_SUITE_P(BoundHandleTestSuite, BoundHandleTests,
+                         ::testing::Combine(testing::ValuesIn(devices),
+                                            testing::Values(layout::col_major, layout::row_major)),
+                         ::LayoutDeviceNamePrint());
+
+} // anonymous namespace
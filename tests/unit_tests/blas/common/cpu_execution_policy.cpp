@@ -0,0 +1,287 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+
+
+// Run-time API only: the policies are kept by the onemath library, which the compile-time
+// tests do not link
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <string>
+#include <vector>
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+#include "oneapi/math.hpp"
+#include "oneapi/math/async_errors.hpp"
+#include "oneapi/math/backend_priority.hpp"
+#include "oneapi/math/cpu_execution_policy.hpp"
+#include "oneapi/math/detail/config.hpp"
+#include "oneapi/math/preload.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+extern std::vector<sycl::device*> devices;
+
+namespace {
+
+class CpuExecutionPolicyTests : public ::testing::TestWithParam<sycl::device*> {
+protected:
+    void SetUp() override {
+        if (!GetParam()->is_cpu())
+            GTEST_SKIP() << "CPU execution policy tests run on CPU devices only";
+    }
+};
+
+TEST_P(CpuExecutionPolicyTests, DefaultPolicy) {
+    sycl::queue queue(*GetParam());
+    auto policy = oneapi::math::get_cpu_execution_policy(queue);
+    EXPECT_EQ(policy.num_threads, 0u);
+    EXPECT_TRUE(policy.cpus.empty());
+}
+
+TEST_P(CpuExecutionPolicyTests, PolicyIsPerQueue) {
+    sycl::queue queue_a(*GetParam());
+    sycl::queue queue_b(*GetParam());
+    oneapi::math::set_cpu_execution_policy(queue_a, { 2, { 0, 1 } });
+    auto policy = oneapi::math::get_cpu_execution_policy(queue_a);
+    EXPECT_EQ(policy.num_threads, 2u);
+    EXPECT_EQ(policy.cpus, (std::vector<int>{ 0, 1 }));
+    EXPECT_EQ(oneapi::math::get_cpu_execution_policy(queue_b).num_threads, 0u);
+    oneapi::math::reset_cpu_execution_policy(queue_a);
+    EXPECT_EQ(oneapi::math::get_cpu_execution_policy(queue_a).num_threads, 0u);
+}
+
+TEST_P(CpuExecutionPolicyTests, PolicyIsReplaced) {
+    sycl::queue queue(*GetParam());
+    oneapi::math::set_cpu_execution_policy(queue, { 4, {} });
+    oneapi::math::set_cpu_execution_policy(queue, { 1, {} });
+    EXPECT_EQ(oneapi::math::get_cpu_execution_policy(queue).num_threads, 1u);
+    oneapi::math::reset_cpu_execution_policy(queue);
+}
+
+#ifdef ONEMATH_ENABLE_MKLCPU_BACKEND
+
+// A USM gemm of the Intel(R) oneMKL CPU backend on a queue whose policy sets num_threads runs
+// in a host task with that number of threads
+TEST_P(CpuExecutionPolicyTests, MklcpuGemmWithThreads) {
+    constexpr std::int64_t m = 16, k = 8, n = 12;
+    const auto initial_priority = oneapi::math::get_backend_priority();
+    oneapi::math::set_backend_priority({ "mklcpu" });
+    auto infos =
+        oneapi::math::preload({ oneapi::math::domain::blas }, { oneapi::math::device::x86cpu });
+    if (infos.empty() || infos[0].library.find("_mklcpu.") == std::string::npos) {
+        oneapi::math::set_backend_priority(initial_priority);
+        GTEST_SKIP() << "This test needs the Intel(R) oneMKL CPU BLAS backend";
+    }
+    sycl::queue queue(*GetParam());
+    float* a = sycl::malloc_shared<float>(m * k, queue);
+    float* b = sycl::malloc_shared<float>(k * n, queue);
+    float* c = sycl::malloc_shared<float>(m * n, queue);
+    for (std::int64_t i = 0; i < m * k; ++i)
+        a[i] = static_cast<float>(i % 5);
+    for (std::int64_t i = 0; i < k * n; ++i)
+        b[i] = static_cast<float>(i % 3);
+    std::fill(c, c + m * n, 1.0f);
+    oneapi::math::set_cpu_execution_policy(queue, { 1, {} });
+    oneapi::math::blas::column_major::gemm(queue, oneapi::math::transpose::nontrans,
+                                           oneapi::math::transpose::nontrans, m, n, k, 1.0f, a, m,
+                                           b, k, 2.0f, c, m)
+        .wait_and_throw();
+    oneapi::math::reset_cpu_execution_policy(queue);
+    oneapi::math::set_backend_priority(initial_priority);
+    for (std::int64_t j = 0; j < n; ++j) {
+        for (std::int64_t i = 0; i < m; ++i) {
+            float expected = 2.0f;
+            for (std::int64_t l = 0; l < k; ++l)
+                expected += a[i + l * m] * b[l + j * k];
+            EXPECT_FLOAT_EQ(c[i + j * m], expected) << "at " << i << ", " << j;
+        }
+    }
+    sycl::free(a, queue);
+    sycl::free(b, queue);
+    sycl::free(c, queue);
+}
+
+#endif
+
+INSTANTIATE_TEST_SUITE_P(CpuExecutionPolicyTestSuite, CpuExecutionPolicyTests,
+                         testing::ValuesIn(devices), ::DeviceNamePrint());
+
+#if defined(ONEMATH_ENABLE_NETLIB_BACKEND) && defined(__linux__)
+
+namespace blas = oneapi::math::blas::column_major;
+
+constexpr std::int64_t n = 64;
+
+// The policy is observed in the calls of the netlib backend: binding the thread running a call
+// to CPUs that are not available fails the call
+class NetlibPolicyTests : public ::testing::TestWithParam<sycl::device*> {
+protected:
+    void SetUp() override {
+        if (!GetParam()->is_cpu())
+            GTEST_SKIP() << "CPU execution policy tests run on CPU devices only";
+        initial_priority = oneapi::math::get_backend_priority();
+        oneapi::math::set_backend_priority({ "netlib" });
+        auto infos = oneapi::math::preload({ oneapi::math::domain::blas },
+                                           { oneapi::math::device::x86cpu });
+        // The priority only applies to tables loaded after it is set. ctest runs each test in
+        // its own process, where this test loads the BLAS table first.
+        if (infos.empty() || infos[0].library.find("_netlib.") == std::string::npos)
+            GTEST_SKIP() << "CPU execution policy tests need the netlib BLAS backend";
+    }
+    void TearDown() override {
+        oneapi::math::set_backend_priority(initial_priority);
+    }
+
+    // Calls scal on x, which must hold n elements of 1, and returns the number of calls that
+    // failed because the CPUs of the policy are not available
+    std::size_t failed_scal(sycl::queue& queue, float* x) {
+        errors.clear();
+        std::size_t failed = 0;
+        try {
+            blas::scal(queue, n, 2.0f, x, 1).wait();
+            queue.wait_and_throw();
+        }
+        catch (const oneapi::math::invalid_argument& e) {
+            // On the inline host path, the call applies the policy itself
+            EXPECT_NE(std::string(e.what()).find("cpu_execution_policy"), std::string::npos);
+            ++failed;
+        }
+        for (const auto& error : errors) {
+            try {
+                std::rethrow_exception(error);
+            }
+            catch (const oneapi::math::invalid_argument& e) {
+                EXPECT_NE(std::string(e.what()).find("cpu_execution_policy"), std::string::npos);
+                ++failed;
+            }
+        }
+        return failed;
+    }
+
+    sycl::async_handler handler() {
+        return [this](sycl::exception_list exceptions) {
+            for (const auto& e : exceptions)
+                errors.push_back(e);
+        };
+    }
+
+    std::vector<std::string> initial_priority;
+    std::vector<std::exception_ptr> errors;
+};
+
+// No logical CPU has this index
+const oneapi::math::cpu_execution_policy unavailable_cpus{ 0, { -1 } };
+
+TEST_P(NetlibPolicyTests, PolicyAppliesToCalls) {
+    sycl::queue queue(*GetParam(), handler());
+    float* x = sycl::malloc_shared<float>(n, queue);
+    std::fill(x, x + n, 1.0f);
+    EXPECT_EQ(failed_scal(queue, x), 0u);
+
+    oneapi::math::set_cpu_execution_policy(queue, unavailable_cpus);
+    EXPECT_EQ(failed_scal(queue, x), 1u);
+    oneapi::math::reset_cpu_execution_policy(queue);
+
+    std::fill(x, x + n, 1.0f);
+    EXPECT_EQ(failed_scal(queue, x), 0u);
+    for (std::int64_t i = 0; i < n; ++i)
+        EXPECT_EQ(x[i], 2.0f) << "at index " << i;
+    sycl::free(x, queue);
+}
+
+TEST_P(NetlibPolicyTests, PolicyIsPerQueue) {
+    sycl::queue queue(*GetParam(), handler());
+    sycl::queue other_queue(*GetParam(), handler());
+    float* x = sycl::malloc_shared<float>(n, queue);
+    std::fill(x, x + n, 1.0f);
+    oneapi::math::set_cpu_execution_policy(other_queue, unavailable_cpus);
+    EXPECT_EQ(failed_scal(queue, x), 0u);
+    EXPECT_EQ(failed_scal(other_queue, x), 1u);
+    oneapi::math::reset_cpu_execution_policy(other_queue);
+    sycl::free(x, queue);
+}
+
+TEST_P(NetlibPolicyTests, SubmittedCallsKeepPolicy) {
+    if (std::getenv("ONEMATH_NETLIB_HOST_PATH"))
+        GTEST_SKIP() << "The calls may run before they return on other netlib host paths";
+    sycl::queue queue(*GetParam(), handler());
+    float* x = sycl::malloc_shared<float>(n, queue);
+    std::fill(x, x + n, 1.0f);
+    oneapi::math::set_cpu_execution_policy(queue, unavailable_cpus);
+    auto done = blas::scal(queue, n, 2.0f, x, 1);
+    oneapi::math::reset_cpu_execution_policy(queue);
+    done.wait();
+    queue.wait_and_throw();
+    EXPECT_EQ(errors.size(), 1u);
+    sycl::free(x, queue);
+}
+
+TEST_P(NetlibPolicyTests, SubmittedCallErrorsAreRecorded) {
+    if (std::getenv("ONEMATH_NETLIB_HOST_PATH"))
+        GTEST_SKIP() << "The calls may run before they return on other netlib host paths";
+    sycl::queue queue(*GetParam(), handler());
+    float* x = sycl::malloc_shared<float>(n, queue);
+    std::fill(x, x + n, 1.0f);
+    oneapi::math::take_async_errors(queue);
+    oneapi::math::set_cpu_execution_policy(queue, unavailable_cpus);
+    auto done = blas::scal(queue, n, 2.0f, x, 1);
+    oneapi::math::reset_cpu_execution_policy(queue);
+    done.wait();
+    auto recorded = oneapi::math::take_async_errors(queue);
+    ASSERT_EQ(recorded.size(), 1u);
+    EXPECT_NE(recorded[0].message.find("cpu_execution_policy"), std::string::npos);
+    queue.wait_and_throw();
+    sycl::free(x, queue);
+}
+
+TEST_P(NetlibPolicyTests, AvailableCpusRunTheCalls) {
+    cpu_set_t available;
+    ASSERT_EQ(sched_getaffinity(0, sizeof(available), &available), 0);
+    int cpu = 0;
+    while (!CPU_ISSET(cpu, &available))
+        ++cpu;
+    sycl::queue queue(*GetParam(), handler());
+    float* x = sycl::malloc_shared<float>(n, queue);
+    std::fill(x, x + n, 1.0f);
+    oneapi::math::set_cpu_execution_policy(queue, { 1, { cpu } });
+    EXPECT_EQ(failed_scal(queue, x), 0u);
+    oneapi::math::reset_cpu_execution_policy(queue);
+    for (std::int64_t i = 0; i < n; ++i)
+        EXPECT_EQ(x[i], 2.0f) << "at index " << i;
+    sycl::free(x, queue);
+}
+
+INSTANTIATE_TEST_SUITE_P(NetlibPolicyTestSuite, NetlibPolicyTests, testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+
+#endif
+
+} // anonymous namespace
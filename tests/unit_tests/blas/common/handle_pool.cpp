@@ -0,0 +1,184 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+
+#include <functional>
+#include <thread>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+#include "handle_pool.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+extern std::vector<sycl::device*> devices;
+
+namespace {
+
+// Stands in for a native library handle: counts how many are alive. Like real handles,
+// it keeps no SYCL object, as it may be destroyed at thread exit.
+struct mock_handle {
+    static int alive;
+    static int created;
+
+    std::size_t device;
+    int id;
+
+    explicit mock_handle(const sycl::queue& queue)
+            : device(std::hash<sycl::device>{}(queue.get_device())),
+              id(created++) {
+        ++alive;
+    }
+    mock_handle(mock_handle&& other) : device(other.device), id(other.id) {
+        ++alive;
+    }
+    mock_handle(const mock_handle&) = delete;
+    ~mock_handle() {
+        --alive;
+    }
+};
+
+int mock_handle::alive = 0;
+int mock_handle::created = 0;
+
+using pool = oneapi::math::detail::handle_pool<mock_handle>;
+
+class HandlePoolTests : public ::testing::TestWithParam<sycl::device*> {
+protected:
+    void SetUp() override {
+        if (!GetParam()->is_cpu())
+            GTEST_SKIP() << "Handle pool tests run on CPU devices only";
+        pool::clear();
+    }
+    void TearDown() override {
+        pool::clear();
+    }
+};
+
+TEST_P(HandlePoolTests, SameQueueReusesHandle) {
+    sycl::queue queue(*GetParam());
+    mock_handle& first = pool::get(queue);
+    mock_handle& second = pool::get(queue);
+    EXPECT_EQ(&first, &second);
+    EXPECT_EQ(pool::size(), 1u);
+    EXPECT_EQ(first.device, std::hash<sycl::device>{}(queue.get_device()));
+}
+
+TEST_P(HandlePoolTests, QueuesShareTheHandleOfTheirDevice) {
+    sycl::queue queue_a(*GetParam());
+    sycl::queue queue_b(*GetParam(), sycl::property_list{ sycl::property::queue::in_order() });
+    mock_handle& a = pool::get(queue_a);
+    EXPECT_EQ(&pool::get(queue_b), &a);
+    EXPECT_EQ(pool::size(), 1u);
+}
+
+TEST_P(HandlePoolTests, EqualDevicesAreInternedOnce) {
+    const sycl::device copy = *GetParam();
+    const sycl::device* interned = oneapi::math::detail::intern_device(*GetParam());
+    EXPECT_EQ(oneapi::math::detail::intern_device(copy), interned);
+    EXPECT_TRUE(*interned == *GetParam());
+}
+
+TEST_P(HandlePoolTests, ShortLivedQueuesKeepOneHandle) {
+    const int alive_before = mock_handle::alive;
+    mock_handle* handle = nullptr;
+    for (int i = 0; i < 16; ++i) {
+        sycl::queue queue(*GetParam());
+        mock_handle& h = pool::get(queue);
+        if (!handle)
+            handle = &h;
+        EXPECT_EQ(&h, handle);
+    }
+    // One handle for the device, however many queues were used
+    EXPECT_EQ(pool::size(), 1u);
+    EXPECT_EQ(mock_handle::alive, alive_before + 1);
+}
+
+TEST_P(HandlePoolTests, DistinctDevicesGetDistinctHandles) {
+    std::vector<sycl::device> others;
+    for (auto* device : devices) {
+        if (device->is_cpu() && !(*device == *GetParam()))
+            others.push_back(*device);
+    }
+    if (others.empty())
+        GTEST_SKIP() << "Needs a second CPU device";
+    sycl::queue queue_a(*GetParam());
+    sycl::queue queue_b(others.front());
+    mock_handle& a = pool::get(queue_a);
+    mock_handle& b = pool::get(queue_b);
+    EXPECT_NE(&a, &b);
+    EXPECT_EQ(pool::size(), 2u);
+    // Switching back finds the first handle again rather than creating one
+    EXPECT_EQ(&pool::get(queue_a), &a);
+    EXPECT_EQ(&pool::get(queue_b), &b);
+    EXPECT_EQ(pool::size(), 2u);
+}
+
+TEST_P(HandlePoolTests, CreateIsCalledOnce) {
+    sycl::queue queue(*GetParam());
+    int calls = 0;
+    auto create = [&calls](const sycl::queue& q) {
+        ++calls;
+        return mock_handle(q);
+    };
+    const int id = pool::get(queue, create).id;
+    EXPECT_EQ(pool::get(queue, create).id, id);
+    EXPECT_EQ(calls, 1);
+}
+
+TEST_P(HandlePoolTests, HandlesArePerThread) {
+    sycl::queue queue(*GetParam());
+    mock_handle* main_handle = &pool::get(queue);
+    const int alive_before = mock_handle::alive;
+    mock_handle* thread_handle = nullptr;
+    std::size_t thread_size = 0;
+    std::thread worker([&]() {
+        thread_handle = &pool::get(queue);
+        thread_size = pool::size();
+    });
+    worker.join();
+    EXPECT_NE(main_handle, thread_handle);
+    EXPECT_EQ(thread_size, 1u);
+    // The worker's handle was destroyed with its thread
+    EXPECT_EQ(mock_handle::alive, alive_before);
+    EXPECT_EQ(&pool::get(queue), main_handle);
+}
+
+TEST_P(HandlePoolTests, ClearDestroysHandles) {
+    sycl::queue queue(*GetParam());
+    const int alive_before = mock_handle::alive;
+    pool::get(queue);
+    EXPECT_EQ(mock_handle::alive, alive_before + 1);
+    pool::clear();
+    EXPECT_EQ(pool::size(), 0u);
+    EXPECT_EQ(mock_handle::alive, alive_before);
+    const int created = mock_handle::created;
+    pool::get(queue);
+    EXPECT_EQ(mock_handle::created, created + 1);
+}
+
+INSTANTIATE_TEST_SUITE_P(HandlePoolTestSuite, HandlePoolTests, testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+
+} // anonymous namespace
@@ -0,0 +1,454 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+// Compile-time API only: the tests call the netlib backend whatever the other CPU backends
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <exception>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+#include "oneapi/math.hpp"
+#include "oneapi/math/detail/config.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+extern std::vector<sycl::device*> devices;
+
+namespace {
+
+#ifdef ONEMATH_ENABLE_NETLIB_BACKEND
+
+using netlib_selector = oneapi::math::backend_selector<oneapi::math::backend::netlib>;
+namespace blas = oneapi::math::blas::column_major;
+
+constexpr std::int64_t n = 64;
+
+// Selects the host path of the netlib backend, which reads it from the environment at its
+// first call. ctest runs each test in its own process. When the tests share a process, the
+// path set first stays, and the tests of the other paths are skipped.
+bool select_host_path(const std::string& path) {
+    const char* value = std::getenv("ONEMATH_NETLIB_HOST_PATH");
+    if (value)
+        return path == value;
+#ifdef _WIN64
+    _putenv_s("ONEMATH_NETLIB_HOST_PATH", path.c_str());
+#else
+    setenv("ONEMATH_NETLIB_HOST_PATH", path.c_str(), 1);
+#endif
+    return true;
+}
+
+// A host task that holds back the commands depending on it until it is opened
+class gate {
+public:
+    explicit gate(sycl::queue& queue) : open_(std::make_shared<std::atomic<bool>>(false)) {
+        auto open = open_;
+        event_ = queue.submit([&](sycl::handler& cgh) {
+            cgh.host_task([=]() {
+                while (!open->load())
+                    std::this_thread::yield();
+            });
+        });
+    }
+    ~gate() {
+        open();
+    }
+
+    void open() {
+        open_->store(true);
+    }
+    const sycl::event& event() const {
+        return event_;
+    }
+
+private:
+    std::shared_ptr<std::atomic<bool>> open_;
+    sycl::event event_;
+};
+
+// Shared allocation of n floats, all equal to value
+struct usm_vector {
+    usm_vector(sycl::queue& queue_, float value)
+            : queue(queue_),
+              data(sycl::malloc_shared<float>(n, queue_)) {
+        std::fill(data, data + n, value);
+    }
+    ~usm_vector() {
+        sycl::free(data, queue);
+    }
+
+    sycl::queue queue;
+    float* data;
+};
+
+float input(std::int64_t i) {
+    return static_cast<float>(i % 7 - 3);
+}
+
+// Errors of the calls, whether thrown by them or reported to the queue's handler
+class error_log {
+public:
+    sycl::async_handler handler() {
+        return [this](sycl::exception_list exceptions) {
+            for (auto& e : exceptions)
+                errors_.push_back(e);
+        };
+    }
+    template <typename F>
+    void call(F f) {
+        try {
+            f();
+        }
+        catch (...) {
+            errors_.push_back(std::current_exception());
+        }
+    }
+    // Number of errors that report a dimension the CBLAS integers cannot hold
+    std::size_t dimension_errors() const {
+        std::size_t count = 0;
+        for (auto& e : errors_) {
+            try {
+                std::rethrow_exception(e);
+            }
+            catch (const oneapi::math::invalid_argument&) {
+                ++count;
+            }
+            catch (...) {
+            }
+        }
+        return count;
+    }
+    std::size_t size() const {
+        return errors_.size();
+    }
+
+private:
+    std::vector<std::exception_ptr> errors_;
+};
+
+// Too large for 32-bit CBLAS integers. With 64-bit integers, scal returns at once as the
+// increment is 0.
+constexpr std::int64_t too_large = std::int64_t(1) << 31;
+
+class NetlibHostPathTests : public ::testing::TestWithParam<sycl::device*> {
+protected:
+    void SetUp() override {
+        if (!GetParam()->is_cpu())
+            GTEST_SKIP() << "The netlib backend runs on CPU devices only";
+    }
+};
+
+TEST_P(NetlibHostPathTests, InlineBufferCalls) {
+    if (!select_host_path("inline"))
+        GTEST_SKIP() << "Another netlib host path is selected";
+    sycl::queue queue(*GetParam());
+    std::vector<float> x(n), y(n, 1.0f);
+    for (std::int64_t i = 0; i < n; ++i)
+        x[i] = input(i);
+    float dot = 0.0f;
+    {
+        sycl::buffer<float, 1> x_buffer(x.data(), x.size(),
+                                        { sycl::property::buffer::use_host_ptr() });
+        sycl::buffer<float, 1> y_buffer(y.data(), y.size());
+        sycl::buffer<float, 1> dot_buffer(&dot, 1);
+        // Each call reads what the previous one wrote
+        blas::scal(netlib_selector{ queue }, n, 2.0f, y_buffer, 1);
+        blas::axpy(netlib_selector{ queue }, n, 3.0f, x_buffer, 1, y_buffer, 1);
+        blas::copy(netlib_selector{ queue }, n, y_buffer, 1, x_buffer, 1);
+        blas::dot(netlib_selector{ queue }, n, x_buffer, 1, y_buffer, 1, dot_buffer);
+        queue.wait_and_throw();
+    }
+    float expected_dot = 0.0f;
+    for (std::int64_t i = 0; i < n; ++i) {
+        const float expected = 2.0f + 3.0f * input(i);
+        EXPECT_EQ(y[i], expected) << "at index " << i;
+        EXPECT_EQ(x[i], expected) << "at index " << i;
+        expected_dot += expected * expected;
+    }
+    EXPECT_EQ(dot, expected_dot);
+}
+
+TEST_P(NetlibHostPathTests, InlineBufferGemm) {
+    if (!select_host_path("inline"))
+        GTEST_SKIP() << "Another netlib host path is selected";
+    sycl::queue queue(*GetParam());
+    constexpr std::int64_t m = 8, k = 4;
+    std::vector<float> a(m * k), b(k * n), c(m * n, 1.0f);
+    for (std::int64_t i = 0; i < m * k; ++i)
+        a[i] = input(i);
+    for (std::int64_t i = 0; i < k * n; ++i)
+        b[i] = input(i + 1);
+    {
+        sycl::buffer<float, 1> a_buffer(a.data(), a.size());
+        sycl::buffer<float, 1> b_buffer(b.data(), b.size());
+        sycl::buffer<float, 1> c_buffer(c.data(), c.size());
+        // The product reads the c written by scal
+        blas::scal(netlib_selector{ queue }, m * n, 3.0f, c_buffer, 1);
+        blas::gemm(netlib_selector{ queue }, oneapi::math::transpose::nontrans,
+                   oneapi::math::transpose::nontrans, m, n, k, 1.0f, a_buffer, m, b_buffer, k,
+                   2.0f, c_buffer, m);
+        queue.wait_and_throw();
+    }
+    for (std::int64_t j = 0; j < n; ++j) {
+        for (std::int64_t i = 0; i < m; ++i) {
+            float expected = 6.0f;
+            for (std::int64_t l = 0; l < k; ++l)
+                expected += a[i + l * m] * b[l + j * k];
+            EXPECT_FLOAT_EQ(c[i + j * m], expected) << "at " << i << ", " << j;
+        }
+    }
+}
+
+// A buffer gemm on use_host_ptr buffers writes the product to the memory of c before the call
+// returns, in every host path
+TEST_P(NetlibHostPathTests, HostPtrBufferGemmWorksInPlace) {
+    sycl::queue queue(*GetParam());
+    constexpr std::int64_t m = 8, k = 4;
+    std::vector<float> a(m * k), b(k * n), c(m * n, 1.0f);
+    for (std::int64_t i = 0; i < m * k; ++i)
+        a[i] = input(i);
+    for (std::int64_t i = 0; i < k * n; ++i)
+        b[i] = input(i + 1);
+    const sycl::property_list host_ptr{ sycl::property::buffer::use_host_ptr() };
+    sycl::buffer<float, 1> a_buffer(a.data(), a.size(), host_ptr);
+    sycl::buffer<float, 1> b_buffer(b.data(), b.size(), host_ptr);
+    sycl::buffer<float, 1> c_buffer(c.data(), c.size(), host_ptr);
+    blas::gemm(netlib_selector{ queue }, oneapi::math::transpose::nontrans,
+               oneapi::math::transpose::nontrans, m, n, k, 1.0f, a_buffer, m, b_buffer, k, 2.0f,
+               c_buffer, m);
+    for (std::int64_t j = 0; j < n; ++j) {
+        for (std::int64_t i = 0; i < m; ++i) {
+            float expected = 2.0f;
+            for (std::int64_t l = 0; l < k; ++l)
+                expected += a[i + l * m] * b[l + j * k];
+            EXPECT_FLOAT_EQ(c[i + j * m], expected) << "at " << i << ", " << j;
+        }
+    }
+}
+
+TEST_P(NetlibHostPathTests, InlineUsmCalls) {
+    if (!select_host_path("inline"))
+        GTEST_SKIP() << "Another netlib host path is selected";
+    sycl::queue queue(*GetParam(), sycl::property::queue::in_order());
+    usm_vector x(queue, 0.0f), y(queue, 1.0f);
+    for (std::int64_t i = 0; i < n; ++i)
+        x.data[i] = input(i);
+    blas::scal(netlib_selector{ queue }, n, 2.0f, y.data, 1);
+    blas::axpy(netlib_selector{ queue }, n, 3.0f, x.data, 1, y.data, 1).wait_and_throw();
+    for (std::int64_t i = 0; i < n; ++i)
+        EXPECT_EQ(y.data[i], 2.0f + 3.0f * input(i)) << "at index " << i;
+}
+
+TEST_P(NetlibHostPathTests, InlineErrorsAreReported) {
+    if (!select_host_path("inline"))
+        GTEST_SKIP() << "Another netlib host path is selected";
+    error_log log;
+    sycl::queue queue(*GetParam(), log.handler());
+    usm_vector x(queue, 1.0f);
+    std::vector<float> y(n, 1.0f);
+    {
+        sycl::buffer<float, 1> y_buffer(y.data(), y.size());
+        log.call([&]() { blas::scal(netlib_selector{ queue }, too_large, 2.0f, x.data, 0); });
+        log.call([&]() { blas::scal(netlib_selector{ queue }, too_large, 2.0f, y_buffer, 0); });
+        queue.wait_and_throw();
+    }
+    if (log.size() == 0)
+        GTEST_SKIP() << "The CBLAS library has 64-bit integers";
+    EXPECT_EQ(log.dimension_errors(), 2u);
+}
+
+// The calls are all added to the host task of the first one, which waits for the gate
+TEST_P(NetlibHostPathTests, DeferredCallsKeepOrder) {
+    if (!select_host_path("deferred"))
+        GTEST_SKIP() << "Another netlib host path is selected";
+    sycl::queue queue(*GetParam());
+    usm_vector x(queue, 0.0f), y(queue, 0.0f);
+    for (std::int64_t i = 0; i < n; ++i)
+        x.data[i] = input(i);
+    constexpr int rounds = 20;
+    {
+        gate start(queue);
+        sycl::event done = start.event();
+        for (int round = 0; round < rounds; ++round) {
+            done = blas::scal(netlib_selector{ queue }, n, 2.0f, y.data, 1, { done });
+            done = blas::axpy(netlib_selector{ queue }, n, 1.0f, x.data, 1, y.data, 1, { done });
+        }
+        start.open();
+        done.wait_and_throw();
+    }
+    // y = 2 y + x at each round
+    for (std::int64_t i = 0; i < n; ++i)
+        EXPECT_EQ(y.data[i], ((1 << rounds) - 1) * input(i)) << "at index " << i;
+}
+
+// A call waiting on a command of another queue cannot be added to a host task of its queue
+TEST_P(NetlibHostPathTests, DeferredCallWaitsForOtherQueue) {
+    if (!select_host_path("deferred"))
+        GTEST_SKIP() << "Another netlib host path is selected";
+    sycl::queue queue(*GetParam());
+    sycl::queue other_queue(*GetParam());
+    usm_vector x(queue, 1.0f), y(queue, 0.0f), z(queue, 0.0f);
+    {
+        gate first_gate(queue);
+        gate second_gate(other_queue);
+        auto first = blas::axpy(netlib_selector{ queue }, n, 1.0f, x.data, 1, y.data, 1,
+                                { first_gate.event() });
+        auto second = blas::axpy(netlib_selector{ queue }, n, 1.0f, x.data, 1, z.data, 1,
+                                 { second_gate.event() });
+        first_gate.open();
+        first.wait_and_throw();
+        EXPECT_NE(second.get_info<sycl::info::event::command_execution_status>(),
+                  sycl::info::event_command_status::complete);
+        for (std::int64_t i = 0; i < n; ++i) {
+            EXPECT_EQ(y.data[i], 1.0f) << "at index " << i;
+            EXPECT_EQ(z.data[i], 0.0f) << "at index " << i;
+        }
+        second_gate.open();
+        second.wait_and_throw();
+    }
+    for (std::int64_t i = 0; i < n; ++i)
+        EXPECT_EQ(z.data[i], 1.0f) << "at index " << i;
+}
+
+// A call is not added to a host task waiting for a command the call does not wait for
+TEST_P(NetlibHostPathTests, DeferredCallIsNotHeldBackByOtherDependencies) {
+    if (!select_host_path("deferred"))
+        GTEST_SKIP() << "Another netlib host path is selected";
+    sycl::queue queue(*GetParam());
+    usm_vector x(queue, 1.0f), y(queue, 0.0f), z(queue, 0.0f);
+    {
+        gate start(queue);
+        auto first = blas::axpy(netlib_selector{ queue }, n, 1.0f, x.data, 1, y.data, 1,
+                                { start.event() });
+        auto second = blas::axpy(netlib_selector{ queue }, n, 1.0f, x.data, 1, z.data, 1);
+        second.wait_and_throw();
+        EXPECT_NE(first.get_info<sycl::info::event::command_execution_status>(),
+                  sycl::info::event_command_status::complete);
+        for (std::int64_t i = 0; i < n; ++i)
+            EXPECT_EQ(z.data[i], 1.0f) << "at index " << i;
+        start.open();
+        first.wait_and_throw();
+    }
+    for (std::int64_t i = 0; i < n; ++i)
+        EXPECT_EQ(y.data[i], 1.0f) << "at index " << i;
+}
+
+// An error of a call added to a host task is reported, and the later calls still run
+TEST_P(NetlibHostPathTests, DeferredErrorsAreReported) {
+    if (!select_host_path("deferred"))
+        GTEST_SKIP() << "Another netlib host path is selected";
+    error_log log;
+    sycl::queue queue(*GetParam(), log.handler());
+    usm_vector x(queue, 1.0f), y(queue, 0.0f);
+    {
+        gate start(queue);
+        auto first = blas::axpy(netlib_selector{ queue }, n, 1.0f, x.data, 1, y.data, 1,
+                                { start.event() });
+        log.call([&]() {
+            blas::scal(netlib_selector{ queue }, too_large, 2.0f, x.data, 0, { first });
+        });
+        auto last =
+            blas::axpy(netlib_selector{ queue }, n, 1.0f, x.data, 1, y.data, 1, { first });
+        start.open();
+        last.wait();
+        queue.wait_and_throw();
+    }
+    for (std::int64_t i = 0; i < n; ++i)
+        EXPECT_EQ(y.data[i], 2.0f) << "at index " << i;
+    if (log.size() == 0)
+        GTEST_SKIP() << "The CBLAS library has 64-bit integers";
+    EXPECT_EQ(log.dimension_errors(), 1u);
+}
+
+// Values out of the range of a 32-bit CBLAS are thrown by the call in every host path
+TEST_P(NetlibHostPathTests, RangeErrorsAreThrownByTheCall) {
+    error_log log;
+    sycl::queue queue(*GetParam(), log.handler());
+    usm_vector x(queue, 1.0f);
+    std::vector<float> y(n, 1.0f);
+    std::size_t thrown = 0;
+    {
+        sycl::buffer<float, 1> y_buffer(y.data(), y.size());
+        try {
+            blas::scal(netlib_selector{ queue }, too_large, 2.0f, x.data, 0).wait();
+        }
+        catch (const oneapi::math::invalid_argument&) {
+            ++thrown;
+        }
+        try {
+            blas::scal(netlib_selector{ queue }, too_large, 2.0f, y_buffer, 0);
+        }
+        catch (const oneapi::math::invalid_argument&) {
+            ++thrown;
+        }
+        queue.wait_and_throw();
+    }
+    EXPECT_EQ(log.size(), 0u);
+    if (thrown == 0)
+        GTEST_SKIP() << "The CBLAS library has 64-bit integers";
+    EXPECT_EQ(thrown, 2u);
+}
+
+// A value out of range in any group of a group batch is thrown by the call, before the host
+// task computing the groups is submitted
+TEST_P(NetlibHostPathTests, GroupBatchRangeErrorsAreThrownByTheCall) {
+    error_log log;
+    sycl::queue queue(*GetParam(), log.handler());
+    usm_vector a(queue, 1.0f), c(queue, 0.0f);
+    // Two groups of one 1x1 syrk, the second with a leading dimension of a out of range
+    oneapi::math::uplo upper_lower[] = { oneapi::math::uplo::lower, oneapi::math::uplo::lower };
+    oneapi::math::transpose trans[] = { oneapi::math::transpose::nontrans,
+                                        oneapi::math::transpose::nontrans };
+    std::int64_t ones[] = { 1, 1 }, lda[] = { 1, too_large };
+    float alpha[] = { 1.0f, 1.0f }, beta[] = { 0.0f, 0.0f };
+    const float* a_items[] = { a.data, a.data + 1 };
+    float* c_items[] = { c.data, c.data + 1 };
+    bool thrown = false;
+    try {
+        blas::syrk_batch(netlib_selector{ queue }, upper_lower, trans, ones, ones, alpha, a_items,
+                         lda, beta, c_items, ones, 2, ones, {})
+            .wait();
+    }
+    catch (const oneapi::math::invalid_argument&) {
+        thrown = true;
+    }
+    queue.wait_and_throw();
+    EXPECT_EQ(log.size(), 0u);
+    if (!thrown)
+        GTEST_SKIP() << "The CBLAS library has 64-bit integers";
+    EXPECT_EQ(c.data[0], 0.0f);
+}
+
+INSTANTIATE_TEST_SUITE_P(NetlibHostPathTestSuite, NetlibHostPathTests,
+                         testing::ValuesIn(devices), ::DeviceNamePrint());
+
+#endif
+
+} // anonymous namespace
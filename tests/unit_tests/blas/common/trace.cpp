@@ -0,0 +1,137 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+// Run-time API only: tracing records the calls made through the loaders
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+#include "oneapi/math.hpp"
+#include "oneapi/math/detail/config.hpp"
+#include "test_helper.hpp"
+
+#include <gtest/gtest.h>
+
+extern std::vector<sycl::device*> devices;
+
+namespace {
+
+#ifdef ONEMATH_ENABLE_TRACING
+
+// ONEMATH_TRACE is read by the first traced call. ctest runs each test in its own process,
+// where no call has been made yet.
+void set_trace_path(const std::string& path) {
+#ifdef _WIN64
+    _putenv_s("ONEMATH_TRACE", path.c_str());
+#else
+    setenv("ONEMATH_TRACE", path.c_str(), 1);
+#endif
+}
+
+// Fields of the CSV summary line of the call with the given routine, data type and
+// dimensions: domain, routine, dtype, dims, backend, calls, host_us_total, host_us_mean,
+// device_us_total and device_us_mean
+std::vector<std::string> find_summary(const std::string& path, const std::string& prefix) {
+    std::ifstream file(path);
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.compare(0, prefix.size(), prefix) != 0)
+            continue;
+        std::vector<std::string> fields;
+        std::istringstream stream(line);
+        std::string field;
+        while (std::getline(stream, field, ','))
+            fields.push_back(field);
+        // getline drops a trailing empty field
+        if (!line.empty() && line.back() == ',')
+            fields.push_back("");
+        return fields;
+    }
+    return {};
+}
+
+class TraceTests : public ::testing::TestWithParam<sycl::device*> {};
+
+TEST_P(TraceTests, FlushReadsProfilingTimes) {
+    const std::string path = ::testing::TempDir() + "onemath_trace_test.csv";
+    std::remove(path.c_str());
+    set_trace_path(path);
+
+    sycl::queue profiling_queue(*GetParam(),
+                                sycl::property_list{ sycl::property::queue::enable_profiling() });
+    sycl::queue queue(*GetParam());
+    constexpr std::int64_t profiled_n = 1000, n = 2000;
+    float* x = sycl::malloc_shared<float>(n, queue);
+    float* y = sycl::malloc_shared<float>(n, queue);
+    std::fill(x, x + n, 1.0f);
+    std::fill(y, y + n, 0.0f);
+    // Calls on a queue without profiling are traced without an execution time
+    EXPECT_NO_THROW(
+        oneapi::math::blas::column_major::axpy(queue, n, 2.0f, x, 1, y, 1).wait_and_throw());
+    float* px = sycl::malloc_shared<float>(profiled_n, profiling_queue);
+    float* py = sycl::malloc_shared<float>(profiled_n, profiling_queue);
+    std::fill(px, px + profiled_n, 1.0f);
+    std::fill(py, py + profiled_n, 0.0f);
+    // Not waited for: flush_trace() waits for the traced calls
+    oneapi::math::blas::column_major::axpy(profiling_queue, profiled_n, 2.0f, px, 1, py, 1);
+    EXPECT_NO_THROW(oneapi::math::flush_trace());
+    EXPECT_EQ(py[0], 2.0f);
+
+    std::ifstream file(path);
+    if (!file)
+        GTEST_SKIP() << "Tracing was set up by an earlier test, before ONEMATH_TRACE was set";
+    file.close();
+
+    const auto plain = find_summary(path, "blas,axpy,f32," + std::to_string(n) + "x");
+    ASSERT_EQ(plain.size(), 10u);
+    EXPECT_EQ(plain[5], "1");
+    EXPECT_EQ(plain[8], "");
+
+    const auto profiled = find_summary(path, "blas,axpy,f32," + std::to_string(profiled_n) + "x");
+    ASSERT_EQ(profiled.size(), 10u);
+    EXPECT_EQ(profiled[5], "1");
+    // CPU backends may run the call in a host task, which has no profiling information
+    if (!GetParam()->is_cpu()) {
+        ASSERT_FALSE(profiled[8].empty());
+        EXPECT_GE(std::stod(profiled[8]), 0.0);
+    }
+
+    sycl::free(x, queue);
+    sycl::free(y, queue);
+    sycl::free(px, profiling_queue);
+    sycl::free(py, profiling_queue);
+    std::remove(path.c_str());
+}
+
+INSTANTIATE_TEST_SUITE_P(TraceTestSuite, TraceTests, testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+
+#endif
+
+} // anonymous namespace
@@ -0,0 +1,128 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+// Run-time API only: the errors are recorded by the onemath library, which the compile-time
+// tests do not link
+
+#include <complex>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include "oneapi/math.hpp"
+#include "oneapi/math/detail/config.hpp"
+#include "test_helper.hpp"
+#include "test_common.hpp"
+#include <gtest/gtest.h>
+
+extern std::vector<sycl::device*> devices;
+
+namespace {
+
+#ifdef ONEMATH_ENABLE_MKLCPU_BACKEND
+
+class AsyncErrorsTests : public ::testing::TestWithParam<sycl::device*> {
+protected:
+    void SetUp() override {
+        if (!GetParam()->is_cpu())
+            GTEST_SKIP() << "Async error tests run on CPU devices only";
+        auto infos = oneapi::math::preload({ oneapi::math::domain::dft },
+                                           { oneapi::math::device::x86cpu });
+        if (infos.empty() || infos[0].library.find("_mklcpu.") == std::string::npos)
+            GTEST_SKIP() << "Async error tests need the mklcpu DFT backend";
+    }
+};
+
+using descriptor_t = oneapi::math::dft::descriptor<oneapi::math::dft::precision::SINGLE,
+                                                   oneapi::math::dft::domain::COMPLEX>;
+
+// A batch of transforms that all start at the same element is accepted by the descriptor,
+// but the mklcpu backend rejects it when it commits the descriptor in a host task
+descriptor_t make_overlapping_batch() {
+    descriptor_t desc(std::int64_t(8));
+    desc.set_value(oneapi::math::dft::config_param::NUMBER_OF_TRANSFORMS, std::int64_t(2));
+    desc.set_value(oneapi::math::dft::config_param::FWD_DISTANCE, std::int64_t(0));
+    desc.set_value(oneapi::math::dft::config_param::BWD_DISTANCE, std::int64_t(0));
+    return desc;
+}
+
+TEST_P(AsyncErrorsTests, NoErrorsByDefault) {
+    sycl::queue queue(*GetParam());
+    descriptor_t desc(std::int64_t(8));
+    commit_descriptor(desc, queue);
+    std::vector<std::complex<float>> data(8, 1.0f);
+    {
+        sycl::buffer<std::complex<float>, 1> buffer(data.data(), data.size());
+        oneapi::math::dft::compute_forward<descriptor_t, std::complex<float>>(desc, buffer);
+    }
+    queue.wait_and_throw();
+    EXPECT_FALSE(oneapi::math::has_async_errors(queue));
+    EXPECT_TRUE(oneapi::math::take_async_errors(queue).empty());
+    // The transform of a constant signal is an impulse
+    EXPECT_NEAR(data[0].real(), 8.0f, 1e-4f);
+}
+
+TEST_P(AsyncErrorsTests, HostTaskErrorsArePolled) {
+    std::size_t reported = 0;
+    sycl::queue queue(*GetParam(), [&reported](sycl::exception_list exceptions) {
+        reported += exceptions.size();
+    });
+    sycl::queue other_queue(*GetParam());
+    auto desc = make_overlapping_batch();
+    // The commit waits for its host task, which fails without throwing on this thread
+    EXPECT_NO_THROW(commit_descriptor(desc, queue));
+
+    ASSERT_TRUE(oneapi::math::has_async_errors(queue));
+    EXPECT_FALSE(oneapi::math::has_async_errors(other_queue));
+    auto errors = oneapi::math::take_async_errors(queue);
+    ASSERT_EQ(errors.size(), 1u);
+    EXPECT_NE(errors[0].message.find("DftiCommitDescriptor"), std::string::npos)
+        << errors[0].message;
+    EXPECT_THROW(std::rethrow_exception(errors[0].exception), oneapi::math::exception);
+    EXPECT_FALSE(oneapi::math::has_async_errors(queue));
+    EXPECT_TRUE(oneapi::math::take_async_errors(queue).empty());
+
+    // The descriptor was not committed by the backend, so the transform fails as well
+    std::vector<std::complex<float>> data(8, 1.0f);
+    {
+        sycl::buffer<std::complex<float>, 1> buffer(data.data(), data.size());
+        oneapi::math::dft::compute_forward<descriptor_t, std::complex<float>>(desc, buffer);
+    }
+    // Polled after the buffer has been written back, without waiting on the queue
+    EXPECT_TRUE(oneapi::math::has_async_errors(queue));
+    errors = oneapi::math::take_async_errors(queue);
+    ASSERT_EQ(errors.size(), 1u);
+    EXPECT_NE(errors[0].message.find("DftiComputeForward"), std::string::npos)
+        << errors[0].message;
+
+    // The errors are still reported through the queue
+    queue.wait_and_throw();
+    EXPECT_EQ(reported, 2u);
+}
+
+INSTANTIATE_TEST_SUITE_P(AsyncErrorsTestSuite, AsyncErrorsTests, testing::ValuesIn(devices),
+                         ::DeviceNamePrint());
+
+#endif
+
+} // anonymous namespace
@@ -0,0 +1,125 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing,
+* software distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions
+* and limitations under the License.
+*
+*
+* SPDX-License-Identifier: Apache-2.0
+*******************************************************************************/
+
+// Run-time API only: checks the members of the bound handle against the free functions
+
+#include <complex>
+#include <vector>
+
+#if __has_include(<sycl/sycl.hpp>)
+#include <sycl/sycl.hpp>
+#else
+#include <CL/sycl.hpp>
+#endif
+
+#include "oneapi/math.hpp"
+#include "lapack_common.hpp"
+#include "lapack_test_controller.hpp"
+#include "lapack_accuracy_checks.hpp"
+#include "lapack_reference_wrappers.hpp"
+#include "test_helper.hpp"
+
+namespace {
+
+const char* accuracy_input = R"(
+0 30 4 42 31 27182
+1 23 3 25 23 27182
+)";
+
+// Factors A with potrf and solves with potrs, either through a bound handle or through the
+// free functions. Returns the solution in B.
+template <typename data_T, typename fp>
+void factor_and_solve(sycl::queue& queue, bool use_bound_handle, oneapi::math::uplo uplo,
+                      int64_t n, int64_t nrhs, std::vector<fp> A, int64_t lda, std::vector<fp>& B,
+                      int64_t ldb) {
+    auto handle = oneapi::math::lapack::bind(queue);
+
+    auto A_dev = device_alloc<data_T>(queue, A.size());
+    auto B_dev = device_alloc<data_T>(queue, B.size());
+    const auto potrf_scratchpad_size =
+        use_bound_handle ? handle.potrf_scratchpad_size<fp>(uplo, n, lda)
+                         : oneapi::math::lapack::potrf_scratchpad_size<fp>(queue, uplo, n, lda);
+    const auto potrs_scratchpad_size =
+        use_bound_handle
+            ? handle.potrs_scratchpad_size<fp>(uplo, n, nrhs, lda, ldb)
+            : oneapi::math::lapack::potrs_scratchpad_size<fp>(queue, uplo, n, nrhs, lda, ldb);
+    auto potrf_scratchpad_dev = device_alloc<data_T>(queue, potrf_scratchpad_size);
+    auto potrs_scratchpad_dev = device_alloc<data_T>(queue, potrs_scratchpad_size);
+
+    host_to_device_copy(queue, A.data(), A_dev, A.size());
+    host_to_device_copy(queue, B.data(), B_dev, B.size());
+    queue.wait_and_throw();
+
+    if (use_bound_handle) {
+        handle.potrf(uplo, n, A_dev, lda, potrf_scratchpad_dev, potrf_scratchpad_size);
+        queue.wait_and_throw();
+        handle.potrs(uplo, n, nrhs, A_dev, lda, B_dev, ldb, potrs_scratchpad_dev,
+                     potrs_scratchpad_size);
+    }
+    else {
+        oneapi::math::lapack::potrf(queue, uplo, n, A_dev, lda, potrf_scratchpad_dev,
+                                    potrf_scratchpad_size);
+        queue.wait_and_throw();
+        oneapi::math::lapack::potrs(queue, uplo, n, nrhs, A_dev, lda, B_dev, ldb,
+                                    potrs_scratchpad_dev, potrs_scratchpad_size);
+    }
+    queue.wait_and_throw();
+
+    device_to_host_copy(queue, B_dev, B.data(), B.size());
+    queue.wait_and_throw();
+
+    device_free(queue, A_dev);
+    device_free(queue, B_dev);
+    device_free(queue, potrf_scratchpad_dev);
+    device_free(queue, potrs_scratchpad_dev);
+}
+
+template <typename data_T>
+bool accuracy(const sycl::device& dev, oneapi::math::uplo uplo, int64_t n, int64_t nrhs,
+              int64_t lda, int64_t ldb, uint64_t seed) {
+    using fp = typename data_T_info<data_T>::value_type;
+
+    /* Initialize */
+    std::vector<fp> A_initial(lda * n);
+    std::vector<fp> B_initial(ldb * nrhs);
+    rand_pos_def_matrix(seed, uplo, n, A_initial, lda);
+    rand_matrix(seed, oneapi::math::transpose::nontrans, n, nrhs, B_initial, ldb);
+
+    std::vector<fp> B_bound = B_initial;
+    std::vector<fp> B_free = B_initial;
+
+    /* Compute on device */
+    {
+        sycl::queue queue{ dev, async_error_handler };
+        factor_and_solve<data_T>(queue, true, uplo, n, nrhs, A_initial, lda, B_bound, ldb);
+        factor_and_solve<data_T>(queue, false, uplo, n, nrhs, A_initial, lda, B_free, ldb);
+    }
+
+    if (!check_potrs_accuracy(uplo, n, nrhs, B_bound, ldb, A_initial, lda, B_initial))
+        return false;
+    // The handle dispatches to the same backend as the free functions
+    return rel_mat_err_check(n, nrhs, B_bound, ldb, B_free, ldb);
+}
+
+InputTestController<decltype(::accuracy<void>)> accuracy_controller{ accuracy_input };
+
+} /* anonymous namespace */
+
+#include "lapack_gtest_suite.hpp"
+INSTANTIATE_GTEST_SUITE_ACCURACY(BoundHandle);